@@ -0,0 +1,691 @@
+// NOTE: Only decompression (DEFLATE/zlib/gzip, RFC 1950/1951/1952) is supported - the assets are never written by the client
+typedef enum : uint8 {
+	INFLATE_SUCCESS,
+	INFLATE_ERROR_TRUNCATED_INPUT,
+	INFLATE_ERROR_OUTPUT_OVERFLOW,
+	INFLATE_ERROR_INVALID_HEADER,
+	INFLATE_ERROR_INVALID_BLOCK_TYPE,
+	INFLATE_ERROR_INVALID_STORED_LENGTH,
+	INFLATE_ERROR_INVALID_HUFFMAN_CODE,
+	INFLATE_ERROR_INVALID_DISTANCE,
+	INFLATE_ERROR_CHECKSUM_MISMATCH,
+} inflate_status_t;
+
+INTERNAL String InflateStatusToString(inflate_status_t status) {
+	switch(status) {
+		case INFLATE_SUCCESS:
+			return StringLiteral("OK");
+		case INFLATE_ERROR_TRUNCATED_INPUT:
+			return StringLiteral("Unexpected end of the compressed stream");
+		case INFLATE_ERROR_OUTPUT_OVERFLOW:
+			return StringLiteral("Decompressed data exceeds the output buffer");
+		case INFLATE_ERROR_INVALID_HEADER:
+			return StringLiteral("Invalid zlib or gzip header");
+		case INFLATE_ERROR_INVALID_BLOCK_TYPE:
+			return StringLiteral("Invalid DEFLATE block type");
+		case INFLATE_ERROR_INVALID_STORED_LENGTH:
+			return StringLiteral("Stored block length doesn't match its complement");
+		case INFLATE_ERROR_INVALID_HUFFMAN_CODE:
+			return StringLiteral("Invalid Huffman code");
+		case INFLATE_ERROR_INVALID_DISTANCE:
+			return StringLiteral("Back-reference points before the start of the output");
+		case INFLATE_ERROR_CHECKSUM_MISMATCH:
+			return StringLiteral("Checksum mismatch (the decompressed data is corrupted)");
+		default:
+			return StringLiteral("N/A");
+	}
+}
+
+constexpr int INFLATE_FAST_LOOKUP_BITS = 10;
+constexpr int INFLATE_MAX_CODE_LENGTH = 15;
+constexpr int INFLATE_SYMBOL_BITS = 9;
+constexpr int INFLATE_LITERAL_LENGTH_SYMBOL_COUNT = 288;
+constexpr int INFLATE_DISTANCE_SYMBOL_COUNT = 32;
+constexpr int INFLATE_CODE_LENGTH_SYMBOL_COUNT = 19;
+constexpr int INFLATE_END_OF_BLOCK = 256;
+constexpr size_t INFLATE_MAX_MATCH_LENGTH = 258;
+constexpr size_t INFLATE_HISTORY_SIZE = 32 * 1024; // Largest distance that back-references can reach
+
+GLOBAL const uint16 INFLATE_LENGTH_BASE[] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115,
+	131, 163, 195, 227, 258 };
+GLOBAL const uint8 INFLATE_LENGTH_EXTRA_BITS[] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+GLOBAL const uint16 INFLATE_DISTANCE_BASE[] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537,
+	2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+GLOBAL const uint8 INFLATE_DISTANCE_EXTRA_BITS[] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12,
+	12, 13, 13 };
+GLOBAL const uint8 INFLATE_CODE_LENGTH_ORDER[INFLATE_CODE_LENGTH_SYMBOL_COUNT] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2,
+	14, 1, 15 };
+
+// NOTE: Short codes resolve with a single lookup, longer ones fall back to a canonical search (they're rare in practice)
+typedef struct inflate_huffman_table {
+	uint16 fastLookup[1 << INFLATE_FAST_LOOKUP_BITS]; // (codeLength << INFLATE_SYMBOL_BITS) | symbol, or zero for long codes
+	uint32 maxCode[INFLATE_MAX_CODE_LENGTH + 2]; // Exclusive, left-aligned to 16 bits
+	uint16 firstCode[INFLATE_MAX_CODE_LENGTH + 1];
+	uint16 firstSymbol[INFLATE_MAX_CODE_LENGTH + 1];
+	uint8 codeLengths[INFLATE_LITERAL_LENGTH_SYMBOL_COUNT]; // Indexed by canonical order
+	uint16 symbols[INFLATE_LITERAL_LENGTH_SYMBOL_COUNT]; // Indexed by canonical order
+} inflate_huffman_table_t;
+
+typedef struct inflate_bit_reader {
+	const uint8* cursor;
+	const uint8* end;
+	uint64 bitBuffer;
+	int bitCount;
+	size_t paddingByteCount; // Zeroes fed past the end of the input (only an error if they're actually consumed)
+} inflate_bit_reader_t;
+
+INTERNAL inline void InflateRefillBits(inflate_bit_reader_t& reader) {
+	if(reader.end - reader.cursor >= (ptrdiff_t)sizeof(uint64)) {
+		uint64 chunk;
+		memcpy(&chunk, reader.cursor, sizeof(chunk));
+		reader.bitBuffer |= chunk << reader.bitCount;
+		reader.cursor += (63 - reader.bitCount) >> 3;
+		reader.bitCount |= 56;
+		return;
+	}
+
+	while(reader.bitCount <= 56) {
+		if(reader.cursor < reader.end) reader.bitBuffer |= (uint64)*reader.cursor++ << reader.bitCount;
+		else reader.paddingByteCount++;
+		reader.bitCount += BITS_PER_BYTE;
+	}
+}
+
+INTERNAL inline bool InflateHasOverrunInput(inflate_bit_reader_t& reader) {
+	return reader.paddingByteCount * BITS_PER_BYTE > (size_t)reader.bitCount;
+}
+
+// NOTE: Callers must ensure enough bits are buffered (a refill guarantees at least 56 of them)
+INTERNAL inline uint32 InflateConsumeBits(inflate_bit_reader_t& reader, int bitCount) {
+	uint32 bits = (uint32)(reader.bitBuffer & ((1ULL << bitCount) - 1));
+	reader.bitBuffer >>= bitCount;
+	reader.bitCount -= bitCount;
+	return bits;
+}
+
+INTERNAL inline uint32 InflateReadBits(inflate_bit_reader_t& reader, int bitCount) {
+	if(reader.bitCount < bitCount) InflateRefillBits(reader);
+	return InflateConsumeBits(reader, bitCount);
+}
+
+INTERNAL inline uint32 InflateReverseBits(uint32 code, int bitCount) {
+	uint32 reversed = 0;
+	for(int bit = 0; bit < bitCount; ++bit) {
+		reversed = (reversed << 1) | (code & 1);
+		code >>= 1;
+	}
+	return reversed;
+}
+
+INTERNAL bool InflateBuildHuffmanTable(inflate_huffman_table_t& table, const uint8* codeLengths, int symbolCount) {
+	int lengthCounts[INFLATE_MAX_CODE_LENGTH + 1] = {};
+	for(int symbol = 0; symbol < symbolCount; ++symbol)
+		lengthCounts[codeLengths[symbol]]++;
+	lengthCounts[0] = 0;
+
+	memset(table.fastLookup, 0, sizeof(table.fastLookup));
+
+	// Canonical codes: Each length starts right after the (doubled) last code of the previous one
+	uint32 nextCode[INFLATE_MAX_CODE_LENGTH + 1];
+	uint32 code = 0;
+	int symbolIndex = 0;
+	for(int length = 1; length <= INFLATE_MAX_CODE_LENGTH; ++length) {
+		nextCode[length] = code;
+		table.firstCode[length] = (uint16)code;
+		table.firstSymbol[length] = (uint16)symbolIndex;
+		code += lengthCounts[length];
+		// NOTE: Incomplete codes are legal (e.g., a single distance code), but oversubscribed ones are not
+		if(lengthCounts[length] && code - 1 >= (1u << length)) return false;
+		table.maxCode[length] = code << (16 - length);
+		code <<= 1;
+		symbolIndex += lengthCounts[length];
+	}
+	table.maxCode[INFLATE_MAX_CODE_LENGTH + 1] = 0x10000; // Sentinel
+
+	for(int symbol = 0; symbol < symbolCount; ++symbol) {
+		int length = codeLengths[symbol];
+		if(length == 0) continue;
+
+		int canonicalIndex = nextCode[length] - table.firstCode[length] + table.firstSymbol[length];
+		table.codeLengths[canonicalIndex] = (uint8)length;
+		table.symbols[canonicalIndex] = (uint16)symbol;
+
+		// DEFLATE packs Huffman codes starting from the MSB, so they appear reversed in the LSB-first bit stream
+		if(length <= INFLATE_FAST_LOOKUP_BITS) {
+			uint16 fastEntry = (uint16)((length << INFLATE_SYMBOL_BITS) | symbol);
+			for(uint32 index = InflateReverseBits(nextCode[length], length); index < (1u << INFLATE_FAST_LOOKUP_BITS); index += (1u << length))
+				table.fastLookup[index] = fastEntry;
+		}
+		nextCode[length]++;
+	}
+
+	return true;
+}
+
+// Returns -1 if the bits don't correspond to any valid code
+INTERNAL inline int InflateDecodeSymbol(inflate_bit_reader_t& reader, inflate_huffman_table_t& table) {
+	if(reader.bitCount < 16) InflateRefillBits(reader);
+
+	uint16 fastEntry = table.fastLookup[reader.bitBuffer & ((1 << INFLATE_FAST_LOOKUP_BITS) - 1)];
+	if(fastEntry) {
+		InflateConsumeBits(reader, fastEntry >> INFLATE_SYMBOL_BITS);
+		return fastEntry & ((1 << INFLATE_SYMBOL_BITS) - 1);
+	}
+
+	uint32 code = InflateReverseBits((uint32)(reader.bitBuffer & 0xFFFF), 16);
+	int length = INFLATE_FAST_LOOKUP_BITS + 1;
+	while(code >= table.maxCode[length])
+		length++;
+	if(length > INFLATE_MAX_CODE_LENGTH) return -1;
+
+	int canonicalIndex = (code >> (16 - length)) - table.firstCode[length] + table.firstSymbol[length];
+	if(canonicalIndex >= INFLATE_LITERAL_LENGTH_SYMBOL_COUNT || table.codeLengths[canonicalIndex] != length) return -1;
+
+	InflateConsumeBits(reader, length);
+	return table.symbols[canonicalIndex];
+}
+
+INTERNAL void InflateBuildFixedHuffmanTables(inflate_huffman_table_t& literalLengthTable, inflate_huffman_table_t& distanceTable) {
+	uint8 codeLengths[INFLATE_LITERAL_LENGTH_SYMBOL_COUNT];
+	memset(codeLengths + 0, 8, 144);
+	memset(codeLengths + 144, 9, 256 - 144);
+	memset(codeLengths + 256, 7, 280 - 256);
+	memset(codeLengths + 280, 8, INFLATE_LITERAL_LENGTH_SYMBOL_COUNT - 280);
+	InflateBuildHuffmanTable(literalLengthTable, codeLengths, INFLATE_LITERAL_LENGTH_SYMBOL_COUNT);
+
+	memset(codeLengths, 5, INFLATE_DISTANCE_SYMBOL_COUNT);
+	InflateBuildHuffmanTable(distanceTable, codeLengths, INFLATE_DISTANCE_SYMBOL_COUNT);
+}
+
+INTERNAL inflate_status_t InflateDecodeDynamicHuffmanTables(inflate_bit_reader_t& reader, inflate_huffman_table_t& literalLengthTable,
+	inflate_huffman_table_t& distanceTable) {
+	InflateRefillBits(reader);
+	int literalLengthCodeCount = InflateConsumeBits(reader, 5) + 257;
+	int distanceCodeCount = InflateConsumeBits(reader, 5) + 1;
+	int codeLengthCodeCount = InflateConsumeBits(reader, 4) + 4;
+
+	uint8 codeLengthCodeLengths[INFLATE_CODE_LENGTH_SYMBOL_COUNT] = {};
+	for(int index = 0; index < codeLengthCodeCount; ++index)
+		codeLengthCodeLengths[INFLATE_CODE_LENGTH_ORDER[index]] = (uint8)InflateReadBits(reader, 3);
+
+	inflate_huffman_table_t codeLengthTable;
+	if(!InflateBuildHuffmanTable(codeLengthTable, codeLengthCodeLengths, INFLATE_CODE_LENGTH_SYMBOL_COUNT))
+		return INFLATE_ERROR_INVALID_HUFFMAN_CODE;
+
+	// NOTE: Both alphabets are encoded as a single sequence (repetitions may cross from one into the other)
+	uint8 codeLengths[INFLATE_LITERAL_LENGTH_SYMBOL_COUNT + INFLATE_DISTANCE_SYMBOL_COUNT];
+	int totalCodeCount = literalLengthCodeCount + distanceCodeCount;
+	int index = 0;
+	while(index < totalCodeCount) {
+		int symbol = InflateDecodeSymbol(reader, codeLengthTable);
+		if(symbol < 0) return INFLATE_ERROR_INVALID_HUFFMAN_CODE;
+
+		if(symbol < 16) {
+			codeLengths[index++] = (uint8)symbol;
+			continue;
+		}
+
+		uint8 repeatedLength = 0;
+		int repetitionCount = 0;
+		if(symbol == 16) {
+			if(index == 0) return INFLATE_ERROR_INVALID_HUFFMAN_CODE;
+			repeatedLength = codeLengths[index - 1];
+			repetitionCount = 3 + InflateReadBits(reader, 2);
+		} else if(symbol == 17) {
+			repetitionCount = 3 + InflateReadBits(reader, 3);
+		} else {
+			repetitionCount = 11 + InflateReadBits(reader, 7);
+		}
+
+		if(index + repetitionCount > totalCodeCount) return INFLATE_ERROR_INVALID_HUFFMAN_CODE;
+		memset(codeLengths + index, repeatedLength, repetitionCount);
+		index += repetitionCount;
+	}
+
+	if(codeLengths[INFLATE_END_OF_BLOCK] == 0) return INFLATE_ERROR_INVALID_HUFFMAN_CODE;
+	if(!InflateBuildHuffmanTable(literalLengthTable, codeLengths, literalLengthCodeCount)) return INFLATE_ERROR_INVALID_HUFFMAN_CODE;
+	if(!InflateBuildHuffmanTable(distanceTable, codeLengths + literalLengthCodeCount, distanceCodeCount))
+		return INFLATE_ERROR_INVALID_HUFFMAN_CODE;
+
+	return INFLATE_SUCCESS;
+}
+
+INTERNAL inline void InflateCopyMatch(uint8* destination, size_t distance, size_t length, uint8* outputEnd) {
+	const uint8* source = destination - distance;
+
+	// NOTE: Overlapping 8-byte copies are still correct as long as every chunk is read before it's being written to
+	if(distance >= sizeof(uint64) && (size_t)(outputEnd - destination) >= length + sizeof(uint64)) {
+		uint8* copyEnd = destination + length;
+		while(destination < copyEnd) {
+			uint64 chunk;
+			memcpy(&chunk, source, sizeof(chunk));
+			memcpy(destination, &chunk, sizeof(chunk));
+			source += sizeof(chunk);
+			destination += sizeof(chunk);
+		}
+		return;
+	}
+
+	for(size_t index = 0; index < length; ++index)
+		destination[index] = source[index];
+}
+
+// NOTE: Streams can pause between symbols (once less than suspendMargin bytes are left) and resume later with the same tables
+INTERNAL inflate_status_t InflateDecodeHuffmanSymbols(inflate_bit_reader_t& reader, inflate_huffman_table_t& literalLengthTable,
+	inflate_huffman_table_t& distanceTable, uint8* output, size_t outputCapacity, size_t& bytesWritten, size_t suspendMargin,
+	bool& isEndOfBlock) {
+	uint8* outputEnd = output + outputCapacity;
+	uint8* destination = output + bytesWritten;
+
+	isEndOfBlock = false;
+	while(true) {
+		if((size_t)(outputEnd - destination) < suspendMargin) break;
+
+		int symbol = InflateDecodeSymbol(reader, literalLengthTable);
+		if(symbol < 0) return INFLATE_ERROR_INVALID_HUFFMAN_CODE;
+
+		if(symbol < INFLATE_END_OF_BLOCK) {
+			if(destination == outputEnd) return INFLATE_ERROR_OUTPUT_OVERFLOW;
+			*destination++ = (uint8)symbol;
+			continue;
+		}
+
+		if(symbol == INFLATE_END_OF_BLOCK) {
+			isEndOfBlock = true;
+			break;
+		}
+
+		symbol -= INFLATE_END_OF_BLOCK + 1;
+		if(symbol >= (int)sizeof(INFLATE_LENGTH_EXTRA_BITS)) return INFLATE_ERROR_INVALID_HUFFMAN_CODE;
+		size_t length = INFLATE_LENGTH_BASE[symbol] + InflateReadBits(reader, INFLATE_LENGTH_EXTRA_BITS[symbol]);
+
+		symbol = InflateDecodeSymbol(reader, distanceTable);
+		if(symbol < 0 || symbol >= (int)sizeof(INFLATE_DISTANCE_EXTRA_BITS)) return INFLATE_ERROR_INVALID_HUFFMAN_CODE;
+		size_t distance = INFLATE_DISTANCE_BASE[symbol] + InflateReadBits(reader, INFLATE_DISTANCE_EXTRA_BITS[symbol]);
+
+		if(distance > (size_t)(destination - output)) return INFLATE_ERROR_INVALID_DISTANCE;
+		if(length > (size_t)(outputEnd - destination)) return INFLATE_ERROR_OUTPUT_OVERFLOW;
+		InflateCopyMatch(destination, distance, length, outputEnd);
+		destination += length;
+
+		// NOTE: Garbage input may decode "successfully" forever, but the output is bounded (and checked) so this will terminate
+	}
+
+	bytesWritten = destination - output;
+	return INFLATE_SUCCESS;
+}
+
+INTERNAL inflate_status_t InflateDecodeHuffmanBlock(inflate_bit_reader_t& reader, inflate_huffman_table_t& literalLengthTable,
+	inflate_huffman_table_t& distanceTable, uint8* output, size_t outputCapacity, size_t& bytesWritten) {
+	bool isEndOfBlock = false;
+	return InflateDecodeHuffmanSymbols(reader, literalLengthTable, distanceTable, output, outputCapacity, bytesWritten, 0, isEndOfBlock);
+}
+
+INTERNAL inflate_status_t InflateCopyStoredBlock(inflate_bit_reader_t& reader, uint8* output, size_t outputCapacity, size_t& bytesWritten) {
+	// Stored blocks start at the next byte boundary (the remaining buffered bytes must be drained before reading directly)
+	InflateConsumeBits(reader, reader.bitCount % BITS_PER_BYTE);
+	uint32 length = InflateReadBits(reader, 16);
+	uint32 complement = InflateReadBits(reader, 16);
+	if(length != (~complement & 0xFFFF)) return INFLATE_ERROR_INVALID_STORED_LENGTH;
+	if(length > outputCapacity - bytesWritten) return INFLATE_ERROR_OUTPUT_OVERFLOW;
+
+	uint8* destination = output + bytesWritten;
+	while(length > 0 && reader.bitCount > 0) {
+		*destination++ = (uint8)InflateConsumeBits(reader, BITS_PER_BYTE);
+		length--;
+	}
+	if(InflateHasOverrunInput(reader)) return INFLATE_ERROR_TRUNCATED_INPUT;
+
+	// NOTE: Refills may have buffered bytes past the counted bits - they'd no longer line up after skipping ahead
+	if(reader.bitCount == 0) reader.bitBuffer = 0;
+	if((size_t)(reader.end - reader.cursor) < length) return INFLATE_ERROR_TRUNCATED_INPUT;
+	memcpy(destination, reader.cursor, length);
+	reader.cursor += length;
+	destination += length;
+
+	bytesWritten = destination - output;
+	return INFLATE_SUCCESS;
+}
+
+INTERNAL inflate_status_t InflateDecodeBlocks(inflate_bit_reader_t& reader, uint8* output, size_t outputCapacity, size_t& bytesWritten) {
+	inflate_huffman_table_t literalLengthTable;
+	inflate_huffman_table_t distanceTable;
+
+	bool isFinalBlock = false;
+	while(!isFinalBlock) {
+		InflateRefillBits(reader);
+		isFinalBlock = InflateConsumeBits(reader, 1);
+		uint32 blockType = InflateConsumeBits(reader, 2);
+
+		inflate_status_t status = INFLATE_SUCCESS;
+		switch(blockType) {
+			case 0:
+				status = InflateCopyStoredBlock(reader, output, outputCapacity, bytesWritten);
+				break;
+			case 1:
+				InflateBuildFixedHuffmanTables(literalLengthTable, distanceTable);
+				status = InflateDecodeHuffmanBlock(reader, literalLengthTable, distanceTable, output, outputCapacity, bytesWritten);
+				break;
+			case 2:
+				status = InflateDecodeDynamicHuffmanTables(reader, literalLengthTable, distanceTable);
+				if(status != INFLATE_SUCCESS) break;
+				status = InflateDecodeHuffmanBlock(reader, literalLengthTable, distanceTable, output, outputCapacity, bytesWritten);
+				break;
+			default:
+				status = INFLATE_ERROR_INVALID_BLOCK_TYPE;
+				break;
+		}
+
+		if(InflateHasOverrunInput(reader)) return INFLATE_ERROR_TRUNCATED_INPUT;
+		if(status != INFLATE_SUCCESS) return status;
+	}
+
+	return INFLATE_SUCCESS;
+}
+
+INTERNAL inflate_status_t InflateRawStream(const uint8* input, size_t inputSize, uint8* output, size_t outputCapacity, size_t& bytesWritten) {
+	inflate_bit_reader_t reader = {
+		.cursor = input,
+		.end = input + inputSize,
+		.bitBuffer = 0,
+		.bitCount = 0,
+		.paddingByteCount = 0,
+	};
+	bytesWritten = 0;
+	return InflateDecodeBlocks(reader, output, outputCapacity, bytesWritten);
+}
+
+INTERNAL uint32 ComputeAdler32Checksum(const uint8* bytes, size_t size) {
+	constexpr uint32 ADLER_MODULUS = 65521;
+	constexpr size_t MAX_DEFERRED_BYTES = 5552; // Largest run that can't overflow the 32-bit sums (before reducing them)
+
+	uint32 first = 1;
+	uint32 second = 0;
+	while(size > 0) {
+		size_t runLength = Min(size, MAX_DEFERRED_BYTES);
+		size -= runLength;
+		for(size_t index = 0; index < runLength; ++index) {
+			first += bytes[index];
+			second += first;
+		}
+		bytes += runLength;
+		first %= ADLER_MODULUS;
+		second %= ADLER_MODULUS;
+	}
+	return (second << 16) | first;
+}
+
+INTERNAL inflate_status_t InflateZlibStream(const uint8* input, size_t inputSize, uint8* output, size_t outputCapacity, size_t& bytesWritten) {
+	constexpr size_t ZLIB_HEADER_SIZE = 2;
+	constexpr size_t ZLIB_CHECKSUM_SIZE = 4;
+	constexpr uint8 ZLIB_METHOD_DEFLATE = 8;
+	constexpr uint8 ZLIB_PRESET_DICTIONARY_FLAG = 0x20;
+
+	bytesWritten = 0;
+	if(inputSize < ZLIB_HEADER_SIZE + ZLIB_CHECKSUM_SIZE) return INFLATE_ERROR_TRUNCATED_INPUT;
+
+	uint8 compressionMethod = input[0];
+	uint8 flags = input[1];
+	if((compressionMethod & 0x0F) != ZLIB_METHOD_DEFLATE) return INFLATE_ERROR_INVALID_HEADER;
+	if(((compressionMethod << 8) | flags) % 31 != 0) return INFLATE_ERROR_INVALID_HEADER;
+	if(flags & ZLIB_PRESET_DICTIONARY_FLAG) return INFLATE_ERROR_INVALID_HEADER;
+
+	inflate_bit_reader_t reader = {
+		.cursor = input + ZLIB_HEADER_SIZE,
+		.end = input + inputSize,
+		.bitBuffer = 0,
+		.bitCount = 0,
+		.paddingByteCount = 0,
+	};
+	inflate_status_t status = InflateDecodeBlocks(reader, output, outputCapacity, bytesWritten);
+	if(status != INFLATE_SUCCESS) return status;
+
+	// NOTE: The refill may have read ahead, so the checksum's position must be derived from the consumed bits instead
+	size_t consumedByteCount = (reader.cursor - input) + reader.paddingByteCount - reader.bitCount / BITS_PER_BYTE;
+	if(inputSize - consumedByteCount < ZLIB_CHECKSUM_SIZE) return INFLATE_ERROR_TRUNCATED_INPUT;
+	const uint8* checksumBytes = input + consumedByteCount;
+	uint32 expectedChecksum = (checksumBytes[0] << 24) | (checksumBytes[1] << 16) | (checksumBytes[2] << 8) | checksumBytes[3];
+	if(ComputeAdler32Checksum(output, bytesWritten) != expectedChecksum) return INFLATE_ERROR_CHECKSUM_MISMATCH;
+
+	return INFLATE_SUCCESS;
+}
+
+// NOTE: Slicing-by-8 tables - gzip streams are checked as they're decoded, so this shouldn't be much slower than the inflate itself
+typedef struct crc32_lookup_tables {
+	uint32 entries[8][256];
+} crc32_lookup_tables_t;
+
+constexpr crc32_lookup_tables_t CRC32BuildLookupTables() {
+	constexpr uint32 CRC32_REVERSED_POLYNOMIAL = 0xEDB88320;
+
+	crc32_lookup_tables_t tables = {};
+	for(uint32 index = 0; index < 256; ++index) {
+		uint32 checksum = index;
+		for(int bit = 0; bit < BITS_PER_BYTE; ++bit)
+			checksum = (checksum >> 1) ^ (CRC32_REVERSED_POLYNOMIAL & (0 - (checksum & 1)));
+		tables.entries[0][index] = checksum;
+	}
+	for(int slice = 1; slice < 8; ++slice) {
+		for(uint32 index = 0; index < 256; ++index) {
+			uint32 previous = tables.entries[slice - 1][index];
+			tables.entries[slice][index] = (previous >> 8) ^ tables.entries[0][previous & 0xFF];
+		}
+	}
+	return tables;
+}
+
+GLOBAL constexpr crc32_lookup_tables_t CRC32_LOOKUP_TABLES = CRC32BuildLookupTables();
+
+// Pass the previous result to continue a running checksum (or zero to start a new one)
+INTERNAL uint32 ComputeCRC32Checksum(const uint8* bytes, size_t size, uint32 previousChecksum) {
+	const uint32(&tables)[8][256] = CRC32_LOOKUP_TABLES.entries;
+
+	uint32 checksum = ~previousChecksum;
+	for(; size >= 2 * sizeof(uint32); size -= 2 * sizeof(uint32), bytes += 2 * sizeof(uint32)) {
+		uint32 low;
+		uint32 high;
+		memcpy(&low, bytes, sizeof(low));
+		memcpy(&high, bytes + sizeof(low), sizeof(high));
+		low ^= checksum;
+		checksum = tables[7][low & 0xFF] ^ tables[6][(low >> 8) & 0xFF] ^ tables[5][(low >> 16) & 0xFF] ^ tables[4][low >> 24]
+			^ tables[3][high & 0xFF] ^ tables[2][(high >> 8) & 0xFF] ^ tables[1][(high >> 16) & 0xFF] ^ tables[0][high >> 24];
+	}
+	for(; size > 0; --size)
+		checksum = (checksum >> 8) ^ tables[0][(checksum ^ *bytes++) & 0xFF];
+	return ~checksum;
+}
+
+typedef enum : uint8 {
+	INFLATE_STREAM_BLOCK_HEADER,
+	INFLATE_STREAM_STORED_BLOCK,
+	INFLATE_STREAM_HUFFMAN_BLOCK,
+	INFLATE_STREAM_FINISHED,
+} inflate_stream_state_t;
+
+// NOTE: Only the output is bounded (the input is expected to be mapped) - it's produced in chunks that fill up a fixed-size window
+// The window retains the last INFLATE_HISTORY_SIZE bytes between chunks, since back-references may still point into them
+typedef struct inflate_stream {
+	inflate_bit_reader_t reader;
+	inflate_huffman_table_t literalLengthTable;
+	inflate_huffman_table_t distanceTable;
+	const uint8* input;
+	size_t inputSize;
+	uint8* window;
+	size_t windowSize;
+	size_t windowUsed;
+	uint32 storedBytesRemaining;
+	inflate_stream_state_t state;
+	bool isFinalBlock;
+	uint32 checksum; // CRC-32 of everything that was emitted so far
+	uint64 totalBytesWritten;
+} inflate_stream_t;
+
+constexpr size_t GZIP_HEADER_SIZE = 10;
+constexpr size_t GZIP_TRAILER_SIZE = 8;
+
+INTERNAL inflate_status_t InflateBeginGzipStream(inflate_stream_t& stream, const uint8* input, size_t inputSize, uint8* window, size_t windowSize) {
+	constexpr uint8 GZIP_METHOD_DEFLATE = 8;
+	constexpr uint8 GZIP_HEADER_CHECKSUM_FLAG = 0x02;
+	constexpr uint8 GZIP_EXTRA_FIELD_FLAG = 0x04;
+	constexpr uint8 GZIP_FILE_NAME_FLAG = 0x08;
+	constexpr uint8 GZIP_COMMENT_FLAG = 0x10;
+	constexpr uint8 GZIP_RESERVED_FLAGS = 0xE0;
+
+	ASSUME(windowSize >= 2 * INFLATE_HISTORY_SIZE, "Inflate window must be able to hold at least one chunk beyond the history");
+	if(inputSize < GZIP_HEADER_SIZE + GZIP_TRAILER_SIZE) return INFLATE_ERROR_TRUNCATED_INPUT;
+	if(input[0] != 0x1F || input[1] != 0x8B || input[2] != GZIP_METHOD_DEFLATE) return INFLATE_ERROR_INVALID_HEADER;
+
+	uint8 flags = input[3];
+	if(flags & GZIP_RESERVED_FLAGS) return INFLATE_ERROR_INVALID_HEADER;
+
+	size_t offset = GZIP_HEADER_SIZE;
+	if(flags & GZIP_EXTRA_FIELD_FLAG) {
+		if(inputSize - offset < sizeof(uint16)) return INFLATE_ERROR_TRUNCATED_INPUT;
+		size_t extraFieldSize = input[offset] | (input[offset + 1] << 8);
+		offset += sizeof(uint16) + extraFieldSize;
+	}
+	uint8 nullTerminatedFields[] = { GZIP_FILE_NAME_FLAG, GZIP_COMMENT_FLAG };
+	for(uint8 fieldFlag : nullTerminatedFields) {
+		if(!(flags & fieldFlag)) continue;
+		while(offset < inputSize && input[offset] != ASCII_NULL_TERMINATOR)
+			offset++;
+		offset++;
+	}
+	if(flags & GZIP_HEADER_CHECKSUM_FLAG) offset += sizeof(uint16);
+	if(offset > inputSize || inputSize - offset < GZIP_TRAILER_SIZE) return INFLATE_ERROR_TRUNCATED_INPUT;
+
+	stream.reader = {
+		.cursor = input + offset,
+		.end = input + inputSize,
+		.bitBuffer = 0,
+		.bitCount = 0,
+		.paddingByteCount = 0,
+	};
+	stream.input = input;
+	stream.inputSize = inputSize;
+	stream.window = window;
+	stream.windowSize = windowSize;
+	stream.windowUsed = 0;
+	stream.storedBytesRemaining = 0;
+	stream.state = INFLATE_STREAM_BLOCK_HEADER;
+	stream.isFinalBlock = false;
+	stream.checksum = 0;
+	stream.totalBytesWritten = 0;
+	return INFLATE_SUCCESS;
+}
+
+INTERNAL inflate_status_t InflateBeginNextBlock(inflate_stream_t& stream) {
+	inflate_bit_reader_t& reader = stream.reader;
+	InflateRefillBits(reader);
+	stream.isFinalBlock = InflateConsumeBits(reader, 1);
+	uint32 blockType = InflateConsumeBits(reader, 2);
+
+	switch(blockType) {
+		case 0: {
+			InflateConsumeBits(reader, reader.bitCount % BITS_PER_BYTE);
+			uint32 length = InflateReadBits(reader, 16);
+			uint32 complement = InflateReadBits(reader, 16);
+			if(length != (~complement & 0xFFFF)) return INFLATE_ERROR_INVALID_STORED_LENGTH;
+			stream.storedBytesRemaining = length;
+			stream.state = INFLATE_STREAM_STORED_BLOCK;
+			return INFLATE_SUCCESS;
+		}
+		case 1:
+			InflateBuildFixedHuffmanTables(stream.literalLengthTable, stream.distanceTable);
+			stream.state = INFLATE_STREAM_HUFFMAN_BLOCK;
+			return INFLATE_SUCCESS;
+		case 2:
+			stream.state = INFLATE_STREAM_HUFFMAN_BLOCK;
+			return InflateDecodeDynamicHuffmanTables(reader, stream.literalLengthTable, stream.distanceTable);
+		default:
+			return INFLATE_ERROR_INVALID_BLOCK_TYPE;
+	}
+}
+
+INTERNAL void InflateContinueStoredBlock(inflate_stream_t& stream, size_t outputCapacity) {
+	inflate_bit_reader_t& reader = stream.reader;
+	uint8* destination = stream.window + stream.windowUsed;
+	size_t length = Min((size_t)stream.storedBytesRemaining, outputCapacity);
+	stream.storedBytesRemaining -= (uint32)length;
+
+	while(length > 0 && reader.bitCount > 0) {
+		*destination++ = (uint8)InflateConsumeBits(reader, BITS_PER_BYTE);
+		length--;
+	}
+	if(reader.bitCount == 0) reader.bitBuffer = 0;
+
+	// NOTE: Truncated blocks are padded with zeroes, so that the overrun is detected (and reported) like for all other blocks
+	size_t availableLength = Min(length, (size_t)(reader.end - reader.cursor));
+	memcpy(destination, reader.cursor, availableLength);
+	memset(destination + availableLength, 0, length - availableLength);
+	reader.cursor += availableLength;
+	reader.paddingByteCount += length - availableLength;
+	destination += length;
+
+	stream.windowUsed = destination - stream.window;
+	if(stream.storedBytesRemaining == 0) stream.state = INFLATE_STREAM_BLOCK_HEADER;
+}
+
+INTERNAL inflate_status_t InflateVerifyGzipTrailer(inflate_stream_t& stream) {
+	inflate_bit_reader_t& reader = stream.reader;
+	size_t consumedByteCount = (reader.cursor - stream.input) + reader.paddingByteCount - reader.bitCount / BITS_PER_BYTE;
+	if(stream.inputSize - consumedByteCount < GZIP_TRAILER_SIZE) return INFLATE_ERROR_TRUNCATED_INPUT;
+
+	const uint8* trailerBytes = stream.input + consumedByteCount;
+	uint32 expectedChecksum = trailerBytes[0] | (trailerBytes[1] << 8) | (trailerBytes[2] << 16) | ((uint32)trailerBytes[3] << 24);
+	uint32 expectedSize = trailerBytes[4] | (trailerBytes[5] << 8) | (trailerBytes[6] << 16) | ((uint32)trailerBytes[7] << 24);
+	if(stream.checksum != expectedChecksum) return INFLATE_ERROR_CHECKSUM_MISMATCH;
+	if((uint32)stream.totalBytesWritten != expectedSize) return INFLATE_ERROR_CHECKSUM_MISMATCH; // Modulo 2^32
+	return INFLATE_SUCCESS;
+}
+
+// Returns the next chunk of decompressed data (it's only valid until the next call) - an empty chunk marks the end of the stream
+INTERNAL inflate_status_t InflateReadNextChunk(inflate_stream_t& stream, const uint8*& chunk, size_t& chunkSize) {
+	chunk = stream.window;
+	chunkSize = 0;
+	if(stream.state == INFLATE_STREAM_FINISHED) return INFLATE_SUCCESS;
+
+	if(stream.windowUsed > INFLATE_HISTORY_SIZE) {
+		memmove(stream.window, stream.window + stream.windowUsed - INFLATE_HISTORY_SIZE, INFLATE_HISTORY_SIZE);
+		stream.windowUsed = INFLATE_HISTORY_SIZE;
+	}
+
+	size_t chunkStart = stream.windowUsed;
+	inflate_status_t status = INFLATE_SUCCESS;
+	while(status == INFLATE_SUCCESS && stream.state != INFLATE_STREAM_FINISHED) {
+		size_t outputCapacity = stream.windowSize - stream.windowUsed;
+		if(outputCapacity < INFLATE_MAX_MATCH_LENGTH) break;
+
+		switch(stream.state) {
+			case INFLATE_STREAM_BLOCK_HEADER: {
+				if(stream.isFinalBlock) {
+					stream.state = INFLATE_STREAM_FINISHED;
+					break;
+				}
+				status = InflateBeginNextBlock(stream);
+			} break;
+			case INFLATE_STREAM_STORED_BLOCK: {
+				InflateContinueStoredBlock(stream, outputCapacity);
+			} break;
+			case INFLATE_STREAM_HUFFMAN_BLOCK: {
+				bool isEndOfBlock = false;
+				status = InflateDecodeHuffmanSymbols(stream.reader, stream.literalLengthTable, stream.distanceTable, stream.window,
+					stream.windowSize, stream.windowUsed, INFLATE_MAX_MATCH_LENGTH, isEndOfBlock);
+				if(isEndOfBlock) stream.state = INFLATE_STREAM_BLOCK_HEADER;
+			} break;
+			default:
+				break;
+		}
+
+		if(InflateHasOverrunInput(stream.reader)) status = INFLATE_ERROR_TRUNCATED_INPUT;
+	}
+	if(status != INFLATE_SUCCESS) return status;
+
+	chunk = stream.window + chunkStart;
+	chunkSize = stream.windowUsed - chunkStart;
+	stream.checksum = ComputeCRC32Checksum(chunk, chunkSize, stream.checksum);
+	stream.totalBytesWritten += chunkSize;
+
+	if(stream.state == INFLATE_STREAM_FINISHED) return InflateVerifyGzipTrailer(stream);
+	return INFLATE_SUCCESS;
+}
\ No newline at end of file
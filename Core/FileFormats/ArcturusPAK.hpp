@@ -0,0 +1,197 @@
+// NOTE: Read-only decoder for Arcturus' asset packs (the archive is expected to be mapped into memory as a whole)
+constexpr size_t PAK_TRAILER_SIZE = 9; // Points to the file table, which is stored right before it
+constexpr uint8 PAK_FILE_ENTRY_TYPE = 0;
+constexpr uint8 PAK_DIRECTORY_ENTRY_TYPE = 1;
+constexpr uint32 PAK_VERSION_COUNT = 2;
+
+#pragma pack(push, 1)
+typedef struct pak_file_entry {
+	uint8 nameLength; // Excluding the null terminator (which follows the name)
+	uint8 type;
+	int32 offset;
+	int32 compressedSize;
+	int32 decompressedSize;
+} pak_file_entry_t;
+#pragma pack(pop)
+
+static_assert(sizeof(pak_file_entry_t) == 14, "PAK file entries must be tightly packed");
+
+typedef struct pak_entry {
+	uint32 nameOffset; // Relative to the start of the name pool
+	uint32 nameLength;
+	uint32 offset;
+	uint32 compressedSize;
+	uint32 decompressedSize;
+	uint8 type;
+	uint8 reserved[3];
+} pak_entry_t;
+
+typedef struct pak_archive {
+	const uint8* bytes;
+	size_t size;
+	String errorMessage;
+	uint32 version;
+	uint32 entryCount;
+	uint32 fileTableOffset;
+	uint32 fileTableSize;
+	pak_entry_t* entries; // In the order they're stored in the file table
+	char* names; // UTF-8 (null-terminated, so that entry names can be passed on as C strings)
+	size_t nameCharacterCount;
+} pak_archive_t;
+
+INTERNAL inline bool PAKSetError(pak_archive_t& archive, String message) {
+	archive.errorMessage = message;
+	return false;
+}
+
+// Returns the size of the file table, or zero if the entries don't fit between the given offset and the trailer
+INTERNAL size_t PAKMeasureFileTable(const uint8* bytes, size_t size, size_t fileTableOffset, uint32 entryCount) {
+	size_t fileTableEnd = size - PAK_TRAILER_SIZE;
+	size_t offset = fileTableOffset;
+	for(uint32 index = 0; index < entryCount; ++index) {
+		if(offset > fileTableEnd || fileTableEnd - offset < sizeof(pak_file_entry_t)) return 0;
+		size_t recordSize = sizeof(pak_file_entry_t) + bytes[offset] + sizeof(ASCII_NULL_TERMINATOR);
+		if(fileTableEnd - offset < recordSize) return 0;
+		offset += recordSize;
+	}
+	return offset - fileTableOffset;
+}
+
+// Validates the trailer only - the file table is decoded separately (after the caller has set aside enough memory for it)
+INTERNAL bool PAKOpenArchive(pak_archive_t& archive, const uint8* bytes, size_t size) {
+	archive = {};
+	archive.bytes = bytes;
+	archive.size = size;
+	archive.errorMessage = StringLiteral("OK");
+
+	if(size < PAK_TRAILER_SIZE) return PAKSetError(archive, StringLiteral("File is too small to be a PAK archive"));
+
+	// NOTE: There's no signature or version field, so each known trailer layout is tried until one yields a consistent file table
+	const uint8* trailer = bytes + size - PAK_TRAILER_SIZE;
+	uint32 fileTableOffset = trailer[0] | (trailer[1] << 8) | (trailer[2] << 16) | ((uint32)trailer[3] << 24);
+	uint16 entryCounts[PAK_VERSION_COUNT] = {
+		(uint16)(trailer[4] | (trailer[5] << 8)),
+		(uint16)(trailer[6] | (trailer[7] << 8)),
+	};
+
+	bool hasValidLayout = false;
+	for(uint32 version = 0; version < PAK_VERSION_COUNT; ++version) {
+		size_t fileTableSize = PAKMeasureFileTable(bytes, size, fileTableOffset, entryCounts[version]);
+		if(fileTableSize == 0 && entryCounts[version] > 0) continue;
+
+		// Prefer layouts where the file table ends exactly at the trailer (the other ones only matched by chance)
+		bool isExactMatch = (fileTableOffset + fileTableSize == size - PAK_TRAILER_SIZE);
+		if(hasValidLayout && !isExactMatch) continue;
+
+		archive.version = version;
+		archive.entryCount = entryCounts[version];
+		archive.fileTableOffset = fileTableOffset;
+		archive.fileTableSize = (uint32)fileTableSize;
+		hasValidLayout = true;
+		if(isExactMatch) break;
+	}
+
+	if(!hasValidLayout) return PAKSetError(archive, StringLiteral("File table doesn't match any known PAK layout"));
+	return true;
+}
+
+INTERNAL inline size_t PAKGetRequiredMemorySize(pak_archive_t& archive) {
+	size_t maxNameCharacterCount = TranscodeGetMaxUTF8Length(archive.fileTableSize) + archive.entryCount * sizeof(ASCII_NULL_TERMINATOR);
+	return archive.entryCount * sizeof(pak_entry_t) + maxNameCharacterCount;
+}
+
+// NOTE: All names are transcoded into a single pool, so the entries themselves remain fixed-size (and trivially copyable)
+INTERNAL bool PAKDecodeFileTable(pak_archive_t& archive, memory_arena_t& persistentStorage) {
+	ASSUME(ArenaCanAllocate(persistentStorage, PAKGetRequiredMemorySize(archive)), "Insufficient memory to store the PAK file table");
+
+	archive.entries = (pak_entry_t*)ArenaAllocateMemoryRegion(persistentStorage, archive.entryCount * sizeof(pak_entry_t));
+	archive.names = (char*)persistentStorage.baseAddress + persistentStorage.used;
+	archive.nameCharacterCount = 0;
+
+	const uint8* record = archive.bytes + archive.fileTableOffset;
+	for(uint32 index = 0; index < archive.entryCount; ++index) {
+		pak_file_entry_t fileEntry;
+		memcpy(&fileEntry, record, sizeof(fileEntry));
+		const uint8* storedName = record + sizeof(fileEntry);
+		record += sizeof(fileEntry) + fileEntry.nameLength + sizeof(ASCII_NULL_TERMINATOR);
+
+		const uint8* nullTerminator = (const uint8*)memchr(storedName, ASCII_NULL_TERMINATOR, fileEntry.nameLength);
+		size_t storedNameLength = nullTerminator ? nullTerminator - storedName : fileEntry.nameLength;
+		String fileName = TranscodeCP949ToUTF8(persistentStorage, StringCreateFromSlice((uint8*)storedName, storedNameLength));
+
+		archive.entries[index] = {
+			.nameOffset = (uint32)((char*)fileName.buffer - archive.names),
+			.nameLength = (uint32)fileName.length,
+			.offset = (uint32)fileEntry.offset,
+			.compressedSize = (uint32)fileEntry.compressedSize,
+			.decompressedSize = (uint32)fileEntry.decompressedSize,
+			.type = fileEntry.type,
+		};
+		archive.nameCharacterCount += fileName.length + sizeof(ASCII_NULL_TERMINATOR);
+	}
+
+	return true;
+}
+
+INTERNAL inline String PAKGetEntryName(pak_archive_t& archive, pak_entry_t& entry) {
+	return StringCreateFromSlice((uint8*)archive.names + entry.nameOffset, entry.nameLength);
+}
+
+INTERNAL inline bool PAKIsFileEntry(pak_entry_t& entry) {
+	return entry.type == PAK_FILE_ENTRY_TYPE;
+}
+
+// NOTE: The compression method isn't stored anywhere, so it's inferred from the sizes and the stream header (if there is one)
+INTERNAL bool PAKExtractEntry(pak_archive_t& archive, pak_entry_t& entry, uint8* output, size_t outputCapacity, size_t& bytesWritten, String& errorMessage) {
+	ASSUME(outputCapacity >= entry.decompressedSize, "Insufficient space to store the extracted PAK entry");
+	bytesWritten = 0;
+
+	if(entry.offset > archive.size || entry.compressedSize > archive.size - entry.offset) {
+		errorMessage = StringLiteral("Entry extends past the end of the archive");
+		return false;
+	}
+
+	const uint8* storedContents = archive.bytes + entry.offset;
+	if(entry.compressedSize == entry.decompressedSize) {
+		memcpy(output, storedContents, entry.decompressedSize);
+		bytesWritten = entry.decompressedSize;
+		return true;
+	}
+
+	constexpr uint8 ZLIB_METHOD_DEFLATE = 8;
+	bool hasZlibHeader = entry.compressedSize >= 2 && (storedContents[0] & 0x0F) == ZLIB_METHOD_DEFLATE
+		&& ((storedContents[0] << 8) | storedContents[1]) % 31 == 0;
+	inflate_status_t status = hasZlibHeader
+		? InflateZlibStream(storedContents, entry.compressedSize, output, entry.decompressedSize, bytesWritten)
+		: InflateRawStream(storedContents, entry.compressedSize, output, entry.decompressedSize, bytesWritten);
+	if(status != INFLATE_SUCCESS) {
+		errorMessage = InflateStatusToString(status);
+		return false;
+	}
+
+	if(bytesWritten != entry.decompressedSize) {
+		errorMessage = StringLiteral("Decompressed size doesn't match the file table");
+		return false;
+	}
+
+	return true;
+}
+
+// Returns the number of file entries whose (UTF-8) path starts with the given prefix
+INTERNAL uint32 PAKCollectEntriesByPrefix(pak_archive_t& archive, String prefix, uint32* entryIndices) {
+	uint32 entryCount = 0;
+	for(uint32 index = 0; index < archive.entryCount; ++index) {
+		pak_entry_t& entry = archive.entries[index];
+		if(!PAKIsFileEntry(entry)) continue;
+		if(entry.nameLength < prefix.length || memcmp(archive.names + entry.nameOffset, prefix.buffer, prefix.length) != 0) continue;
+		entryIndices[entryCount++] = index;
+	}
+	return entryCount;
+}
+
+INTERNAL size_t PAKGetLargestExtractedSize(pak_archive_t& archive, const uint32* entryIndices, uint32 entryCount) {
+	size_t largestSize = 0;
+	for(uint32 index = 0; index < entryCount; ++index)
+		largestSize = Max(largestSize, (size_t)archive.entries[entryIndices[index]].decompressedSize);
+	return largestSize;
+}
\ No newline at end of file
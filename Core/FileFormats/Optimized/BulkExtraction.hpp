@@ -0,0 +1,194 @@
+// NOTE: Batch counterpart of RagnarokGRF:ExtractFileInMemory - entries are claimed in queue order and inflated on all available cores
+constexpr uint32 BULK_EXTRACTION_BATCH_SIZE = 64; // Neighboring entries are claimed together, so that each worker reads mostly sequentially
+constexpr uint32 BULK_EXTRACTION_MAX_WORKERS = 64;
+
+typedef struct bulk_extraction_worker bulk_extraction_worker_t;
+
+typedef struct bulk_extraction_entry {
+	uint32 index; // Into the archive's file table
+	String name;
+	const uint8* contents; // NULL if the extraction failed
+	size_t size;
+	String errorMessage;
+} bulk_extraction_entry_t;
+
+// Extracts the given entry into the (already reset) scratch arena - the name must be set even if that fails
+typedef bool (*bulk_extraction_entry_fn)(void* archive, bulk_extraction_entry_t& entry, memory_arena_t& scratchMemory);
+
+// Receives the extracted contents (or NULL and the reason for the failure) - returns false if they couldn't be stored
+typedef bool (*bulk_extraction_sink_fn)(bulk_extraction_worker_t& worker, bulk_extraction_entry_t& entry);
+
+typedef struct bulk_extraction_job {
+	void* archive;
+	bulk_extraction_entry_fn extractEntry;
+	const uint32* entryIndices; // Ideally sorted by offset
+	uint32 entryCount;
+	uint32 batchCount;
+	volatile long claimedBatchCount;
+	bulk_extraction_sink_fn sink;
+	void* sinkContext;
+} bulk_extraction_job_t;
+
+typedef struct bulk_extraction_worker {
+	platform_thread_t thread;
+	bulk_extraction_job_t* job;
+	uint32 workerIndex;
+	memory_arena_t scratchMemory; // Must be able to hold the largest entry (reset after each one)
+	uint32 extractedCount;
+	uint32 failedCount;
+	uint64 extractedSize;
+} bulk_extraction_worker_t;
+
+INTERNAL void BulkExtractionRunWorker(void* argument) {
+	bulk_extraction_worker_t& worker = *(bulk_extraction_worker_t*)argument;
+	bulk_extraction_job_t& job = *worker.job;
+
+	while(true) {
+		uint32 batchIndex = (uint32)(IntrinsicsAtomicIncrement(&job.claimedBatchCount) - 1);
+		if(batchIndex >= job.batchCount) break;
+
+		uint32 firstIndex = batchIndex * BULK_EXTRACTION_BATCH_SIZE;
+		uint32 lastIndex = Min(firstIndex + BULK_EXTRACTION_BATCH_SIZE, job.entryCount);
+		for(uint32 index = firstIndex; index < lastIndex; ++index) {
+			ArenaResetAllocations(worker.scratchMemory);
+			bulk_extraction_entry_t entry = {
+				.index = job.entryIndices[index],
+				.name = {},
+				.contents = NULL,
+				.size = 0,
+				.errorMessage = StringLiteral("OK"),
+			};
+			bool wasExtracted = job.extractEntry(job.archive, entry, worker.scratchMemory);
+			if(!wasExtracted) entry.contents = NULL;
+
+			bool wasStored = job.sink(worker, entry);
+			if(!wasExtracted || !wasStored) {
+				worker.failedCount++;
+				continue;
+			}
+
+			worker.extractedCount++;
+			worker.extractedSize += entry.size;
+		}
+	}
+}
+
+// NOTE: The calling thread works on the job as well - if some threads can't be created, the others simply claim more batches
+INTERNAL void BulkExtractionRunJob(bulk_extraction_job_t& job, bulk_extraction_worker_t* workers, uint32 workerCount) {
+	ASSUME(workerCount > 0 && workerCount <= BULK_EXTRACTION_MAX_WORKERS, "Invalid number of extraction workers");
+	job.batchCount = (job.entryCount + BULK_EXTRACTION_BATCH_SIZE - 1) / BULK_EXTRACTION_BATCH_SIZE;
+	job.claimedBatchCount = 0;
+
+	bool wasThreadCreated[BULK_EXTRACTION_MAX_WORKERS] = {};
+	for(uint32 workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+		bulk_extraction_worker_t& worker = workers[workerIndex];
+		worker.job = &job;
+		worker.workerIndex = workerIndex;
+		worker.extractedCount = 0;
+		worker.failedCount = 0;
+		worker.extractedSize = 0;
+		if(workerIndex > 0) wasThreadCreated[workerIndex] = PlatformCreateThread(worker.thread, BulkExtractionRunWorker, &worker);
+	}
+
+	BulkExtractionRunWorker(&workers[0]);
+	for(uint32 workerIndex = 1; workerIndex < workerCount; ++workerIndex) {
+		if(wasThreadCreated[workerIndex]) PlatformJoinThread(workers[workerIndex].thread);
+	}
+}
+
+// Returns the number of matching entries - directories are skipped, and duplicate paths only yield the entry that lookups resolve to
+INTERNAL uint32 GRFCollectEntriesByPrefix(grf_archive_t& archive, String prefix, uint32* entryIndices) {
+	char normalizedPrefix[GRF_MAX_PATH_LENGTH];
+	String normalizedPrefixString = StringCreateFromSlice((uint8*)normalizedPrefix, Min(prefix.length, sizeof(normalizedPrefix)));
+	memcpy(normalizedPrefix, prefix.buffer, normalizedPrefixString.length);
+	GRFNormalizeFileName(normalizedPrefixString);
+	if(normalizedPrefixString.length > 0 && normalizedPrefixString.buffer[0] == ASCII_FORWARD_SLASH) {
+		normalizedPrefixString.buffer++;
+		normalizedPrefixString.length--;
+	}
+
+	uint32 entryCount = 0;
+	for(uint32 index = 0; index < archive.fileCount; ++index) {
+		grf_entry_t& entry = archive.entries[index];
+		if(!GRFIsFileEntry(entry)) continue;
+		if(archive.entryIndicesByName[entry.name] != index) continue;
+
+		String fileName = GRFGetEntryName(archive, entry);
+		if(fileName.length < normalizedPrefixString.length) continue;
+		if(memcmp(fileName.buffer, normalizedPrefixString.buffer, normalizedPrefixString.length) != 0) continue;
+
+		entryIndices[entryCount++] = index;
+	}
+	return entryCount;
+}
+
+// NOTE: Reading in archive order turns thousands of random reads into a (mostly) sequential scan of the file mapping
+INTERNAL void GRFSortEntriesByOffset(grf_archive_t& archive, uint32* entryIndices, uint32 entryCount, memory_arena_t& scratchMemory) {
+	constexpr uint32 RADIX_BITS = 8;
+	constexpr uint32 BUCKET_COUNT = 1 << RADIX_BITS;
+	constexpr uint32 PASS_COUNT = sizeof(uint32) * BITS_PER_BYTE / RADIX_BITS;
+
+	uint32 bucketSizes[PASS_COUNT][BUCKET_COUNT] = {};
+	for(uint32 index = 0; index < entryCount; ++index) {
+		uint32 offset = archive.entries[entryIndices[index]].offset;
+		for(uint32 pass = 0; pass < PASS_COUNT; ++pass)
+			bucketSizes[pass][(offset >> (pass * RADIX_BITS)) & (BUCKET_COUNT - 1)]++;
+	}
+
+	// LSD radix sort (stable, so that entries sharing an offset remain in file table order)
+	uint32* sourceIndices = entryIndices;
+	uint32* sortedIndices = (uint32*)ArenaAllocateAlignedMemoryRegion(scratchMemory, entryCount * sizeof(uint32), alignof(uint32));
+	for(uint32 pass = 0; pass < PASS_COUNT; ++pass) {
+		uint32 bucketStarts[BUCKET_COUNT];
+		uint32 bucketStart = 0;
+		bool hasSingleBucket = false;
+		for(uint32 bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+			bucketStarts[bucket] = bucketStart;
+			bucketStart += bucketSizes[pass][bucket];
+			if(bucketSizes[pass][bucket] == entryCount) hasSingleBucket = true;
+		}
+		// Smaller archives never use the upper bytes, so there's nothing to reorder
+		if(hasSingleBucket) continue;
+
+		for(uint32 index = 0; index < entryCount; ++index) {
+			uint32 offset = archive.entries[sourceIndices[index]].offset;
+			uint32 bucket = (offset >> (pass * RADIX_BITS)) & (BUCKET_COUNT - 1);
+			sortedIndices[bucketStarts[bucket]++] = sourceIndices[index];
+		}
+
+		uint32* previousIndices = sourceIndices;
+		sourceIndices = sortedIndices;
+		sortedIndices = previousIndices;
+	}
+
+	if(sourceIndices != entryIndices) memcpy(entryIndices, sourceIndices, entryCount * sizeof(uint32));
+}
+
+INTERNAL size_t GRFGetLargestExtractedSize(grf_archive_t& archive, const uint32* entryIndices, uint32 entryCount) {
+	size_t largestSize = 0;
+	for(uint32 index = 0; index < entryCount; ++index)
+		largestSize = Max(largestSize, GRFGetExtractedSize(archive.entries[entryIndices[index]]));
+	return largestSize;
+}
+
+// Entry accessors for BulkExtractionRunJob (the archive must outlive the job, and it isn't modified by any of the workers)
+INTERNAL bool GRFExtractBulkEntry(void* archive, bulk_extraction_entry_t& entry, memory_arena_t& scratchMemory) {
+	grf_archive_t& grfArchive = *(grf_archive_t*)archive;
+	grf_entry_t& grfEntry = grfArchive.entries[entry.index];
+	entry.name = GRFGetEntryName(grfArchive, grfEntry);
+
+	size_t outputCapacity = GRFGetExtractedSize(grfEntry);
+	uint8* output = (uint8*)ArenaAllocateMemoryRegion(scratchMemory, outputCapacity);
+	entry.contents = output;
+	return GRFExtractEntry(grfArchive, grfEntry, output, outputCapacity, entry.size, entry.errorMessage);
+}
+
+INTERNAL bool PAKExtractBulkEntry(void* archive, bulk_extraction_entry_t& entry, memory_arena_t& scratchMemory) {
+	pak_archive_t& pakArchive = *(pak_archive_t*)archive;
+	pak_entry_t& pakEntry = pakArchive.entries[entry.index];
+	entry.name = PAKGetEntryName(pakArchive, pakEntry);
+
+	uint8* output = (uint8*)ArenaAllocateMemoryRegion(scratchMemory, pakEntry.decompressedSize);
+	entry.contents = output;
+	return PAKExtractEntry(pakArchive, pakEntry, output, pakEntry.decompressedSize, entry.size, entry.errorMessage);
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+// NOTE: Cached version of a decoded ACT file - it's designed to be used in-place, straight from a file mapping (same as CGRF indices)
+// Arrays are stored exactly as the decoder lays them out in memory, so restoring them only requires a few bounds checks
+constexpr char CACT_SIGNATURE[] = "CACT";
+constexpr uint32 CACT_VERSION = 2; // The source file is identified by its contents since version 2
+constexpr size_t CACT_SECTION_ALIGNMENT = 8;
+
+typedef struct cact_section {
+	uint32 offset; // Relative to the start of the file
+	uint32 size;
+} cact_section_t;
+
+typedef struct cact_header {
+	char signature[4];
+	uint32 version;
+	uint8 sourceMajorVersion;
+	uint8 sourceMinorVersion;
+	uint16 reserved;
+	uint32 clipCount;
+	uint32 frameCount;
+	uint32 layerCount;
+	uint32 anchorCount;
+	uint32 eventCount;
+	uint64 sourceHash; // Computed over the entire ACT file (any change to it invalidates the cache)
+	cact_section_t sections[ACT_SECTION_COUNT]; // Same order as the decoder's section layout
+} cact_header_t;
+
+static_assert(sizeof(cact_header_t) == 40 + ACT_SECTION_COUNT * sizeof(cact_section_t), "CACT headers must not contain any implicit padding");
+
+INTERNAL inline size_t CACTAlignSectionSize(size_t size) {
+	return (size + CACT_SECTION_ALIGNMENT - 1) & ~(CACT_SECTION_ALIGNMENT - 1);
+}
+
+// Expects a decoded animation (otherwise, the event names would be stored with their worst-case size)
+INTERNAL cact_header_t CACTComputeLayout(act_animation_t& animation, const uint8* sourceBytes, size_t sourceSize) {
+	cact_header_t header = {
+		.signature = { 'C', 'A', 'C', 'T' },
+		.version = CACT_VERSION,
+		.sourceMajorVersion = animation.majorVersion,
+		.sourceMinorVersion = animation.minorVersion,
+		.reserved = 0,
+		.clipCount = animation.clipCount,
+		.frameCount = animation.frameCount,
+		.layerCount = animation.layerCount,
+		.anchorCount = animation.anchorCount,
+		.eventCount = animation.eventCount,
+		.sourceHash = CGRFComputeContentHash(sourceBytes, sourceSize),
+	};
+
+	act_section_layout_t layout = ACTGetSectionLayout(animation);
+	size_t offset = sizeof(cact_header_t);
+	for(size_t section = 0; section < ACT_SECTION_COUNT; ++section) {
+		header.sections[section].offset = (uint32)offset;
+		header.sections[section].size = (uint32)layout.sizes[section];
+		offset += CACTAlignSectionSize(layout.sizes[section]);
+	}
+
+	return header;
+}
+
+INTERNAL inline size_t CACTGetCompiledSize(cact_header_t& header) {
+	cact_section_t& lastSection = header.sections[ACT_SECTION_COUNT - 1];
+	return lastSection.offset + CACTAlignSectionSize(lastSection.size);
+}
+
+// Returns the number of bytes written (the output must be large enough to hold the entire file)
+INTERNAL size_t CACTCompileAnimation(act_animation_t& animation, cact_header_t& header, uint8* output, size_t outputCapacity) {
+	size_t compiledSize = CACTGetCompiledSize(header);
+	ASSUME(compiledSize <= outputCapacity, "Insufficient space to store the compiled ACT file");
+
+	// NOTE: Zeroing everything first ensures that the alignment padding is deterministic (identical animations yield identical caches)
+	memset(output, 0, compiledSize);
+	memcpy(output, &header, sizeof(header));
+	act_section_layout_t layout = ACTGetSectionLayout(animation);
+	for(size_t section = 0; section < ACT_SECTION_COUNT; ++section)
+		memcpy(output + header.sections[section].offset, *layout.pointers[section], header.sections[section].size);
+
+	return compiledSize;
+}
+
+// NOTE: Only validates the cache itself - use CACTVerifySourceContents to make sure it's still up to date (just like CGRF indices)
+INTERNAL bool CACTRestoreAnimation(act_animation_t& animation, const uint8* cacheBytes, size_t cacheSize) {
+	animation = {};
+	animation.errorMessage = StringLiteral("OK");
+	if(cacheSize < sizeof(cact_header_t)) return ACTSetError(animation, StringLiteral("File is too small to be a CACT file"));
+
+	cact_header_t header;
+	memcpy(&header, cacheBytes, sizeof(header));
+	if(memcmp(header.signature, CACT_SIGNATURE, sizeof(header.signature)) != 0) return ACTSetError(animation, StringLiteral("Signature should be \"CACT\""));
+	if(header.version != CACT_VERSION) return ACTSetError(animation, StringLiteral("Unsupported CACT version"));
+
+	animation.majorVersion = header.sourceMajorVersion;
+	animation.minorVersion = header.sourceMinorVersion;
+	animation.clipCount = header.clipCount;
+	animation.frameCount = header.frameCount;
+	animation.layerCount = header.layerCount;
+	animation.anchorCount = header.anchorCount;
+	animation.eventCount = header.eventCount;
+	animation.eventNameCharacterCount = header.sections[ACT_EVENT_NAME_CHARACTERS].size;
+
+	// NOTE: The expected sizes are derived from the counts, so they can't overflow (uint32 * small constant fits into size_t)
+	act_section_layout_t layout = ACTGetSectionLayout(animation);
+	for(size_t section = 0; section < ACT_SECTION_COUNT; ++section) {
+		cact_section_t& storedSection = header.sections[section];
+		if(storedSection.offset % CACT_SECTION_ALIGNMENT != 0 || storedSection.size != layout.sizes[section])
+			return ACTSetError(animation, StringLiteral("Invalid section layout"));
+		if(storedSection.offset > cacheSize || storedSection.size > cacheSize - storedSection.offset)
+			return ACTSetError(animation, StringLiteral("Cache sections exceed the file size"));
+		*layout.pointers[section] = (uint8*)cacheBytes + storedSection.offset;
+	}
+
+	// NOTE: Caches are compiled locally, so the array contents are trusted - but the ranges must at least end where the counts say they do
+	bool hasConsistentRanges = animation.clipFrameOffsets[animation.clipCount] == animation.frameCount
+		&& animation.frameLayerOffsets[animation.frameCount] == animation.layerCount
+		&& animation.frameAnchorOffsets[animation.frameCount] == animation.anchorCount
+		&& animation.eventNameOffsets[animation.eventCount] == animation.eventNameCharacterCount;
+	if(!hasConsistentRanges) return ACTSetError(animation, StringLiteral("Cache contents don't match the stored counts"));
+
+	return true;
+}
+
+// Hashing the ACT file is much cheaper than decoding it again (so there's no need to rely on timestamps, which aren't always preserved)
+INTERNAL bool CACTVerifySourceContents(act_animation_t& animation, const uint8* cacheBytes, const uint8* sourceBytes, size_t sourceSize) {
+	cact_header_t header;
+	memcpy(&header, cacheBytes, sizeof(header));
+
+	uint64 sourceHash = CGRFComputeContentHash(sourceBytes, sourceSize);
+	if(sourceHash != header.sourceHash) return ACTSetError(animation, StringLiteral("Cache is outdated (ACT file contents have changed)"));
+	return true;
+}
\ No newline at end of file
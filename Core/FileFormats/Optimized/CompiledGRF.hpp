@@ -0,0 +1,244 @@
+// NOTE: Successor of the cached table of contents in CompiledGRF.lua - it's designed to be used in-place, straight from a file mapping
+// Sections are stored exactly as the GRF decoder lays them out in memory, so restoring them doesn't require decoding the file table
+// Restoring is still O(n) in the number of entries and name slots (every ID and offset is validated), and so is hashing the source table
+constexpr char CGRF_SIGNATURE[] = "CGRF";
+constexpr uint32 CGRF_MAJOR_VERSION = 3; // Paths are stored as UTF-8 since version 3 (previously CP949)
+constexpr uint32 CGRF_MINOR_VERSION = 0;
+constexpr uint32 CGRF_PATCH_VERSION = 0;
+constexpr size_t CGRF_SECTION_ALIGNMENT = 8;
+
+typedef struct cgrf_version {
+	uint32 major;
+	uint32 minor;
+	uint32 patch;
+} cgrf_version_t;
+
+typedef struct cgrf_section {
+	uint64 offset; // Relative to the start of the index
+	uint64 size;
+} cgrf_section_t;
+
+// Identifies the archive that the index was compiled from (any change to its file table invalidates the index)
+typedef struct cgrf_source {
+	uint32 fileTableOffset;
+	uint32 scramblingSeed;
+	uint32 scrambledFileCount;
+	uint32 version;
+	uint32 compressedTableSize;
+	uint32 decompressedTableSize;
+	uint64 contentHash; // Computed over the compressed file table
+} cgrf_source_t;
+
+typedef struct cgrf_header {
+	char signature[4];
+	cgrf_version_t semanticVersion;
+	uint32 fileCount;
+	uint32 nameCount; // Unique paths only (duplicates resolve to the last entry)
+	uint32 slotMask;
+	uint32 reserved;
+	cgrf_source_t source;
+	cgrf_section_t entries;
+	cgrf_section_t entryIndicesByName;
+	cgrf_section_t nameSlots;
+	cgrf_section_t nameEntries;
+	cgrf_section_t nameCharacters;
+} cgrf_header_t;
+
+static_assert(sizeof(cgrf_header_t) == 144, "CGRF headers must not contain any implicit padding");
+
+// NOTE: Four independent lanes keep the multipliers busy - the table is hashed on every load, so this should run at memory speed
+INTERNAL uint64 CGRFComputeContentHash(const uint8* bytes, size_t size) {
+	constexpr uint64 HASH_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+	constexpr size_t LANE_COUNT = 4;
+	constexpr size_t STRIPE_SIZE = LANE_COUNT * sizeof(uint64);
+
+	uint64 lanes[LANE_COUNT] = { size, size ^ HASH_MULTIPLIER, ~size, size + HASH_MULTIPLIER };
+	size_t index = 0;
+	for(; index + STRIPE_SIZE <= size; index += STRIPE_SIZE) {
+		uint64 chunks[LANE_COUNT];
+		memcpy(chunks, bytes + index, sizeof(chunks));
+		for(size_t lane = 0; lane < LANE_COUNT; ++lane) {
+			lanes[lane] = (lanes[lane] ^ chunks[lane]) * HASH_MULTIPLIER;
+			lanes[lane] ^= lanes[lane] >> 29;
+		}
+	}
+
+	uint64 hash = lanes[0] ^ (lanes[1] * 3) ^ (lanes[2] * 5) ^ (lanes[3] * 7);
+	for(; index < size; ++index)
+		hash = (hash ^ bytes[index]) * HASH_MULTIPLIER;
+	hash ^= hash >> 32;
+	return hash * HASH_MULTIPLIER;
+}
+
+INTERNAL cgrf_source_t CGRFGetSourceInfo(grf_archive_t& archive) {
+	grf_header_t header;
+	memcpy(&header, archive.bytes, sizeof(header));
+
+	cgrf_source_t source = {
+		.fileTableOffset = header.fileTableOffset,
+		.scramblingSeed = header.scramblingSeed,
+		.scrambledFileCount = header.fileCount,
+		.version = header.version,
+		.compressedTableSize = archive.fileTable.compressedSize,
+		.decompressedTableSize = archive.fileTable.decompressedSize,
+		.contentHash = 0,
+	};
+	return source;
+}
+
+INTERNAL inline size_t CGRFAlignSectionSize(size_t size) {
+	return (size + CGRF_SECTION_ALIGNMENT - 1) & ~(CGRF_SECTION_ALIGNMENT - 1);
+}
+
+INTERNAL cgrf_header_t CGRFComputeLayout(grf_archive_t& archive) {
+	string_intern_table_t& fileNames = archive.fileNames;
+
+	cgrf_header_t header = {
+		.signature = { 'C', 'G', 'R', 'F' },
+		.semanticVersion = {
+			.major = CGRF_MAJOR_VERSION,
+			.minor = CGRF_MINOR_VERSION,
+			.patch = CGRF_PATCH_VERSION,
+		},
+		.fileCount = archive.fileCount,
+		.nameCount = InternTableGetStringCount(fileNames),
+		.slotMask = fileNames.slotMask,
+		.reserved = 0,
+		.source = CGRFGetSourceInfo(archive),
+	};
+	header.source.contentHash = CGRFComputeContentHash(archive.compressedFileTable, archive.fileTable.compressedSize);
+
+	cgrf_section_t* sections[] = { &header.entries, &header.entryIndicesByName, &header.nameSlots, &header.nameEntries, &header.nameCharacters };
+	size_t sectionSizes[] = {
+		archive.fileCount * sizeof(grf_entry_t),
+		fileNames.entryCount * sizeof(uint32),
+		(fileNames.slotMask + 1) * sizeof(intern_table_slot_t),
+		fileNames.entryCount * sizeof(intern_table_entry_t),
+		fileNames.usedCharacterCount,
+	};
+
+	size_t offset = sizeof(cgrf_header_t);
+	for(size_t index = 0; index < sizeof(sections) / sizeof(sections[0]); ++index) {
+		sections[index]->offset = offset;
+		sections[index]->size = sectionSizes[index];
+		offset += CGRFAlignSectionSize(sectionSizes[index]);
+	}
+
+	return header;
+}
+
+INTERNAL inline size_t CGRFGetCompiledSize(cgrf_header_t& header) {
+	return header.nameCharacters.offset + CGRFAlignSectionSize(header.nameCharacters.size);
+}
+
+// Returns the number of bytes written (the output must be large enough to hold the entire index)
+INTERNAL size_t CGRFCompileTableOfContents(grf_archive_t& archive, cgrf_header_t& header, uint8* output, size_t outputCapacity) {
+	size_t compiledSize = CGRFGetCompiledSize(header);
+	ASSUME(compiledSize <= outputCapacity, "Insufficient space to store the compiled GRF index");
+
+	// NOTE: Zeroing everything first ensures that the alignment padding is deterministic (identical archives yield identical caches)
+	memset(output, 0, compiledSize);
+	memcpy(output, &header, sizeof(header));
+	memcpy(output + header.entries.offset, archive.entries, header.entries.size);
+	memcpy(output + header.entryIndicesByName.offset, archive.entryIndicesByName, header.entryIndicesByName.size);
+	memcpy(output + header.nameSlots.offset, archive.fileNames.slots, header.nameSlots.size);
+	memcpy(output + header.nameEntries.offset, archive.fileNames.entries, header.nameEntries.size);
+	memcpy(output + header.nameCharacters.offset, archive.fileNames.characters, header.nameCharacters.size);
+
+	return compiledSize;
+}
+
+INTERNAL inline bool CGRFIsValidSection(cgrf_section_t& section, size_t expectedSize, size_t indexSize) {
+	if(section.offset % CGRF_SECTION_ALIGNMENT != 0) return false;
+	if(section.size != expectedSize) return false;
+	return section.offset <= indexSize && section.size <= indexSize - section.offset;
+}
+
+// NOTE: Every ID and offset is used to index into another section without further checks, so they must all be in bounds
+// This is still much cheaper than decoding the file table (there's no decompression, transcoding, or hashing of the names)
+INTERNAL bool CGRFHasValidContents(grf_archive_t& archive, cgrf_header_t& header) {
+	uint32 nameEntryCount = header.nameCount + 1;
+	for(uint32 index = 0; index < header.fileCount; ++index) {
+		string_id_t nameID = archive.entries[index].name;
+		if(nameID == INVALID_STRING_ID || nameID >= nameEntryCount) return false;
+	}
+
+	string_intern_table_t& fileNames = archive.fileNames;
+	for(string_id_t nameID = INVALID_STRING_ID + 1; nameID < nameEntryCount; ++nameID) {
+		if(archive.entryIndicesByName[nameID] >= header.fileCount) return false;
+
+		// Stored names are NULL-terminated, so the terminator must be in bounds as well
+		intern_table_entry_t& entry = fileNames.entries[nameID];
+		if(entry.offset >= fileNames.usedCharacterCount || entry.length >= fileNames.usedCharacterCount - entry.offset) return false;
+		if(fileNames.characters[entry.offset + entry.length] != ASCII_NULL_TERMINATOR) return false;
+	}
+
+	// Lookups probe until they find an empty slot, so there must be exactly one occupied slot per name (and some empty ones)
+	uint32 occupiedSlotCount = 0;
+	for(uint64 slotIndex = 0; slotIndex <= fileNames.slotMask; ++slotIndex) {
+		string_id_t nameID = fileNames.slots[slotIndex].id;
+		if(nameID == INVALID_STRING_ID) continue;
+		if(nameID >= nameEntryCount) return false;
+		occupiedSlotCount++;
+	}
+	return occupiedSlotCount == header.nameCount;
+}
+
+// The source hash is verified separately since it requires reading the whole file table (the cache itself is always checked in a single pass)
+INTERNAL bool CGRFRestoreTableOfContents(grf_archive_t& archive, const uint8* indexBytes, size_t indexSize) {
+	if(indexSize < sizeof(cgrf_header_t)) return GRFSetError(archive, StringLiteral("Index is too small to be a CGRF file"));
+
+	cgrf_header_t header;
+	memcpy(&header, indexBytes, sizeof(header));
+	if(memcmp(header.signature, CGRF_SIGNATURE, sizeof(header.signature)) != 0) return GRFSetError(archive, StringLiteral("Signature should be \"CGRF\""));
+	if(header.semanticVersion.major != CGRF_MAJOR_VERSION) return GRFSetError(archive, StringLiteral("Unsupported CGRF version"));
+
+	cgrf_source_t source = CGRFGetSourceInfo(archive);
+	source.contentHash = header.source.contentHash;
+	if(memcmp(&source, &header.source, sizeof(source)) != 0) return GRFSetError(archive, StringLiteral("Index was compiled from a different archive"));
+	// Entries that were skipped while decoding aren't stored, so the index may contain fewer of them than the archive
+	if(header.fileCount > archive.fileCount) return GRFSetError(archive, StringLiteral("Index was compiled from a different archive"));
+
+	uint64 slotCount = (uint64)header.slotMask + 1;
+	if((slotCount & header.slotMask) != 0 || header.nameCount > header.fileCount || slotCount < 2 * (uint64)header.nameCount)
+		return GRFSetError(archive, StringLiteral("Invalid name table dimensions"));
+
+	uint64 nameEntryCount = (uint64)header.nameCount + 1;
+	bool hasValidSections = CGRFIsValidSection(header.entries, header.fileCount * sizeof(grf_entry_t), indexSize)
+		&& CGRFIsValidSection(header.entryIndicesByName, nameEntryCount * sizeof(uint32), indexSize)
+		&& CGRFIsValidSection(header.nameSlots, slotCount * sizeof(intern_table_slot_t), indexSize)
+		&& CGRFIsValidSection(header.nameEntries, nameEntryCount * sizeof(intern_table_entry_t), indexSize)
+		&& CGRFIsValidSection(header.nameCharacters, header.nameCharacters.size, indexSize) && header.nameCharacters.size <= UINT32_MAX;
+	if(!hasValidSections) return GRFSetError(archive, StringLiteral("Index sections exceed the file size"));
+
+	// NOTE: The restored tables point into read-only memory, so nothing must be inserted afterwards (lookups are fine)
+	uint8* base = (uint8*)indexBytes;
+	grf_archive_t restoredArchive = archive;
+	restoredArchive.fileCount = header.fileCount;
+	restoredArchive.skippedEntryCount = archive.fileCount - header.fileCount;
+	restoredArchive.entries = (grf_entry_t*)(base + header.entries.offset);
+	restoredArchive.entryIndicesByName = (uint32*)(base + header.entryIndicesByName.offset);
+	restoredArchive.fileNames = {
+		.slots = (intern_table_slot_t*)(base + header.nameSlots.offset),
+		.entries = (intern_table_entry_t*)(base + header.nameEntries.offset),
+		.characters = (char*)(base + header.nameCharacters.offset),
+		.slotMask = header.slotMask,
+		.entryCount = (uint32)nameEntryCount,
+		.maxEntryCount = (uint32)nameEntryCount,
+		.usedCharacterCount = header.nameCharacters.size,
+		.maxCharacterCount = header.nameCharacters.size,
+	};
+	if(!CGRFHasValidContents(restoredArchive, header)) return GRFSetError(archive, StringLiteral("Index contents are corrupted"));
+
+	archive = restoredArchive;
+	return true;
+}
+
+INTERNAL bool CGRFVerifySourceContents(grf_archive_t& archive, const uint8* indexBytes) {
+	cgrf_header_t header;
+	memcpy(&header, indexBytes, sizeof(header));
+
+	uint64 contentHash = CGRFComputeContentHash(archive.compressedFileTable, archive.fileTable.compressedSize);
+	if(contentHash != header.source.contentHash) return GRFSetError(archive, StringLiteral("Index is outdated (file table contents have changed)"));
+	return true;
+}
\ No newline at end of file
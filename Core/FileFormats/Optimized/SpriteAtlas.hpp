@@ -0,0 +1,321 @@
+// NOTE: Packs all images of a sprite sheet into a single texture, so that every layer of a character can be drawn without switching textures
+// The atlas is stored as a plain TGA image (to make it easy to inspect), and the UV table is meant to be used in-place (same as CGRF indices)
+constexpr char SATL_SIGNATURE[] = "SATL";
+constexpr uint32 SATL_VERSION = 1;
+constexpr int SPRITE_ATLAS_PADDING = 1; // Prevents neighboring sprites from bleeding into each other when using bilinear filtering
+constexpr int SPRITE_ATLAS_MIN_SIZE = 64;
+constexpr int SPRITE_ATLAS_MAX_SIZE = 4096; // Guaranteed to be supported by all relevant GPUs
+constexpr size_t TGA_HEADER_SIZE = 18;
+constexpr uint8 TGA_UNCOMPRESSED_TRUE_COLOR_IMAGE = 2;
+constexpr uint8 TGA_TOP_LEFT_ORIGIN = 0x20;
+
+// Fully transparent images are stored as empty rectangles (they still need an entry, since the table is indexed by image)
+typedef struct sprite_atlas_entry {
+	uint16 atlasX;
+	uint16 atlasY;
+	uint16 width;
+	uint16 height;
+	// Position of the trimmed rectangle in the original image (ACT layers are positioned relative to the untrimmed image's center)
+	uint16 trimmedX;
+	uint16 trimmedY;
+	uint16 imageWidth;
+	uint16 imageHeight;
+} sprite_atlas_entry_t;
+
+static_assert(sizeof(sprite_atlas_entry_t) == 16, "SATL entries must not contain any implicit padding");
+
+// Entries follow the header, in the same order as the sprite sheet's images (indexed-color first, then true-color)
+typedef struct sprite_atlas_header {
+	char signature[4];
+	uint32 version;
+	uint16 atlasWidth;
+	uint16 atlasHeight;
+	uint16 indexedImageCount;
+	uint16 trueColorImageCount;
+} sprite_atlas_header_t;
+
+static_assert(sizeof(sprite_atlas_header_t) == 16, "SATL headers must not contain any implicit padding");
+
+typedef struct skyline_segment {
+	int x;
+	int y; // Top of the occupied area (all rectangles are placed below the skyline, growing downwards)
+	int width;
+} skyline_segment_t;
+
+typedef struct skyline_packer {
+	int width;
+	int height;
+	uint32 segmentCount;
+	uint32 maxSegmentCount;
+	skyline_segment_t* segments; // Sorted by x, without gaps (always covers the entire width)
+} skyline_packer_t;
+
+typedef struct sprite_atlas {
+	String errorMessage;
+	int width;
+	int height;
+	uint32 entryCount;
+	sprite_atlas_entry_t* entries;
+	offscreen_buffer_t image;
+} sprite_atlas_t;
+
+INTERNAL inline bool SpriteAtlasSetError(sprite_atlas_t& atlas, String message) {
+	atlas.errorMessage = message;
+	return false;
+}
+
+INTERNAL void SkylineReset(skyline_packer_t& packer, int width, int height) {
+	packer.width = width;
+	packer.height = height;
+	packer.segmentCount = 1;
+	packer.segments[0] = { .x = 0, .y = 0, .width = width };
+}
+
+// Returns the lowest position at which the rectangle fits if its left edge is aligned with the given segment (or -1 if it doesn't fit)
+INTERNAL int SkylineFitRectangle(skyline_packer_t& packer, uint32 segmentIndex, int width, int height) {
+	if(packer.segments[segmentIndex].x + width > packer.width) return -1;
+
+	int y = 0;
+	int remainingWidth = width;
+	for(uint32 index = segmentIndex; remainingWidth > 0; ++index) {
+		y = Max(y, packer.segments[index].y);
+		if(y + height > packer.height) return -1;
+		remainingWidth -= packer.segments[index].width;
+	}
+	return y;
+}
+
+INTERNAL inline void SkylineRemoveSegment(skyline_packer_t& packer, uint32 segmentIndex) {
+	memmove(packer.segments + segmentIndex, packer.segments + segmentIndex + 1, (packer.segmentCount - segmentIndex - 1) * sizeof(skyline_segment_t));
+	packer.segmentCount--;
+}
+
+// NOTE: Bottom-left heuristic - picks the placement with the lowest bottom edge, preferring narrow segments (they're harder to fill later)
+INTERNAL bool SkylinePackRectangle(skyline_packer_t& packer, int width, int height, int& x, int& y) {
+	uint32 bestIndex = packer.segmentCount;
+	int bestBottom = packer.height + 1;
+	int bestWidth = packer.width + 1;
+	int bestY = 0;
+	for(uint32 index = 0; index < packer.segmentCount; ++index) {
+		int fittedY = SkylineFitRectangle(packer, index, width, height);
+		if(fittedY < 0) continue;
+
+		int bottom = fittedY + height;
+		int segmentWidth = packer.segments[index].width;
+		if(bottom < bestBottom || (bottom == bestBottom && segmentWidth < bestWidth)) {
+			bestIndex = index;
+			bestBottom = bottom;
+			bestWidth = segmentWidth;
+			bestY = fittedY;
+		}
+	}
+	if(bestIndex == packer.segmentCount) return false;
+
+	ASSUME(packer.segmentCount < packer.maxSegmentCount, "Skyline segment list should never overflow (each rectangle adds at most one segment)");
+	x = packer.segments[bestIndex].x;
+	y = bestY;
+	memmove(packer.segments + bestIndex + 1, packer.segments + bestIndex, (packer.segmentCount - bestIndex) * sizeof(skyline_segment_t));
+	packer.segments[bestIndex] = { .x = x, .y = y + height, .width = width };
+	packer.segmentCount++;
+
+	// Segments that are (partially) covered by the new one must be shortened or removed
+	for(uint32 index = bestIndex + 1; index < packer.segmentCount;) {
+		skyline_segment_t& segment = packer.segments[index];
+		int coveredWidth = (x + width) - segment.x;
+		if(coveredWidth <= 0) break;
+		if(segment.width > coveredWidth) {
+			segment.x += coveredWidth;
+			segment.width -= coveredWidth;
+			break;
+		}
+		SkylineRemoveSegment(packer, index);
+	}
+
+	for(uint32 index = 0; index + 1 < packer.segmentCount;) {
+		if(packer.segments[index].y != packer.segments[index + 1].y) {
+			++index;
+			continue;
+		}
+		packer.segments[index].width += packer.segments[index + 1].width;
+		SkylineRemoveSegment(packer, index + 1);
+	}
+
+	return true;
+}
+
+INTERNAL inline bool SpriteAtlasIsOpaquePixel(const uint32* row, int x) {
+	rgba_color_t pixel = { .bytes = row[x] };
+	return pixel.alpha != 0;
+}
+
+// Shrinks the entry to the smallest rectangle that still contains every visible pixel of the image
+INTERNAL void SpriteAtlasTrimImage(offscreen_buffer_t& image, sprite_atlas_entry_t& entry) {
+	entry = {
+		.imageWidth = (uint16)image.width,
+		.imageHeight = (uint16)image.height,
+	};
+
+	int top = 0;
+	int bottom = image.height;
+	int left = image.width;
+	int right = 0;
+	for(int y = 0; y < image.height; ++y) {
+		const uint32* row = BitmapGetRowAddress(image, y);
+		int firstOpaque = 0;
+		while(firstOpaque < image.width && !SpriteAtlasIsOpaquePixel(row, firstOpaque))
+			++firstOpaque;
+		if(firstOpaque == image.width) {
+			if(top == y) ++top;
+			continue;
+		}
+
+		int lastOpaque = image.width - 1;
+		while(!SpriteAtlasIsOpaquePixel(row, lastOpaque))
+			--lastOpaque;
+		left = Min(left, firstOpaque);
+		right = Max(right, lastOpaque + 1);
+		bottom = y + 1;
+	}
+	if(left >= right) return;
+
+	entry.trimmedX = (uint16)left;
+	entry.trimmedY = (uint16)top;
+	entry.width = (uint16)(right - left);
+	entry.height = (uint16)(bottom - top);
+}
+
+INTERNAL inline size_t SpriteAtlasGetRequiredMemorySize(uint32 imageCount) {
+	// Entries, sort keys, and skyline segments (only the entries are still needed after packing)
+	return imageCount * (sizeof(sprite_atlas_entry_t) + sizeof(uint64) + sizeof(skyline_segment_t)) + sizeof(skyline_segment_t);
+}
+
+// Tries each atlas size in turn (doubling the shorter side), so the result is the smallest power-of-two atlas this heuristic finds
+INTERNAL bool SpriteAtlasPackImages(sprite_atlas_t& atlas, offscreen_buffer_t* images, uint32 imageCount, memory_arena_t& arena) {
+	ASSUME(ArenaCanAllocate(arena, SpriteAtlasGetRequiredMemorySize(imageCount)), "Insufficient memory to pack the sprite atlas");
+	atlas = {};
+	atlas.errorMessage = StringLiteral("OK");
+	atlas.entryCount = imageCount;
+	atlas.entries = (sprite_atlas_entry_t*)ArenaAllocateMemoryRegion(arena, imageCount * sizeof(sprite_atlas_entry_t));
+	uint64* sortKeys = (uint64*)ArenaAllocateMemoryRegion(arena, imageCount * sizeof(uint64));
+	skyline_packer_t packer = {
+		.maxSegmentCount = imageCount + 1,
+		.segments = (skyline_segment_t*)ArenaAllocateMemoryRegion(arena, (imageCount + 1) * sizeof(skyline_segment_t)),
+	};
+
+	uint32 packedCount = 0;
+	size_t totalArea = 0;
+	int maxWidth = 0;
+	int maxHeight = 0;
+	for(uint32 index = 0; index < imageCount; ++index) {
+		sprite_atlas_entry_t& entry = atlas.entries[index];
+		SpriteAtlasTrimImage(images[index], entry);
+		if(entry.width == 0) continue;
+
+		int paddedWidth = entry.width + SPRITE_ATLAS_PADDING;
+		int paddedHeight = entry.height + SPRITE_ATLAS_PADDING;
+		totalArea += (size_t)paddedWidth * paddedHeight;
+		maxWidth = Max(maxWidth, paddedWidth);
+		maxHeight = Max(maxHeight, paddedHeight);
+		sortKeys[packedCount++] = ((uint64)paddedHeight << 48) | ((uint64)paddedWidth << 32) | index;
+	}
+
+	// NOTE: Tall rectangles first (then wide ones), which is what the skyline heuristic works best with - insertion sort is fine for a few hundred images
+	for(uint32 sorted = 1; sorted < packedCount; ++sorted) {
+		uint64 key = sortKeys[sorted];
+		uint32 index = sorted;
+		for(; index > 0 && sortKeys[index - 1] < key; --index)
+			sortKeys[index] = sortKeys[index - 1];
+		sortKeys[index] = key;
+	}
+
+	int width = SPRITE_ATLAS_MIN_SIZE;
+	int height = SPRITE_ATLAS_MIN_SIZE;
+	while(width < maxWidth)
+		width *= 2;
+	while(height < maxHeight)
+		height *= 2;
+	while((size_t)width * height < totalArea) {
+		if(width <= height) width *= 2;
+		else height *= 2;
+	}
+
+	while(width <= SPRITE_ATLAS_MAX_SIZE && height <= SPRITE_ATLAS_MAX_SIZE) {
+		// The padding is only needed between sprites, so the last row and column may omit it
+		SkylineReset(packer, width + SPRITE_ATLAS_PADDING, height + SPRITE_ATLAS_PADDING);
+		uint32 index = 0;
+		for(; index < packedCount; ++index) {
+			sprite_atlas_entry_t& entry = atlas.entries[(uint32)sortKeys[index]];
+			int x;
+			int y;
+			if(!SkylinePackRectangle(packer, entry.width + SPRITE_ATLAS_PADDING, entry.height + SPRITE_ATLAS_PADDING, x, y)) break;
+			entry.atlasX = (uint16)x;
+			entry.atlasY = (uint16)y;
+		}
+
+		if(index == packedCount) {
+			atlas.width = width;
+			atlas.height = height;
+			return true;
+		}
+
+		if(width <= height) width *= 2;
+		else height *= 2;
+	}
+
+	return SpriteAtlasSetError(atlas, StringLiteral("Images don't fit into the largest supported atlas size"));
+}
+
+INTERNAL inline size_t SpriteAtlasGetImageSize(sprite_atlas_t& atlas) {
+	return (size_t)atlas.width * atlas.height * sizeof(uint32);
+}
+
+// NOTE: The arena's memory must be zeroed, since the unused parts of the atlas are never written (but should be transparent)
+INTERNAL void SpriteAtlasCopyImages(sprite_atlas_t& atlas, offscreen_buffer_t* images, memory_arena_t& arena) {
+	ASSUME(ArenaCanAllocate(arena, SpriteAtlasGetImageSize(atlas)), "Insufficient memory to store the sprite atlas");
+	atlas.image = {
+		.width = atlas.width,
+		.height = atlas.height,
+		.bytesPerPixel = (int)sizeof(uint32),
+		.stride = atlas.width * (int)sizeof(uint32),
+		.pixelBuffer = ArenaAllocateMemoryRegion(arena, SpriteAtlasGetImageSize(atlas)),
+	};
+
+	for(uint32 index = 0; index < atlas.entryCount; ++index) {
+		sprite_atlas_entry_t& entry = atlas.entries[index];
+		for(int y = 0; y < entry.height; ++y) {
+			uint32* source = BitmapGetRowAddress(images[index], entry.trimmedY + y) + entry.trimmedX;
+			uint32* destination = BitmapGetRowAddress(atlas.image, entry.atlasY + y) + entry.atlasX;
+			memcpy(destination, source, entry.width * sizeof(uint32));
+		}
+	}
+}
+
+// Atlas pixels are BGRA, which is exactly what TGA uses (so the image can be written as-is after this header)
+INTERNAL void SpriteAtlasEncodeTGAHeader(sprite_atlas_t& atlas, uint8* header) {
+	memset(header, 0, TGA_HEADER_SIZE);
+	header[2] = TGA_UNCOMPRESSED_TRUE_COLOR_IMAGE;
+	header[12] = (uint8)(atlas.width & 0xFF);
+	header[13] = (uint8)(atlas.width >> 8);
+	header[14] = (uint8)(atlas.height & 0xFF);
+	header[15] = (uint8)(atlas.height >> 8);
+	header[16] = 8 * sizeof(uint32);
+	header[17] = TGA_TOP_LEFT_ORIGIN | 8; // Alpha channel depth
+}
+
+INTERNAL inline size_t SpriteAtlasGetTableSize(sprite_atlas_t& atlas) {
+	return sizeof(sprite_atlas_header_t) + atlas.entryCount * sizeof(sprite_atlas_entry_t);
+}
+
+INTERNAL void SpriteAtlasEncodeTable(sprite_atlas_t& atlas, spr_sprite_sheet_t& sheet, uint8* output) {
+	ASSUME(atlas.entryCount == SPRGetImageCount(sheet), "Atlas must have been packed from the given sprite sheet");
+	sprite_atlas_header_t header = {
+		.version = SATL_VERSION,
+		.atlasWidth = (uint16)atlas.width,
+		.atlasHeight = (uint16)atlas.height,
+		.indexedImageCount = sheet.indexedImageCount,
+		.trueColorImageCount = sheet.trueColorImageCount,
+	};
+	memcpy(header.signature, SATL_SIGNATURE, sizeof(header.signature));
+	memcpy(output, &header, sizeof(header));
+	memcpy(output + sizeof(header), atlas.entries, atlas.entryCount * sizeof(sprite_atlas_entry_t));
+}
\ No newline at end of file
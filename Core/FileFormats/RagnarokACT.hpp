@@ -0,0 +1,376 @@
+// NOTE: Native counterpart of RagnarokACT.lua - clips, frames, layers, and events are flattened into arrays (one per field) instead of nested tables
+constexpr char ACT_SIGNATURE[] = "AC";
+constexpr size_t ACT_HEADER_SIZE = 16; // Signature, version, clip count, and ten unknown bytes
+constexpr uint8 ACT_SUPPORTED_MAJOR_VERSION = 2;
+constexpr uint8 ACT_MAX_SUPPORTED_MINOR_VERSION = 5;
+constexpr size_t ACT_FRAME_UNKNOWN_BYTES = 8 * sizeof(int32);
+constexpr size_t ACT_MIN_FRAME_SIZE = ACT_FRAME_UNKNOWN_BYTES + 2 * sizeof(uint32); // Layer count and event ID
+constexpr size_t ACT_ANCHOR_SIZE = 4 * sizeof(int32);
+constexpr size_t ACT_EVENT_NAME_SIZE = 40;
+constexpr float ACT_DEFAULT_TICKS_PER_FRAME = 4.0f;
+constexpr milliseconds ACT_UPDATE_INTERVAL = 24.0f;
+constexpr int32 ACT_NO_EVENT = -1;
+constexpr int32 ACT_TRUE_COLOR_IMAGE_TYPE = 1;
+// Offsets are 32-bit, and transcoding may (roughly) triple the size of the event names - real files are only a few kilobytes
+constexpr size_t ACT_MAX_FILE_SIZE = UINT32_MAX / 4;
+
+constexpr uint8 ACT_LAYER_MIRRORED = 1 << 0;
+constexpr uint8 ACT_LAYER_TRUE_COLOR = 1 << 1; // Refers to the sprite sheet's true-color images (indexed-color otherwise)
+
+// NOTE: All arrays that hold 32-bit values come first, so that they're still aligned when allocated back-to-back
+typedef enum : uint8 {
+	ACT_CLIP_FRAME_OFFSETS,
+	ACT_CLIP_FRAME_TIMES,
+	ACT_FRAME_LAYER_OFFSETS,
+	ACT_FRAME_ANCHOR_OFFSETS,
+	ACT_FRAME_EVENT_IDS,
+	ACT_LAYER_POSITIONS_X,
+	ACT_LAYER_POSITIONS_Y,
+	ACT_LAYER_SPRITE_INDICES,
+	ACT_LAYER_COLORS,
+	ACT_LAYER_SCALES_X,
+	ACT_LAYER_SCALES_Y,
+	ACT_LAYER_ROTATIONS,
+	ACT_LAYER_WIDTHS,
+	ACT_LAYER_HEIGHTS,
+	ACT_ANCHOR_POSITIONS_X,
+	ACT_ANCHOR_POSITIONS_Y,
+	ACT_EVENT_NAME_OFFSETS,
+	ACT_LAYER_FLAGS,
+	ACT_EVENT_NAME_CHARACTERS,
+	ACT_SECTION_COUNT,
+} act_section_t;
+
+// Ranges are stored as offsets (with one extra entry at the end), e.g., the layers of frame i are [frameLayerOffsets[i], frameLayerOffsets[i + 1])
+typedef struct act_animation {
+	const uint8* bytes;
+	size_t size;
+	String errorMessage;
+	uint8 majorVersion;
+	uint8 minorVersion;
+	uint32 clipCount;
+	uint32 frameCount;
+	uint32 layerCount;
+	uint32 anchorCount;
+	uint32 eventCount;
+	uint32 eventNameCharacterCount; // Worst case until the names have been transcoded
+
+	uint32* clipFrameOffsets;
+	milliseconds* clipFrameTimes;
+
+	uint32* frameLayerOffsets;
+	uint32* frameAnchorOffsets;
+	int32* frameEventIDs;
+
+	int32* layerPositionsX;
+	int32* layerPositionsY;
+	int32* layerSpriteIndices;
+	uint32* layerColors; // BGRA
+	float* layerScalesX;
+	float* layerScalesY;
+	int32* layerRotations; // In degrees
+	int32* layerWidths; // Only stored since version 2.5 (zero otherwise)
+	int32* layerHeights;
+	uint8* layerFlags;
+
+	int32* anchorPositionsX;
+	int32* anchorPositionsY;
+
+	uint32* eventNameOffsets;
+	char* eventNameCharacters; // UTF-8, with NULL terminators
+} act_animation_t;
+
+typedef struct act_section_layout {
+	void** pointers[ACT_SECTION_COUNT];
+	size_t sizes[ACT_SECTION_COUNT];
+} act_section_layout_t;
+
+INTERNAL inline bool ACTSetError(act_animation_t& animation, String message) {
+	animation.errorMessage = message;
+	return false;
+}
+
+INTERNAL inline bool ACTIsAtLeastVersion(act_animation_t& animation, uint8 minorVersion) {
+	return animation.minorVersion >= minorVersion;
+}
+
+INTERNAL inline size_t ACTGetLayerSize(act_animation_t& animation) {
+	size_t layerSize = 8 * sizeof(int32); // Position, sprite index, mirroring, color, scale, rotation, and image type
+	if(ACTIsAtLeastVersion(animation, 4)) layerSize += sizeof(float); // Separate vertical scale
+	if(ACTIsAtLeastVersion(animation, 5)) layerSize += 2 * sizeof(int32); // Image dimensions
+	return layerSize;
+}
+
+INTERNAL inline bool ACTHasBytes(const uint8* cursor, const uint8* end, size_t count) {
+	return (size_t)(end - cursor) >= count;
+}
+
+INTERNAL inline int32 ACTReadInt32(const uint8*& cursor) {
+	int32 value;
+	memcpy(&value, cursor, sizeof(value));
+	cursor += sizeof(value);
+	return value;
+}
+
+INTERNAL inline uint32 ACTReadUnsignedInt32(const uint8*& cursor) {
+	return (uint32)ACTReadInt32(cursor);
+}
+
+INTERNAL inline float ACTReadFloat(const uint8*& cursor) {
+	float value;
+	memcpy(&value, cursor, sizeof(value));
+	cursor += sizeof(value);
+	return value;
+}
+
+// Same as the Lua decoder: Negative counts are treated as empty lists (they're stored as signed integers for some reason)
+INTERNAL inline uint32 ACTReadCount(const uint8*& cursor) {
+	int32 count = ACTReadInt32(cursor);
+	return (count < 0) ? 0 : (uint32)count;
+}
+
+// Same as GetNullTerminatedString: The name ends at the first null byte (if there is one)
+INTERNAL inline size_t ACTGetStoredNameLength(const uint8* storedName) {
+	const uint8* nullTerminator = (const uint8*)memchr(storedName, ASCII_NULL_TERMINATOR, ACT_EVENT_NAME_SIZE);
+	return nullTerminator ? nullTerminator - storedName : ACT_EVENT_NAME_SIZE;
+}
+
+// Validates the entire file and counts everything - the arrays are decoded separately (after the caller has set aside enough memory)
+INTERNAL bool ACTOpenAnimation(act_animation_t& animation, const uint8* bytes, size_t size) {
+	animation = {};
+	animation.bytes = bytes;
+	animation.size = size;
+	animation.errorMessage = StringLiteral("OK");
+
+	if(size < ACT_HEADER_SIZE) return ACTSetError(animation, StringLiteral("File is too small to be an ACT file"));
+	if(size > ACT_MAX_FILE_SIZE) return ACTSetError(animation, StringLiteral("File is too large to be an ACT file"));
+	if(memcmp(bytes, ACT_SIGNATURE, sizeof(ACT_SIGNATURE) - 1) != 0) return ACTSetError(animation, StringLiteral("Signature should be \"AC\""));
+
+	animation.minorVersion = bytes[2];
+	animation.majorVersion = bytes[3];
+	if(animation.majorVersion != ACT_SUPPORTED_MAJOR_VERSION || animation.minorVersion > ACT_MAX_SUPPORTED_MINOR_VERSION)
+		return ACTSetError(animation, StringLiteral("Unsupported ACT version (must be between 2.0 and 2.5)"));
+	animation.clipCount = bytes[4] | (bytes[5] << 8);
+
+	// NOTE: Counts are checked against the remaining size before they're used, so the totals can't overflow (given the file size limit)
+	const uint8* cursor = bytes + ACT_HEADER_SIZE;
+	const uint8* end = bytes + size;
+	size_t layerSize = ACTGetLayerSize(animation);
+	for(uint32 clipIndex = 0; clipIndex < animation.clipCount; ++clipIndex) {
+		if(!ACTHasBytes(cursor, end, sizeof(uint32))) return ACTSetError(animation, StringLiteral("Unexpected end of file (animation clip is truncated)"));
+		uint32 frameCount = ACTReadUnsignedInt32(cursor);
+		if(frameCount > (size_t)(end - cursor) / ACT_MIN_FRAME_SIZE) return ACTSetError(animation, StringLiteral("Frame count exceeds the file size"));
+
+		for(uint32 frameIndex = 0; frameIndex < frameCount; ++frameIndex) {
+			if(!ACTHasBytes(cursor, end, ACT_FRAME_UNKNOWN_BYTES + sizeof(uint32))) return ACTSetError(animation, StringLiteral("Unexpected end of file (animation frame is truncated)"));
+			cursor += ACT_FRAME_UNKNOWN_BYTES;
+			uint32 layerCount = ACTReadUnsignedInt32(cursor);
+			if(layerCount > (size_t)(end - cursor) / layerSize) return ACTSetError(animation, StringLiteral("Layer count exceeds the file size"));
+			cursor += layerCount * layerSize;
+
+			if(!ACTHasBytes(cursor, end, sizeof(int32))) return ACTSetError(animation, StringLiteral("Unexpected end of file (animation frame is truncated)"));
+			cursor += sizeof(int32); // Event ID
+
+			uint32 anchorCount = 0;
+			if(ACTIsAtLeastVersion(animation, 3)) {
+				if(!ACTHasBytes(cursor, end, sizeof(int32))) return ACTSetError(animation, StringLiteral("Unexpected end of file (animation frame is truncated)"));
+				anchorCount = ACTReadCount(cursor);
+				if(anchorCount > (size_t)(end - cursor) / ACT_ANCHOR_SIZE) return ACTSetError(animation, StringLiteral("Anchor count exceeds the file size"));
+				cursor += anchorCount * ACT_ANCHOR_SIZE;
+			}
+
+			animation.layerCount += layerCount;
+			animation.anchorCount += anchorCount;
+		}
+		animation.frameCount += frameCount;
+	}
+
+	if(ACTIsAtLeastVersion(animation, 1)) {
+		if(!ACTHasBytes(cursor, end, sizeof(int32))) return ACTSetError(animation, StringLiteral("Unexpected end of file (animation events are missing)"));
+		animation.eventCount = ACTReadCount(cursor);
+		if(animation.eventCount > (size_t)(end - cursor) / ACT_EVENT_NAME_SIZE) return ACTSetError(animation, StringLiteral("Event count exceeds the file size"));
+
+		for(uint32 eventIndex = 0; eventIndex < animation.eventCount; ++eventIndex) {
+			size_t storedNameLength = ACTGetStoredNameLength(cursor);
+			animation.eventNameCharacterCount += (uint32)(TranscodeGetMaxUTF8Length(storedNameLength) + sizeof(ASCII_NULL_TERMINATOR));
+			cursor += ACT_EVENT_NAME_SIZE;
+		}
+	}
+
+	if(ACTIsAtLeastVersion(animation, 2)) {
+		if(!ACTHasBytes(cursor, end, animation.clipCount * sizeof(float))) return ACTSetError(animation, StringLiteral("Unexpected end of file (frame times are missing)"));
+		cursor += animation.clipCount * sizeof(float);
+	}
+
+	if(cursor != end) return ACTSetError(animation, StringLiteral("Detected leftover bytes at the end of the file"));
+	return true;
+}
+
+// NOTE: Shared by the decoder and the compiled format (CACT), so that both always agree on the order and size of every array
+INTERNAL act_section_layout_t ACTGetSectionLayout(act_animation_t& animation) {
+	size_t clipCount = animation.clipCount;
+	size_t frameCount = animation.frameCount;
+	size_t layerCount = animation.layerCount;
+	size_t anchorCount = animation.anchorCount;
+	size_t eventCount = animation.eventCount;
+
+	act_section_layout_t layout = {
+		.pointers = {
+			(void**)&animation.clipFrameOffsets,
+			(void**)&animation.clipFrameTimes,
+			(void**)&animation.frameLayerOffsets,
+			(void**)&animation.frameAnchorOffsets,
+			(void**)&animation.frameEventIDs,
+			(void**)&animation.layerPositionsX,
+			(void**)&animation.layerPositionsY,
+			(void**)&animation.layerSpriteIndices,
+			(void**)&animation.layerColors,
+			(void**)&animation.layerScalesX,
+			(void**)&animation.layerScalesY,
+			(void**)&animation.layerRotations,
+			(void**)&animation.layerWidths,
+			(void**)&animation.layerHeights,
+			(void**)&animation.anchorPositionsX,
+			(void**)&animation.anchorPositionsY,
+			(void**)&animation.eventNameOffsets,
+			(void**)&animation.layerFlags,
+			(void**)&animation.eventNameCharacters,
+		},
+		.sizes = {
+			(clipCount + 1) * sizeof(uint32),
+			clipCount * sizeof(milliseconds),
+			(frameCount + 1) * sizeof(uint32),
+			(frameCount + 1) * sizeof(uint32),
+			frameCount * sizeof(int32),
+			layerCount * sizeof(int32),
+			layerCount * sizeof(int32),
+			layerCount * sizeof(int32),
+			layerCount * sizeof(uint32),
+			layerCount * sizeof(float),
+			layerCount * sizeof(float),
+			layerCount * sizeof(int32),
+			layerCount * sizeof(int32),
+			layerCount * sizeof(int32),
+			anchorCount * sizeof(int32),
+			anchorCount * sizeof(int32),
+			(eventCount + 1) * sizeof(uint32),
+			layerCount * sizeof(uint8),
+			animation.eventNameCharacterCount,
+		},
+	};
+	return layout;
+}
+
+INTERNAL size_t ACTGetRequiredMemorySize(act_animation_t& animation) {
+	act_section_layout_t layout = ACTGetSectionLayout(animation);
+	size_t requiredSize = 0;
+	for(size_t section = 0; section < ACT_SECTION_COUNT; ++section)
+		requiredSize += layout.sizes[section];
+	return requiredSize;
+}
+
+INTERNAL void ACTDecodeSpriteLayer(act_animation_t& animation, const uint8*& cursor, uint32 layerIndex) {
+	animation.layerPositionsX[layerIndex] = ACTReadInt32(cursor);
+	animation.layerPositionsY[layerIndex] = ACTReadInt32(cursor);
+	animation.layerSpriteIndices[layerIndex] = ACTReadInt32(cursor);
+	uint8 flags = (ACTReadInt32(cursor) == 1) ? ACT_LAYER_MIRRORED : 0;
+
+	rgba_color_t color = {
+		.blue = cursor[2],
+		.green = cursor[1],
+		.red = cursor[0],
+		.alpha = cursor[3],
+	};
+	cursor += sizeof(uint32);
+	animation.layerColors[layerIndex] = color.bytes;
+
+	float scaleX = ACTReadFloat(cursor);
+	animation.layerScalesX[layerIndex] = scaleX;
+	animation.layerScalesY[layerIndex] = ACTIsAtLeastVersion(animation, 4) ? ACTReadFloat(cursor) : scaleX;
+	animation.layerRotations[layerIndex] = ACTReadInt32(cursor);
+	// TBD: Unknown image types are treated as indexed-color (the Lua decoder doesn't reject them either)
+	if(ACTReadInt32(cursor) == ACT_TRUE_COLOR_IMAGE_TYPE) flags |= ACT_LAYER_TRUE_COLOR;
+	animation.layerFlags[layerIndex] = flags;
+
+	bool hasImageDimensions = ACTIsAtLeastVersion(animation, 5);
+	animation.layerWidths[layerIndex] = hasImageDimensions ? ACTReadInt32(cursor) : 0;
+	animation.layerHeights[layerIndex] = hasImageDimensions ? ACTReadInt32(cursor) : 0;
+}
+
+// NOTE: The file was fully validated when it was opened, so there's no need to check any of the sizes again here
+INTERNAL void ACTDecodeAnimation(act_animation_t& animation, memory_arena_t& arena) {
+	ASSUME(ArenaCanAllocate(arena, ACTGetRequiredMemorySize(animation)), "Insufficient memory to decode the ACT file");
+
+	act_section_layout_t layout = ACTGetSectionLayout(animation);
+	for(size_t section = 0; section < ACT_SECTION_COUNT; ++section)
+		*layout.pointers[section] = ArenaAllocateMemoryRegion(arena, layout.sizes[section]);
+
+	const uint8* cursor = animation.bytes + ACT_HEADER_SIZE;
+	uint32 frameIndex = 0;
+	uint32 layerIndex = 0;
+	uint32 anchorIndex = 0;
+	for(uint32 clipIndex = 0; clipIndex < animation.clipCount; ++clipIndex) {
+		animation.clipFrameOffsets[clipIndex] = frameIndex;
+		uint32 frameCount = ACTReadUnsignedInt32(cursor);
+
+		for(uint32 frameEnd = frameIndex + frameCount; frameIndex < frameEnd; ++frameIndex) {
+			animation.frameLayerOffsets[frameIndex] = layerIndex;
+			animation.frameAnchorOffsets[frameIndex] = anchorIndex;
+
+			cursor += ACT_FRAME_UNKNOWN_BYTES;
+			uint32 layerCount = ACTReadUnsignedInt32(cursor);
+			for(uint32 layerEnd = layerIndex + layerCount; layerIndex < layerEnd; ++layerIndex)
+				ACTDecodeSpriteLayer(animation, cursor, layerIndex);
+			animation.frameEventIDs[frameIndex] = ACTReadInt32(cursor);
+
+			if(!ACTIsAtLeastVersion(animation, 3)) continue;
+			uint32 anchorCount = ACTReadCount(cursor);
+			for(uint32 anchorEnd = anchorIndex + anchorCount; anchorIndex < anchorEnd; ++anchorIndex) {
+				cursor += sizeof(int32); // Unknown
+				animation.anchorPositionsX[anchorIndex] = ACTReadInt32(cursor);
+				animation.anchorPositionsY[anchorIndex] = ACTReadInt32(cursor);
+				cursor += sizeof(int32); // Unknown
+			}
+		}
+	}
+	animation.clipFrameOffsets[animation.clipCount] = frameIndex;
+	animation.frameLayerOffsets[animation.frameCount] = layerIndex;
+	animation.frameAnchorOffsets[animation.frameCount] = anchorIndex;
+
+	// NOTE: Event names are mostly sound files, which must be transcoded to match the (UTF-8) paths stored in GRF archives
+	uint32 characterCount = 0;
+	if(ACTIsAtLeastVersion(animation, 1)) cursor += sizeof(int32);
+	for(uint32 eventIndex = 0; eventIndex < animation.eventCount; ++eventIndex) {
+		animation.eventNameOffsets[eventIndex] = characterCount;
+		uint8* transcodedName = (uint8*)animation.eventNameCharacters + characterCount;
+		size_t transcodedNameLength = TranscodeCP949ToUTF8(cursor, ACTGetStoredNameLength(cursor), transcodedName);
+		transcodedName[transcodedNameLength] = ASCII_NULL_TERMINATOR;
+		characterCount += (uint32)(transcodedNameLength + sizeof(ASCII_NULL_TERMINATOR));
+		cursor += ACT_EVENT_NAME_SIZE;
+	}
+	animation.eventNameOffsets[animation.eventCount] = characterCount;
+	animation.eventNameCharacterCount = characterCount;
+
+	for(uint32 clipIndex = 0; clipIndex < animation.clipCount; ++clipIndex) {
+		float ticksPerFrame = ACTIsAtLeastVersion(animation, 2) ? ACTReadFloat(cursor) : ACT_DEFAULT_TICKS_PER_FRAME;
+		animation.clipFrameTimes[clipIndex] = ACT_UPDATE_INTERVAL * ticksPerFrame;
+	}
+}
+
+INTERNAL inline uint32 ACTGetClipFrameCount(act_animation_t& animation, uint32 clipIndex) {
+	return animation.clipFrameOffsets[clipIndex + 1] - animation.clipFrameOffsets[clipIndex];
+}
+
+INTERNAL inline uint32 ACTGetFrameLayerCount(act_animation_t& animation, uint32 frameIndex) {
+	return animation.frameLayerOffsets[frameIndex + 1] - animation.frameLayerOffsets[frameIndex];
+}
+
+INTERNAL inline uint32 ACTGetFrameAnchorCount(act_animation_t& animation, uint32 frameIndex) {
+	return animation.frameAnchorOffsets[frameIndex + 1] - animation.frameAnchorOffsets[frameIndex];
+}
+
+INTERNAL inline String ACTGetEventName(act_animation_t& animation, uint32 eventIndex) {
+	uint32 offset = animation.eventNameOffsets[eventIndex];
+	size_t length = animation.eventNameOffsets[eventIndex + 1] - offset - sizeof(ASCII_NULL_TERMINATOR);
+	return StringCreateFromSlice((uint8*)animation.eventNameCharacters + offset, length);
+}
\ No newline at end of file
@@ -0,0 +1,328 @@
+// NOTE: Native counterpart of RagnarokGAT.lua - terrain flags are converted to bitsets (one bit per tile) when the map is loaded
+// Queries then test up to 32 tiles per instruction (or 128 with SSE2), instead of probing one tile record at a time
+constexpr char GAT_SIGNATURE[] = "GRAT";
+constexpr size_t GAT_HEADER_SIZE = 14; // Signature, version, and map dimensions
+constexpr uint8 GAT_SUPPORTED_MAJOR_VERSION = 1;
+constexpr uint8 GAT_MIN_SUPPORTED_MINOR_VERSION = 2;
+constexpr uint8 GAT_MAX_SUPPORTED_MINOR_VERSION = 3;
+constexpr uint32 GAT_MAX_MAP_SIZE = 4096; // The largest known maps are 512x512, so this leaves plenty of room
+constexpr uint16 GAT_OBSTRUCTED_TERRAIN_BITMASK = 0x01;
+constexpr uint16 GAT_SNIPABLE_TERRAIN_BITMASK = 0x02;
+constexpr uint16 GAT_WATER_TERRAIN_BITMASK = 0x04;
+constexpr float GAT_WORLD_UNITS_PER_TILE = 5.0f; // Half a GND surface
+constexpr int GAT_TILES_PER_WORD = 32;
+
+#pragma pack(push, 1)
+typedef struct gat_tile {
+	float altitudeSouthwest;
+	float altitudeSoutheast;
+	float altitudeNorthwest;
+	float altitudeNortheast;
+	uint16 terrainFlags;
+	uint16 renewalWaterFlag;
+} gat_tile_t;
+#pragma pack(pop)
+
+static_assert(sizeof(gat_tile_t) == 20, "GAT tiles must be tightly packed");
+
+typedef enum : uint8 {
+	GAT_WALKABLE_TILES,
+	GAT_WATER_TILES,
+	GAT_SNIPABLE_TILES, // Ranged attacks can pass (same as RagnarokGAT:IsTerrainBlockingRangedAttacks, but inverted)
+	GAT_TERRAIN_LAYER_COUNT,
+} gat_terrain_layer_t;
+
+// NOTE: Tile (x, y) is stored in bit x % 32 of word y * wordsPerRow + x / 32 - coordinates start at zero (unlike the Lua decoder's)
+// Rows are padded to whole words, and the padding bits are never set (so tiles past the right edge read as unset automatically)
+typedef struct gat_collision_map {
+	const uint8* bytes;
+	size_t size;
+	String errorMessage;
+	uint8 majorVersion;
+	uint8 minorVersion;
+	int width;
+	int height;
+	int wordsPerRow;
+	uint32* terrainLayers[GAT_TERRAIN_LAYER_COUNT];
+	int16* heights; // Average altitude of each tile, rounded to whole world units (positive is up, unlike in the file)
+} gat_collision_map_t;
+
+INTERNAL inline bool GATSetError(gat_collision_map_t& map, String message) {
+	map.errorMessage = message;
+	return false;
+}
+
+// Validates the header only - the tiles are decoded separately (after the caller has set aside enough memory)
+INTERNAL bool GATOpenCollisionMap(gat_collision_map_t& map, const uint8* bytes, size_t size) {
+	map = {};
+	map.bytes = bytes;
+	map.size = size;
+	map.errorMessage = StringLiteral("OK");
+
+	if(size < GAT_HEADER_SIZE) return GATSetError(map, StringLiteral("File is too small to be a GAT file"));
+	if(memcmp(bytes, GAT_SIGNATURE, sizeof(GAT_SIGNATURE) - 1) != 0) return GATSetError(map, StringLiteral("Signature should be \"GRAT\""));
+
+	map.majorVersion = bytes[4];
+	map.minorVersion = bytes[5];
+	bool isSupportedVersion = map.majorVersion == GAT_SUPPORTED_MAJOR_VERSION && map.minorVersion >= GAT_MIN_SUPPORTED_MINOR_VERSION
+		&& map.minorVersion <= GAT_MAX_SUPPORTED_MINOR_VERSION;
+	if(!isSupportedVersion) return GATSetError(map, StringLiteral("Unsupported GAT version (must be 1.2 or 1.3)"));
+
+	uint32 width;
+	uint32 height;
+	memcpy(&width, bytes + 6, sizeof(width));
+	memcpy(&height, bytes + 10, sizeof(height));
+	if(width > GAT_MAX_MAP_SIZE || height > GAT_MAX_MAP_SIZE) return GATSetError(map, StringLiteral("Map dimensions exceed the supported size"));
+
+	size_t tilesSize = (size_t)width * height * sizeof(gat_tile_t);
+	if(size - GAT_HEADER_SIZE < tilesSize) return GATSetError(map, StringLiteral("Unexpected end of file (collision map is truncated)"));
+	if(size - GAT_HEADER_SIZE > tilesSize) return GATSetError(map, StringLiteral("Detected leftover bytes at the end of the file"));
+
+	map.width = (int)width;
+	map.height = (int)height;
+	map.wordsPerRow = (map.width + GAT_TILES_PER_WORD - 1) / GAT_TILES_PER_WORD;
+	return true;
+}
+
+INTERNAL inline size_t GATGetTerrainLayerSize(gat_collision_map_t& map) {
+	return (size_t)map.wordsPerRow * map.height * sizeof(uint32);
+}
+
+INTERNAL inline size_t GATGetRequiredMemorySize(gat_collision_map_t& map) {
+	return GAT_TERRAIN_LAYER_COUNT * GATGetTerrainLayerSize(map) + (size_t)map.width * map.height * sizeof(int16);
+}
+
+INTERNAL inline int16 GATQuantizeAltitude(gat_tile_t& tile) {
+	float averageAltitude = (tile.altitudeSouthwest + tile.altitudeSoutheast + tile.altitudeNorthwest + tile.altitudeNortheast) / 4;
+	float height = ClampToInterval(-averageAltitude, (float)INT16_MIN, (float)INT16_MAX);
+	return (int16)((height < 0) ? height - 0.5f : height + 0.5f);
+}
+
+INTERNAL void GATDecodeCollisionMap(gat_collision_map_t& map, memory_arena_t& arena) {
+	ASSUME(ArenaCanAllocate(arena, GATGetRequiredMemorySize(map)), "Insufficient memory to decode the GAT collision map");
+
+	for(size_t layer = 0; layer < GAT_TERRAIN_LAYER_COUNT; ++layer) {
+		map.terrainLayers[layer] = (uint32*)ArenaAllocateMemoryRegion(arena, GATGetTerrainLayerSize(map));
+		memset(map.terrainLayers[layer], 0, GATGetTerrainLayerSize(map));
+	}
+	map.heights = (int16*)ArenaAllocateMemoryRegion(arena, (size_t)map.width * map.height * sizeof(int16));
+
+	const uint8* tiles = map.bytes + GAT_HEADER_SIZE;
+	for(int y = 0; y < map.height; ++y) {
+		for(int x = 0; x < map.width; ++x) {
+			size_t tileIndex = (size_t)y * map.width + x;
+			gat_tile_t tile;
+			memcpy(&tile, tiles + tileIndex * sizeof(gat_tile_t), sizeof(tile));
+			map.heights[tileIndex] = GATQuantizeAltitude(tile);
+
+			size_t wordIndex = (size_t)y * map.wordsPerRow + x / GAT_TILES_PER_WORD;
+			uint32 bit = 1u << (x % GAT_TILES_PER_WORD);
+			if(!(tile.terrainFlags & GAT_OBSTRUCTED_TERRAIN_BITMASK)) map.terrainLayers[GAT_WALKABLE_TILES][wordIndex] |= bit;
+			if(tile.terrainFlags & GAT_WATER_TERRAIN_BITMASK) map.terrainLayers[GAT_WATER_TILES][wordIndex] |= bit;
+			if(tile.terrainFlags & GAT_SNIPABLE_TERRAIN_BITMASK) map.terrainLayers[GAT_SNIPABLE_TILES][wordIndex] |= bit;
+		}
+	}
+}
+
+INTERNAL inline bool GATIsWithinBounds(gat_collision_map_t& map, int x, int y) {
+	return x >= 0 && y >= 0 && x < map.width && y < map.height;
+}
+
+INTERNAL inline const uint32* GATGetRowWords(gat_collision_map_t& map, gat_terrain_layer_t layer, int y) {
+	return map.terrainLayers[layer] + (size_t)y * map.wordsPerRow;
+}
+
+// NOTE: Tiles outside of the map are never walkable (or water, or snipable), so callers don't need to check the bounds themselves
+INTERNAL inline bool GATIsTileSet(gat_collision_map_t& map, gat_terrain_layer_t layer, int x, int y) {
+	if(!GATIsWithinBounds(map, x, y)) return false;
+	uint32 word = GATGetRowWords(map, layer, y)[x / GAT_TILES_PER_WORD];
+	return (word >> (x % GAT_TILES_PER_WORD)) & 1;
+}
+
+INTERNAL inline bool GATIsWalkable(gat_collision_map_t& map, int x, int y) {
+	return GATIsTileSet(map, GAT_WALKABLE_TILES, x, y);
+}
+
+INTERNAL inline bool GATIsWater(gat_collision_map_t& map, int x, int y) {
+	return GATIsTileSet(map, GAT_WATER_TILES, x, y);
+}
+
+INTERNAL inline bool GATIsTerrainBlockingRangedAttacks(gat_collision_map_t& map, int x, int y) {
+	return !GATIsTileSet(map, GAT_SNIPABLE_TILES, x, y);
+}
+
+INTERNAL inline int16 GATGetTileHeight(gat_collision_map_t& map, int x, int y) {
+	ASSUME(GATIsWithinBounds(map, x, y), "Attempted to query the height of a tile outside of the map");
+	return map.heights[(size_t)y * map.width + x];
+}
+
+// Returns the given number of consecutive tiles (at most 32), starting at (x, y) - tiles outside of the map are unset
+INTERNAL uint32 GATExtractRowBits(gat_collision_map_t& map, gat_terrain_layer_t layer, int x, int y, int count) {
+	ASSUME(count > 0 && count <= GAT_TILES_PER_WORD, "Can only extract up to one word at a time");
+	if(y < 0 || y >= map.height) return 0;
+
+	const uint32* row = GATGetRowWords(map, layer, y);
+	int wordIndex = x >> 5; // Rounds towards negative infinity (so that tiles left of the map still end up in word -1)
+	uint64 lowWord = (wordIndex >= 0 && wordIndex < map.wordsPerRow) ? row[wordIndex] : 0;
+	uint64 highWord = (wordIndex + 1 >= 0 && wordIndex + 1 < map.wordsPerRow) ? row[wordIndex + 1] : 0;
+	uint64 bits = (lowWord | (highWord << 32)) >> (x - wordIndex * GAT_TILES_PER_WORD);
+	uint64 mask = (count == GAT_TILES_PER_WORD) ? UINT32_MAX : (1u << count) - 1;
+	return (uint32)(bits & mask);
+}
+
+// Neighbors are stored in row-major order, skipping the tile itself: Bit 0 is (x - 1, y - 1), bit 3 is (x - 1, y), bit 7 is (x + 1, y + 1)
+INTERNAL uint8 GATGetNeighborMask(gat_collision_map_t& map, gat_terrain_layer_t layer, int x, int y) {
+	uint32 previousRow = GATExtractRowBits(map, layer, x - 1, y - 1, 3);
+	uint32 currentRow = GATExtractRowBits(map, layer, x - 1, y, 3);
+	uint32 nextRow = GATExtractRowBits(map, layer, x - 1, y + 1, 3);
+	return (uint8)(previousRow | (currentRow & 1) << 3 | (currentRow >> 2) << 4 | nextRow << 5);
+}
+
+// Shrinks the region to the part that overlaps the map (returns false if there isn't any)
+INTERNAL inline bool GATClipRegion(gat_collision_map_t& map, bitmap_rectangle_t& region) {
+	region.left = Max(region.left, 0);
+	region.top = Max(region.top, 0);
+	region.right = Min(region.right, map.width);
+	region.bottom = Min(region.bottom, map.height);
+	return region.left < region.right && region.top < region.bottom;
+}
+
+INTERNAL inline uint32 GATGetFirstWordMask(int left) {
+	return UINT32_MAX << (left % GAT_TILES_PER_WORD);
+}
+
+INTERNAL inline uint32 GATGetLastWordMask(int right) {
+	return UINT32_MAX >> (GAT_TILES_PER_WORD - 1 - (right - 1) % GAT_TILES_PER_WORD);
+}
+
+// NOTE: Rows are at most 128 words long, so SSE2 is more than enough here (AVX2 wouldn't save much, even for the largest maps)
+INTERNAL bool GATAreAllBitsSet(const uint32* words, int count) {
+	int index = 0;
+#ifdef RAGLITE_INTRINSICS_SSE2
+	__m128i allBits = _mm_set1_epi32(-1);
+	for(; index + 4 <= count; index += 4) {
+		__m128i block = _mm_loadu_si128((const __m128i*)(words + index));
+		if(_mm_movemask_epi8(_mm_cmpeq_epi32(block, allBits)) != 0xFFFF) return false;
+	}
+#endif
+	for(; index < count; ++index)
+		if(words[index] != UINT32_MAX) return false;
+	return true;
+}
+
+INTERNAL bool GATIsAnyBitSet(const uint32* words, int count) {
+	int index = 0;
+#ifdef RAGLITE_INTRINSICS_SSE2
+	__m128i combinedBits = _mm_setzero_si128();
+	for(; index + 4 <= count; index += 4)
+		combinedBits = _mm_or_si128(combinedBits, _mm_loadu_si128((const __m128i*)(words + index)));
+	if(_mm_movemask_epi8(_mm_cmpeq_epi32(combinedBits, _mm_setzero_si128())) != 0xFFFF) return true;
+#endif
+	for(; index < count; ++index)
+		if(words[index] != 0) return true;
+	return false;
+}
+
+// E.g., whether every tile that a large monster occupies is walkable (tiles outside of the map count as unset, and empty regions fail)
+INTERNAL bool GATAreAllTilesSet(gat_collision_map_t& map, gat_terrain_layer_t layer, bitmap_rectangle_t region) {
+	bool isWithinMap = region.left >= 0 && region.top >= 0 && region.right <= map.width && region.bottom <= map.height;
+	if(!isWithinMap || region.left >= region.right || region.top >= region.bottom) return false;
+
+	int firstWord = region.left / GAT_TILES_PER_WORD;
+	int lastWord = (region.right - 1) / GAT_TILES_PER_WORD;
+	uint32 firstMask = GATGetFirstWordMask(region.left);
+	uint32 lastMask = GATGetLastWordMask(region.right);
+	for(int y = region.top; y < region.bottom; ++y) {
+		const uint32* row = GATGetRowWords(map, layer, y);
+		if(firstWord == lastWord) {
+			uint32 mask = firstMask & lastMask;
+			if((row[firstWord] & mask) != mask) return false;
+			continue;
+		}
+
+		if((row[firstWord] & firstMask) != firstMask) return false;
+		if(!GATAreAllBitsSet(row + firstWord + 1, lastWord - firstWord - 1)) return false;
+		if((row[lastWord] & lastMask) != lastMask) return false;
+	}
+	return true;
+}
+
+// E.g., whether an area of effect touches any water (only the part of the region that overlaps the map is considered)
+INTERNAL bool GATIsAnyTileSet(gat_collision_map_t& map, gat_terrain_layer_t layer, bitmap_rectangle_t region) {
+	if(!GATClipRegion(map, region)) return false;
+
+	int firstWord = region.left / GAT_TILES_PER_WORD;
+	int lastWord = (region.right - 1) / GAT_TILES_PER_WORD;
+	uint32 firstMask = GATGetFirstWordMask(region.left);
+	uint32 lastMask = GATGetLastWordMask(region.right);
+	for(int y = region.top; y < region.bottom; ++y) {
+		const uint32* row = GATGetRowWords(map, layer, y);
+		if(firstWord == lastWord) {
+			if(row[firstWord] & firstMask & lastMask) return true;
+			continue;
+		}
+
+		if(row[firstWord] & firstMask) return true;
+		if(GATIsAnyBitSet(row + firstWord + 1, lastWord - firstWord - 1)) return true;
+		if(row[lastWord] & lastMask) return true;
+	}
+	return false;
+}
+
+// Scans [left, right) eastwards and returns the first unset tile, or right if there is none (e.g., how far a knockback can push)
+INTERNAL int GATFindFirstUnsetTileInRow(gat_collision_map_t& map, gat_terrain_layer_t layer, int y, int left, int right) {
+	if(left >= right) return right;
+	if(y < 0 || y >= map.height || left < 0 || left >= map.width) return left;
+
+	int scanEnd = Min(right, map.width);
+	const uint32* row = GATGetRowWords(map, layer, y);
+	for(int x = left; x < scanEnd;) {
+		int wordIndex = x / GAT_TILES_PER_WORD;
+		uint32 unsetBits = ~row[wordIndex] & GATGetFirstWordMask(x);
+		if(unsetBits != 0) return Min(wordIndex * GAT_TILES_PER_WORD + IntrinsicsFindLowestSetBit(unsetBits), right);
+		x = (wordIndex + 1) * GAT_TILES_PER_WORD;
+	}
+	return scanEnd; // Either the first tile past the right edge of the map (which is never set), or the end of the range
+}
+
+// Scans [left, right) westwards and returns the last unset tile, or left - 1 if there is none
+INTERNAL int GATFindLastUnsetTileInRow(gat_collision_map_t& map, gat_terrain_layer_t layer, int y, int left, int right) {
+	if(left >= right) return left - 1;
+	if(y < 0 || y >= map.height || right <= 0 || right > map.width) return right - 1;
+
+	int scanStart = Max(left, 0);
+	const uint32* row = GATGetRowWords(map, layer, y);
+	for(int x = right - 1; x >= scanStart;) {
+		int wordIndex = x / GAT_TILES_PER_WORD;
+		uint32 unsetBits = ~row[wordIndex] & GATGetLastWordMask(x + 1);
+		if(unsetBits != 0) return Max(wordIndex * GAT_TILES_PER_WORD + IntrinsicsFindHighestSetBit(unsetBits), left - 1);
+		x = wordIndex * GAT_TILES_PER_WORD - 1;
+	}
+	return scanStart - 1; // Either the first tile past the left edge of the map (which is never set), or the end of the range
+}
+
+// Walks the same tiles as Bresenham's algorithm, including both endpoints (e.g., whether a projectile's path is clear)
+INTERNAL bool GATAreAllTilesSetAlongLine(gat_collision_map_t& map, gat_terrain_layer_t layer, int startX, int startY, int endX, int endY) {
+	int deltaX = (endX > startX) ? endX - startX : startX - endX;
+	int deltaY = (endY > startY) ? startY - endY : endY - startY; // Negative
+	int stepX = (startX < endX) ? 1 : -1;
+	int stepY = (startY < endY) ? 1 : -1;
+	int error = deltaX + deltaY;
+
+	int x = startX;
+	int y = startY;
+	while(true) {
+		if(!GATIsTileSet(map, layer, x, y)) return false;
+		if(x == endX && y == endY) return true;
+
+		int doubledError = 2 * error;
+		if(doubledError >= deltaY) {
+			error += deltaY;
+			x += stepX;
+		}
+		if(doubledError <= deltaX) {
+			error += deltaX;
+			y += stepY;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,263 @@
+// NOTE: Read-only counterpart of RagnarokGRF.lua (the archive is expected to be mapped into memory as a whole)
+constexpr char GRF_MAGIC_HEADER[] = "Master of Magic";
+constexpr uint32 GRF_SCRAMBLING_OFFSET = 7; // Presumably, arbitrary constant (for obfusciation purposes?)
+constexpr uint32 GRF_SUPPORTED_MAJOR_VERSION = 2;
+constexpr uint8 GRF_RAW_FILE_ENTRY_TYPE = 0;
+constexpr uint8 GRF_COMPRESSED_FILE_ENTRY_TYPE = 1;
+constexpr size_t GRF_MAX_PATH_LENGTH = 512;
+
+#pragma pack(push, 1)
+typedef struct grf_header {
+	uint8 signature[15];
+	uint8 key[15];
+	uint32 fileTableOffset; // Relative to the end of the header
+	uint32 scramblingSeed;
+	uint32 fileCount;
+	uint32 version;
+} grf_header_t;
+
+typedef struct grf_file_table {
+	uint32 compressedSize;
+	uint32 decompressedSize;
+} grf_file_table_t;
+
+typedef struct grf_file_entry {
+	uint32 compressedSize;
+	uint32 byteAlignedSize; // Compressed, then padded to next 8 byte boundary?
+	uint32 decompressedSize;
+	uint8 nodeType;
+	uint32 offset; // Relative to the end of the header
+} grf_file_entry_t;
+#pragma pack(pop)
+
+constexpr size_t GRF_HEADER_SIZE = sizeof(grf_header_t);
+static_assert(GRF_HEADER_SIZE == 46, "The GRF header must be tightly packed");
+static_assert(sizeof(grf_file_entry_t) == 17, "GRF file entries must be tightly packed");
+
+typedef struct grf_entry {
+	string_id_t name;
+	uint32 compressedSize;
+	uint32 alignedSize;
+	uint32 decompressedSize;
+	uint32 offset; // Relative to the end of the header
+	uint8 type;
+	uint8 reserved[3]; // Explicit padding (so that serialized entries don't contain uninitialized bytes)
+} grf_entry_t;
+
+typedef struct grf_archive {
+	const uint8* bytes;
+	size_t size;
+	String errorMessage;
+	uint32 majorVersion;
+	uint32 minorVersion;
+	uint32 fileCount; // Decoded entries only (after the file table has been decoded)
+	uint32 skippedEntryCount; // Entries whose names are too long to be looked up, which aren't included in the file count
+	grf_file_table_t fileTable;
+	const uint8* compressedFileTable;
+	grf_entry_t* entries; // In the order they're stored in the file table
+	uint32* entryIndicesByName; // Indexed by string ID (duplicate paths resolve to the last entry, same as the Lua decoder)
+	string_intern_table_t fileNames;
+} grf_archive_t;
+
+INTERNAL inline bool GRFSetError(grf_archive_t& archive, String message) {
+	archive.errorMessage = message;
+	return false;
+}
+
+// Validates the header only - the file table is decoded separately (after the caller has set aside enough memory for it)
+INTERNAL bool GRFOpenArchive(grf_archive_t& archive, const uint8* bytes, size_t size) {
+	archive = {};
+	archive.bytes = bytes;
+	archive.size = size;
+	archive.errorMessage = StringLiteral("OK");
+
+	if(size < GRF_HEADER_SIZE + sizeof(grf_file_table_t)) return GRFSetError(archive, StringLiteral("File is too small to be a GRF archive"));
+
+	grf_header_t header;
+	memcpy(&header, bytes, sizeof(header));
+	if(memcmp(header.signature, GRF_MAGIC_HEADER, sizeof(header.signature)) != 0)
+		return GRFSetError(archive, StringLiteral("Signature should be \"Master of Magic\""));
+	// Unencrypted archives store an empty key (but there's no guarantee that the remaining bytes are zeroed out)
+	if(header.key[0] != ASCII_NULL_TERMINATOR) return GRFSetError(archive, StringLiteral("Encryption is not currently supported"));
+
+	archive.majorVersion = (header.version & 0xFF00) >> 8;
+	archive.minorVersion = header.version & 0xFF;
+	if(archive.majorVersion != GRF_SUPPORTED_MAJOR_VERSION) return GRFSetError(archive, StringLiteral("Only version 2.x archives are currently supported"));
+
+	// Naive scrambling algorithm? Or at least that's what I'm guessing is going on here...
+	uint64 scrambledFileCount = header.fileCount;
+	if(scrambledFileCount < (uint64)header.scramblingSeed + GRF_SCRAMBLING_OFFSET) return GRFSetError(archive, StringLiteral("Invalid file count"));
+	archive.fileCount = (uint32)(scrambledFileCount - header.scramblingSeed - GRF_SCRAMBLING_OFFSET);
+
+	size_t fileTableOffset = GRF_HEADER_SIZE + (size_t)header.fileTableOffset;
+	if(fileTableOffset + sizeof(grf_file_table_t) > size) return GRFSetError(archive, StringLiteral("File table starts past the end of the archive"));
+	memcpy(&archive.fileTable, bytes + fileTableOffset, sizeof(archive.fileTable));
+
+	archive.compressedFileTable = bytes + fileTableOffset + sizeof(grf_file_table_t);
+	if(archive.fileTable.compressedSize > size - fileTableOffset - sizeof(grf_file_table_t))
+		return GRFSetError(archive, StringLiteral("File table extends past the end of the archive"));
+
+	// NOTE: Every entry needs at least a NULL terminator and the fixed-size record, which bounds the memory required up front
+	constexpr size_t MIN_ENTRY_SIZE = sizeof(ASCII_NULL_TERMINATOR) + sizeof(grf_file_entry_t);
+	if(archive.fileCount > archive.fileTable.decompressedSize / MIN_ENTRY_SIZE)
+		return GRFSetError(archive, StringLiteral("File count exceeds what the file table can hold"));
+
+	return true;
+}
+
+// Worst case: Every byte of every name expands to three (when transcoding), plus one NULL terminator per name
+INTERNAL inline size_t GRFGetMaxNameCharacterCount(grf_archive_t& archive) {
+	size_t nameBytesCount = archive.fileTable.decompressedSize - archive.fileCount * (sizeof(ASCII_NULL_TERMINATOR) + sizeof(grf_file_entry_t));
+	return TranscodeGetMaxUTF8Length(nameBytesCount) + archive.fileCount * sizeof(ASCII_NULL_TERMINATOR);
+}
+
+INTERNAL inline size_t GRFGetRequiredMemorySize(grf_archive_t& archive) {
+	size_t entriesSize = archive.fileCount * sizeof(grf_entry_t);
+	size_t indicesSize = (archive.fileCount + 1) * sizeof(uint32);
+	return entriesSize + indicesSize + InternTableGetRequiredMemorySize(archive.fileCount, GRFGetMaxNameCharacterCount(archive));
+}
+
+// The decompressed table is only needed while decoding (it can be discarded afterwards)
+INTERNAL inline size_t GRFGetRequiredTransientMemorySize(grf_archive_t& archive) {
+	return archive.fileTable.decompressedSize;
+}
+
+// NOTE: Paths are stored as UTF-8, where every byte of a multi-byte character has the high bit set (so only ASCII letters are affected)
+INTERNAL inline void GRFNormalizeFileName(String& fileName) {
+	PathStringNormalizeInPlace(fileName);
+}
+
+INTERNAL bool GRFDecodeFileTable(grf_archive_t& archive, memory_arena_t& persistentStorage, memory_arena_t& transientStorage) {
+	ASSUME(ArenaCanAllocate(persistentStorage, GRFGetRequiredMemorySize(archive)), "Insufficient memory to store the GRF file table");
+	ASSUME(ArenaCanAllocate(transientStorage, GRFGetRequiredTransientMemorySize(archive)), "Insufficient memory to decompress the GRF file table");
+
+	uint8* decompressedTable = (uint8*)ArenaAllocateMemoryRegion(transientStorage, archive.fileTable.decompressedSize);
+	size_t decompressedSize = 0;
+	inflate_status_t status = InflateZlibStream(archive.compressedFileTable, archive.fileTable.compressedSize, decompressedTable,
+		archive.fileTable.decompressedSize, decompressedSize);
+	if(status != INFLATE_SUCCESS) return GRFSetError(archive, InflateStatusToString(status));
+
+	// NOTE: Fixed-size records are allocated first - the interned characters that follow them aren't aligned
+	archive.entries = (grf_entry_t*)ArenaAllocateMemoryRegion(persistentStorage, archive.fileCount * sizeof(grf_entry_t));
+	archive.entryIndicesByName = (uint32*)ArenaAllocateMemoryRegion(persistentStorage, (archive.fileCount + 1) * sizeof(uint32));
+	InternTableInitialize(archive.fileNames, persistentStorage, archive.fileCount, GRFGetMaxNameCharacterCount(archive));
+
+	uint8* cursor = decompressedTable;
+	uint8* end = decompressedTable + decompressedSize;
+	uint32 decodedEntryCount = 0;
+	for(uint32 index = 0; index < archive.fileCount; ++index) {
+		size_t remainingSize = end - cursor;
+		uint8* terminator = (uint8*)memchr(cursor, ASCII_NULL_TERMINATOR, remainingSize);
+		if(!terminator || (size_t)(end - terminator) < sizeof(ASCII_NULL_TERMINATOR) + sizeof(grf_file_entry_t))
+			return GRFSetError(archive, StringLiteral("File table ends in the middle of an entry"));
+
+		// Converting to a standardized format ASAP avoids crossplatform and encoding headaches
+		String fileName = StringCreateFromSlice(cursor, terminator - cursor);
+		cursor = terminator + sizeof(ASCII_NULL_TERMINATOR) + sizeof(grf_file_entry_t);
+
+		// NOTE: One broken entry shouldn't prevent all others from being accessed (lookups couldn't find it anyway, since the path is too long)
+		uint8 transcodedFileName[GRF_MAX_PATH_LENGTH * UTF8_MAX_BYTES_PER_CP949_BYTE];
+		if(!StringIsASCII(fileName)) {
+			if(fileName.length > GRF_MAX_PATH_LENGTH) {
+				archive.skippedEntryCount++;
+				continue;
+			}
+			fileName = StringCreateFromSlice(transcodedFileName, TranscodeCP949ToUTF8(fileName.bytes, fileName.length, transcodedFileName));
+		}
+		GRFNormalizeFileName(fileName);
+		// Transcoding may have made the name longer, and ASCII names were never checked (normalizing only ever shortens them)
+		if(fileName.length > GRF_MAX_PATH_LENGTH) {
+			archive.skippedEntryCount++;
+			continue;
+		}
+
+		grf_file_entry_t fileEntry;
+		memcpy(&fileEntry, terminator + sizeof(ASCII_NULL_TERMINATOR), sizeof(fileEntry));
+
+		string_id_t nameID = InternTableInsert(archive.fileNames, fileName);
+		uint32 entryIndex = decodedEntryCount++;
+		archive.entries[entryIndex] = {
+			.name = nameID,
+			.compressedSize = fileEntry.compressedSize,
+			.alignedSize = fileEntry.byteAlignedSize,
+			.decompressedSize = fileEntry.decompressedSize,
+			.offset = fileEntry.offset,
+			.type = fileEntry.nodeType,
+		};
+		archive.entryIndicesByName[nameID] = entryIndex;
+	}
+	archive.fileCount = decodedEntryCount;
+
+	return true;
+}
+
+INTERNAL inline String GRFGetEntryName(grf_archive_t& archive, grf_entry_t& entry) {
+	return InternTableGetString(archive.fileNames, entry.name);
+}
+
+// Accepts UTF-8 paths in any format (e.g., straight from a HTTP route) - returns NULL if there's no such entry
+INTERNAL grf_entry_t* GRFFindEntry(grf_archive_t& archive, String filePath) {
+	if(filePath.length > GRF_MAX_PATH_LENGTH) return NULL;
+
+	char normalizedPath[GRF_MAX_PATH_LENGTH];
+	memcpy(normalizedPath, filePath.buffer, filePath.length);
+	String normalizedFilePath = StringCreateFromSlice((uint8*)normalizedPath, filePath.length);
+	GRFNormalizeFileName(normalizedFilePath);
+
+	// HTTP route handlers may add this (it's unnecessary and not how GRF paths are stored)
+	if(normalizedFilePath.length > 0 && normalizedFilePath.buffer[0] == ASCII_FORWARD_SLASH) {
+		normalizedFilePath.buffer++;
+		normalizedFilePath.length--;
+	}
+
+	string_id_t nameID = InternTableFind(archive.fileNames, normalizedFilePath);
+	if(nameID == INVALID_STRING_ID) return NULL;
+	return &archive.entries[archive.entryIndicesByName[nameID]];
+}
+
+INTERNAL inline bool GRFIsFileEntry(grf_entry_t& entry) {
+	return entry.type == GRF_COMPRESSED_FILE_ENTRY_TYPE;
+}
+
+// Raw entries are returned as-is, including their alignment padding (same as the Lua decoder)
+INTERNAL inline size_t GRFGetExtractedSize(grf_entry_t& entry) {
+	return (entry.type == GRF_RAW_FILE_ENTRY_TYPE) ? entry.alignedSize : entry.decompressedSize;
+}
+
+// NOTE: Doesn't modify the archive (errors are reported via the message instead), so that workers may extract entries concurrently
+INTERNAL bool GRFExtractEntry(grf_archive_t& archive, grf_entry_t& entry, uint8* output, size_t outputCapacity, size_t& bytesWritten, String& errorMessage) {
+	ASSUME(outputCapacity >= GRFGetExtractedSize(entry), "Insufficient space to store the extracted GRF entry");
+	bytesWritten = 0;
+
+	size_t startOffset = GRF_HEADER_SIZE + (size_t)entry.offset;
+	if(startOffset > archive.size || entry.alignedSize > archive.size - startOffset) {
+		errorMessage = StringLiteral("Entry extends past the end of the archive");
+		return false;
+	}
+
+	// Padding is discarded by the decompressor (it stops after the final block)
+	const uint8* storedContents = archive.bytes + startOffset;
+	if(entry.type == GRF_RAW_FILE_ENTRY_TYPE) {
+		memcpy(output, storedContents, entry.alignedSize);
+		bytesWritten = entry.alignedSize;
+		return true;
+	}
+
+	if(entry.type != GRF_COMPRESSED_FILE_ENTRY_TYPE) {
+		errorMessage = StringLiteral("Encrypted entries are not currently supported");
+		return false;
+	}
+
+	inflate_status_t status = InflateZlibStream(storedContents, entry.alignedSize, output, entry.decompressedSize, bytesWritten);
+	if(status != INFLATE_SUCCESS) {
+		errorMessage = InflateStatusToString(status);
+		return false;
+	}
+
+	if(bytesWritten != entry.decompressedSize) {
+		errorMessage = StringLiteral("Decompressed size doesn't match the file table");
+		return false;
+	}
+
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,157 @@
+// NOTE: Streaming counterpart of RagnarokRGZ.lua - entries are decoded as the archive is inflated, so memory use doesn't depend on its size
+constexpr uint8 RGZ_DIRECTORY_ENTRY_TYPE = 'd';
+constexpr uint8 RGZ_FILE_ENTRY_TYPE = 'f';
+constexpr uint8 RGZ_END_ENTRY_TYPE = 'e';
+constexpr char RGZ_END_ENTRY_NAME[] = "end";
+constexpr size_t RGZ_MAX_NAME_LENGTH = 255; // Stored as uint8
+constexpr size_t RGZ_DEFAULT_WINDOW_SIZE = INFLATE_HISTORY_SIZE + 1024 * 1024;
+
+typedef struct rgz_entry {
+	String name; // UTF-8 (only valid until the next entry is decoded)
+	uint32 size;
+	uint8 type;
+} rgz_entry_t;
+
+typedef bool (*rgz_entry_fn)(void* context, rgz_entry_t& entry);
+// File contents are passed in chunks, in order - returning false aborts the decoding
+typedef bool (*rgz_contents_fn)(void* context, rgz_entry_t& entry, const uint8* contents, size_t size);
+
+// NOTE: Unused callbacks may be left as NULL (e.g., listing the contents only requires the entries themselves)
+typedef struct rgz_sink {
+	void* context;
+	rgz_entry_fn beginEntry;
+	rgz_contents_fn writeContents;
+	rgz_entry_fn endEntry;
+} rgz_sink_t;
+
+typedef struct rgz_archive {
+	inflate_stream_t stream;
+	const uint8* chunk;
+	size_t chunkSize;
+	size_t chunkOffset;
+	String errorMessage;
+	uint32 directoryCount;
+	uint32 fileCount;
+	uint64 totalFileSize;
+	uint8 transcodedName[RGZ_MAX_NAME_LENGTH * UTF8_MAX_BYTES_PER_CP949_BYTE + sizeof(ASCII_NULL_TERMINATOR)];
+} rgz_archive_t;
+
+INTERNAL inline bool RGZSetError(rgz_archive_t& archive, String message) {
+	archive.errorMessage = message;
+	return false;
+}
+
+// The window must be able to hold at least 2 * INFLATE_HISTORY_SIZE bytes (larger windows mean fewer, larger chunks)
+INTERNAL bool RGZOpenArchive(rgz_archive_t& archive, const uint8* bytes, size_t size, uint8* window, size_t windowSize) {
+	archive.chunk = NULL;
+	archive.chunkSize = 0;
+	archive.chunkOffset = 0;
+	archive.errorMessage = StringLiteral("OK");
+	archive.directoryCount = 0;
+	archive.fileCount = 0;
+	archive.totalFileSize = 0;
+
+	inflate_status_t status = InflateBeginGzipStream(archive.stream, bytes, size, window, windowSize);
+	if(status != INFLATE_SUCCESS) return RGZSetError(archive, InflateStatusToString(status));
+	return true;
+}
+
+// Only called while an entry is incomplete, so running out of data is always an error
+INTERNAL bool RGZFetchNextChunk(rgz_archive_t& archive) {
+	if(archive.chunkOffset < archive.chunkSize) return true;
+
+	inflate_status_t status = InflateReadNextChunk(archive.stream, archive.chunk, archive.chunkSize);
+	archive.chunkOffset = 0;
+	if(status != INFLATE_SUCCESS) return RGZSetError(archive, InflateStatusToString(status));
+	if(archive.chunkSize == 0) return RGZSetError(archive, StringLiteral("Unexpected end of the archive (entry is truncated)"));
+	return true;
+}
+
+// NOTE: Header fields may straddle two chunks, so they're always copied (file contents are passed on directly instead)
+INTERNAL bool RGZReadBytes(rgz_archive_t& archive, uint8* destination, size_t count) {
+	while(count > 0) {
+		if(!RGZFetchNextChunk(archive)) return false;
+
+		size_t copiedCount = Min(count, archive.chunkSize - archive.chunkOffset);
+		memcpy(destination, archive.chunk + archive.chunkOffset, copiedCount);
+		archive.chunkOffset += copiedCount;
+		destination += copiedCount;
+		count -= copiedCount;
+	}
+	return true;
+}
+
+INTERNAL bool RGZStreamFileContents(rgz_archive_t& archive, rgz_entry_t& entry, rgz_sink_t& sink) {
+	uint32 remainingSize = entry.size;
+	while(remainingSize > 0) {
+		if(!RGZFetchNextChunk(archive)) return false;
+
+		size_t contentsSize = Min((size_t)remainingSize, archive.chunkSize - archive.chunkOffset);
+		const uint8* contents = archive.chunk + archive.chunkOffset;
+		archive.chunkOffset += contentsSize;
+		remainingSize -= (uint32)contentsSize;
+
+		if(sink.writeContents && !sink.writeContents(sink.context, entry, contents, contentsSize))
+			return RGZSetError(archive, StringLiteral("Failed to store the file contents"));
+	}
+	return true;
+}
+
+// Decodes all entries up to (and including) the end marker, then verifies that the stream ends there as well
+INTERNAL bool RGZDecodeEntries(rgz_archive_t& archive, rgz_sink_t& sink) {
+	while(true) {
+		uint8 entryHeader[2];
+		if(!RGZReadBytes(archive, entryHeader, sizeof(entryHeader))) return false;
+
+		uint8 type = entryHeader[0];
+		uint8 nameLength = entryHeader[1];
+		if(type != RGZ_DIRECTORY_ENTRY_TYPE && type != RGZ_FILE_ENTRY_TYPE && type != RGZ_END_ENTRY_TYPE)
+			return RGZSetError(archive, StringLiteral("Invalid entry type (must be one of 'd', 'e', or 'f')"));
+		if(nameLength == 0) return RGZSetError(archive, StringLiteral("Invalid file name length 0"));
+
+		uint8 storedName[RGZ_MAX_NAME_LENGTH];
+		if(!RGZReadBytes(archive, storedName, nameLength)) return false;
+		// Same as GetNullTerminatedString: The name ends at the first null byte (if there is one)
+		const uint8* nullTerminator = (const uint8*)memchr(storedName, ASCII_NULL_TERMINATOR, nameLength);
+		size_t storedNameLength = nullTerminator ? nullTerminator - storedName : nameLength;
+
+		if(type == RGZ_END_ENTRY_TYPE) {
+			bool isValidEndMarker = storedNameLength == sizeof(RGZ_END_ENTRY_NAME) - 1
+				&& memcmp(storedName, RGZ_END_ENTRY_NAME, storedNameLength) == 0;
+			if(!isValidEndMarker) return RGZSetError(archive, StringLiteral("Unexpected file name for end-of-archive entry"));
+			break;
+		}
+
+		size_t transcodedNameLength = TranscodeCP949ToUTF8(storedName, storedNameLength, archive.transcodedName);
+		archive.transcodedName[transcodedNameLength] = ASCII_NULL_TERMINATOR;
+
+		rgz_entry_t entry = {
+			.name = StringCreateFromSlice(archive.transcodedName, transcodedNameLength),
+			.size = 0,
+			.type = type,
+		};
+		if(type == RGZ_FILE_ENTRY_TYPE) {
+			uint8 sizeBytes[sizeof(uint32)];
+			if(!RGZReadBytes(archive, sizeBytes, sizeof(sizeBytes))) return false;
+			entry.size = sizeBytes[0] | (sizeBytes[1] << 8) | (sizeBytes[2] << 16) | ((uint32)sizeBytes[3] << 24);
+		}
+
+		if(sink.beginEntry && !sink.beginEntry(sink.context, entry)) return RGZSetError(archive, StringLiteral("Failed to store the entry"));
+		if(type == RGZ_FILE_ENTRY_TYPE && !RGZStreamFileContents(archive, entry, sink)) return false;
+		if(sink.endEntry && !sink.endEntry(sink.context, entry)) return RGZSetError(archive, StringLiteral("Failed to store the entry"));
+
+		if(type == RGZ_FILE_ENTRY_TYPE) {
+			archive.fileCount++;
+			archive.totalFileSize += entry.size;
+		} else {
+			archive.directoryCount++;
+		}
+	}
+
+	// NOTE: Reading past the end also verifies the gzip trailer (checksum and size)
+	if(archive.chunkOffset < archive.chunkSize) return RGZSetError(archive, StringLiteral("Detected leftover bytes at the end of the archive"));
+	inflate_status_t status = InflateReadNextChunk(archive.stream, archive.chunk, archive.chunkSize);
+	if(status != INFLATE_SUCCESS) return RGZSetError(archive, InflateStatusToString(status));
+	if(archive.chunkSize > 0) return RGZSetError(archive, StringLiteral("Detected leftover bytes at the end of the archive"));
+	return true;
+}
\ No newline at end of file
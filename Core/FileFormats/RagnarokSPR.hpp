@@ -0,0 +1,273 @@
+// NOTE: Native counterpart of RagnarokSPR.lua - images are decoded straight into arena-backed bitmaps (same layout as offscreen buffers)
+constexpr char SPR_SIGNATURE[] = "SP";
+constexpr uint32 SPR_PALETTE_COLOR_COUNT = 256;
+constexpr size_t SPR_PALETTE_SIZE = SPR_PALETTE_COLOR_COUNT * sizeof(uint32);
+constexpr size_t SPR_BYTES_PER_PIXEL = sizeof(uint32);
+constexpr uint8 SPR_TRANSPARENT_COLOR_INDEX = 0;
+
+typedef struct spr_sprite_sheet {
+	const uint8* bytes;
+	size_t size;
+	String errorMessage;
+	uint8 majorVersion;
+	uint8 minorVersion;
+	uint16 indexedImageCount;
+	uint16 trueColorImageCount;
+	size_t pixelCount; // Across all images (determines how much memory is needed to decode them)
+	uint32 palette[SPR_PALETTE_COLOR_COUNT]; // BGRA, with the background color made transparent
+	offscreen_buffer_t* images; // Indexed-color bitmaps first, then the true-color ones (same order as in the file)
+} spr_sprite_sheet_t;
+
+INTERNAL inline bool SPRSetError(spr_sprite_sheet_t& sheet, String message) {
+	sheet.errorMessage = message;
+	return false;
+}
+
+INTERNAL inline bool SPRUsesRunLengthEncoding(spr_sprite_sheet_t& sheet) {
+	return sheet.majorVersion > 2 || (sheet.majorVersion == 2 && sheet.minorVersion >= 1);
+}
+
+INTERNAL inline uint16 SPRReadUnsignedInt16(const uint8* bytes) {
+	return (uint16)(bytes[0] | (bytes[1] << 8));
+}
+
+INTERNAL inline uint32 SPRGetImageCount(spr_sprite_sheet_t& sheet) {
+	return (uint32)sheet.indexedImageCount + sheet.trueColorImageCount;
+}
+
+// Signature, version, and image counts (the true-color image count was added in version 2.0)
+INTERNAL inline size_t SPRGetHeaderSize(spr_sprite_sheet_t& sheet) {
+	return (sheet.majorVersion >= 2) ? 4 + 2 * sizeof(uint16) : 4 + sizeof(uint16);
+}
+
+// Validates the header and the image sizes only - the pixels are decoded separately (after the caller has set aside enough memory)
+INTERNAL bool SPROpenSpriteSheet(spr_sprite_sheet_t& sheet, const uint8* bytes, size_t size) {
+	sheet = {};
+	sheet.bytes = bytes;
+	sheet.size = size;
+	sheet.errorMessage = StringLiteral("OK");
+
+	if(size < 4 + sizeof(uint16) + SPR_PALETTE_SIZE) return SPRSetError(sheet, StringLiteral("File is too small to be a SPR file"));
+	if(memcmp(bytes, SPR_SIGNATURE, sizeof(SPR_SIGNATURE) - 1) != 0) return SPRSetError(sheet, StringLiteral("Signature should be \"SP\""));
+
+	sheet.minorVersion = bytes[2];
+	sheet.majorVersion = bytes[3];
+	bool isSupportedVersion = (sheet.majorVersion == 1 && sheet.minorVersion == 1) || sheet.majorVersion >= 2;
+	if(!isSupportedVersion) return SPRSetError(sheet, StringLiteral("Unsupported SPR version"));
+
+	// NOTE: The palette can't overlap the header, or the remaining size (between the two) would underflow
+	size_t offset = SPRGetHeaderSize(sheet);
+	if(size < offset + SPR_PALETTE_SIZE) return SPRSetError(sheet, StringLiteral("File is too small to be a SPR file"));
+	sheet.indexedImageCount = SPRReadUnsignedInt16(bytes + 4);
+	if(sheet.majorVersion >= 2) sheet.trueColorImageCount = SPRReadUnsignedInt16(bytes + 6);
+
+	// NOTE: Every image must be skipped to find the next one, so the sizes might as well be validated here (so decoding can't fail later)
+	size_t paletteOffset = size - SPR_PALETTE_SIZE;
+	bool usesRunLengthEncoding = SPRUsesRunLengthEncoding(sheet);
+	for(uint32 index = 0; index < SPRGetImageCount(sheet); ++index) {
+		bool isIndexedImage = index < sheet.indexedImageCount;
+		size_t headerSize = (isIndexedImage && usesRunLengthEncoding) ? 3 * sizeof(uint16) : 2 * sizeof(uint16);
+		if(paletteOffset - offset < headerSize) return SPRSetError(sheet, StringLiteral("Image header exceeds the file size"));
+
+		size_t pixelCount = (size_t)SPRReadUnsignedInt16(bytes + offset) * SPRReadUnsignedInt16(bytes + offset + 2);
+		size_t storedSize = pixelCount;
+		if(!isIndexedImage) storedSize = pixelCount * SPR_BYTES_PER_PIXEL;
+		else if(usesRunLengthEncoding) storedSize = SPRReadUnsignedInt16(bytes + offset + 4);
+		offset += headerSize;
+
+		if(paletteOffset - offset < storedSize) return SPRSetError(sheet, StringLiteral("Image data exceeds the file size"));
+		offset += storedSize;
+		sheet.pixelCount += pixelCount;
+	}
+	if(offset != paletteOffset) return SPRSetError(sheet, StringLiteral("Detected leftover bytes before the color palette"));
+
+	// Stored as RGBA, but the alpha channel is unused: Only the background color (first entry) is transparent
+	const uint8* paletteColors = bytes + paletteOffset;
+	for(uint32 index = 0; index < SPR_PALETTE_COLOR_COUNT; ++index) {
+		const uint8* color = paletteColors + index * sizeof(uint32);
+		rgba_color_t paletteColor = {
+			.blue = color[2],
+			.green = color[1],
+			.red = color[0],
+			.alpha = (uint8)((index == SPR_TRANSPARENT_COLOR_INDEX) ? 0 : UINT8_MAX),
+		};
+		sheet.palette[index] = paletteColor.bytes;
+	}
+
+	return true;
+}
+
+INTERNAL inline size_t SPRGetRequiredMemorySize(spr_sprite_sheet_t& sheet) {
+	return SPRGetImageCount(sheet) * sizeof(offscreen_buffer_t) + sheet.pixelCount * SPR_BYTES_PER_PIXEL;
+}
+
+#ifdef RAGLITE_INTRINSICS_AVX2
+RAGLITE_TARGET_AVX2 INTERNAL size_t SPRFindZeroByteAVX2(const uint8* input, size_t length) {
+	size_t index = 0;
+	__m256i zeroes = _mm256_setzero_si256();
+	for(; index + 32 <= length; index += 32) {
+		__m256i bytes = _mm256_loadu_si256((const __m256i*)(input + index));
+		uint32 mask = (uint32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, zeroes));
+		if(mask != 0) return index; // The remaining loops will find the exact position
+	}
+	return index;
+}
+#endif
+
+// Returns the length of the literal run at the start of the input (i.e., the index of the first zero byte, if there is one)
+INTERNAL size_t SPRFindZeroByte(const uint8* input, size_t length) {
+	size_t index = 0;
+#ifdef RAGLITE_INTRINSICS_AVX2
+	if(IntrinsicsSupportsAVX2()) index = SPRFindZeroByteAVX2(input, length);
+#endif
+#ifdef RAGLITE_INTRINSICS_SSE2
+	__m128i zeroes = _mm_setzero_si128();
+	for(; index + 16 <= length; index += 16) {
+		__m128i bytes = _mm_loadu_si128((const __m128i*)(input + index));
+		uint32 mask = (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, zeroes));
+		if(mask != 0) return index + IntrinsicsFindLowestSetBit(mask);
+	}
+#endif
+	for(; index < length && input[index] != 0; ++index)
+		;
+	return index;
+}
+
+// NOTE: Only the background color is run-length encoded (a zero byte followed by the run length), so literal runs are copied as a whole
+// Images that decode to fewer pixels than expected are padded with the background color, but overflowing them is an error
+INTERNAL bool SPRDecodeRunLengthEncodedIndices(const uint8* input, size_t inputSize, uint8* output, size_t pixelCount, String& errorMessage) {
+	const uint8* inputEnd = input + inputSize;
+	uint8* destination = output;
+	uint8* outputEnd = output + pixelCount;
+
+	while(input < inputEnd) {
+		size_t literalLength = SPRFindZeroByte(input, inputEnd - input);
+		if(literalLength > (size_t)(outputEnd - destination)) {
+			errorMessage = StringLiteral("Run-length encoded data exceeds the image size");
+			return false;
+		}
+		memcpy(destination, input, literalLength);
+		destination += literalLength;
+		input += literalLength;
+		if(input == inputEnd) break;
+
+		// Same as the Lua decoder: A trailing zero byte (without a run length) is copied as-is
+		input++;
+		size_t runLength = (input < inputEnd) ? *input++ : 1;
+		if(runLength == 0) {
+			errorMessage = StringLiteral("Encountered zero-length run (not an RLE-encoded image?)");
+			return false;
+		}
+		if(runLength > (size_t)(outputEnd - destination)) {
+			errorMessage = StringLiteral("Run-length encoded data exceeds the image size");
+			return false;
+		}
+		memset(destination, SPR_TRANSPARENT_COLOR_INDEX, runLength);
+		destination += runLength;
+	}
+
+	memset(destination, SPR_TRANSPARENT_COLOR_INDEX, outputEnd - destination);
+	return true;
+}
+
+#ifdef RAGLITE_INTRINSICS_AVX2
+RAGLITE_TARGET_AVX2 INTERNAL size_t SPRApplyColorPaletteAVX2(const uint8* indices, size_t count, const uint32* palette, uint32* output) {
+	size_t index = 0;
+	for(; index + 16 <= count; index += 16) {
+		__m128i packedIndices = _mm_loadu_si128((const __m128i*)(indices + index));
+		__m256i lowIndices = _mm256_cvtepu8_epi32(packedIndices);
+		__m256i highIndices = _mm256_cvtepu8_epi32(_mm_srli_si128(packedIndices, 8));
+		__m256i lowColors = _mm256_i32gather_epi32((const int*)palette, lowIndices, sizeof(uint32));
+		__m256i highColors = _mm256_i32gather_epi32((const int*)palette, highIndices, sizeof(uint32));
+		_mm256_storeu_si256((__m256i*)(output + index), lowColors);
+		_mm256_storeu_si256((__m256i*)(output + index + 8), highColors);
+	}
+	return index;
+}
+#endif
+
+// NOTE: SSE2 lacks gathers (and a 256-entry table is too large for shuffles), so older CPUs use unrolled scalar lookups instead
+INTERNAL void SPRApplyColorPalette(const uint8* indices, size_t count, const uint32* palette, uint32* output) {
+	size_t index = 0;
+#ifdef RAGLITE_INTRINSICS_AVX2
+	if(IntrinsicsSupportsAVX2()) index = SPRApplyColorPaletteAVX2(indices, count, palette, output);
+#endif
+	for(; index + 4 <= count; index += 4) {
+		output[index + 0] = palette[indices[index + 0]];
+		output[index + 1] = palette[indices[index + 1]];
+		output[index + 2] = palette[indices[index + 2]];
+		output[index + 3] = palette[indices[index + 3]];
+	}
+	for(; index < count; ++index)
+		output[index] = palette[indices[index]];
+}
+
+// True-color images are stored as ABGR, which only differs from BGRA by one byte (so rotating each pixel is enough)
+INTERNAL void SPRConvertTrueColorPixels(const uint8* input, size_t pixelCount, uint32* output) {
+	size_t index = 0;
+#ifdef RAGLITE_INTRINSICS_SSE2
+	for(; index + 4 <= pixelCount; index += 4) {
+		__m128i pixels = _mm_loadu_si128((const __m128i*)(input + index * sizeof(uint32)));
+		__m128i rotatedPixels = _mm_or_si128(_mm_srli_epi32(pixels, 8), _mm_slli_epi32(pixels, 24));
+		_mm_storeu_si128((__m128i*)(output + index), rotatedPixels);
+	}
+#endif
+	for(; index < pixelCount; ++index) {
+		uint32 pixel;
+		memcpy(&pixel, input + index * sizeof(uint32), sizeof(pixel));
+		output[index] = (pixel >> 8) | (pixel << 24);
+	}
+}
+
+INTERNAL offscreen_buffer_t SPRAllocateBitmap(memory_arena_t& arena, int width, int height) {
+	offscreen_buffer_t bitmap = {
+		.width = width,
+		.height = height,
+		.bytesPerPixel = (int)SPR_BYTES_PER_PIXEL,
+		.stride = width * (int)SPR_BYTES_PER_PIXEL,
+		.pixelBuffer = ArenaAllocateMemoryRegion(arena, (size_t)width * height * SPR_BYTES_PER_PIXEL),
+	};
+	return bitmap;
+}
+
+// NOTE: Indexed pixels are first decoded into the end of each bitmap's own buffer, then expanded in place (front to back, which is safe)
+INTERNAL bool SPRDecodeImages(spr_sprite_sheet_t& sheet, memory_arena_t& arena) {
+	ASSUME(ArenaCanAllocate(arena, SPRGetRequiredMemorySize(sheet)), "Insufficient memory to decode the SPR images");
+
+	sheet.images = (offscreen_buffer_t*)ArenaAllocateMemoryRegion(arena, SPRGetImageCount(sheet) * sizeof(offscreen_buffer_t));
+	size_t offset = SPRGetHeaderSize(sheet);
+	bool usesRunLengthEncoding = SPRUsesRunLengthEncoding(sheet);
+	for(uint32 index = 0; index < SPRGetImageCount(sheet); ++index) {
+		int width = SPRReadUnsignedInt16(sheet.bytes + offset);
+		int height = SPRReadUnsignedInt16(sheet.bytes + offset + 2);
+		offset += 2 * sizeof(uint16);
+
+		offscreen_buffer_t& image = sheet.images[index];
+		image = SPRAllocateBitmap(arena, width, height);
+		uint32* pixels = (uint32*)image.pixelBuffer;
+		size_t pixelCount = (size_t)width * height;
+
+		if(index >= sheet.indexedImageCount) {
+			SPRConvertTrueColorPixels(sheet.bytes + offset, pixelCount, pixels);
+			offset += pixelCount * SPR_BYTES_PER_PIXEL;
+			continue;
+		}
+
+		const uint8* paletteIndices = sheet.bytes + offset;
+		if(usesRunLengthEncoding) {
+			size_t compressedSize = SPRReadUnsignedInt16(sheet.bytes + offset);
+			offset += sizeof(uint16);
+
+			uint8* decodedIndices = (uint8*)(pixels + pixelCount) - pixelCount;
+			if(!SPRDecodeRunLengthEncodedIndices(sheet.bytes + offset, compressedSize, decodedIndices, pixelCount, sheet.errorMessage)) return false;
+			paletteIndices = decodedIndices;
+			offset += compressedSize;
+		} else {
+			offset += pixelCount;
+		}
+
+		SPRApplyColorPalette(paletteIndices, pixelCount, sheet.palette, pixels);
+	}
+
+	return true;
+}
\ No newline at end of file
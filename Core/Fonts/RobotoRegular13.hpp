@@ -0,0 +1,310 @@
+// Generated by Tools/FontBaker.cpp from Core/NativeClient/Assets/Fonts/Roboto-Regular.ttf (13 px, printable ASCII only)
+// NOTE: Glyph outlines are licensed under the Apache License, Version 2.0 (see Roboto-LICENSE.txt)
+GLOBAL const uint8 ROBOTO_REGULAR_13PX_COVERAGE[] = {
+	0x41, 0xE4, 0xE4, 0xE4, 0xD4, 0xD4, 0xD3, 0x51, 0x31, 0xE5, 0x10, 0x18, 0x56, 0x2B, 0x77, 0x2A,
+	0x75, 0x13, 0x22, 0x00, 0x02, 0x20, 0x30, 0x00, 0x09, 0x50, 0xD0, 0x00, 0x0C, 0x23, 0xB0, 0x07,
+	0x9E, 0x9B, 0xD8, 0x03, 0x6C, 0x4B, 0x73, 0x00, 0x58, 0x0C, 0x20, 0x28, 0xBA, 0x8E, 0x83, 0x16,
+	0xD7, 0x8C, 0x62, 0x00, 0xD0, 0x58, 0x00, 0x02, 0xC0, 0x85, 0x00, 0x00, 0x08, 0x30, 0x00, 0x00,
+	0x2C, 0x70, 0x00, 0x05, 0xEA, 0xDC, 0x10, 0x0D, 0x60, 0x0D, 0x60, 0x0E, 0x50, 0x06, 0x50, 0x08,
+	0xD5, 0x10, 0x00, 0x00, 0x6D, 0xE7, 0x00, 0x00, 0x00, 0x4E, 0x50, 0x3A, 0x00, 0x09, 0x90, 0x1F,
+	0x40, 0x1D, 0x70, 0x06, 0xEE, 0xFA, 0x10, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x04, 0x10, 0x00, 0x02,
+	0x52, 0x00, 0x00, 0x00, 0x1D, 0x6C, 0x30, 0x20, 0x00, 0x59, 0x07, 0x60, 0xC2, 0x00, 0x4A, 0x08,
+	0x67, 0x70, 0x00, 0x09, 0xCA, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xB3, 0x12, 0x00, 0x00, 0x05, 0x96,
+	0xCB, 0x70, 0x00, 0x1C, 0x1C, 0x20, 0xD0, 0x00, 0x95, 0x0C, 0x20, 0xD0, 0x00, 0x10, 0x05, 0xCB,
+	0x70, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x25, 0x40, 0x00, 0x00, 0x03, 0xEA, 0xD8, 0x00, 0x00,
+	0x09, 0x90, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x9A, 0x00, 0x00, 0x01, 0xDD, 0xA1, 0x00, 0x00, 0x04,
+	0xEE, 0x40, 0x22, 0x00, 0x2E, 0x45, 0xE3, 0xA7, 0x00, 0x5D, 0x00, 0x7D, 0xE3, 0x00, 0x2F, 0x30,
+	0x1D, 0xD0, 0x00, 0x06, 0xED, 0xE9, 0xB9, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x47, 0x59, 0x68,
+	0x22, 0x00, 0x02, 0x00, 0x00, 0x3C, 0x10, 0x00, 0xD3, 0x00, 0x06, 0xA0, 0x00, 0x0C, 0x50, 0x00,
+	0x0F, 0x20, 0x00, 0x2F, 0x10, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x0E, 0x30, 0x00, 0x09,
+	0x70, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x97, 0x00, 0x00, 0x0A, 0x10, 0x20, 0x00, 0x79, 0x00, 0x0B,
+	0x50, 0x04, 0xD0, 0x00, 0xE3, 0x00, 0xB7, 0x00, 0x98, 0x00, 0x89, 0x00, 0xA8, 0x00, 0xC5, 0x01,
+	0xE1, 0x07, 0xA0, 0x2D, 0x20, 0x83, 0x00, 0x00, 0x31, 0x00, 0x00, 0xA4, 0x00, 0x76, 0xA6, 0x72,
+	0x49, 0xFD, 0x82, 0x07, 0xBD, 0x10, 0x0C, 0x17, 0x70, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x00,
+	0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x7E, 0xEF, 0xEE, 0xB0, 0x12, 0x2E, 0x52, 0x20,
+	0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x15, 0x3E, 0x6B, 0x73,
+	0x46, 0x62, 0x68, 0x83, 0x04, 0x10, 0x1F, 0x50, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x05, 0xA0,
+	0x00, 0x0A, 0x50, 0x00, 0x1D, 0x00, 0x00, 0x78, 0x00, 0x00, 0xD2, 0x00, 0x04, 0xC0, 0x00, 0x09,
+	0x60, 0x00, 0x1E, 0x10, 0x00, 0x69, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x25, 0x40, 0x00, 0x06,
+	0xEA, 0xCB, 0x00, 0x0E, 0x40, 0x1E, 0x40, 0x3E, 0x00, 0x0A, 0x70, 0x4D, 0x00, 0x09, 0x80, 0x4D,
+	0x00, 0x09, 0x80, 0x4E, 0x00, 0x09, 0x80, 0x2F, 0x00, 0x0B, 0x70, 0x0D, 0x60, 0x2E, 0x30, 0x04,
+	0xDD, 0xE7, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x02, 0x38, 0xE9, 0xC8, 0xA9, 0x00, 0x89, 0x00,
+	0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0x35, 0x40, 0x00, 0x09,
+	0xD9, 0xCB, 0x00, 0x4E, 0x10, 0x1E, 0x50, 0x36, 0x00, 0x0C, 0x50, 0x00, 0x00, 0x3E, 0x10, 0x00,
+	0x01, 0xD6, 0x00, 0x00, 0x1C, 0x80, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x4F,
+	0xEE, 0xEE, 0xB0, 0x00, 0x36, 0x40, 0x00, 0x09, 0xD9, 0xDA, 0x00, 0x3E, 0x10, 0x1E, 0x30, 0x12,
+	0x00, 0x0E, 0x40, 0x00, 0x13, 0x8C, 0x00, 0x00, 0x6C, 0xE7, 0x00, 0x00, 0x00, 0x2E, 0x40, 0x25,
+	0x00, 0x0B, 0x70, 0x3E, 0x20, 0x2E, 0x40, 0x07, 0xED, 0xE7, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x23, 0x00, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x0A, 0xDB, 0x00, 0x00, 0x4C, 0x7B, 0x00, 0x01,
+	0xD3, 0x7B, 0x00, 0x09, 0x80, 0x7B, 0x00, 0x4E, 0x32, 0x8C, 0x20, 0x9D, 0xDD, 0xEF, 0xD0, 0x00,
+	0x00, 0x7B, 0x00, 0x00, 0x00, 0x7B, 0x00, 0x01, 0x44, 0x44, 0x20, 0x04, 0xEC, 0xCC, 0x60, 0x06,
+	0xA0, 0x00, 0x00, 0x08, 0x90, 0x00, 0x00, 0x09, 0xDF, 0xF9, 0x00, 0x05, 0x61, 0x3D, 0x70, 0x00,
+	0x00, 0x07, 0xB0, 0x07, 0x10, 0x06, 0xB0, 0x0C, 0x70, 0x1C, 0x80, 0x03, 0xCD, 0xEA, 0x10, 0x00,
+	0x02, 0x10, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x6E, 0xC4, 0x00, 0x05, 0xE3, 0x00, 0x00, 0x0C,
+	0x50, 0x00, 0x00, 0x1F, 0xAE, 0xE9, 0x00, 0x2F, 0x80, 0x2D, 0x60, 0x3F, 0x00, 0x08, 0xA0, 0x1F,
+	0x20, 0x08, 0xA0, 0x0B, 0x90, 0x1D, 0x60, 0x02, 0xCE, 0xE9, 0x00, 0x00, 0x01, 0x10, 0x00, 0x24,
+	0x44, 0x44, 0x30, 0x6B, 0xBB, 0xBD, 0xA0, 0x00, 0x00, 0x0D, 0x40, 0x00, 0x00, 0x5C, 0x00, 0x00,
+	0x00, 0xC5, 0x00, 0x00, 0x04, 0xD0, 0x00, 0x00, 0x0B, 0x70, 0x00, 0x00, 0x3E, 0x10, 0x00, 0x00,
+	0xA9, 0x00, 0x00, 0x02, 0xF2, 0x00, 0x00, 0x00, 0x25, 0x40, 0x00, 0x07, 0xEA, 0xCB, 0x00, 0x0E,
+	0x40, 0x1E, 0x40, 0x1F, 0x20, 0x0D, 0x50, 0x09, 0xB4, 0x8D, 0x10, 0x04, 0xEB, 0xE8, 0x00, 0x1E,
+	0x30, 0x1D, 0x50, 0x4D, 0x00, 0x09, 0x80, 0x2F, 0x40, 0x1D, 0x60, 0x06, 0xED, 0xE9, 0x00, 0x00,
+	0x02, 0x10, 0x00, 0x00, 0x35, 0x30, 0x00, 0x08, 0xDA, 0xE7, 0x00, 0x2F, 0x20, 0x3F, 0x20, 0x5C,
+	0x00, 0x0C, 0x60, 0x5D, 0x00, 0x0B, 0x70, 0x1E, 0x71, 0x6F, 0x60, 0x04, 0xCD, 0x8C, 0x50, 0x00,
+	0x00, 0x2E, 0x10, 0x00, 0x03, 0xC8, 0x00, 0x01, 0xFC, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
+	0x30, 0x06, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1F, 0x40, 0x01, 0x00, 0x3D,
+	0x10, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2F, 0x00, 0x4D, 0x00, 0x64,
+	0x00, 0x00, 0x01, 0x78, 0x01, 0x8E, 0xB4, 0x6E, 0x92, 0x00, 0x4D, 0xB5, 0x00, 0x00, 0x5B, 0xE6,
+	0x00, 0x00, 0x36, 0x03, 0x33, 0x33, 0x10, 0x1C, 0xCC, 0xCC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x88, 0x88, 0x20, 0x07, 0x77, 0x77, 0x20, 0x2A, 0x40, 0x00, 0x00, 0x07, 0xDC, 0x50, 0x00, 0x00,
+	0x04, 0xAD, 0x20, 0x00, 0x28, 0xDA, 0x20, 0x1B, 0xE9, 0x20, 0x00, 0x17, 0x10, 0x00, 0x00, 0x01,
+	0x55, 0x10, 0x2D, 0xCB, 0xE3, 0x6B, 0x00, 0xA8, 0x00, 0x00, 0x98, 0x00, 0x04, 0xE3, 0x00, 0x3E,
+	0x50, 0x00, 0x99, 0x00, 0x00, 0x42, 0x00, 0x00, 0x21, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x05, 0xCC, 0xCD, 0x81, 0x00, 0x00, 0x8A, 0x10, 0x00,
+	0x6C, 0x00, 0x04, 0xB0, 0x02, 0x41, 0x06, 0x70, 0x0B, 0x30, 0x5C, 0x9D, 0x11, 0xC0, 0x1D, 0x01,
+	0xD1, 0x0E, 0x00, 0xC0, 0x3B, 0x05, 0xA0, 0x1D, 0x00, 0xC1, 0x4A, 0x07, 0x80, 0x2C, 0x00, 0xC0,
+	0x3B, 0x07, 0x90, 0x7C, 0x03, 0xA0, 0x0D, 0x12, 0xEC, 0x8C, 0xAB, 0x20, 0x08, 0x70, 0x01, 0x00,
+	0x20, 0x00, 0x01, 0xC8, 0x10, 0x03, 0x00, 0x00, 0x00, 0x07, 0xBC, 0xC8, 0x00, 0x00, 0x00, 0x01,
+	0x30, 0x00, 0x00, 0x00, 0x09, 0xF1, 0x00, 0x00, 0x00, 0x0E, 0xC7, 0x00, 0x00, 0x00, 0x5C, 0x5C,
+	0x00, 0x00, 0x00, 0xB6, 0x0E, 0x30, 0x00, 0x02, 0xF1, 0x09, 0x90, 0x00, 0x07, 0xD7, 0x79, 0xE0,
+	0x00, 0x0D, 0xA8, 0x88, 0xD5, 0x00, 0x4E, 0x10, 0x00, 0x7B, 0x00, 0x99, 0x00, 0x00, 0x2F, 0x20,
+	0x44, 0x43, 0x10, 0x00, 0xEC, 0xBC, 0xE7, 0x00, 0xE5, 0x00, 0x4F, 0x10, 0xE5, 0x00, 0x2F, 0x10,
+	0xE8, 0x55, 0xC9, 0x00, 0xEC, 0xAA, 0xD7, 0x00, 0xE5, 0x00, 0x1F, 0x30, 0xE5, 0x00, 0x0D, 0x50,
+	0xE5, 0x00, 0x6F, 0x20, 0xEF, 0xFF, 0xC5, 0x00, 0x00, 0x04, 0x64, 0x00, 0x01, 0xCD, 0xAD, 0xC1,
+	0x0A, 0xA0, 0x00, 0xC8, 0x1F, 0x30, 0x00, 0x59, 0x3F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00,
+	0x3F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x6B, 0x08, 0xC1, 0x02, 0xD6, 0x00, 0x9E, 0xDE, 0x80,
+	0x00, 0x01, 0x20, 0x00, 0x44, 0x42, 0x00, 0x00, 0xEC, 0xBD, 0xD3, 0x00, 0xE5, 0x00, 0x6E, 0x20,
+	0xE5, 0x00, 0x0B, 0x80, 0xE5, 0x00, 0x07, 0xB0, 0xE5, 0x00, 0x07, 0xB0, 0xE5, 0x00, 0x08, 0xA0,
+	0xE5, 0x00, 0x0C, 0x70, 0xE5, 0x02, 0xAD, 0x10, 0xEF, 0xFE, 0x91, 0x00, 0x44, 0x44, 0x43, 0xEC,
+	0xBB, 0xBA, 0xE5, 0x00, 0x00, 0xE5, 0x00, 0x00, 0xE7, 0x44, 0x41, 0xEC, 0xBB, 0xB4, 0xE5, 0x00,
+	0x00, 0xE5, 0x00, 0x00, 0xE5, 0x00, 0x00, 0xEF, 0xFF, 0xFE, 0x44, 0x44, 0x43, 0xEC, 0xBB, 0xB9,
+	0xE5, 0x00, 0x00, 0xE5, 0x00, 0x00, 0xE5, 0x11, 0x10, 0xEE, 0xEE, 0xE3, 0xE5, 0x00, 0x00, 0xE5,
+	0x00, 0x00, 0xE5, 0x00, 0x00, 0xE5, 0x00, 0x00, 0x00, 0x04, 0x64, 0x00, 0x02, 0xCC, 0xAD, 0xC1,
+	0x0B, 0xA0, 0x00, 0xB9, 0x1F, 0x30, 0x00, 0x36, 0x3F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x49, 0x98,
+	0x3F, 0x10, 0x26, 0x9D, 0x0E, 0x50, 0x00, 0x5D, 0x07, 0xD2, 0x00, 0x7D, 0x00, 0x7E, 0xDE, 0xC4,
+	0x00, 0x00, 0x21, 0x00, 0x41, 0x00, 0x00, 0x41, 0xE5, 0x00, 0x01, 0xF3, 0xE5, 0x00, 0x01, 0xF3,
+	0xE5, 0x00, 0x01, 0xF3, 0xE7, 0x44, 0x44, 0xF3, 0xEC, 0xBB, 0xBB, 0xF3, 0xE5, 0x00, 0x01, 0xF3,
+	0xE5, 0x00, 0x01, 0xF3, 0xE5, 0x00, 0x01, 0xF3, 0xE5, 0x00, 0x01, 0xF3, 0x31, 0xC6, 0xC6, 0xC6,
+	0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00,
+	0x1F, 0x30, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00,
+	0x1F, 0x30, 0x55, 0x00, 0x1F, 0x20, 0x7D, 0x10, 0x7E, 0x00, 0x1A, 0xEE, 0xD4, 0x00, 0x00, 0x12,
+	0x00, 0x00, 0x41, 0x00, 0x03, 0x30, 0xE5, 0x00, 0x4E, 0x40, 0xE5, 0x03, 0xE5, 0x00, 0xE5, 0x2E,
+	0x70, 0x00, 0xE6, 0xD8, 0x00, 0x00, 0xEE, 0xEB, 0x00, 0x00, 0xEA, 0x1D, 0x80, 0x00, 0xE5, 0x03,
+	0xF4, 0x00, 0xE5, 0x00, 0x7E, 0x20, 0xE5, 0x00, 0x0A, 0xB0, 0x41, 0x00, 0x00, 0xE5, 0x00, 0x00,
+	0xE5, 0x00, 0x00, 0xE5, 0x00, 0x00, 0xE5, 0x00, 0x00, 0xE5, 0x00, 0x00, 0xE5, 0x00, 0x00, 0xE5,
+	0x00, 0x00, 0xE5, 0x00, 0x00, 0xEF, 0xFF, 0xFA, 0x43, 0x00, 0x00, 0x01, 0x41, 0xEE, 0x00, 0x00,
+	0x09, 0xF4, 0xEE, 0x50, 0x00, 0x1E, 0xE4, 0xE9, 0xB0, 0x00, 0x6B, 0xD4, 0xE5, 0xE2, 0x00, 0xC5,
+	0xD4, 0xE4, 0x98, 0x03, 0xE0, 0xE4, 0xE5, 0x3E, 0x09, 0x80, 0xE4, 0xE5, 0x0C, 0x6E, 0x20, 0xE4,
+	0xE5, 0x06, 0xEB, 0x00, 0xE4, 0xE5, 0x01, 0xE5, 0x00, 0xE4, 0x41, 0x00, 0x00, 0x41, 0xEC, 0x00,
+	0x01, 0xF3, 0xEF, 0x70, 0x01, 0xF3, 0xE9, 0xE2, 0x01, 0xF3, 0xE5, 0xAB, 0x01, 0xF3, 0xE5, 0x1E,
+	0x61, 0xF3, 0xE5, 0x05, 0xE3, 0xF3, 0xE5, 0x00, 0xAB, 0xF3, 0xE5, 0x00, 0x1E, 0xF3, 0xE5, 0x00,
+	0x06, 0xF3, 0x00, 0x04, 0x63, 0x00, 0x00, 0x01, 0xCD, 0xAD, 0xB1, 0x00, 0x0A, 0xB0, 0x00, 0xB9,
+	0x00, 0x1F, 0x30, 0x00, 0x4E, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x20, 0x4E, 0x00, 0x00, 0x0F, 0x30,
+	0x3F, 0x00, 0x00, 0x1F, 0x20, 0x0E, 0x40, 0x00, 0x5E, 0x00, 0x08, 0xD2, 0x02, 0xD7, 0x00, 0x00,
+	0x8E, 0xEE, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x44, 0x44, 0x20, 0x00, 0xEC, 0xBB, 0xEB,
+	0x10, 0xE5, 0x00, 0x1C, 0x80, 0xE5, 0x00, 0x08, 0xA0, 0xE5, 0x00, 0x0B, 0x90, 0xEB, 0x99, 0xCD,
+	0x20, 0xE9, 0x66, 0x40, 0x00, 0xE5, 0x00, 0x00, 0x00, 0xE5, 0x00, 0x00, 0x00, 0xE5, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x63, 0x00, 0x00, 0x02, 0xCD, 0xAE, 0xB1, 0x00, 0x0B, 0xA0, 0x01, 0xC8, 0x00,
+	0x2F, 0x20, 0x00, 0x5E, 0x00, 0x4E, 0x00, 0x00, 0x2F, 0x20, 0x5E, 0x00, 0x00, 0x1F, 0x20, 0x4E,
+	0x00, 0x00, 0x2F, 0x10, 0x1F, 0x30, 0x00, 0x6D, 0x00, 0x08, 0xC2, 0x03, 0xD6, 0x00, 0x00, 0x9E,
+	0xEF, 0xC0, 0x00, 0x00, 0x01, 0x23, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x44, 0x43, 0x10,
+	0x00, 0xEC, 0xBC, 0xE8, 0x00, 0xE5, 0x00, 0x3F, 0x30, 0xE5, 0x00, 0x0D, 0x50, 0xE5, 0x00, 0x3F,
+	0x30, 0xEC, 0xBC, 0xE7, 0x00, 0xE7, 0x48, 0xD0, 0x00, 0xE5, 0x00, 0xD7, 0x00, 0xE5, 0x00, 0x5E,
+	0x10, 0xE5, 0x00, 0x0C, 0x80, 0x00, 0x25, 0x51, 0x00, 0x07, 0xEA, 0xAE, 0x50, 0x2F, 0x30, 0x04,
+	0xE1, 0x2F, 0x20, 0x00, 0x71, 0x0A, 0xD6, 0x10, 0x00, 0x00, 0x6C, 0xFB, 0x20, 0x00, 0x00, 0x2A,
+	0xD0, 0x58, 0x00, 0x00, 0xF3, 0x3E, 0x40, 0x05, 0xF1, 0x05, 0xDE, 0xED, 0x50, 0x00, 0x01, 0x20,
+	0x00, 0x34, 0x44, 0x44, 0x42, 0x8B, 0xBE, 0xDB, 0xB5, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0x80,
+	0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0x80,
+	0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x04, 0x00, 0x00, 0x22, 0x2F, 0x20, 0x00,
+	0x98, 0x2F, 0x20, 0x00, 0x98, 0x2F, 0x20, 0x00, 0x98, 0x2F, 0x20, 0x00, 0x98, 0x2F, 0x20, 0x00,
+	0x98, 0x2F, 0x20, 0x00, 0x98, 0x1F, 0x20, 0x00, 0xA8, 0x0C, 0x90, 0x03, 0xE4, 0x02, 0xBE, 0xDE,
+	0x60, 0x00, 0x01, 0x20, 0x00, 0x32, 0x00, 0x00, 0x14, 0x00, 0x8B, 0x00, 0x00, 0x7C, 0x00, 0x3F,
+	0x20, 0x00, 0xC7, 0x00, 0x0C, 0x70, 0x03, 0xF1, 0x00, 0x07, 0xC0, 0x08, 0xB0, 0x00, 0x01, 0xF2,
+	0x0D, 0x50, 0x00, 0x00, 0xA7, 0x3E, 0x10, 0x00, 0x00, 0x5C, 0x89, 0x00, 0x00, 0x00, 0x0E, 0xE4,
+	0x00, 0x00, 0x00, 0x09, 0xD0, 0x00, 0x00, 0x22, 0x00, 0x03, 0x10, 0x00, 0x41, 0x7C, 0x00, 0x0D,
+	0x80, 0x02, 0xF1, 0x3F, 0x00, 0x2E, 0xD0, 0x06, 0xC0, 0x0E, 0x40, 0x7A, 0xE2, 0x09, 0x90, 0x0B,
+	0x70, 0xB5, 0xA6, 0x0C, 0x50, 0x07, 0xA1, 0xE1, 0x6A, 0x1F, 0x20, 0x03, 0xE5, 0xB0, 0x1E, 0x4D,
+	0x00, 0x00, 0xEA, 0x70, 0x0C, 0xA9, 0x00, 0x00, 0xBF, 0x30, 0x08, 0xF6, 0x00, 0x00, 0x8D, 0x00,
+	0x04, 0xF2, 0x00, 0x24, 0x00, 0x00, 0x33, 0x2E, 0x50, 0x03, 0xF4, 0x07, 0xD1, 0x0C, 0x90, 0x00,
+	0xC9, 0x6E, 0x10, 0x00, 0x3F, 0xE5, 0x00, 0x00, 0x0C, 0xE1, 0x00, 0x00, 0x6E, 0xD8, 0x00, 0x01,
+	0xE6, 0x3F, 0x30, 0x0A, 0xB0, 0x09, 0xC0, 0x5F, 0x20, 0x01, 0xD7, 0x32, 0x00, 0x00, 0x32, 0x7D,
+	0x00, 0x02, 0xF4, 0x1E, 0x60, 0x09, 0xB0, 0x06, 0xD0, 0x2F, 0x30, 0x00, 0xC7, 0xA9, 0x00, 0x00,
+	0x4E, 0xE2, 0x00, 0x00, 0x0C, 0x90, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00,
+	0x0A, 0x80, 0x00, 0x14, 0x44, 0x44, 0x40, 0x4B, 0xBB, 0xBD, 0xF1, 0x00, 0x00, 0x1D, 0x70, 0x00,
+	0x00, 0x9C, 0x00, 0x00, 0x04, 0xE2, 0x00, 0x00, 0x1D, 0x60, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x05,
+	0xE2, 0x00, 0x00, 0x2E, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x18, 0x83, 0x1F, 0x72, 0x1F,
+	0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F,
+	0x20, 0x1F, 0x20, 0x1F, 0xF5, 0x32, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x0A, 0x60,
+	0x00, 0x05, 0xC0, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x89, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x50,
+	0x00, 0x06, 0xB0, 0x00, 0x01, 0xC1, 0x88, 0x40, 0x5C, 0x70, 0x0A, 0x70, 0x0A, 0x70, 0x0A, 0x70,
+	0x0A, 0x70, 0x0A, 0x70, 0x0A, 0x70, 0x0A, 0x70, 0x0A, 0x70, 0x0A, 0x70, 0x0A, 0x70, 0xEF, 0x70,
+	0x00, 0x31, 0x00, 0x01, 0xE6, 0x00, 0x06, 0xCC, 0x00, 0x0C, 0x4C, 0x40, 0x4D, 0x06, 0xA0, 0x33,
+	0x01, 0x50, 0xEE, 0xEE, 0xEB, 0x4B, 0x10, 0x08, 0x90, 0x00, 0x20, 0x04, 0xCE, 0xD5, 0x00, 0x1E,
+	0x40, 0x5E, 0x00, 0x01, 0x12, 0x4F, 0x20, 0x08, 0xDB, 0xBF, 0x20, 0x3E, 0x10, 0x1F, 0x20, 0x4E,
+	0x20, 0x6F, 0x20, 0x0A, 0xFE, 0xAF, 0x40, 0x00, 0x11, 0x00, 0x00, 0x1B, 0x10, 0x00, 0x00, 0x2F,
+	0x10, 0x00, 0x00, 0x2F, 0x10, 0x00, 0x00, 0x2F, 0x8E, 0xE8, 0x00, 0x2F, 0x80, 0x3E, 0x50, 0x2F,
+	0x10, 0x09, 0x90, 0x2F, 0x10, 0x08, 0xA0, 0x2F, 0x10, 0x08, 0x90, 0x2F, 0x60, 0x2E, 0x50, 0x2F,
+	0x9E, 0xF9, 0x00, 0x00, 0x01, 0x10, 0x00, 0x03, 0xCF, 0xD5, 0x00, 0x1E, 0x60, 0x4E, 0x20, 0x5D,
+	0x00, 0x06, 0x30, 0x6B, 0x00, 0x00, 0x00, 0x5D, 0x00, 0x02, 0x10, 0x1E, 0x40, 0x2E, 0x30, 0x04,
+	0xDD, 0xE6, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0x0B, 0x60, 0x00,
+	0x00, 0x0B, 0x60, 0x04, 0xDF, 0xBC, 0x60, 0x1E, 0x70, 0x4E, 0x60, 0x4E, 0x00, 0x0B, 0x60, 0x6C,
+	0x00, 0x0B, 0x60, 0x5D, 0x00, 0x0B, 0x60, 0x1E, 0x50, 0x2E, 0x60, 0x05, 0xED, 0xCC, 0x60, 0x00,
+	0x02, 0x00, 0x00, 0x02, 0xBF, 0xD4, 0x00, 0x0D, 0x70, 0x4E, 0x10, 0x4E, 0x11, 0x1C, 0x50, 0x6F,
+	0xDD, 0xDD, 0x60, 0x5D, 0x00, 0x00, 0x00, 0x1E, 0x60, 0x08, 0x10, 0x04, 0xDD, 0xE9, 0x00, 0x00,
+	0x02, 0x10, 0x00, 0x00, 0x9D, 0x60, 0x06, 0xD3, 0x10, 0x08, 0x90, 0x00, 0x8E, 0xED, 0x20, 0x19,
+	0xA1, 0x00, 0x08, 0x90, 0x00, 0x08, 0x90, 0x00, 0x08, 0x90, 0x00, 0x08, 0x90, 0x00, 0x08, 0x90,
+	0x00, 0x04, 0xDF, 0xBA, 0x60, 0x1E, 0x70, 0x4E, 0x70, 0x4E, 0x00, 0x0B, 0x70, 0x6C, 0x00, 0x0B,
+	0x70, 0x5D, 0x00, 0x0B, 0x70, 0x1E, 0x50, 0x2E, 0x70, 0x05, 0xED, 0xCD, 0x70, 0x00, 0x02, 0x0D,
+	0x50, 0x0C, 0x74, 0x9D, 0x10, 0x02, 0x8A, 0x82, 0x00, 0x1B, 0x10, 0x00, 0x00, 0x2F, 0x10, 0x00,
+	0x00, 0x2F, 0x10, 0x00, 0x00, 0x2F, 0x7E, 0xE8, 0x00, 0x2F, 0x80, 0x3F, 0x20, 0x2F, 0x10, 0x0D,
+	0x40, 0x2F, 0x10, 0x0D, 0x50, 0x2F, 0x10, 0x0D, 0x50, 0x2F, 0x10, 0x0D, 0x50, 0x2F, 0x10, 0x0D,
+	0x50, 0x05, 0x10, 0x1E, 0x30, 0x00, 0x00, 0x0D, 0x20, 0x0F, 0x30, 0x0F, 0x30, 0x0F, 0x30, 0x0F,
+	0x30, 0x0F, 0x30, 0x0F, 0x30, 0x00, 0x50, 0x02, 0xE2, 0x00, 0x00, 0x01, 0xD2, 0x01, 0xF2, 0x01,
+	0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x26, 0xF0, 0x5B, 0x50, 0x1B,
+	0x10, 0x00, 0x00, 0x2F, 0x10, 0x00, 0x00, 0x2F, 0x10, 0x00, 0x00, 0x2F, 0x10, 0x8B, 0x10, 0x2F,
+	0x17, 0xD2, 0x00, 0x2F, 0x7E, 0x20, 0x00, 0x2F, 0xED, 0x10, 0x00, 0x2F, 0x4A, 0xB0, 0x00, 0x2F,
+	0x11, 0xD7, 0x00, 0x2F, 0x10, 0x3E, 0x30, 0x0B, 0x20, 0x0F, 0x30, 0x0F, 0x30, 0x0F, 0x30, 0x0F,
+	0x30, 0x0F, 0x30, 0x0F, 0x30, 0x0F, 0x30, 0x0F, 0x30, 0x0F, 0x30, 0x2D, 0x8E, 0xE8, 0x6D, 0xFA,
+	0x00, 0x2F, 0x70, 0x4F, 0xA1, 0x2D, 0x60, 0x2F, 0x10, 0x0D, 0x50, 0x0A, 0x80, 0x2F, 0x10, 0x0D,
+	0x50, 0x0A, 0x80, 0x2F, 0x10, 0x0D, 0x50, 0x0A, 0x80, 0x2F, 0x10, 0x0D, 0x50, 0x0A, 0x80, 0x2F,
+	0x10, 0x0D, 0x50, 0x0A, 0x80, 0x2D, 0x7E, 0xE8, 0x00, 0x2F, 0x80, 0x3F, 0x20, 0x2F, 0x10, 0x0D,
+	0x40, 0x2F, 0x10, 0x0D, 0x50, 0x2F, 0x10, 0x0D, 0x50, 0x2F, 0x10, 0x0D, 0x50, 0x2F, 0x10, 0x0D,
+	0x50, 0x02, 0xBF, 0xD6, 0x00, 0x0D, 0x70, 0x3E, 0x50, 0x5D, 0x00, 0x07, 0xB0, 0x6B, 0x00, 0x06,
+	0xC0, 0x5D, 0x00, 0x07, 0xB0, 0x1E, 0x50, 0x1D, 0x60, 0x04, 0xDD, 0xE8, 0x00, 0x00, 0x02, 0x10,
+	0x00, 0x2D, 0x8E, 0xE7, 0x00, 0x2F, 0x70, 0x4E, 0x40, 0x2F, 0x10, 0x09, 0x90, 0x2F, 0x10, 0x08,
+	0xA0, 0x2F, 0x10, 0x09, 0x90, 0x2F, 0x50, 0x2E, 0x50, 0x2F, 0xBD, 0xE9, 0x00, 0x2F, 0x11, 0x10,
+	0x00, 0x2F, 0x10, 0x00, 0x00, 0x19, 0x10, 0x00, 0x00, 0x04, 0xDF, 0xBB, 0x50, 0x1E, 0x70, 0x3E,
+	0x60, 0x5E, 0x00, 0x0C, 0x60, 0x6C, 0x00, 0x0C, 0x60, 0x5D, 0x00, 0x0C, 0x60, 0x1E, 0x50, 0x2E,
+	0x60, 0x05, 0xED, 0xCE, 0x60, 0x00, 0x02, 0x0C, 0x60, 0x00, 0x00, 0x0C, 0x60, 0x00, 0x00, 0x08,
+	0x40, 0x2D, 0x9F, 0x30, 0x2F, 0x92, 0x10, 0x2F, 0x10, 0x00, 0x2F, 0x10, 0x00, 0x2F, 0x10, 0x00,
+	0x2F, 0x10, 0x00, 0x2F, 0x10, 0x00, 0x05, 0xDF, 0xC3, 0x00, 0x1F, 0x30, 0x7D, 0x00, 0x1F, 0x50,
+	0x02, 0x00, 0x04, 0xCE, 0xA3, 0x00, 0x11, 0x01, 0x8E, 0x00, 0x4E, 0x10, 0x4F, 0x00, 0x08, 0xED,
+	0xE6, 0x00, 0x00, 0x12, 0x00, 0x00, 0x05, 0x40, 0x0A, 0x80, 0xCE, 0xEA, 0x1B, 0x81, 0x0A, 0x80,
+	0x0A, 0x80, 0x0A, 0x80, 0x0A, 0x80, 0x05, 0xFB, 0x00, 0x11, 0x2D, 0x10, 0x0B, 0x30, 0x2F, 0x10,
+	0x0D, 0x40, 0x2F, 0x10, 0x0D, 0x40, 0x2F, 0x10, 0x0D, 0x40, 0x2F, 0x10, 0x0D, 0x40, 0x1F, 0x40,
+	0x3F, 0x40, 0x07, 0xFD, 0xCE, 0x40, 0x00, 0x11, 0x00, 0x00, 0x87, 0x00, 0x4C, 0x00, 0x4D, 0x00,
+	0x98, 0x00, 0x0E, 0x30, 0xD3, 0x00, 0x08, 0x83, 0xD0, 0x00, 0x03, 0xD8, 0x70, 0x00, 0x00, 0xDE,
+	0x20, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x87, 0x00, 0xA6, 0x00, 0xB4, 0x5C, 0x01, 0xEB, 0x01, 0xF1,
+	0x1F, 0x15, 0xAE, 0x15, 0xC0, 0x0B, 0x5A, 0x59, 0x68, 0x70, 0x07, 0x9E, 0x14, 0xAC, 0x30, 0x03,
+	0xFA, 0x00, 0xED, 0x00, 0x00, 0xD6, 0x00, 0xA9, 0x00, 0x5C, 0x10, 0x7A, 0x00, 0x0B, 0x82, 0xE3,
+	0x00, 0x02, 0xEC, 0x80, 0x00, 0x00, 0x9E, 0x10, 0x00, 0x02, 0xEC, 0x70, 0x00, 0x0B, 0x82, 0xE3,
+	0x00, 0x6D, 0x10, 0x8C, 0x00, 0x98, 0x00, 0x5B, 0x6D, 0x00, 0xA8, 0x1E, 0x31, 0xE3, 0x0A, 0x85,
+	0xC0, 0x04, 0xD9, 0x70, 0x00, 0xEF, 0x20, 0x00, 0x8C, 0x00, 0x00, 0x96, 0x00, 0x26, 0xE1, 0x00,
+	0x5B, 0x40, 0x00, 0x5D, 0xDD, 0xDB, 0x00, 0x12, 0x23, 0xE6, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00,
+	0x7D, 0x10, 0x00, 0x03, 0xE3, 0x00, 0x00, 0x1D, 0x60, 0x00, 0x00, 0x7F, 0xEE, 0xEE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x4D, 0x20, 0x01, 0xE3, 0x00, 0x03, 0xE0, 0x00, 0x04, 0xE0, 0x00, 0x04, 0xD0,
+	0x00, 0x4C, 0x80, 0x00, 0x5D, 0x50, 0x00, 0x05, 0xD0, 0x00, 0x04, 0xE0, 0x00, 0x04, 0xE0, 0x00,
+	0x01, 0xF2, 0x00, 0x00, 0x7C, 0x10, 0x00, 0x02, 0x00, 0x30, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+	0xD1, 0xD1, 0xD1, 0xD1, 0x91, 0x00, 0x00, 0xA9, 0x00, 0x0C, 0x60, 0x09, 0x90, 0x08, 0x90, 0x08,
+	0xA0, 0x02, 0xE7, 0x01, 0xCA, 0x07, 0xB0, 0x08, 0x90, 0x08, 0x90, 0x0B, 0x70, 0x8B, 0x10, 0x20,
+	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0xEE, 0x60, 0x1D, 0x00, 0x1E, 0x13, 0xDB, 0xC9, 0x00,
+	0x13, 0x00, 0x16, 0x50, 0x00,
+};
+
+GLOBAL const embedded_glyph_t ROBOTO_REGULAR_13PX_GLYPHS[] = {
+	{ .coverageOffset = 0, .width = 0, .height = 0, .bearingX = 0, .bearingY = 0, .advance = 3 }, // Space
+	{ .coverageOffset = 0, .width = 2, .height = 11, .bearingX = 1, .bearingY = 10, .advance = 3 }, // !
+	{ .coverageOffset = 11, .width = 4, .height = 4, .bearingX = 0, .bearingY = 10, .advance = 4 }, // "
+	{ .coverageOffset = 19, .width = 8, .height = 10, .bearingX = 0, .bearingY = 10, .advance = 8 }, // #
+	{ .coverageOffset = 59, .width = 7, .height = 13, .bearingX = 0, .bearingY = 11, .advance = 7 }, // $
+	{ .coverageOffset = 111, .width = 9, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 10 }, // %
+	{ .coverageOffset = 166, .width = 9, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 8 }, // &
+	{ .coverageOffset = 221, .width = 2, .height = 4, .bearingX = 0, .bearingY = 10, .advance = 2 }, // Apostrophe
+	{ .coverageOffset = 225, .width = 5, .height = 14, .bearingX = 0, .bearingY = 11, .advance = 4 }, // (
+	{ .coverageOffset = 267, .width = 4, .height = 14, .bearingX = 0, .bearingY = 11, .advance = 5 }, // )
+	{ .coverageOffset = 295, .width = 6, .height = 7, .bearingX = 0, .bearingY = 10, .advance = 6 }, // *
+	{ .coverageOffset = 316, .width = 7, .height = 8, .bearingX = 0, .bearingY = 8, .advance = 7 }, // +
+	{ .coverageOffset = 348, .width = 2, .height = 4, .bearingX = 0, .bearingY = 2, .advance = 3 }, // ,
+	{ .coverageOffset = 352, .width = 4, .height = 2, .bearingX = 0, .bearingY = 5, .advance = 4 }, // -
+	{ .coverageOffset = 356, .width = 3, .height = 3, .bearingX = 0, .bearingY = 2, .advance = 3 }, // .
+	{ .coverageOffset = 362, .width = 5, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 5 }, // /
+	{ .coverageOffset = 395, .width = 7, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 7 }, // 0
+	{ .coverageOffset = 439, .width = 4, .height = 10, .bearingX = 1, .bearingY = 10, .advance = 7 }, // 1
+	{ .coverageOffset = 459, .width = 7, .height = 10, .bearingX = 0, .bearingY = 10, .advance = 7 }, // 2
+	{ .coverageOffset = 499, .width = 7, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 7 }, // 3
+	{ .coverageOffset = 543, .width = 8, .height = 10, .bearingX = 0, .bearingY = 10, .advance = 7 }, // 4
+	{ .coverageOffset = 583, .width = 7, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 7 }, // 5
+	{ .coverageOffset = 627, .width = 7, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 7 }, // 6
+	{ .coverageOffset = 671, .width = 7, .height = 10, .bearingX = 0, .bearingY = 10, .advance = 7 }, // 7
+	{ .coverageOffset = 711, .width = 7, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 7 }, // 8
+	{ .coverageOffset = 755, .width = 7, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 7 }, // 9
+	{ .coverageOffset = 799, .width = 3, .height = 8, .bearingX = 0, .bearingY = 7, .advance = 3 }, // :
+	{ .coverageOffset = 815, .width = 3, .height = 9, .bearingX = 0, .bearingY = 7, .advance = 3 }, // ;
+	{ .coverageOffset = 833, .width = 6, .height = 6, .bearingX = 0, .bearingY = 7, .advance = 7 }, // <
+	{ .coverageOffset = 851, .width = 7, .height = 5, .bearingX = 0, .bearingY = 7, .advance = 7 }, // =
+	{ .coverageOffset = 871, .width = 7, .height = 6, .bearingX = 0, .bearingY = 7, .advance = 7 }, // >
+	{ .coverageOffset = 895, .width = 6, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 6 }, // ?
+	{ .coverageOffset = 928, .width = 12, .height = 13, .bearingX = 0, .bearingY = 10, .advance = 12 }, // @
+	{ .coverageOffset = 1006, .width = 9, .height = 10, .bearingX = 0, .bearingY = 10, .advance = 8 }, // A
+	{ .coverageOffset = 1056, .width = 7, .height = 10, .bearingX = 1, .bearingY = 10, .advance = 8 }, // B
+	{ .coverageOffset = 1096, .width = 8, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 8 }, // C
+	{ .coverageOffset = 1140, .width = 7, .height = 10, .bearingX = 1, .bearingY = 10, .advance = 9 }, // D
+	{ .coverageOffset = 1180, .width = 6, .height = 10, .bearingX = 1, .bearingY = 10, .advance = 7 }, // E
+	{ .coverageOffset = 1210, .width = 6, .height = 10, .bearingX = 1, .bearingY = 10, .advance = 7 }, // F
+	{ .coverageOffset = 1240, .width = 8, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 9 }, // G
+	{ .coverageOffset = 1284, .width = 8, .height = 10, .bearingX = 1, .bearingY = 10, .advance = 9 }, // H
+	{ .coverageOffset = 1324, .width = 2, .height = 10, .bearingX = 1, .bearingY = 10, .advance = 4 }, // I
+	{ .coverageOffset = 1334, .width = 7, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 7 }, // J
+	{ .coverageOffset = 1378, .width = 8, .height = 10, .bearingX = 1, .bearingY = 10, .advance = 8 }, // K
+	{ .coverageOffset = 1418, .width = 6, .height = 10, .bearingX = 1, .bearingY = 10, .advance = 7 }, // L
+	{ .coverageOffset = 1448, .width = 10, .height = 10, .bearingX = 1, .bearingY = 10, .advance = 11 }, // M
+	{ .coverageOffset = 1498, .width = 8, .height = 10, .bearingX = 1, .bearingY = 10, .advance = 9 }, // N
+	{ .coverageOffset = 1538, .width = 9, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 9 }, // O
+	{ .coverageOffset = 1593, .width = 7, .height = 10, .bearingX = 1, .bearingY = 10, .advance = 8 }, // P
+	{ .coverageOffset = 1633, .width = 9, .height = 12, .bearingX = 0, .bearingY = 10, .advance = 9 }, // Q
+	{ .coverageOffset = 1693, .width = 7, .height = 10, .bearingX = 1, .bearingY = 10, .advance = 8 }, // R
+	{ .coverageOffset = 1733, .width = 8, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 8 }, // S
+	{ .coverageOffset = 1777, .width = 8, .height = 10, .bearingX = 0, .bearingY = 10, .advance = 8 }, // T
+	{ .coverageOffset = 1817, .width = 8, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 8 }, // U
+	{ .coverageOffset = 1861, .width = 9, .height = 10, .bearingX = 0, .bearingY = 10, .advance = 8 }, // V
+	{ .coverageOffset = 1911, .width = 12, .height = 10, .bearingX = 0, .bearingY = 10, .advance = 12 }, // W
+	{ .coverageOffset = 1971, .width = 8, .height = 10, .bearingX = 0, .bearingY = 10, .advance = 8 }, // X
+	{ .coverageOffset = 2011, .width = 8, .height = 10, .bearingX = 0, .bearingY = 10, .advance = 8 }, // Y
+	{ .coverageOffset = 2051, .width = 8, .height = 10, .bearingX = 0, .bearingY = 10, .advance = 8 }, // Z
+	{ .coverageOffset = 2091, .width = 4, .height = 13, .bearingX = 0, .bearingY = 11, .advance = 3 }, // [
+	{ .coverageOffset = 2117, .width = 6, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 5 }, // Backslash
+	{ .coverageOffset = 2150, .width = 3, .height = 13, .bearingX = 0, .bearingY = 11, .advance = 3 }, // ]
+	{ .coverageOffset = 2176, .width = 6, .height = 6, .bearingX = 0, .bearingY = 10, .advance = 5 }, // ^
+	{ .coverageOffset = 2194, .width = 6, .height = 1, .bearingX = 0, .bearingY = 0, .advance = 6 }, // _
+	{ .coverageOffset = 2197, .width = 4, .height = 3, .bearingX = 0, .bearingY = 10, .advance = 4 }, // `
+	{ .coverageOffset = 2203, .width = 7, .height = 8, .bearingX = 0, .bearingY = 7, .advance = 7 }, // a
+	{ .coverageOffset = 2235, .width = 7, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 7 }, // b
+	{ .coverageOffset = 2279, .width = 7, .height = 8, .bearingX = 0, .bearingY = 7, .advance = 7 }, // c
+	{ .coverageOffset = 2311, .width = 7, .height = 11, .bearingX = 0, .bearingY = 10, .advance = 7 }, // d
+	{ .coverageOffset = 2355, .width = 7, .height = 8, .bearingX = 0, .bearingY = 7, .advance = 7 }, // e
+	{ .coverageOffset = 2387, .width = 5, .height = 10, .bearingX = 0, .bearingY = 10, .advance = 5 }, // f
+	{ .coverageOffset = 2417, .width = 7, .height = 10, .bearingX = 0, .bearingY = 7, .advance = 7 }, // g
+	{ .coverageOffset = 2457, .width = 7, .height = 10, .bearingX = 0, .bearingY = 10, .advance = 7 }, // h
+	{ .coverageOffset = 2497, .width = 3, .height = 10, .bearingX = 0, .bearingY = 10, .advance = 3 }, // i
+	{ .coverageOffset = 2517, .width = 4, .height = 13, .bearingX = -1, .bearingY = 10, .advance = 3 }, // j
+	{ .coverageOffset = 2543, .width = 7, .height = 10, .bearingX = 0, .bearingY = 10, .advance = 7 }, // k
+	{ .coverageOffset = 2583, .width = 3, .height = 10, .bearingX = 0, .bearingY = 10, .advance = 3 }, // l
+	{ .coverageOffset = 2603, .width = 11, .height = 7, .bearingX = 0, .bearingY = 7, .advance = 11 }, // m
+	{ .coverageOffset = 2645, .width = 7, .height = 7, .bearingX = 0, .bearingY = 7, .advance = 7 }, // n
+	{ .coverageOffset = 2673, .width = 7, .height = 8, .bearingX = 0, .bearingY = 7, .advance = 7 }, // o
+	{ .coverageOffset = 2705, .width = 7, .height = 10, .bearingX = 0, .bearingY = 7, .advance = 7 }, // p
+	{ .coverageOffset = 2745, .width = 7, .height = 10, .bearingX = 0, .bearingY = 7, .advance = 7 }, // q
+	{ .coverageOffset = 2785, .width = 5, .height = 7, .bearingX = 0, .bearingY = 7, .advance = 4 }, // r
+	{ .coverageOffset = 2806, .width = 7, .height = 8, .bearingX = 0, .bearingY = 7, .advance = 7 }, // s
+	{ .coverageOffset = 2838, .width = 4, .height = 10, .bearingX = 0, .bearingY = 9, .advance = 4 }, // t
+	{ .coverageOffset = 2858, .width = 7, .height = 8, .bearingX = 0, .bearingY = 7, .advance = 7 }, // u
+	{ .coverageOffset = 2890, .width = 7, .height = 7, .bearingX = 0, .bearingY = 7, .advance = 6 }, // v
+	{ .coverageOffset = 2918, .width = 10, .height = 7, .bearingX = 0, .bearingY = 7, .advance = 10 }, // w
+	{ .coverageOffset = 2953, .width = 7, .height = 7, .bearingX = 0, .bearingY = 7, .advance = 6 }, // x
+	{ .coverageOffset = 2981, .width = 6, .height = 10, .bearingX = 0, .bearingY = 7, .advance = 6 }, // y
+	{ .coverageOffset = 3011, .width = 7, .height = 7, .bearingX = 0, .bearingY = 7, .advance = 6 }, // z
+	{ .coverageOffset = 3039, .width = 5, .height = 14, .bearingX = 0, .bearingY = 11, .advance = 4 }, // {
+	{ .coverageOffset = 3081, .width = 2, .height = 12, .bearingX = 1, .bearingY = 10, .advance = 3 }, // |
+	{ .coverageOffset = 3093, .width = 4, .height = 14, .bearingX = 0, .bearingY = 11, .advance = 4 }, // }
+	{ .coverageOffset = 3121, .width = 9, .height = 4, .bearingX = 0, .bearingY = 6, .advance = 9 }, // ~
+};
+
+GLOBAL const embedded_font_t ROBOTO_REGULAR_13PX = {
+	.pixelSize = 13,
+	.ascent = 13,
+	.descent = 4,
+	.firstCharacter = ' ',
+	.lastCharacter = '~',
+	.glyphs = ROBOTO_REGULAR_13PX_GLYPHS,
+	.coverage = ROBOTO_REGULAR_13PX_COVERAGE,
+	.coverageSize = sizeof(ROBOTO_REGULAR_13PX_COVERAGE),
+};
\ No newline at end of file
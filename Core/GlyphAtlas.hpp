@@ -0,0 +1,274 @@
+typedef struct embedded_glyph {
+	uint16 coverageOffset; // 4 bits per pixel (rows are padded to a full byte)
+	uint8 width;
+	uint8 height;
+	int8 bearingX; // Offset from the pen position to the left edge
+	int8 bearingY; // Offset from the baseline to the top edge (upwards)
+	uint8 advance;
+} embedded_glyph_t;
+
+typedef struct embedded_font {
+	int pixelSize;
+	int ascent;
+	int descent;
+	char firstCharacter;
+	char lastCharacter;
+	const embedded_glyph_t* glyphs;
+	const uint8* coverage;
+	size_t coverageSize;
+} embedded_font_t;
+
+#include "Fonts/RobotoRegular13.hpp"
+
+constexpr int GLYPH_ATLAS_WIDTH = 512;
+constexpr int GLYPH_ATLAS_HEIGHT = 64;
+constexpr int GLYPH_ATLAS_PADDING = 1;
+constexpr int GLYPH_ATLAS_CHARACTER_COUNT = 128;
+constexpr char GLYPH_ATLAS_FALLBACK_CHARACTER = '?';
+
+typedef struct atlas_glyph {
+	int16 atlasX;
+	int16 atlasY;
+	uint8 width;
+	uint8 height;
+	int8 offsetX; // Relative to the pen position
+	int8 offsetY; // Relative to the top of the line
+	uint8 advance;
+} atlas_glyph_t;
+
+typedef struct glyph_atlas {
+	bool isBaked;
+	int lineHeight;
+	int ascent;
+	atlas_glyph_t glyphs[GLYPH_ATLAS_CHARACTER_COUNT];
+	uint8 coverage[GLYPH_ATLAS_WIDTH * GLYPH_ATLAS_HEIGHT];
+} glyph_atlas_t;
+
+// NOTE: Most overlay text is identical from one frame to the next, so entire lines are composited once and reused
+constexpr int TEXT_LINE_CACHE_SIZE = 128;
+constexpr int TEXT_LINE_CACHE_MAX_LENGTH = 128;
+constexpr int TEXT_LINE_CACHE_MAX_WIDTH = 512;
+constexpr int TEXT_LINE_CACHE_MAX_HEIGHT = 24;
+
+typedef struct cached_text_line {
+	int length;
+	int width;
+	int offsetX; // Some glyphs extend to the left of the pen position
+	char text[TEXT_LINE_CACHE_MAX_LENGTH];
+	uint8 coverage[TEXT_LINE_CACHE_MAX_WIDTH * TEXT_LINE_CACHE_MAX_HEIGHT];
+} cached_text_line_t;
+
+typedef struct text_line_cache {
+	cached_text_line_t lines[TEXT_LINE_CACHE_SIZE];
+	uint64 hits;
+	uint64 misses;
+} text_line_cache_t;
+
+INTERNAL bool GlyphAtlasBake(glyph_atlas_t& atlas, const embedded_font_t& font) {
+	ASSUME(font.ascent + font.descent <= TEXT_LINE_CACHE_MAX_HEIGHT, "Font is too large to fit into the text line cache");
+	memset(&atlas, 0, sizeof(atlas));
+	atlas.ascent = font.ascent;
+	atlas.lineHeight = font.ascent + font.descent;
+
+	// Simple shelf packing is more than enough for a few dozen glyphs of roughly the same height
+	int penX = 0;
+	int penY = 0;
+	int shelfHeight = 0;
+	for(int character = font.firstCharacter; character <= font.lastCharacter; ++character) {
+		const embedded_glyph_t& source = font.glyphs[character - font.firstCharacter];
+		if(penX + source.width > GLYPH_ATLAS_WIDTH) {
+			penX = 0;
+			penY += shelfHeight + GLYPH_ATLAS_PADDING;
+			shelfHeight = 0;
+		}
+		if(penY + source.height > GLYPH_ATLAS_HEIGHT) return false;
+
+		atlas_glyph_t& glyph = atlas.glyphs[character];
+		glyph.atlasX = (int16)penX;
+		glyph.atlasY = (int16)penY;
+		glyph.width = source.width;
+		glyph.height = source.height;
+		glyph.offsetX = source.bearingX;
+		glyph.offsetY = (int8)(font.ascent - source.bearingY);
+		glyph.advance = source.advance;
+
+		int packedRowSize = (source.width + 1) / 2;
+		for(int y = 0; y < source.height; ++y) {
+			const uint8* packedRow = font.coverage + source.coverageOffset + y * packedRowSize;
+			uint8* row = atlas.coverage + (penY + y) * GLYPH_ATLAS_WIDTH + penX;
+			for(int x = 0; x < source.width; ++x) {
+				uint8 nibble = (x & 1) ? (packedRow[x / 2] & 0x0F) : (packedRow[x / 2] >> 4);
+				row[x] = nibble * 17; // 0x0F -> 0xFF
+			}
+		}
+
+		penX += source.width + GLYPH_ATLAS_PADDING;
+		shelfHeight = Max(shelfHeight, (int)source.height);
+	}
+
+	// Anything that isn't printable ASCII still needs to show up somehow
+	for(int index = 0; index < GLYPH_ATLAS_CHARACTER_COUNT; ++index) {
+		if(index >= font.firstCharacter && index <= font.lastCharacter) continue;
+		atlas.glyphs[index] = atlas.glyphs[(uint8)GLYPH_ATLAS_FALLBACK_CHARACTER];
+	}
+
+	atlas.isBaked = true;
+	return true;
+}
+
+INTERNAL inline atlas_glyph_t& GlyphAtlasLookup(glyph_atlas_t& atlas, char character) {
+	uint8 index = (uint8)character;
+	if(index >= GLYPH_ATLAS_CHARACTER_COUNT) index = (uint8)GLYPH_ATLAS_FALLBACK_CHARACTER;
+	return atlas.glyphs[index];
+}
+
+INTERNAL int GlyphAtlasMeasureText(glyph_atlas_t& atlas, const char* text, int length) {
+	int width = 0;
+	for(int index = 0; index < length; ++index)
+		width += GlyphAtlasLookup(atlas, text[index]).advance;
+	return width;
+}
+
+INTERNAL inline uint32 BlendCoverageChannel(uint32 destination, uint32 source, uint32 alpha) {
+	// NOTE: Exact division by 255 (must match the SIMD version bit for bit)
+	uint32 blended = destination * (255 - alpha) + source * alpha + 128;
+	return (blended + (blended >> 8)) >> 8;
+}
+
+INTERNAL void BitmapBlendCoverageSpan(uint32* pixels, const uint8* coverage, int count, rgba_color_t color) {
+	int index = 0;
+
+#ifdef RAGLITE_INTRINSICS_SSE2
+	__m128i zero = _mm_setzero_si128();
+	__m128i bias = _mm_set1_epi16(128);
+	__m128i maximum = _mm_set1_epi16(255);
+	__m128i colorAlpha = _mm_set1_epi16(color.alpha);
+	__m128i source = _mm_unpacklo_epi8(_mm_set1_epi32((int)color.bytes), zero);
+
+	for(; index + 4 <= count; index += 4) {
+		uint32 coverageBytes;
+		memcpy(&coverageBytes, coverage + index, sizeof(coverageBytes));
+		if(coverageBytes == 0) continue;
+
+		// Broadcast each coverage value to all four channels of the corresponding pixel
+		__m128i alpha = _mm_cvtsi32_si128((int)coverageBytes);
+		alpha = _mm_unpacklo_epi8(alpha, alpha);
+		alpha = _mm_unpacklo_epi16(alpha, alpha);
+
+		__m128i destination = _mm_loadu_si128((__m128i*)(pixels + index));
+		__m128i blendedHalves[2];
+		for(int half = 0; half < 2; ++half) {
+			__m128i pixelAlpha = half ? _mm_unpackhi_epi8(alpha, zero) : _mm_unpacklo_epi8(alpha, zero);
+			__m128i pixelColor = half ? _mm_unpackhi_epi8(destination, zero) : _mm_unpacklo_epi8(destination, zero);
+
+			// Scale coverage by the color's own alpha first (same rounding as the blending step)
+			pixelAlpha = _mm_add_epi16(_mm_mullo_epi16(pixelAlpha, colorAlpha), bias);
+			pixelAlpha = _mm_srli_epi16(_mm_add_epi16(pixelAlpha, _mm_srli_epi16(pixelAlpha, 8)), 8);
+
+			__m128i blended = _mm_add_epi16(_mm_mullo_epi16(pixelColor, _mm_sub_epi16(maximum, pixelAlpha)), _mm_mullo_epi16(source, pixelAlpha));
+			blended = _mm_add_epi16(blended, bias);
+			blendedHalves[half] = _mm_srli_epi16(_mm_add_epi16(blended, _mm_srli_epi16(blended, 8)), 8);
+		}
+		_mm_storeu_si128((__m128i*)(pixels + index), _mm_packus_epi16(blendedHalves[0], blendedHalves[1]));
+	}
+#endif
+
+	for(; index < count; ++index) {
+		if(coverage[index] == 0) continue;
+		uint32 alpha = coverage[index] * (uint32)color.alpha + 128;
+		alpha = (alpha + (alpha >> 8)) >> 8;
+
+		rgba_color_t destination = { .bytes = pixels[index] };
+		destination.red = (uint8)BlendCoverageChannel(destination.red, color.red, alpha);
+		destination.green = (uint8)BlendCoverageChannel(destination.green, color.green, alpha);
+		destination.blue = (uint8)BlendCoverageChannel(destination.blue, color.blue, alpha);
+		destination.alpha = (uint8)BlendCoverageChannel(destination.alpha, color.alpha, alpha);
+		pixels[index] = destination.bytes;
+	}
+}
+
+INTERNAL void BitmapBlendCoverageMask(offscreen_buffer_t& bitmap, int x, int y, const uint8* coverage, int width, int height, int pitch, rgba_color_t color) {
+	int left = Max(x, 0);
+	int top = Max(y, 0);
+	int right = Min(x + width, bitmap.width);
+	int bottom = Min(y + height, bitmap.height);
+	if(left >= right || top >= bottom) return;
+
+	BitmapMarkDirtyRectangle(bitmap, left, top, right, bottom);
+	for(int row = top; row < bottom; ++row) {
+		const uint8* coverageRow = coverage + (row - y) * pitch + (left - x);
+		BitmapBlendCoverageSpan(BitmapGetPixelAddress(bitmap, left, row), coverageRow, right - left, color);
+	}
+}
+
+INTERNAL int BitmapDrawGlyphRun(offscreen_buffer_t& bitmap, glyph_atlas_t& atlas, int x, int y, const char* text, int length, rgba_color_t color) {
+	int penX = x;
+	for(int index = 0; index < length; ++index) {
+		atlas_glyph_t& glyph = GlyphAtlasLookup(atlas, text[index]);
+		const uint8* coverage = atlas.coverage + glyph.atlasY * GLYPH_ATLAS_WIDTH + glyph.atlasX;
+		BitmapBlendCoverageMask(bitmap, penX + glyph.offsetX, y + glyph.offsetY, coverage, glyph.width, glyph.height, GLYPH_ATLAS_WIDTH, color);
+		penX += glyph.advance;
+	}
+	return penX - x;
+}
+
+INTERNAL cached_text_line_t* TextLineCacheLookup(text_line_cache_t& cache, glyph_atlas_t& atlas, const char* text, int length) {
+	if(length > TEXT_LINE_CACHE_MAX_LENGTH) return NULL;
+
+	// FNV-1a (fast enough for short strings, and collisions only cost a redraw)
+	uint64 hash = 0xCBF29CE484222325ULL;
+	for(int index = 0; index < length; ++index)
+		hash = (hash ^ (uint8)text[index]) * 0x100000001B3ULL;
+
+	cached_text_line_t& line = cache.lines[hash % TEXT_LINE_CACHE_SIZE];
+	if(line.length == length && memcmp(line.text, text, length) == 0) {
+		cache.hits++;
+		return &line;
+	}
+
+	int minX = 0;
+	int maxX = 0;
+	int penX = 0;
+	for(int index = 0; index < length; ++index) {
+		atlas_glyph_t& glyph = GlyphAtlasLookup(atlas, text[index]);
+		minX = Min(minX, penX + glyph.offsetX);
+		maxX = Max(maxX, penX + glyph.offsetX + glyph.width);
+		penX += glyph.advance;
+	}
+	if(maxX - minX > TEXT_LINE_CACHE_MAX_WIDTH) return NULL;
+
+	cache.misses++;
+	line.length = length;
+	line.width = maxX - minX;
+	line.offsetX = minX;
+	memcpy(line.text, text, length);
+	memset(line.coverage, 0, sizeof(line.coverage));
+
+	// Neighboring glyphs may overlap slightly, in which case the higher coverage should win
+	penX = -minX;
+	for(int index = 0; index < length; ++index) {
+		atlas_glyph_t& glyph = GlyphAtlasLookup(atlas, text[index]);
+		for(int row = 0; row < glyph.height; ++row) {
+			int lineRow = glyph.offsetY + row;
+			if(lineRow < 0 || lineRow >= TEXT_LINE_CACHE_MAX_HEIGHT) continue;
+			const uint8* source = atlas.coverage + (glyph.atlasY + row) * GLYPH_ATLAS_WIDTH + glyph.atlasX;
+			uint8* destination = line.coverage + lineRow * TEXT_LINE_CACHE_MAX_WIDTH + penX + glyph.offsetX;
+			for(int column = 0; column < glyph.width; ++column)
+				destination[column] = Max(destination[column], source[column]);
+		}
+		penX += glyph.advance;
+	}
+
+	return &line;
+}
+
+INTERNAL int BitmapDrawText(offscreen_buffer_t& bitmap, glyph_atlas_t& atlas, text_line_cache_t& cache, int x, int y, const char* text, int length, rgba_color_t color) {
+	ASSUME(atlas.isBaked, "Attempted to draw text before the glyph atlas was baked");
+	if(length <= 0) return 0;
+
+	cached_text_line_t* line = TextLineCacheLookup(cache, atlas, text, length);
+	if(!line) return BitmapDrawGlyphRun(bitmap, atlas, x, y, text, length, color);
+
+	BitmapBlendCoverageMask(bitmap, x + line->offsetX, y, line->coverage, line->width, atlas.lineHeight, TEXT_LINE_CACHE_MAX_WIDTH, color);
+	return GlyphAtlasMeasureText(atlas, text, length);
+}
\ No newline at end of file
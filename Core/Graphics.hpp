@@ -0,0 +1,308 @@
+typedef union rgba_color {
+	// NOTE: For simplicity, ensure this matches the pixel format used by offscreen bitmaps (and GDI's DIB sections)
+	struct {
+		uint8 blue;
+		uint8 green;
+		uint8 red;
+		uint8 alpha;
+	};
+	uint32 bytes;
+} rgba_color_t;
+
+typedef enum {
+	DEFAULT_GDI_LINE,
+	BRESENHAM_INTEGER_LINE,
+	DDA_FLOAT_LINE,
+	WU_FLOAT_LINE,
+	LINE_STYLE_COUNT,
+
+} line_drawing_style_t;
+
+INTERNAL const char* LineDrawingStyleToString(line_drawing_style_t style) {
+	switch(style) {
+		case DEFAULT_GDI_LINE:
+			return "GDI (LineTo)";
+		case BRESENHAM_INTEGER_LINE:
+			return "Bresenham (Integer)";
+		case DDA_FLOAT_LINE:
+			return "DDA (Float)";
+		case WU_FLOAT_LINE:
+			return "Xiaolin Wu (Anti-Aliased)";
+		default:
+			return "N/A";
+	}
+}
+
+INTERNAL inline int DoubleGetIntegerPart(double number) {
+	return (int)floor(number);
+}
+
+INTERNAL inline double DoubleGetDecimalPart(double number) {
+	return number - floor(number);
+}
+
+INTERNAL inline double DoubleGetReverseDecimalPart(double number) {
+	return 1.0 - DoubleGetDecimalPart(number);
+}
+
+INTERNAL inline bool BitmapContainsPoint(offscreen_buffer_t& bitmap, int x, int y) {
+	return x >= 0 && y >= 0 && x < bitmap.width && y < bitmap.height;
+}
+
+INTERNAL inline bool RectangleIsEmpty(bitmap_rectangle_t& rectangle) {
+	return rectangle.left >= rectangle.right || rectangle.top >= rectangle.bottom;
+}
+
+INTERNAL inline size_t RectangleGetArea(bitmap_rectangle_t& rectangle) {
+	if(RectangleIsEmpty(rectangle)) return 0;
+	return (size_t)(rectangle.right - rectangle.left) * (size_t)(rectangle.bottom - rectangle.top);
+}
+
+INTERNAL inline bool RectanglesOverlapOrTouch(bitmap_rectangle_t& first, bitmap_rectangle_t& second) {
+	return first.left <= second.right && second.left <= first.right && first.top <= second.bottom && second.top <= first.bottom;
+}
+
+INTERNAL inline void RectangleExpandToInclude(bitmap_rectangle_t& rectangle, bitmap_rectangle_t& other) {
+	rectangle.left = Min(rectangle.left, other.left);
+	rectangle.top = Min(rectangle.top, other.top);
+	rectangle.right = Max(rectangle.right, other.right);
+	rectangle.bottom = Max(rectangle.bottom, other.bottom);
+}
+
+INTERNAL void BitmapMarkDirtyRectangle(offscreen_buffer_t& bitmap, int left, int top, int right, int bottom) {
+	bitmap_rectangle_t dirtyRectangle = {
+		.left = Max(left, 0),
+		.top = Max(top, 0),
+		.right = Min(right, bitmap.width),
+		.bottom = Min(bottom, bitmap.height),
+	};
+	if(RectangleIsEmpty(dirtyRectangle)) return;
+
+	// NOTE: Merging may cause new overlaps with regions that were already checked, so restart after each one
+	dirty_region_list_t& dirtyRegions = bitmap.dirtyRegions;
+	int index = 0;
+	while(index < dirtyRegions.count) {
+		bitmap_rectangle_t& existingRectangle = dirtyRegions.rectangles[index];
+		if(!RectanglesOverlapOrTouch(existingRectangle, dirtyRectangle)) {
+			index++;
+			continue;
+		}
+
+		RectangleExpandToInclude(dirtyRectangle, existingRectangle);
+		dirtyRegions.count--;
+		dirtyRegions.rectangles[index] = dirtyRegions.rectangles[dirtyRegions.count];
+		index = 0;
+	}
+
+	if(dirtyRegions.count == MAX_DIRTY_RECTANGLES) {
+		// Too fragmented to be worth tracking individually (copying a few clean pixels is cheaper)
+		for(index = 0; index < dirtyRegions.count; ++index)
+			RectangleExpandToInclude(dirtyRectangle, dirtyRegions.rectangles[index]);
+		dirtyRegions.count = 0;
+	}
+
+	dirtyRegions.rectangles[dirtyRegions.count] = dirtyRectangle;
+	dirtyRegions.count++;
+}
+
+INTERNAL inline void BitmapMarkEverythingDirty(offscreen_buffer_t& bitmap) {
+	bitmap.dirtyRegions.count = 0;
+	BitmapMarkDirtyRectangle(bitmap, 0, 0, bitmap.width, bitmap.height);
+}
+
+INTERNAL inline void BitmapClearDirtyRegions(offscreen_buffer_t& bitmap) {
+	bitmap.dirtyRegions.count = 0;
+}
+
+INTERNAL inline size_t BitmapGetDirtyPixelCount(offscreen_buffer_t& bitmap) {
+	// NOTE: Dirty regions never overlap, so there's no need to account for pixels being counted twice
+	size_t dirtyPixelCount = 0;
+	for(int index = 0; index < bitmap.dirtyRegions.count; ++index)
+		dirtyPixelCount += RectangleGetArea(bitmap.dirtyRegions.rectangles[index]);
+	return dirtyPixelCount;
+}
+
+INTERNAL inline uint32* BitmapGetPixelAddress(offscreen_buffer_t& bitmap, int x, int y) {
+	ASSUME(BitmapContainsPoint(bitmap, x, y), "Attempted to access a pixel outside of the bitmap");
+	uint8* row = (uint8*)bitmap.pixelBuffer + (size_t)y * (size_t)bitmap.stride;
+	return (uint32*)row + x;
+}
+
+INTERNAL inline void BitmapBlendPixelRGBA(rgba_color_t& source, rgba_color_t& destination, rgba_color_t& blended) {
+	// TODO: Improve performance, accuracy/gamma, SSE etc. (don't try this at home, use the GPU instead)
+	if(source.alpha == 0) {
+		blended.red = destination.red;
+		blended.blue = destination.blue;
+		blended.green = destination.green;
+		blended.alpha = destination.alpha;
+		return;
+	}
+
+	if(source.alpha == 255) {
+		blended.red = source.red;
+		blended.blue = source.blue;
+		blended.green = source.green;
+		blended.alpha = 255;
+		return;
+	}
+
+	uint8 oneMinusAlpha = 255 - source.alpha;
+	int r = ((int)source.red * (int)source.alpha + (int)destination.red * oneMinusAlpha + 127) / 255;
+	int g = ((int)source.green * (int)source.alpha + (int)destination.green * oneMinusAlpha + 127) / 255;
+	int b = ((int)source.blue * (int)source.alpha + (int)destination.blue * oneMinusAlpha + 127) / 255;
+
+	int a = ((int)source.alpha * 255 + (int)destination.alpha * oneMinusAlpha + 127) / 255;
+
+	blended.red = ClampToInterval((uint8)r, 0, 255);
+	blended.green = ClampToInterval((uint8)g, 0, 255);
+	blended.blue = ClampToInterval((uint8)b, 0, 255);
+	blended.alpha = ClampToInterval((uint8)a, 0, 255);
+}
+
+INTERNAL inline void BitmapSetPixelColor(offscreen_buffer_t& bitmap, int x, int y, rgba_color_t source) {
+	if(!BitmapContainsPoint(bitmap, x, y)) return;
+	if(source.alpha == 0) return;
+
+	uint32* pixel = BitmapGetPixelAddress(bitmap, x, y);
+	if(source.alpha == 255) {
+		*pixel = source.bytes;
+		return;
+	}
+
+	rgba_color_t destination = { .bytes = *pixel };
+	rgba_color_t blended = source;
+	BitmapBlendPixelRGBA(source, destination, blended);
+	*pixel = blended.bytes;
+}
+
+INTERNAL inline void BitmapPlotAntiAliased(offscreen_buffer_t& bitmap, int x, int y, double alpha, rgba_color_t color) {
+	if(alpha <= 0.0) return;
+	if(alpha > 1.0) alpha = 1.0;
+	// NOTE: Coverage modulates the color's own alpha, so that translucent lines stay translucent
+	color.alpha = (uint8)ClampToInterval((int)round(color.alpha * alpha), 0, 255);
+	BitmapSetPixelColor(bitmap, x, y, color);
+}
+
+// Xiaolin Wu's Anti-Aliased Line Drawing Algorithm
+INTERNAL void BitmapDrawLineWu(offscreen_buffer_t& bitmap, double x0, double y0, double x1, double y1, rgba_color_t color) {
+	// NOTE: The anti-aliased endpoints and neighboring pixels may extend slightly beyond the line's bounding box
+	BitmapMarkDirtyRectangle(bitmap, (int)floor(Min(x0, x1)) - 1, (int)floor(Min(y0, y1)) - 1, (int)ceil(Max(x0, x1)) + 2, (int)ceil(Max(y0, y1)) + 2);
+
+	bool isSteepLine = fabs(y1 - y0) > fabs(x1 - x0);
+
+	if(isSteepLine) {
+		Swap(x0, y0, double);
+		Swap(x1, y1, double);
+	}
+
+	if(x0 > x1) {
+		Swap(x0, x1, double);
+		Swap(y0, y1, double);
+	}
+
+	double deltaX = x1 - x0;
+	double deltaY = y1 - y0;
+	double gradient = (deltaX == 0.0) ? 1.0 : deltaY / deltaX;
+
+	// First endpoint
+	double xEnd = round(x0);
+	double yEnd = y0 + gradient * (xEnd - x0);
+	double xGap = DoubleGetReverseDecimalPart(x0 + 0.5);
+	int xPixel1 = (int)xEnd;
+	int yPixel1 = DoubleGetIntegerPart(yEnd);
+
+	if(isSteepLine) {
+		BitmapPlotAntiAliased(bitmap, yPixel1, xPixel1, DoubleGetReverseDecimalPart(yEnd) * xGap, color);
+		BitmapPlotAntiAliased(bitmap, yPixel1 + 1, xPixel1, DoubleGetDecimalPart(yEnd) * xGap, color);
+	} else {
+		BitmapPlotAntiAliased(bitmap, xPixel1, yPixel1, DoubleGetReverseDecimalPart(yEnd) * xGap, color);
+		BitmapPlotAntiAliased(bitmap, xPixel1, yPixel1 + 1, DoubleGetDecimalPart(yEnd) * xGap, color);
+	}
+
+	double errY = yEnd + gradient;
+
+	// Second endpoint
+	xEnd = round(x1);
+	yEnd = y1 + gradient * (xEnd - x1);
+	xGap = DoubleGetDecimalPart(x1 + 0.5);
+	int xPixel2 = (int)xEnd;
+	int yPixel2 = DoubleGetIntegerPart(yEnd);
+
+	if(isSteepLine) {
+		BitmapPlotAntiAliased(bitmap, yPixel2, xPixel2, DoubleGetReverseDecimalPart(yEnd) * xGap, color);
+		BitmapPlotAntiAliased(bitmap, yPixel2 + 1, xPixel2, DoubleGetDecimalPart(yEnd) * xGap, color);
+	} else {
+		BitmapPlotAntiAliased(bitmap, xPixel2, yPixel2, DoubleGetReverseDecimalPart(yEnd) * xGap, color);
+		BitmapPlotAntiAliased(bitmap, xPixel2, yPixel2 + 1, DoubleGetDecimalPart(yEnd) * xGap, color);
+	}
+
+	// Main loop
+	if(isSteepLine) {
+		for(int x = xPixel1 + 1; x < xPixel2; x++) {
+			BitmapPlotAntiAliased(bitmap, DoubleGetIntegerPart(errY), x, DoubleGetReverseDecimalPart(errY), color);
+			BitmapPlotAntiAliased(bitmap, DoubleGetIntegerPart(errY) + 1, x, DoubleGetDecimalPart(errY), color);
+			errY += gradient;
+		}
+	} else {
+		for(int x = xPixel1 + 1; x < xPixel2; x++) {
+			BitmapPlotAntiAliased(bitmap, x, DoubleGetIntegerPart(errY), DoubleGetReverseDecimalPart(errY), color);
+			BitmapPlotAntiAliased(bitmap, x, DoubleGetIntegerPart(errY) + 1, DoubleGetDecimalPart(errY), color);
+			errY += gradient;
+		}
+	}
+}
+
+// Digital Differential Analyzer Line Drawing Algorithm
+INTERNAL void BitmapDrawLineDDA(offscreen_buffer_t& bitmap, double startX, double startY, double endX, double endY, rgba_color_t color) {
+	double deltaX = endX - startX;
+	double deltaY = endY - startY;
+	double absDeltaX = fabs(deltaX);
+	double absDeltaY = fabs(deltaY);
+
+	int minX = (int)round(Min(startX, endX));
+	int minY = (int)round(Min(startY, endY));
+	int maxX = (int)round(Max(startX, endX));
+	int maxY = (int)round(Max(startY, endY));
+	BitmapMarkDirtyRectangle(bitmap, minX, minY, maxX + 1, maxY + 1);
+
+	int steps = (absDeltaX > absDeltaY) ? (int)absDeltaX : (int)absDeltaY;
+	if(steps == 0) {
+		BitmapSetPixelColor(bitmap, (int)round(startX), (int)round(startY), color);
+		return;
+	}
+
+	double xIncrement = deltaX / steps;
+	double yIncrement = deltaY / steps;
+
+	double x = startX;
+	double y = startY;
+	for(int i = 0; i <= steps; i++) {
+		BitmapSetPixelColor(bitmap, (int)round(x), (int)round(y), color);
+		x += xIncrement;
+		y += yIncrement;
+	}
+}
+
+// Bresenham's Integer Line Drawing Algorithm
+INTERNAL void BitmapDrawLineBresenham(offscreen_buffer_t& bitmap, int x0, int y0, int x1, int y1, rgba_color_t color) {
+	int deltaX = (x1 > x0) ? (x1 - x0) : (x0 - x1);
+	int stepX = (x0 < x1) ? 1 : -1;
+	int deltaY = (y1 > y0) ? (y0 - y1) : (y1 - y0);
+	int stepY = (y0 < y1) ? 1 : -1;
+	int accumulatedError = deltaX + deltaY;
+	BitmapMarkDirtyRectangle(bitmap, Min(x0, x1), Min(y0, y1), Max(x0, x1) + 1, Max(y0, y1) + 1);
+
+	while(true) {
+		BitmapSetPixelColor(bitmap, x0, y0, color);
+		if(x0 == x1 && y0 == y1) break;
+		int errorThreshold = 2 * accumulatedError;
+		if(errorThreshold >= deltaY) {
+			accumulatedError += deltaY;
+			x0 += stepX;
+		}
+		if(errorThreshold <= deltaX) {
+			accumulatedError += deltaX;
+			y0 += stepY;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+// NOTE: Availability depends on the platform (and permissions), so every counter may be missing independently
+typedef enum : uint8 {
+	HARDWARE_COUNTER_CYCLES,
+	HARDWARE_COUNTER_INSTRUCTIONS,
+	HARDWARE_COUNTER_L1D_MISSES,
+	HARDWARE_COUNTER_LLC_MISSES,
+	HARDWARE_COUNTER_BRANCH_MISSES,
+	HARDWARE_COUNTER_DTLB_MISSES,
+	HARDWARE_COUNTER_COUNT,
+} hardware_counter_t;
+
+GLOBAL const char* HARDWARE_COUNTER_NAMES[HARDWARE_COUNTER_COUNT] = {
+	"Cycles",
+	"Instructions",
+	"L1D Misses",
+	"LLC Misses",
+	"Branch Misses",
+	"dTLB Misses",
+};
+
+typedef struct hardware_counter_values {
+	uint64 values[HARDWARE_COUNTER_COUNT];
+} hardware_counter_values_t;
+
+// NOTE: Counters only measure the thread that opened them (each thread must open its own group if needed)
+typedef struct hardware_counter_group {
+	int64 handles[HARDWARE_COUNTER_COUNT]; // Platform-specific (file descriptors on Linux)
+	int64 leaderHandle;
+	uint32 availableCounterMask;
+} hardware_counter_group_t;
+
+INTERNAL inline bool HardwareCounterIsAvailable(hardware_counter_group_t& group, hardware_counter_t counter) {
+	return (group.availableCounterMask & (1u << counter)) != 0;
+}
+
+INTERNAL inline void HardwareCountersGetDelta(hardware_counter_values_t& before, hardware_counter_values_t& after, hardware_counter_values_t& delta) {
+	for(int counter = 0; counter < HARDWARE_COUNTER_COUNT; ++counter) {
+		// Multiplexed counters are scaled estimates, so they may occasionally appear to run backwards
+		delta.values[counter] = (after.values[counter] > before.values[counter]) ? after.values[counter] - before.values[counter] : 0;
+	}
+}
+
+INTERNAL inline float HardwareCountersGetInstructionsPerCycle(hardware_counter_values_t& delta) {
+	uint64 cycles = delta.values[HARDWARE_COUNTER_CYCLES];
+	if(cycles == 0) return 0.0f;
+	return (float)delta.values[HARDWARE_COUNTER_INSTRUCTIONS] / (float)cycles;
+}
+
+INTERNAL inline float HardwareCountersGetMissesPerKiloInstruction(hardware_counter_values_t& delta, hardware_counter_t counter) {
+	uint64 instructions = delta.values[HARDWARE_COUNTER_INSTRUCTIONS];
+	if(instructions == 0) return 0.0f;
+	return (float)delta.values[counter] * 1000.0f / (float)instructions;
+}
\ No newline at end of file
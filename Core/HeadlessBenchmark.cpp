@@ -0,0 +1,381 @@
+// ABOUT: Headless benchmark mode (runs an app without creating any windows, then reports the costs in a diffable format)
+// ABOUT: Usage: RagLite2 --benchmark [--app <Name>] [--frames <N> | --duration <seconds>] [--resolution <W>x<H>]
+// ABOUT:        [--output <file>] [--baseline <file>] [--threshold <percent>]
+// ABOUT: Thresholds are stored per metric in the output (so baselines can be hand-tuned for noisier metrics)
+// ABOUT: Exit codes: 0 = no regressions, 1 = at least one metric regressed, 2 = the benchmark itself failed to run
+
+// TODO: Eliminate this
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+constexpr const char* BENCHMARK_COMMAND_LINE_FLAG = "--benchmark";
+constexpr const char* BENCHMARK_DEFAULT_APP = TOSTRING(RAGLITE_DEFAULT_APP);
+constexpr int BENCHMARK_DEFAULT_WIDTH = 1280;
+constexpr int BENCHMARK_DEFAULT_HEIGHT = 720;
+constexpr int BENCHMARK_MAX_RESOLUTION = 8192;
+constexpr int BENCHMARK_DEFAULT_FRAME_COUNT = 750; // Long enough for the pattern test to cycle through all of its patterns
+constexpr int BENCHMARK_WARMUP_FRAME_COUNT = 30;
+constexpr percentage BENCHMARK_DEFAULT_THRESHOLD = 10.0f;
+constexpr int BENCHMARK_MAX_BASELINE_METRICS = 64;
+constexpr size_t BENCHMARK_MAX_METRIC_NAME_LENGTH = 64;
+constexpr size_t BENCHMARK_MAX_PATH_LENGTH = 4096;
+constexpr size_t BENCHMARK_MAX_CONFIGURATION_LENGTH = 256;
+constexpr const char* BENCHMARK_CONFIGURATION_PREFIX = "# config: ";
+
+// NOTE: Same as the runtime, so that the app's allocation patterns (and page faults) are representative
+constexpr size_t BENCHMARK_MAIN_MEMORY_SIZE = Megabytes(85);
+constexpr size_t BENCHMARK_TRANSIENT_MEMORY_SIZE = Megabytes(1596) + Kilobytes(896);
+
+// NOTE: Scripts must be able to tell regressions apart from runs that didn't produce any (comparable) results
+typedef enum : int {
+	BENCHMARK_EXIT_SUCCESS = 0,
+	BENCHMARK_EXIT_REGRESSION = 1,
+	BENCHMARK_EXIT_ERROR = 2,
+} benchmark_exit_code_t;
+
+typedef struct benchmark_options {
+	const char* appName;
+	const char* outputFilePath;
+	const char* baselineFilePath;
+	int frameCount;
+	seconds duration; // Takes precedence over the frame count (if set)
+	int width;
+	int height;
+	percentage defaultThreshold;
+} benchmark_options_t;
+
+// NOTE: All metrics are costs (lower is better), so that the baseline comparison doesn't need to know what they mean
+typedef enum : uint8 {
+	BENCHMARK_METRIC_FRAME_TIME_MEAN,
+	BENCHMARK_METRIC_FRAME_TIME_P50,
+	BENCHMARK_METRIC_FRAME_TIME_P90,
+	BENCHMARK_METRIC_FRAME_TIME_P99,
+	BENCHMARK_METRIC_FRAME_TIME_P999,
+	BENCHMARK_METRIC_FRAME_TIME_MAX,
+	BENCHMARK_METRIC_NANOSECONDS_PER_PIXEL,
+	BENCHMARK_METRIC_COUNT,
+} benchmark_metric_t;
+
+GLOBAL const char* BENCHMARK_METRIC_NAMES[BENCHMARK_METRIC_COUNT] = {
+	"frameTime.mean",
+	"frameTime.p50",
+	"frameTime.p90",
+	"frameTime.p99",
+	"frameTime.p99.9",
+	"frameTime.max",
+	"nanosecondsPerPixel",
+};
+
+typedef struct benchmark_results {
+	double metrics[BENCHMARK_METRIC_COUNT];
+	int measuredFrameCount;
+	seconds elapsedTime;
+} benchmark_results_t;
+
+typedef struct benchmark_baseline_entry {
+	char name[BENCHMARK_MAX_METRIC_NAME_LENGTH];
+	double value;
+	percentage threshold;
+} benchmark_baseline_entry_t;
+
+GLOBAL latency_histogram_t BENCHMARK_FRAME_TIMES = {};
+GLOBAL benchmark_baseline_entry_t BENCHMARK_BASELINE[BENCHMARK_MAX_BASELINE_METRICS] = {};
+GLOBAL char BENCHMARK_BASELINE_CONFIGURATION[BENCHMARK_MAX_CONFIGURATION_LENGTH] = {};
+
+INTERNAL bool BenchmarkWasRequested(int argc, char** argv) {
+	for(int index = 1; index < argc; ++index) {
+		if(strcmp(argv[index], BENCHMARK_COMMAND_LINE_FLAG) == 0) return true;
+	}
+	return false;
+}
+
+INTERNAL bool BenchmarkParseArguments(int argc, char** argv, benchmark_options_t& options) {
+	options = {
+		.appName = BENCHMARK_DEFAULT_APP,
+		.outputFilePath = NULL,
+		.baselineFilePath = NULL,
+		.frameCount = BENCHMARK_DEFAULT_FRAME_COUNT,
+		.duration = 0,
+		.width = BENCHMARK_DEFAULT_WIDTH,
+		.height = BENCHMARK_DEFAULT_HEIGHT,
+		.defaultThreshold = BENCHMARK_DEFAULT_THRESHOLD,
+	};
+
+	for(int index = 1; index < argc; ++index) {
+		const char* argument = argv[index];
+		if(strcmp(argument, BENCHMARK_COMMAND_LINE_FLAG) == 0) continue;
+
+		const char* value = (index + 1 < argc) ? argv[index + 1] : NULL;
+		if(!value) {
+			fprintf(stderr, "Missing value for command-line argument %s\n", argument);
+			return false;
+		}
+		index++;
+
+		if(strcmp(argument, "--app") == 0) options.appName = value;
+		else if(strcmp(argument, "--output") == 0) options.outputFilePath = value;
+		else if(strcmp(argument, "--baseline") == 0) options.baselineFilePath = value;
+		else if(strcmp(argument, "--frames") == 0) options.frameCount = atoi(value);
+		else if(strcmp(argument, "--duration") == 0) options.duration = (seconds)atof(value);
+		else if(strcmp(argument, "--threshold") == 0) options.defaultThreshold = (percentage)atof(value);
+		else if(strcmp(argument, "--resolution") == 0) {
+			if(sscanf(value, "%dx%d", &options.width, &options.height) != 2) {
+				fprintf(stderr, "Invalid resolution %s (expected <width>x<height>, e.g., 1920x1080)\n", value);
+				return false;
+			}
+		} else {
+			fprintf(stderr, "Unknown command-line argument %s\n", argument);
+			return false;
+		}
+	}
+
+	if(options.frameCount <= 0 && options.duration <= 0) {
+		fprintf(stderr, "Nothing to run (frame count and duration must not both be zero)\n");
+		return false;
+	}
+
+	bool isValidResolution = options.width > 0 && options.height > 0;
+	isValidResolution = isValidResolution && options.width <= BENCHMARK_MAX_RESOLUTION && options.height <= BENCHMARK_MAX_RESOLUTION;
+	if(!isValidResolution) {
+		fprintf(stderr, "Invalid resolution %dx%d (must be between 1 and %d pixels)\n", options.width, options.height, BENCHMARK_MAX_RESOLUTION);
+		return false;
+	}
+
+	return true;
+}
+
+INTERNAL advance_simulation_fn_t BenchmarkLoadApplication(const char* appName, const char* executablePath) {
+	// NOTE: The default app is linked into the executable, but all others have to be loaded from their respective modules
+	if(strcmp(appName, BENCHMARK_DEFAULT_APP) == 0) return AdvanceSimulation;
+
+	char moduleDirectory[BENCHMARK_MAX_PATH_LENGTH] = {};
+	const char* lastSeparator = NULL;
+	for(const char* character = executablePath; *character; ++character) {
+		if(*character == '/' || *character == '\\') lastSeparator = character;
+	}
+	size_t directoryLength = lastSeparator ? (size_t)(lastSeparator - executablePath + 1) : 0;
+	directoryLength = Min(directoryLength, sizeof(moduleDirectory) - 1);
+	memcpy(moduleDirectory, executablePath, directoryLength);
+
+	return PlatformLoadSimulationModule(moduleDirectory, appName);
+}
+
+INTERNAL void BenchmarkMeasureFrames(benchmark_options_t& options, advance_simulation_fn_t advanceSimulation, offscreen_buffer_t& bitmap,
+	memory_arena_t& persistentStorage, memory_arena_t& transientStorage, benchmark_results_t& results) {
+	simulation_state_t simulation = {};
+	gamepad_state_t controllerInputs = {};
+	HistogramReset(BENCHMARK_FRAME_TIMES);
+
+	// NOTE: Frames advance at a fixed rate (regardless of how long they took), so that every run renders the exact same frames
+	double ticksPerMillisecond = (double)PlatformGetMonotonicTicksPerSecond() / MILLISECONDS_PER_SECOND;
+	double totalFrameTime = 0;
+	double highestFrameTime = 0;
+	int measuredFrameCount = 0;
+	uint64 benchmarkStartTime = 0;
+	for(int frameIndex = 0;; ++frameIndex) {
+		bool isWarmupFrame = frameIndex < BENCHMARK_WARMUP_FRAME_COUNT;
+		if(frameIndex == BENCHMARK_WARMUP_FRAME_COUNT) benchmarkStartTime = PlatformGetMonotonicTicks();
+		if(!isWarmupFrame) {
+			seconds elapsed = (seconds)((double)(PlatformGetMonotonicTicks() - benchmarkStartTime) / (double)PlatformGetMonotonicTicksPerSecond());
+			bool isDone = (options.duration > 0) ? (elapsed >= options.duration) : (measuredFrameCount >= options.frameCount);
+			if(isDone) {
+				results.elapsedTime = elapsed;
+				break;
+			}
+		}
+
+		milliseconds uptime = (milliseconds)frameIndex * MAX_FRAME_TIME;
+		uint64 before = PlatformGetMonotonicTicks();
+		advanceSimulation(simulation, controllerInputs, bitmap, uptime, persistentStorage, transientStorage);
+		double frameTime = (double)(PlatformGetMonotonicTicks() - before) / ticksPerMillisecond;
+		BitmapClearDirtyRegions(bitmap);
+
+		if(isWarmupFrame) continue;
+		HistogramRecordValue(BENCHMARK_FRAME_TIMES, (milliseconds)frameTime);
+		totalFrameTime += frameTime;
+		highestFrameTime = Max(highestFrameTime, frameTime);
+		measuredFrameCount++;
+	}
+
+	constexpr double FRAME_TIME_PERCENTILES[] = { 50.0, 90.0, 99.0, 99.9 };
+	milliseconds frameTimePercentiles[4];
+	HistogramGetPercentiles(&BENCHMARK_FRAME_TIMES, 1, FRAME_TIME_PERCENTILES, frameTimePercentiles, 4);
+
+	double meanFrameTime = totalFrameTime / (double)Max(measuredFrameCount, 1);
+	results.measuredFrameCount = measuredFrameCount;
+	results.metrics[BENCHMARK_METRIC_FRAME_TIME_MEAN] = meanFrameTime;
+	results.metrics[BENCHMARK_METRIC_FRAME_TIME_P50] = frameTimePercentiles[0];
+	results.metrics[BENCHMARK_METRIC_FRAME_TIME_P90] = frameTimePercentiles[1];
+	results.metrics[BENCHMARK_METRIC_FRAME_TIME_P99] = frameTimePercentiles[2];
+	results.metrics[BENCHMARK_METRIC_FRAME_TIME_P999] = frameTimePercentiles[3];
+	results.metrics[BENCHMARK_METRIC_FRAME_TIME_MAX] = highestFrameTime;
+	results.metrics[BENCHMARK_METRIC_NANOSECONDS_PER_PIXEL] = meanFrameTime * 1e6 / ((double)options.width * (double)options.height);
+}
+
+INTERNAL bool BenchmarkRunApplication(benchmark_options_t& options, advance_simulation_fn_t advanceSimulation, benchmark_results_t& results) {
+	size_t pixelBufferSize = (size_t)options.width * (size_t)options.height * sizeof(uint32);
+	offscreen_buffer_t bitmap = {
+		.width = options.width,
+		.height = options.height,
+		.bytesPerPixel = sizeof(uint32),
+		.stride = options.width * (int)sizeof(uint32),
+		.pixelBuffer = PlatformAllocateMemory(pixelBufferSize),
+		.dirtyRegions = {},
+	};
+
+	memory_arena_t persistentStorage = {
+		.displayName = StringLiteral("Main Memory"),
+		.lifetime = KEEP_FOREVER_MANUAL_RESET,
+		.usage = PREALLOCATED_ON_LOAD,
+		.baseAddress = PlatformAllocateMemory(BENCHMARK_MAIN_MEMORY_SIZE),
+		.reservedSize = BENCHMARK_MAIN_MEMORY_SIZE,
+		.committedSize = BENCHMARK_MAIN_MEMORY_SIZE,
+		.used = 0,
+		.allocationCount = 0,
+	};
+	memory_arena_t transientStorage = {
+		.displayName = StringLiteral("Transient Memory"),
+		.lifetime = KEEP_FOREVER_MANUAL_RESET,
+		.usage = PREALLOCATED_ON_LOAD,
+		.baseAddress = PlatformAllocateMemory(BENCHMARK_TRANSIENT_MEMORY_SIZE),
+		.reservedSize = BENCHMARK_TRANSIENT_MEMORY_SIZE,
+		.committedSize = BENCHMARK_TRANSIENT_MEMORY_SIZE,
+		.used = 0,
+		.allocationCount = 0,
+	};
+
+	bool hasAllocatedEverything = bitmap.pixelBuffer && persistentStorage.baseAddress && transientStorage.baseAddress;
+	if(hasAllocatedEverything) BenchmarkMeasureFrames(options, advanceSimulation, bitmap, persistentStorage, transientStorage, results);
+	else {
+		size_t requestedSize = pixelBufferSize + (size_t)BENCHMARK_MAIN_MEMORY_SIZE + (size_t)BENCHMARK_TRANSIENT_MEMORY_SIZE;
+		fprintf(stderr, "Failed to allocate memory for the benchmark (%zu MB requested)\n", requestedSize / (size_t)Megabytes(1));
+	}
+
+	// Some of the allocations may have succeeded even if the benchmark couldn't run
+	if(transientStorage.baseAddress) PlatformFreeMemory(transientStorage.baseAddress, BENCHMARK_TRANSIENT_MEMORY_SIZE);
+	if(persistentStorage.baseAddress) PlatformFreeMemory(persistentStorage.baseAddress, BENCHMARK_MAIN_MEMORY_SIZE);
+	if(bitmap.pixelBuffer) PlatformFreeMemory(bitmap.pixelBuffer, pixelBufferSize);
+	return hasAllocatedEverything;
+}
+
+// NOTE: Every run renders the same frames, but only if the app, resolution, and frame count (or duration) all match
+INTERNAL void BenchmarkFormatConfiguration(benchmark_options_t& options, char* buffer, size_t bufferSize) {
+	if(options.duration > 0) {
+		snprintf(buffer, bufferSize, "app=%s resolution=%dx%d duration=%.1fs", options.appName, options.width, options.height, options.duration);
+		return;
+	}
+	snprintf(buffer, bufferSize, "app=%s resolution=%dx%d frames=%d", options.appName, options.width, options.height, options.frameCount);
+}
+
+// Format: One metric per line (name, value, and regression threshold in percent) - the output can be used as a baseline
+INTERNAL void BenchmarkWriteResults(FILE* stream, benchmark_options_t& options, benchmark_results_t& results) {
+	char configuration[BENCHMARK_MAX_CONFIGURATION_LENGTH];
+	BenchmarkFormatConfiguration(options, configuration, sizeof(configuration));
+	fprintf(stream, "# RagLite2 benchmark (commit: %s)\n", RAGLITE_COMMIT_HASH);
+	fprintf(stream, "%s%s\n", BENCHMARK_CONFIGURATION_PREFIX, configuration);
+	fprintf(stream, "# measured: frames=%d elapsed=%.2fs\n", results.measuredFrameCount, results.elapsedTime);
+	for(int metric = 0; metric < BENCHMARK_METRIC_COUNT; ++metric)
+		fprintf(stream, "%s %.6f %.1f\n", BENCHMARK_METRIC_NAMES[metric], results.metrics[metric], options.defaultThreshold);
+}
+
+INTERNAL int BenchmarkReadBaseline(const char* filePath, percentage defaultThreshold) {
+	FILE* baselineFile = fopen(filePath, "r");
+	if(!baselineFile) return -1;
+
+	char line[256];
+	int entryCount = 0;
+	BENCHMARK_BASELINE_CONFIGURATION[0] = '\0';
+	size_t prefixLength = strlen(BENCHMARK_CONFIGURATION_PREFIX);
+	while(fgets(line, sizeof(line), baselineFile) && entryCount < BENCHMARK_MAX_BASELINE_METRICS) {
+		if(strncmp(line, BENCHMARK_CONFIGURATION_PREFIX, prefixLength) == 0) {
+			snprintf(BENCHMARK_BASELINE_CONFIGURATION, sizeof(BENCHMARK_BASELINE_CONFIGURATION), "%s", line + prefixLength);
+			BENCHMARK_BASELINE_CONFIGURATION[strcspn(BENCHMARK_BASELINE_CONFIGURATION, "\r\n")] = '\0';
+			continue;
+		}
+		if(line[0] == '#') continue;
+
+		benchmark_baseline_entry_t& entry = BENCHMARK_BASELINE[entryCount];
+		entry.threshold = defaultThreshold; // Optional (hand-edited baselines may omit it)
+		int parsedFieldCount = sscanf(line, "%63s %lf %f", entry.name, &entry.value, &entry.threshold);
+		if(parsedFieldCount < 2) continue; // Blank or malformed line
+		entryCount++;
+	}
+
+	fclose(baselineFile);
+	return entryCount;
+}
+
+INTERNAL int BenchmarkCompareWithBaseline(benchmark_results_t& results, int baselineEntryCount) {
+	printf("%-24s %12s %12s %9s %9s %10s\n", "Metric", "Baseline", "Current", "Change", "Allowed", "Result");
+
+	int regressionCount = 0;
+	for(int index = 0; index < baselineEntryCount; ++index) {
+		benchmark_baseline_entry_t& entry = BENCHMARK_BASELINE[index];
+		int metric = 0;
+		while(metric < BENCHMARK_METRIC_COUNT && strcmp(BENCHMARK_METRIC_NAMES[metric], entry.name) != 0)
+			metric++;
+		if(metric == BENCHMARK_METRIC_COUNT) {
+			printf("%-24s %12.4f %12s %9s %8.1f%% %10s\n", entry.name, entry.value, "-", "-", entry.threshold, "UNKNOWN");
+			continue;
+		}
+
+		double current = results.metrics[metric];
+		double change = (entry.value > 0) ? (current - entry.value) / entry.value * 100.0 : 0.0;
+		bool isRegression = change > entry.threshold;
+		if(isRegression) regressionCount++;
+
+		const char* verdict = isRegression ? "REGRESSED" : (change < -entry.threshold ? "IMPROVED" : "OK");
+		printf("%-24s %12.4f %12.4f %+8.1f%% %8.1f%% %10s\n", entry.name, entry.value, current, change, entry.threshold, verdict);
+	}
+	return regressionCount;
+}
+
+INTERNAL int BenchmarkRunFromCommandLine(int argc, char** argv) {
+	benchmark_options_t options;
+	if(!BenchmarkParseArguments(argc, argv, options)) return BENCHMARK_EXIT_ERROR;
+
+	advance_simulation_fn_t advanceSimulation = BenchmarkLoadApplication(options.appName, argv[0]);
+	if(!advanceSimulation) {
+		fprintf(stderr, "Failed to load app %s (is its module in the same directory as the executable?)\n", options.appName);
+		return BENCHMARK_EXIT_ERROR;
+	}
+
+	if(options.duration > 0) printf("Running %s at %dx%d for %.1f seconds...\n", options.appName, options.width, options.height, options.duration);
+	else printf("Running %s at %dx%d for %d frames...\n", options.appName, options.width, options.height, options.frameCount);
+
+	benchmark_results_t results = {};
+	if(!BenchmarkRunApplication(options, advanceSimulation, results)) return BENCHMARK_EXIT_ERROR;
+	BenchmarkWriteResults(stdout, options, results);
+
+	if(options.outputFilePath) {
+		FILE* outputFile = fopen(options.outputFilePath, "w");
+		if(!outputFile) {
+			fprintf(stderr, "Failed to open %s for writing\n", options.outputFilePath);
+			return BENCHMARK_EXIT_ERROR;
+		}
+		BenchmarkWriteResults(outputFile, options, results);
+		fclose(outputFile);
+	}
+
+	if(!options.baselineFilePath) return BENCHMARK_EXIT_SUCCESS;
+
+	int baselineEntryCount = BenchmarkReadBaseline(options.baselineFilePath, options.defaultThreshold);
+	if(baselineEntryCount < 0) {
+		fprintf(stderr, "Failed to read baseline from %s\n", options.baselineFilePath);
+		return BENCHMARK_EXIT_ERROR;
+	}
+
+	char configuration[BENCHMARK_MAX_CONFIGURATION_LENGTH];
+	BenchmarkFormatConfiguration(options, configuration, sizeof(configuration));
+	if(BENCHMARK_BASELINE_CONFIGURATION[0] && strcmp(configuration, BENCHMARK_BASELINE_CONFIGURATION) != 0) {
+		fprintf(stderr, "WARNING: The baseline was recorded with a different configuration (%s), so the results may not be comparable\n",
+			BENCHMARK_BASELINE_CONFIGURATION);
+	}
+
+	int regressionCount = BenchmarkCompareWithBaseline(results, baselineEntryCount);
+	if(regressionCount == 0) printf("SUCCESS: No regressions compared to baseline %s\n", options.baselineFilePath);
+	else fprintf(stderr, "FAILED: %d metrics regressed compared to baseline %s\n", regressionCount, options.baselineFilePath);
+
+	return (regressionCount == 0) ? BENCHMARK_EXIT_SUCCESS : BENCHMARK_EXIT_REGRESSION;
+}
\ No newline at end of file
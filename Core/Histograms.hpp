@@ -0,0 +1,121 @@
+// NOTE: Log-linear buckets (as in HdrHistogram) - each power of two is split into equally-sized sub-buckets, which bounds
+// the relative error of any reported percentile to 1/HISTOGRAM_SUB_BUCKET_COUNT regardless of the order of magnitude
+constexpr int HISTOGRAM_SUB_BUCKET_BITS = 5;
+constexpr uint64 HISTOGRAM_SUB_BUCKET_COUNT = 1ULL << HISTOGRAM_SUB_BUCKET_BITS;
+constexpr int HISTOGRAM_HIGHEST_TRACKED_BIT = 31; // Slightly more than half an hour (in microseconds)
+constexpr uint64 HISTOGRAM_HIGHEST_TRACKED_VALUE = (1ULL << (HISTOGRAM_HIGHEST_TRACKED_BIT + 1)) - 1;
+constexpr int HISTOGRAM_BUCKET_COUNT = (int)HISTOGRAM_SUB_BUCKET_COUNT * (HISTOGRAM_HIGHEST_TRACKED_BIT - HISTOGRAM_SUB_BUCKET_BITS + 2);
+constexpr double MICROSECONDS_PER_MILLISECOND = 1000.0;
+
+typedef struct latency_histogram {
+	uint32 counts[HISTOGRAM_BUCKET_COUNT];
+	uint64 totalCount;
+	uint64 highestRecordedValue;
+} latency_histogram_t;
+
+// NOTE: Sliding windows are made up of time slices, so that expired samples can be discarded in bulk
+constexpr int HISTOGRAM_WINDOW_SLICE_COUNT = 10;
+constexpr milliseconds HISTOGRAM_WINDOW_SLICE_DURATION = 1000.0f;
+typedef struct sliding_histogram_window {
+	latency_histogram_t slices[HISTOGRAM_WINDOW_SLICE_COUNT];
+	uint64 currentSliceID;
+} sliding_histogram_window_t;
+
+INTERNAL inline int HistogramGetHighestSetBit(uint64 value) {
+#ifdef RAGLITE_COMPILER_MSVC
+	unsigned long bitIndex;
+	_BitScanReverse64(&bitIndex, value);
+	return (int)bitIndex;
+#else
+	return 63 - __builtin_clzll(value);
+#endif
+}
+
+INTERNAL inline int HistogramGetBucketIndex(uint64 value) {
+	if(value < HISTOGRAM_SUB_BUCKET_COUNT) return (int)value;
+
+	int highestBit = HistogramGetHighestSetBit(value);
+	int shift = highestBit - HISTOGRAM_SUB_BUCKET_BITS;
+	int subBucket = (int)(value >> shift) - (int)HISTOGRAM_SUB_BUCKET_COUNT;
+	return (int)HISTOGRAM_SUB_BUCKET_COUNT * (shift + 1) + subBucket;
+}
+
+// Returns the highest value that maps to the same bucket (so that reported percentiles err on the conservative side)
+INTERNAL inline uint64 HistogramGetBucketUpperBound(int bucketIndex) {
+	if(bucketIndex < (int)HISTOGRAM_SUB_BUCKET_COUNT) return (uint64)bucketIndex;
+
+	int shift = bucketIndex / (int)HISTOGRAM_SUB_BUCKET_COUNT - 1;
+	uint64 subBucket = (uint64)(bucketIndex % HISTOGRAM_SUB_BUCKET_COUNT) + HISTOGRAM_SUB_BUCKET_COUNT;
+	return ((subBucket + 1) << shift) - 1;
+}
+
+INTERNAL inline void HistogramReset(latency_histogram_t& histogram) {
+	memset(&histogram, 0, sizeof(histogram));
+}
+
+INTERNAL inline void HistogramRecordValue(latency_histogram_t& histogram, milliseconds value) {
+	uint64 microseconds = (value > 0) ? (uint64)((double)value * MICROSECONDS_PER_MILLISECOND) : 0;
+	microseconds = Min(microseconds, HISTOGRAM_HIGHEST_TRACKED_VALUE);
+	histogram.counts[HistogramGetBucketIndex(microseconds)]++;
+	histogram.totalCount++;
+	histogram.highestRecordedValue = Max(histogram.highestRecordedValue, microseconds);
+}
+
+// Computes several percentiles in a single pass over the combined buckets (percentiles must be sorted in ascending order)
+INTERNAL void HistogramGetPercentiles(latency_histogram_t* histograms, int histogramCount, const double* percentiles, milliseconds* results, int percentileCount) {
+	uint64 totalCount = 0;
+	uint64 highestRecordedValue = 0;
+	for(int index = 0; index < histogramCount; ++index) {
+		totalCount += histograms[index].totalCount;
+		highestRecordedValue = Max(highestRecordedValue, histograms[index].highestRecordedValue);
+	}
+
+	for(int index = 0; index < percentileCount; ++index)
+		results[index] = 0;
+	if(totalCount == 0) return;
+
+	int percentileIndex = 0;
+	uint64 cumulativeCount = 0;
+	for(int bucketIndex = 0; bucketIndex < HISTOGRAM_BUCKET_COUNT && percentileIndex < percentileCount; ++bucketIndex) {
+		for(int index = 0; index < histogramCount; ++index)
+			cumulativeCount += histograms[index].counts[bucketIndex];
+
+		while(percentileIndex < percentileCount) {
+			uint64 rank = (uint64)ceil(percentiles[percentileIndex] / 100.0 * (double)totalCount);
+			rank = ClampToInterval(rank, 1, totalCount);
+			if(cumulativeCount < rank) break;
+
+			uint64 value = Min(HistogramGetBucketUpperBound(bucketIndex), highestRecordedValue);
+			results[percentileIndex] = (milliseconds)((double)value / MICROSECONDS_PER_MILLISECOND);
+			percentileIndex++;
+		}
+	}
+}
+
+INTERNAL uint64 HistogramCountValuesAbove(latency_histogram_t& histogram, milliseconds threshold) {
+	uint64 microseconds = (uint64)Max((double)threshold * MICROSECONDS_PER_MILLISECOND, 0.0);
+	int thresholdBucket = HistogramGetBucketIndex(Min(microseconds, HISTOGRAM_HIGHEST_TRACKED_VALUE));
+
+	// NOTE: Values sharing the threshold's bucket can't be distinguished from it, so they aren't counted
+	uint64 count = 0;
+	for(int bucketIndex = thresholdBucket + 1; bucketIndex < HISTOGRAM_BUCKET_COUNT; ++bucketIndex)
+		count += histogram.counts[bucketIndex];
+	return count;
+}
+
+INTERNAL void HistogramWindowRecordValue(sliding_histogram_window_t& window, milliseconds timestamp, milliseconds value) {
+	uint64 sliceID = (uint64)(Max(timestamp, 0.0f) / HISTOGRAM_WINDOW_SLICE_DURATION);
+	if(sliceID > window.currentSliceID) {
+		// Every slice that was skipped over has expired (e.g., after the application was suspended for a while)
+		uint64 expiredSliceCount = Min(sliceID - window.currentSliceID, (uint64)HISTOGRAM_WINDOW_SLICE_COUNT);
+		for(uint64 offset = 1; offset <= expiredSliceCount; ++offset)
+			HistogramReset(window.slices[(window.currentSliceID + offset) % HISTOGRAM_WINDOW_SLICE_COUNT]);
+		window.currentSliceID = sliceID;
+	}
+
+	HistogramRecordValue(window.slices[window.currentSliceID % HISTOGRAM_WINDOW_SLICE_COUNT], value);
+}
+
+INTERNAL inline void HistogramWindowGetPercentiles(sliding_histogram_window_t& window, const double* percentiles, milliseconds* results, int percentileCount) {
+	HistogramGetPercentiles(window.slices, HISTOGRAM_WINDOW_SLICE_COUNT, percentiles, results, percentileCount);
+}
\ No newline at end of file
@@ -45,6 +45,79 @@ INTERNAL void IntrinsicsReadCPUID() {
 
 #endif
 
+// NOTE: Only for reads that are known to be safe even though they extend past the end of an allocation (e.g., aligned loads)
+#ifdef RAGLITE_COMPILER_MSVC
+#define RAGLITE_NO_SANITIZE_ADDRESS __declspec(no_sanitize_address)
+#else
+#define RAGLITE_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#endif
+
+// NOTE: SSE2 is part of the x64 baseline, so it can be used unconditionally (wider instruction sets require detection)
+#if defined(_M_X64) || defined(__SSE2__)
+#define RAGLITE_INTRINSICS_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define RAGLITE_INTRINSICS_AVX2
+#include <immintrin.h>
+
+#ifdef RAGLITE_COMPILER_MSVC
+#define RAGLITE_TARGET_AVX2
+#else
+#define RAGLITE_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+GLOBAL int CPU_SUPPORTS_AVX2 = -1; // Unknown (detected on first use)
+
+INTERNAL bool IntrinsicsSupportsAVX2() {
+	if(CPU_SUPPORTS_AVX2 != -1) return CPU_SUPPORTS_AVX2;
+
+#ifdef RAGLITE_COMPILER_MSVC
+	int registers[4] = {};
+	__cpuid(registers, 1);
+	bool hasSavedExtendedState = (registers[2] & (1 << 27)) && (registers[2] & (1 << 28)); // OSXSAVE + AVX
+	bool isEnabledByKernel = hasSavedExtendedState && ((_xgetbv(0) & 0x6) == 0x6); // XMM + YMM state
+	__cpuidex(registers, 7, 0);
+	CPU_SUPPORTS_AVX2 = isEnabledByKernel && (registers[1] & (1 << 5));
+#else
+	CPU_SUPPORTS_AVX2 = __builtin_cpu_supports("avx2");
+#endif
+
+	return CPU_SUPPORTS_AVX2;
+}
+#endif
+
+// NOTE: The result is undefined if no bits are set (callers must check the mask first)
+INTERNAL inline int IntrinsicsFindLowestSetBit(unsigned int mask) {
+#ifdef RAGLITE_COMPILER_MSVC
+	unsigned long bitIndex;
+	_BitScanForward(&bitIndex, mask);
+	return (int)bitIndex;
+#else
+	return __builtin_ctz(mask);
+#endif
+}
+
+INTERNAL inline int IntrinsicsFindHighestSetBit(unsigned int mask) {
+#ifdef RAGLITE_COMPILER_MSVC
+	unsigned long bitIndex;
+	_BitScanReverse(&bitIndex, mask);
+	return (int)bitIndex;
+#else
+	return 31 - __builtin_clz(mask);
+#endif
+}
+
+// Returns the incremented value (with a full barrier, so that it can be used to hand out work items to any number of threads)
+INTERNAL inline long IntrinsicsAtomicIncrement(volatile long* value) {
+#ifdef RAGLITE_COMPILER_MSVC
+	return _InterlockedIncrement(value);
+#else
+	return __atomic_add_fetch(value, 1, __ATOMIC_SEQ_CST);
+#endif
+}
+
 // TODO: typeof(x) could simplify this - look into toolchain support/extensions?
 #define Swap(first, second, type) \
 	do {                          \
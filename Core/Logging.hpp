@@ -0,0 +1,667 @@
+// TODO: Eliminate this
+#include <stdarg.h>
+#include <stdio.h>
+
+// NOTE: Producers only capture the format string and raw arguments, while a background thread does all of the formatting
+// NOTE: Each thread writes into its own ring buffer, and messages are dropped (never blocking) if the logger can't keep up
+constexpr int MAX_LOGGING_THREADS = 8;
+constexpr uint64 LOGGER_RING_BUFFER_SIZE = 1024; // Must be a power of two
+constexpr int LOGGER_MAX_ARGUMENTS = 8;
+constexpr size_t LOGGER_RECORD_SIZE = 256;
+constexpr size_t LOGGER_FLUSH_BUFFER_SIZE = Kilobytes(64);
+constexpr uint64 LOGGER_SIGNATURE_CACHE_SIZE = 256; // Must be a power of two
+
+typedef struct logger_record_header {
+	const char* format; // Must be a string literal (or otherwise outlive the logger)
+	uint64 timestamp;
+	uint64 arguments[LOGGER_MAX_ARGUMENTS];
+	uint16 payloadSize;
+} logger_record_header_t;
+
+constexpr size_t LOGGER_RECORD_PAYLOAD_SIZE = LOGGER_RECORD_SIZE - sizeof(logger_record_header_t);
+
+// String arguments are copied into the payload (truncated if there isn't enough space), since they may not outlive the call
+typedef struct logger_record : logger_record_header_t {
+	char payload[LOGGER_RECORD_PAYLOAD_SIZE];
+} logger_record_t;
+
+static_assert(sizeof(logger_record_t) == LOGGER_RECORD_SIZE, "Log records should be a multiple of the cache line size");
+
+typedef enum : uint8 {
+	LOGGER_ARGUMENT_NONE,
+	LOGGER_ARGUMENT_SIGNED,
+	LOGGER_ARGUMENT_UNSIGNED,
+	LOGGER_ARGUMENT_CHARACTER,
+	LOGGER_ARGUMENT_FLOATING_POINT,
+	LOGGER_ARGUMENT_POINTER,
+	LOGGER_ARGUMENT_STRING,
+} logger_argument_t;
+
+typedef enum : uint8 {
+	LOGGER_LENGTH_DEFAULT,
+	LOGGER_LENGTH_CHAR, // hh
+	LOGGER_LENGTH_SHORT, // h
+	LOGGER_LENGTH_LONG, // l
+	LOGGER_LENGTH_LONG_LONG, // ll
+	LOGGER_LENGTH_SIZE, // z
+	LOGGER_LENGTH_MAXIMUM, // j
+	LOGGER_LENGTH_POINTER_DIFFERENCE, // t
+	LOGGER_LENGTH_LONG_DOUBLE, // L
+} logger_length_modifier_t;
+
+typedef struct logger_conversion_specifier {
+	const char* start; // The '%' character
+	const char* end; // Just past the conversion character
+	logger_argument_t type;
+	logger_length_modifier_t length;
+	bool hasVariableWidth; // '*' (consumes an additional int argument)
+	bool hasVariablePrecision; // '.*' (ditto)
+} logger_conversion_specifier_t;
+
+// Returns the next conversion specifier (or NULL at the end) - both producers and the logger thread must agree on these
+INTERNAL const char* LoggerParseNextSpecifier(const char* format, logger_conversion_specifier_t& specifier) {
+	while(*format) {
+		if(*format != '%') {
+			format++;
+			continue;
+		}
+		if(format[1] == '%') {
+			format += 2;
+			continue;
+		}
+
+		specifier = {};
+		specifier.start = format++;
+		while(*format == '-' || *format == '+' || *format == ' ' || *format == '#' || *format == '0')
+			format++;
+		if(*format == '*') {
+			specifier.hasVariableWidth = true;
+			format++;
+		}
+		while(*format >= '0' && *format <= '9')
+			format++;
+		if(*format == '.') {
+			format++;
+			if(*format == '*') {
+				specifier.hasVariablePrecision = true;
+				format++;
+			}
+			while(*format >= '0' && *format <= '9')
+				format++;
+		}
+
+		switch(*format) {
+			case 'h': {
+				format++;
+				specifier.length = (*format == 'h') ? LOGGER_LENGTH_CHAR : LOGGER_LENGTH_SHORT;
+				if(*format == 'h') format++;
+			} break;
+			case 'l': {
+				format++;
+				specifier.length = (*format == 'l') ? LOGGER_LENGTH_LONG_LONG : LOGGER_LENGTH_LONG;
+				if(*format == 'l') format++;
+			} break;
+			case 'z': {
+				format++;
+				specifier.length = LOGGER_LENGTH_SIZE;
+			} break;
+			case 'j': {
+				format++;
+				specifier.length = LOGGER_LENGTH_MAXIMUM;
+			} break;
+			case 't': {
+				format++;
+				specifier.length = LOGGER_LENGTH_POINTER_DIFFERENCE;
+			} break;
+			case 'L': {
+				format++;
+				specifier.length = LOGGER_LENGTH_LONG_DOUBLE;
+			} break;
+			default:
+				break;
+		}
+
+		switch(*format) {
+			case 'd':
+			case 'i':
+				specifier.type = LOGGER_ARGUMENT_SIGNED;
+				break;
+			case 'u':
+			case 'x':
+			case 'X':
+			case 'o':
+				specifier.type = LOGGER_ARGUMENT_UNSIGNED;
+				break;
+			case 'c':
+				specifier.type = LOGGER_ARGUMENT_CHARACTER;
+				break;
+			case 'f':
+			case 'F':
+			case 'e':
+			case 'E':
+			case 'g':
+			case 'G':
+			case 'a':
+			case 'A':
+				specifier.type = LOGGER_ARGUMENT_FLOATING_POINT;
+				break;
+			case 'p':
+				specifier.type = LOGGER_ARGUMENT_POINTER;
+				break;
+			case 's':
+				specifier.type = LOGGER_ARGUMENT_STRING;
+				break;
+			default:
+				specifier.type = LOGGER_ARGUMENT_NONE; // Unsupported (will be printed as-is)
+				break;
+		}
+		if(*format) format++;
+		specifier.end = format;
+		return format;
+	}
+	return NULL;
+}
+
+// NOTE: Parsing the format string is the most expensive part of capturing, so each thread caches the results by address
+typedef enum : uint8 {
+	LOGGER_CAPTURE_INT,
+	LOGGER_CAPTURE_UNSIGNED_INT,
+	LOGGER_CAPTURE_SIGNED_CHAR,
+	LOGGER_CAPTURE_UNSIGNED_CHAR,
+	LOGGER_CAPTURE_SHORT,
+	LOGGER_CAPTURE_UNSIGNED_SHORT,
+	LOGGER_CAPTURE_LONG,
+	LOGGER_CAPTURE_UNSIGNED_LONG,
+	LOGGER_CAPTURE_INT64, // Also used for sizes and pointer differences (64 bits wide on the supported platforms)
+	LOGGER_CAPTURE_UNSIGNED_INT64,
+	LOGGER_CAPTURE_DOUBLE,
+	LOGGER_CAPTURE_LONG_DOUBLE, // Narrowed to double (the extra precision is lost, but the value is still printed)
+	LOGGER_CAPTURE_POINTER,
+	LOGGER_CAPTURE_STRING,
+	LOGGER_CAPTURE_WIDE_CHARACTER, // Stored as UTF-8 in the payload (and then printed like a regular string)
+	LOGGER_CAPTURE_WIDE_STRING, // Ditto
+} logger_capture_t;
+
+typedef struct logger_format_signature {
+	const char* format;
+	uint8 argumentCount;
+	logger_capture_t captures[LOGGER_MAX_ARGUMENTS];
+} logger_format_signature_t;
+
+INTERNAL logger_capture_t LoggerGetIntegerCapture(logger_conversion_specifier_t& specifier) {
+	bool isSigned = specifier.type == LOGGER_ARGUMENT_SIGNED;
+	switch(specifier.length) {
+		case LOGGER_LENGTH_CHAR:
+			return isSigned ? LOGGER_CAPTURE_SIGNED_CHAR : LOGGER_CAPTURE_UNSIGNED_CHAR;
+		case LOGGER_LENGTH_SHORT:
+			return isSigned ? LOGGER_CAPTURE_SHORT : LOGGER_CAPTURE_UNSIGNED_SHORT;
+		case LOGGER_LENGTH_LONG:
+			return isSigned ? LOGGER_CAPTURE_LONG : LOGGER_CAPTURE_UNSIGNED_LONG;
+		case LOGGER_LENGTH_LONG_LONG:
+		case LOGGER_LENGTH_LONG_DOUBLE: // Non-standard, but that's how glibc interprets it
+		case LOGGER_LENGTH_SIZE:
+		case LOGGER_LENGTH_MAXIMUM:
+		case LOGGER_LENGTH_POINTER_DIFFERENCE:
+			return isSigned ? LOGGER_CAPTURE_INT64 : LOGGER_CAPTURE_UNSIGNED_INT64;
+		default:
+			return isSigned ? LOGGER_CAPTURE_INT : LOGGER_CAPTURE_UNSIGNED_INT;
+	}
+}
+
+INTERNAL void LoggerParseFormatSignature(const char* format, logger_format_signature_t& signature) {
+	signature.format = format;
+	signature.argumentCount = 0;
+
+	logger_conversion_specifier_t specifier;
+	while((format = LoggerParseNextSpecifier(format, specifier)) != NULL) {
+		// Variable widths and precisions are stored as if they were separate arguments (which is what they are)
+		logger_capture_t captures[3];
+		int captureCount = 0;
+		if(specifier.hasVariableWidth) captures[captureCount++] = LOGGER_CAPTURE_INT;
+		if(specifier.hasVariablePrecision) captures[captureCount++] = LOGGER_CAPTURE_INT;
+		switch(specifier.type) {
+			case LOGGER_ARGUMENT_SIGNED:
+			case LOGGER_ARGUMENT_UNSIGNED:
+				captures[captureCount++] = LoggerGetIntegerCapture(specifier);
+				break;
+			case LOGGER_ARGUMENT_CHARACTER:
+				captures[captureCount++] = (specifier.length == LOGGER_LENGTH_LONG) ? LOGGER_CAPTURE_WIDE_CHARACTER : LOGGER_CAPTURE_INT;
+				break;
+			case LOGGER_ARGUMENT_FLOATING_POINT:
+				captures[captureCount++] = (specifier.length == LOGGER_LENGTH_LONG_DOUBLE) ? LOGGER_CAPTURE_LONG_DOUBLE : LOGGER_CAPTURE_DOUBLE;
+				break;
+			case LOGGER_ARGUMENT_POINTER:
+				captures[captureCount++] = LOGGER_CAPTURE_POINTER;
+				break;
+			case LOGGER_ARGUMENT_STRING:
+				captures[captureCount++] = (specifier.length == LOGGER_LENGTH_LONG) ? LOGGER_CAPTURE_WIDE_STRING : LOGGER_CAPTURE_STRING;
+				break;
+			default:
+				break;
+		}
+
+		// Any remaining arguments will be displayed as missing (the formatter stops at the same point)
+		if(signature.argumentCount + captureCount > LOGGER_MAX_ARGUMENTS) return;
+		for(int index = 0; index < captureCount; ++index)
+			signature.captures[signature.argumentCount++] = captures[index];
+	}
+}
+
+// Appends the text to the payload and returns its offset (the string is always terminated, even if it had to be truncated)
+INTERNAL uint64 LoggerCaptureString(logger_record_t& record, const char* text, size_t length) {
+	uint64 offset = record.payloadSize;
+	size_t remainingSize = LOGGER_RECORD_PAYLOAD_SIZE - record.payloadSize;
+	size_t copiedLength = Min(length, remainingSize - 1);
+	memcpy(record.payload + record.payloadSize, text, copiedLength);
+	record.payload[record.payloadSize + copiedLength] = '\0';
+	record.payloadSize = (uint16)Min(record.payloadSize + copiedLength + 1, LOGGER_RECORD_PAYLOAD_SIZE - 1);
+	return offset;
+}
+
+// Returns the number of bytes written (invalid code points are replaced with U+FFFD)
+INTERNAL size_t LoggerEncodeUTF8(uint32 codePoint, char* output) {
+	bool isSurrogate = codePoint >= 0xD800 && codePoint <= 0xDFFF;
+	if(isSurrogate || codePoint > 0x10FFFF) codePoint = 0xFFFD;
+
+	if(codePoint < 0x80) {
+		output[0] = (char)codePoint;
+		return 1;
+	}
+	if(codePoint < 0x800) {
+		output[0] = (char)(0xC0 | (codePoint >> 6));
+		output[1] = (char)(0x80 | (codePoint & 0x3F));
+		return 2;
+	}
+	if(codePoint < 0x10000) {
+		output[0] = (char)(0xE0 | (codePoint >> 12));
+		output[1] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+		output[2] = (char)(0x80 | (codePoint & 0x3F));
+		return 3;
+	}
+	output[0] = (char)(0xF0 | (codePoint >> 18));
+	output[1] = (char)(0x80 | ((codePoint >> 12) & 0x3F));
+	output[2] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+	output[3] = (char)(0x80 | (codePoint & 0x3F));
+	return 4;
+}
+
+// NOTE: Wide strings are UTF-16 on Windows and UTF-32 elsewhere, so surrogate pairs only need to be combined on the former
+INTERNAL uint64 LoggerCaptureWideString(logger_record_t& record, const wchar_t* text) {
+	constexpr size_t MAX_ENCODED_LENGTH = LOGGER_RECORD_PAYLOAD_SIZE;
+	char encoded[MAX_ENCODED_LENGTH];
+	size_t encodedLength = 0;
+	while(*text && encodedLength + 4 <= MAX_ENCODED_LENGTH) {
+		uint32 codePoint = (uint32)*text++;
+		bool isHighSurrogate = sizeof(wchar_t) == 2 && codePoint >= 0xD800 && codePoint <= 0xDBFF;
+		if(isHighSurrogate && (uint32)*text >= 0xDC00 && (uint32)*text <= 0xDFFF) {
+			codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + ((uint32)*text++ - 0xDC00);
+		}
+		encodedLength += LoggerEncodeUTF8(codePoint, encoded + encodedLength);
+	}
+	return LoggerCaptureString(record, encoded, encodedLength);
+}
+
+INTERNAL void LoggerCaptureArguments(logger_record_t& record, logger_format_signature_t& signature, va_list& arguments) {
+	record.payloadSize = 0;
+	for(int index = 0; index < signature.argumentCount; ++index) {
+		uint64& argument = record.arguments[index];
+		switch(signature.captures[index]) {
+			case LOGGER_CAPTURE_INT:
+				argument = (uint64)(int64)va_arg(arguments, int);
+				break;
+			case LOGGER_CAPTURE_UNSIGNED_INT:
+				argument = (uint64)va_arg(arguments, unsigned int);
+				break;
+			case LOGGER_CAPTURE_SIGNED_CHAR:
+				argument = (uint64)(int64)(signed char)va_arg(arguments, int);
+				break;
+			case LOGGER_CAPTURE_UNSIGNED_CHAR:
+				argument = (uint64)(unsigned char)va_arg(arguments, unsigned int);
+				break;
+			case LOGGER_CAPTURE_SHORT:
+				argument = (uint64)(int64)(short)va_arg(arguments, int);
+				break;
+			case LOGGER_CAPTURE_UNSIGNED_SHORT:
+				argument = (uint64)(unsigned short)va_arg(arguments, unsigned int);
+				break;
+			case LOGGER_CAPTURE_LONG:
+				argument = (uint64)(int64)va_arg(arguments, long);
+				break;
+			case LOGGER_CAPTURE_UNSIGNED_LONG:
+				argument = (uint64)va_arg(arguments, unsigned long);
+				break;
+			case LOGGER_CAPTURE_INT64:
+				argument = (uint64)va_arg(arguments, long long);
+				break;
+			case LOGGER_CAPTURE_UNSIGNED_INT64:
+				argument = (uint64)va_arg(arguments, unsigned long long);
+				break;
+			case LOGGER_CAPTURE_DOUBLE: {
+				double value = va_arg(arguments, double);
+				memcpy(&argument, &value, sizeof(value));
+			} break;
+			case LOGGER_CAPTURE_LONG_DOUBLE: {
+				double value = (double)va_arg(arguments, long double);
+				memcpy(&argument, &value, sizeof(value));
+			} break;
+			case LOGGER_CAPTURE_POINTER:
+				argument = (uint64)va_arg(arguments, void*);
+				break;
+			case LOGGER_CAPTURE_STRING: {
+				const char* text = va_arg(arguments, const char*);
+				if(!text) text = "(null)";
+				argument = LoggerCaptureString(record, text, strlen(text));
+			} break;
+			case LOGGER_CAPTURE_WIDE_CHARACTER: {
+				// NOTE: wint_t is promoted to int when passed through the ellipsis (it's only 16 bits wide on Windows)
+				wchar_t text[] = { (wchar_t)va_arg(arguments, int), L'\0' };
+				argument = LoggerCaptureWideString(record, text);
+			} break;
+			case LOGGER_CAPTURE_WIDE_STRING: {
+				const wchar_t* text = va_arg(arguments, const wchar_t*);
+				if(!text) text = L"(null)";
+				argument = LoggerCaptureWideString(record, text);
+			} break;
+		}
+	}
+}
+
+typedef struct logger_thread_buffer {
+	logger_record_t records[LOGGER_RING_BUFFER_SIZE];
+	volatile uint64 writeIndex; // Only ever advanced by the owning thread
+	volatile uint64 readIndex; // Only ever advanced by the logger thread
+	volatile uint64 droppedRecordCount; // Only ever advanced by the owning thread
+	uint64 reportedDroppedRecordCount;
+	logger_format_signature_t cachedSignatures[LOGGER_SIGNATURE_CACHE_SIZE];
+} logger_thread_buffer_t;
+
+typedef struct logger_state {
+	FILE* outputStream;
+	platform_thread_t backgroundThread;
+	platform_semaphore_t wakeupSignal;
+	volatile uint64 isWaitingForRecords; // Producers only have to signal the logger thread while this is set
+	volatile uint64 isShuttingDown;
+	bool isRunning;
+	size_t flushBufferUsed;
+	char flushBuffer[LOGGER_FLUSH_BUFFER_SIZE];
+} logger_state_t;
+
+GLOBAL logger_thread_buffer_t LOGGER_THREAD_BUFFERS[MAX_LOGGING_THREADS] = {};
+GLOBAL volatile long LOGGER_REGISTERED_THREAD_COUNT = 0;
+GLOBAL thread_local logger_thread_buffer_t* LOGGER_CURRENT_THREAD_BUFFER = nullptr;
+GLOBAL logger_state_t LOGGER_STATE = {};
+
+INTERNAL logger_thread_buffer_t* LoggerGetThreadBuffer() {
+	if(LOGGER_CURRENT_THREAD_BUFFER) return LOGGER_CURRENT_THREAD_BUFFER;
+
+	long slot = IntrinsicsAtomicIncrement(&LOGGER_REGISTERED_THREAD_COUNT) - 1;
+	if(slot >= MAX_LOGGING_THREADS) return nullptr; // Messages logged by any additional threads are simply dropped
+
+	LOGGER_CURRENT_THREAD_BUFFER = &LOGGER_THREAD_BUFFERS[slot];
+	return LOGGER_CURRENT_THREAD_BUFFER;
+}
+
+INTERNAL inline int LoggerGetRegisteredThreadCount() {
+	return Min((int)LOGGER_REGISTERED_THREAD_COUNT, MAX_LOGGING_THREADS);
+}
+
+#ifdef RAGLITE_COMPILER_MSVC
+INTERNAL void LoggerWrite(_Printf_format_string_ const char* format, ...) {
+#else
+__attribute__((format(printf, 1, 2))) INTERNAL void LoggerWrite(const char* format, ...) {
+#endif
+	uint64 timestamp = PlatformGetMonotonicTicks();
+	logger_thread_buffer_t* buffer = LoggerGetThreadBuffer();
+	if(!buffer) return;
+
+	uint64 writeIndex = buffer->writeIndex;
+	uint64 readIndex = ProfilerAtomicLoadAcquire(&buffer->readIndex);
+	if(writeIndex - readIndex >= LOGGER_RING_BUFFER_SIZE) {
+		ProfilerAtomicStoreRelease(&buffer->droppedRecordCount, buffer->droppedRecordCount + 1);
+		return;
+	}
+
+	// NOTE: Format strings are literals, so their addresses are good enough to identify them (hashed like pointers usually are)
+	uint64 cacheIndex = ((uint64)format >> 4) & (LOGGER_SIGNATURE_CACHE_SIZE - 1);
+	logger_format_signature_t& signature = buffer->cachedSignatures[cacheIndex];
+	if(signature.format != format) LoggerParseFormatSignature(format, signature);
+
+	logger_record_t& record = buffer->records[writeIndex & (LOGGER_RING_BUFFER_SIZE - 1)];
+	record.format = format;
+	record.timestamp = timestamp;
+
+	va_list arguments;
+	va_start(arguments, format);
+	LoggerCaptureArguments(record, signature, arguments);
+	va_end(arguments);
+
+	ProfilerAtomicStoreRelease(&buffer->writeIndex, writeIndex + 1);
+
+	// NOTE: The fence pairs with the one in the logger thread (either it sees the new record, or this sees it waiting)
+	ProfilerAtomicFenceSequential();
+	if(ProfilerAtomicLoadAcquire(&LOGGER_STATE.isWaitingForRecords)) PlatformSignalSemaphore(LOGGER_STATE.wakeupSignal);
+}
+
+#define LOG(...) LoggerWrite(__VA_ARGS__)
+
+INTERNAL void LoggerFlushOutput(logger_state_t& logger) {
+	if(logger.flushBufferUsed == 0) return;
+	fwrite(logger.flushBuffer, 1, logger.flushBufferUsed, logger.outputStream);
+	fflush(logger.outputStream);
+	logger.flushBufferUsed = 0;
+}
+
+INTERNAL void LoggerAppendText(logger_state_t& logger, const char* text, size_t length) {
+	while(length > 0) {
+		if(logger.flushBufferUsed == LOGGER_FLUSH_BUFFER_SIZE) LoggerFlushOutput(logger);
+		size_t copiedLength = Min(length, LOGGER_FLUSH_BUFFER_SIZE - logger.flushBufferUsed);
+		memcpy(logger.flushBuffer + logger.flushBufferUsed, text, copiedLength);
+		logger.flushBufferUsed += copiedLength;
+		text += copiedLength;
+		length -= copiedLength;
+	}
+}
+
+INTERNAL void LoggerFormatRecord(logger_state_t& logger, logger_record_t& record) {
+	constexpr size_t MAX_SPECIFIER_LENGTH = 32;
+	constexpr size_t MAX_FORMATTED_ARGUMENT_LENGTH = 512;
+	char specifierBuffer[MAX_SPECIFIER_LENGTH];
+	char formattedArgument[MAX_FORMATTED_ARGUMENT_LENGTH];
+
+	int argumentIndex = 0;
+	bool hasMissingArguments = false;
+	const char* literalStart = record.format;
+	const char* format = record.format;
+	logger_conversion_specifier_t specifier;
+	while((format = LoggerParseNextSpecifier(format, specifier)) != NULL) {
+		// Literal text (with any escaped percent signs collapsed, like printf does)
+		for(const char* character = literalStart; character < specifier.start; ++character) {
+			LoggerAppendText(logger, character, 1);
+			if(character[0] == '%' && character[1] == '%') character++;
+		}
+		literalStart = specifier.end;
+
+		// NOTE: Once the capture stopped (too many arguments), nothing after that point can be matched up anymore
+		int neededArgumentCount = (specifier.type != LOGGER_ARGUMENT_NONE) + specifier.hasVariableWidth + specifier.hasVariablePrecision;
+		size_t specifierLength = (size_t)(specifier.end - specifier.start);
+		hasMissingArguments = hasMissingArguments || (argumentIndex + neededArgumentCount > LOGGER_MAX_ARGUMENTS);
+		// NOTE: Precision is undefined for characters and pointers, so a variable one can't be forwarded (wide characters become strings, which is fine)
+		bool isNarrowCharacter = specifier.type == LOGGER_ARGUMENT_CHARACTER && specifier.length != LOGGER_LENGTH_LONG;
+		bool hasInvalidPrecision = specifier.hasVariablePrecision && (isNarrowCharacter || specifier.type == LOGGER_ARGUMENT_POINTER);
+		if(hasMissingArguments || hasInvalidPrecision || specifier.type == LOGGER_ARGUMENT_NONE || specifierLength >= MAX_SPECIFIER_LENGTH) {
+			LoggerAppendText(logger, specifier.start, specifierLength);
+			if(!hasMissingArguments) argumentIndex += neededArgumentCount;
+			continue;
+		}
+
+		int width = specifier.hasVariableWidth ? (int)record.arguments[argumentIndex++] : 0;
+		int precision = specifier.hasVariablePrecision ? (int)record.arguments[argumentIndex++] : 0;
+		uint64 argument = record.arguments[argumentIndex++];
+
+		// Wide characters were converted to (narrow) strings when they were captured
+		logger_argument_t formattedType = specifier.type;
+		char conversion = specifier.end[-1];
+		if(specifier.type == LOGGER_ARGUMENT_CHARACTER && specifier.length == LOGGER_LENGTH_LONG) {
+			formattedType = LOGGER_ARGUMENT_STRING;
+			conversion = 's';
+		}
+
+		// NOTE: Arguments were widened (or narrowed) when they were captured, so the length modifier has to be replaced to match
+		char* specifierEnd = specifierBuffer;
+		for(const char* character = specifier.start; character < specifier.end - 1; ++character) {
+			char modifier = *character;
+			if(modifier == 'h' || modifier == 'l' || modifier == 'L' || modifier == 'z' || modifier == 'j' || modifier == 't') continue;
+			*specifierEnd++ = modifier;
+		}
+		bool isInteger = specifier.type == LOGGER_ARGUMENT_SIGNED || specifier.type == LOGGER_ARGUMENT_UNSIGNED;
+		if(isInteger) {
+			*specifierEnd++ = 'l';
+			*specifierEnd++ = 'l';
+		}
+		*specifierEnd++ = conversion;
+		*specifierEnd = '\0';
+
+		// Variable widths/precisions are passed even if unused (printf ignores any excess arguments)
+		int formattedLength = 0;
+		switch(formattedType) {
+			case LOGGER_ARGUMENT_SIGNED: {
+				long long value = (long long)argument;
+				if(specifier.hasVariableWidth && specifier.hasVariablePrecision) formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, width, precision, value);
+				else if(specifier.hasVariableWidth) formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, width, value);
+				else if(specifier.hasVariablePrecision) formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, precision, value);
+				else formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, value);
+			} break;
+			case LOGGER_ARGUMENT_UNSIGNED: {
+				unsigned long long value = (unsigned long long)argument;
+				if(specifier.hasVariableWidth && specifier.hasVariablePrecision) formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, width, precision, value);
+				else if(specifier.hasVariableWidth) formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, width, value);
+				else if(specifier.hasVariablePrecision) formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, precision, value);
+				else formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, value);
+			} break;
+			case LOGGER_ARGUMENT_CHARACTER: {
+				int value = (int)argument;
+				if(specifier.hasVariableWidth) formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, width, value);
+				else formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, value);
+			} break;
+			case LOGGER_ARGUMENT_FLOATING_POINT: {
+				double value;
+				memcpy(&value, &argument, sizeof(value));
+				if(specifier.hasVariableWidth && specifier.hasVariablePrecision) formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, width, precision, value);
+				else if(specifier.hasVariableWidth) formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, width, value);
+				else if(specifier.hasVariablePrecision) formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, precision, value);
+				else formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, value);
+			} break;
+			case LOGGER_ARGUMENT_POINTER: {
+				void* value = (void*)argument;
+				if(specifier.hasVariableWidth) formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, width, value);
+				else formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, value);
+			} break;
+			case LOGGER_ARGUMENT_STRING: {
+				const char* value = record.payload + Min(argument, LOGGER_RECORD_PAYLOAD_SIZE - 1);
+				if(specifier.hasVariableWidth && specifier.hasVariablePrecision) formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, width, precision, value);
+				else if(specifier.hasVariableWidth) formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, width, value);
+				else if(specifier.hasVariablePrecision) formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, precision, value);
+				else formattedLength = snprintf(formattedArgument, sizeof(formattedArgument), specifierBuffer, value);
+			} break;
+			default:
+				break;
+		}
+		if(formattedLength > 0) LoggerAppendText(logger, formattedArgument, Min((size_t)formattedLength, sizeof(formattedArgument) - 1));
+	}
+
+	for(const char* character = literalStart; *character; ++character) {
+		LoggerAppendText(logger, character, 1);
+		if(character[0] == '%' && character[1] == '%') character++;
+	}
+}
+
+// Returns the number of records that were written (in chronological order, even if they came from different threads)
+INTERNAL size_t LoggerDrainRecords(logger_state_t& logger) {
+	uint64 writeIndices[MAX_LOGGING_THREADS];
+	int threadCount = LoggerGetRegisteredThreadCount();
+	for(int slot = 0; slot < threadCount; ++slot) {
+		logger_thread_buffer_t& buffer = LOGGER_THREAD_BUFFERS[slot];
+		writeIndices[slot] = ProfilerAtomicLoadAcquire(&buffer.writeIndex);
+
+		uint64 droppedRecordCount = ProfilerAtomicLoadAcquire(&buffer.droppedRecordCount);
+		if(droppedRecordCount != buffer.reportedDroppedRecordCount) {
+			char warning[128];
+			int length = snprintf(warning, sizeof(warning), "[Logger] Dropped %llu messages (the ring buffer of thread slot %d was full)\n",
+				(unsigned long long)(droppedRecordCount - buffer.reportedDroppedRecordCount), slot);
+			LoggerAppendText(logger, warning, (size_t)length);
+			buffer.reportedDroppedRecordCount = droppedRecordCount;
+		}
+	}
+
+	size_t drainedRecordCount = 0;
+	while(true) {
+		// NOTE: With only a handful of threads, a linear scan is cheaper than maintaining a heap for the merge
+		int oldestSlot = -1;
+		uint64 oldestTimestamp = 0;
+		for(int slot = 0; slot < threadCount; ++slot) {
+			logger_thread_buffer_t& buffer = LOGGER_THREAD_BUFFERS[slot];
+			if(buffer.readIndex == writeIndices[slot]) continue;
+
+			uint64 timestamp = buffer.records[buffer.readIndex & (LOGGER_RING_BUFFER_SIZE - 1)].timestamp;
+			if(oldestSlot == -1 || timestamp < oldestTimestamp) {
+				oldestSlot = slot;
+				oldestTimestamp = timestamp;
+			}
+		}
+		if(oldestSlot == -1) break;
+
+		logger_thread_buffer_t& buffer = LOGGER_THREAD_BUFFERS[oldestSlot];
+		LoggerFormatRecord(logger, buffer.records[buffer.readIndex & (LOGGER_RING_BUFFER_SIZE - 1)]);
+		ProfilerAtomicStoreRelease(&buffer.readIndex, buffer.readIndex + 1);
+		drainedRecordCount++;
+	}
+
+	LoggerFlushOutput(logger);
+	return drainedRecordCount;
+}
+
+INTERNAL bool LoggerHasPendingRecords() {
+	int threadCount = LoggerGetRegisteredThreadCount();
+	for(int slot = 0; slot < threadCount; ++slot) {
+		logger_thread_buffer_t& buffer = LOGGER_THREAD_BUFFERS[slot];
+		if(ProfilerAtomicLoadAcquire(&buffer.writeIndex) != buffer.readIndex) return true;
+	}
+	return false;
+}
+
+INTERNAL void LoggerRunBackgroundThread(void* argument) {
+	logger_state_t& logger = *(logger_state_t*)argument;
+	while(!ProfilerAtomicLoadAcquire(&logger.isShuttingDown)) {
+		if(LoggerDrainRecords(logger) > 0) continue;
+
+		// Announce the wait before checking one last time, so that no record can slip through in between
+		ProfilerAtomicStoreRelease(&logger.isWaitingForRecords, 1);
+		ProfilerAtomicFenceSequential();
+		bool canWait = !LoggerHasPendingRecords() && !ProfilerAtomicLoadAcquire(&logger.isShuttingDown);
+		if(canWait) PlatformWaitForSemaphore(logger.wakeupSignal);
+		ProfilerAtomicStoreRelease(&logger.isWaitingForRecords, 0);
+	}
+	LoggerDrainRecords(logger); // Anything logged before the shutdown was requested shouldn't be lost
+}
+
+INTERNAL bool LoggerInitialize(FILE* outputStream) {
+	LOGGER_STATE.outputStream = outputStream;
+	LOGGER_STATE.isWaitingForRecords = 0;
+	LOGGER_STATE.isShuttingDown = 0;
+	LOGGER_STATE.flushBufferUsed = 0;
+	if(!PlatformCreateSemaphore(LOGGER_STATE.wakeupSignal)) return false;
+
+	LOGGER_STATE.isRunning = PlatformCreateThread(LOGGER_STATE.backgroundThread, LoggerRunBackgroundThread, &LOGGER_STATE);
+	if(!LOGGER_STATE.isRunning) PlatformDestroySemaphore(LOGGER_STATE.wakeupSignal);
+	return LOGGER_STATE.isRunning;
+}
+
+INTERNAL void LoggerShutdown() {
+	if(!LOGGER_STATE.isRunning) return;
+
+	ProfilerAtomicStoreRelease(&LOGGER_STATE.isShuttingDown, 1);
+	PlatformSignalSemaphore(LOGGER_STATE.wakeupSignal);
+	PlatformJoinThread(LOGGER_STATE.backgroundThread);
+	PlatformDestroySemaphore(LOGGER_STATE.wakeupSignal);
+	LOGGER_STATE.isRunning = false;
+}
\ No newline at end of file
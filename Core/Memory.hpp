@@ -69,6 +69,17 @@ INTERNAL void* ArenaAllocateMemoryRegion(memory_arena_t& arena, size_t allocatio
 	return memoryRegionStartPointer;
 }
 
+// NOTE: Regions are packed tightly by default, so anything accessed as wider types after a byte-sized allocation must be aligned explicitly
+INTERNAL void* ArenaAllocateAlignedMemoryRegion(memory_arena_t& arena, size_t allocationSize, size_t alignment) {
+	ASSUME(alignment != 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of two");
+	uintptr_t nextAddress = (uintptr_t)arena.baseAddress + arena.used;
+	size_t paddingSize = (alignment - (nextAddress & (alignment - 1))) & (alignment - 1);
+	ASSUME(arena.used + paddingSize <= arena.reservedSize, "Attempting to allocate outside the reserved set");
+	arena.used += paddingSize;
+
+	return ArenaAllocateMemoryRegion(arena, allocationSize);
+}
+
 INTERNAL bool ArenaCanAllocate(memory_arena_t& arena, size_t allocationSize) {
 	if(arena.used + allocationSize > arena.reservedSize) return false;
 	return true;
@@ -83,4 +94,42 @@ INTERNAL inline void ArenaDebugTouchAddress(memory_arena_t& arena, uint8* addres
 	ASSUME(address >= arena.baseAddress, "Attempted to access an invalid arena offset");
 	size_t offset = address - (uint8*)arena.baseAddress;
 	// TODO: Update last accessed time
+}
+
+typedef enum : uint8 {
+	BLOCK_RESERVED,
+	BLOCK_COMMITTED,
+	BLOCK_COMMITTED_RESIDENT, // Not allocated, but still backed by physical memory (e.g., after resetting the arena)
+	BLOCK_USED_NOT_RESIDENT, // Allocated, but either never touched or paged out since
+	BLOCK_USED_RESIDENT,
+} arena_block_state_t;
+
+// NOTE: Large arenas are sampled a few blocks at a time, so the residency data may lag behind by a fraction of a second
+constexpr size_t MAX_RESIDENCY_MAP_BLOCKS = 32768;
+typedef struct arena_residency_map {
+	size_t blockSize;
+	size_t blockCount;
+	size_t nextSampledBlock;
+	size_t residentSize; // As of the last completed sweep
+	size_t pendingResidentSize;
+	bool isBlockResident[MAX_RESIDENCY_MAP_BLOCKS];
+} arena_residency_map_t;
+
+INTERNAL void ArenaResidencyMapInitialize(arena_residency_map_t& map, memory_arena_t& arena, size_t allocationGranularity) {
+	size_t blocksAtGranularity = (arena.reservedSize + allocationGranularity - 1) / allocationGranularity;
+	size_t granulesPerBlock = (blocksAtGranularity + MAX_RESIDENCY_MAP_BLOCKS - 1) / MAX_RESIDENCY_MAP_BLOCKS;
+	map.blockSize = Max(granulesPerBlock, 1) * allocationGranularity;
+	map.blockCount = (arena.reservedSize + map.blockSize - 1) / map.blockSize;
+	map.nextSampledBlock = 0;
+	map.residentSize = 0;
+	map.pendingResidentSize = 0;
+	memset(map.isBlockResident, 0, sizeof(map.isBlockResident));
+}
+
+INTERNAL inline arena_block_state_t ArenaResidencyMapGetBlockState(arena_residency_map_t& map, memory_arena_t& arena, size_t blockID) {
+	size_t offset = blockID * map.blockSize;
+	bool isResident = map.isBlockResident[blockID];
+	if(offset < arena.used) return isResident ? BLOCK_USED_RESIDENT : BLOCK_USED_NOT_RESIDENT;
+	if(offset < arena.committedSize) return isResident ? BLOCK_COMMITTED_RESIDENT : BLOCK_COMMITTED;
+	return BLOCK_RESERVED;
 }
\ No newline at end of file
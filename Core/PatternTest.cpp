@@ -11,6 +11,18 @@ typedef enum : uint8 {
 
 GLOBAL animated_debug_pattern_t ANIMATED_DEBUG_PATTERN = PATTERN_SHIFTING_GRADIENT;
 
+// NOTE: Remembers what the bitmap currently shows, so that only the pixels that actually change need to be redrawn (and marked dirty)
+typedef struct pattern_frame_state {
+	animated_debug_pattern_t pattern;
+	void* pixelBuffer;
+	int width;
+	int height;
+	int paramA;
+	int paramB;
+} pattern_frame_state_t;
+
+GLOBAL pattern_frame_state_t LAST_DRAWN_PATTERN_FRAME = { .pattern = PATTERN_COUNT };
+
 INTERNAL void DebugDrawUpdateBackgroundPattern(milliseconds uptime) {
 	seconds updateInterval = 5.0f;
 	seconds elapsed = uptime / MILLISECONDS_PER_SECOND;
@@ -155,8 +167,76 @@ INTERNAL void DebugDrawUseMovingScanlinePattern(offscreen_buffer_t& bitmap, int
 	}
 }
 
+INTERNAL void DebugDrawMovingScanlineRow(offscreen_buffer_t& bitmap, int y) {
+	if(y < 0) return; // Negative offsets never show the scanline (same as the full redraw)
+	uint32* pixel = (uint32*)((uint8*)bitmap.pixelBuffer + (size_t)y * bitmap.stride);
+	for(int x = 0; x < bitmap.width; ++x)
+		*pixel++ = (255 << 16) | (255 << 8) | 255;
+	BitmapMarkDirtyRectangle(bitmap, 0, y, bitmap.width, y + 1);
+}
+
+INTERNAL void DebugDrawRestoreGridRow(offscreen_buffer_t& bitmap, int y) {
+	if(y < 0) return;
+	int gridSpacing = 32;
+	uint32* pixel = (uint32*)((uint8*)bitmap.pixelBuffer + (size_t)y * bitmap.stride);
+	for(int x = 0; x < bitmap.width; ++x) {
+		uint8 c = (x % gridSpacing == 0 || y % gridSpacing == 0) ? 100 : 180;
+		*pixel++ = (c << 16) | (c << 8) | c;
+	}
+	BitmapMarkDirtyRectangle(bitmap, 0, y, bitmap.width, y + 1);
+}
+
+// Returns true if the previous frame was drawn with a different pattern (or into a different buffer), so that none of it can be reused
+INTERNAL bool DebugDrawRequiresFullRedraw(offscreen_buffer_t& bitmap) {
+	// NOTE: Overlays may have drawn over any part of the previous frame, and there's no telling which pixels they touched
+	if(bitmap.isSharedWithOverlays) return true;
+
+	pattern_frame_state_t& lastFrame = LAST_DRAWN_PATTERN_FRAME;
+	return lastFrame.pattern != ANIMATED_DEBUG_PATTERN || lastFrame.pixelBuffer != bitmap.pixelBuffer
+		|| lastFrame.width != bitmap.width || lastFrame.height != bitmap.height;
+}
+
 INTERNAL void DebugDrawIntoFrameBuffer(offscreen_buffer_t& bitmap, int paramA,
 	int paramB) {
+	if(!bitmap.pixelBuffer || bitmap.width <= 0 || bitmap.height <= 0)
+		return;
+
+	pattern_frame_state_t& lastFrame = LAST_DRAWN_PATTERN_FRAME;
+	bool isFullRedraw = DebugDrawRequiresFullRedraw(bitmap);
+	bool haveParametersChanged = lastFrame.paramA != paramA || lastFrame.paramB != paramB;
+	if(!isFullRedraw) {
+		switch(ANIMATED_DEBUG_PATTERN) {
+			case PATTERN_AXIS_GRADIENTS:
+				// Static: Nothing changes until the pattern (or the buffer) does
+				return;
+			case PATTERN_GRID_SCANLINE: {
+				// Only the rows covered by the previous and current scanline differ
+				int previousScanY = (lastFrame.paramA / 2) % bitmap.height;
+				int scanY = (paramA / 2) % bitmap.height;
+				if(previousScanY != scanY) {
+					DebugDrawRestoreGridRow(bitmap, previousScanY);
+					DebugDrawMovingScanlineRow(bitmap, scanY);
+				}
+				lastFrame.paramA = paramA;
+				lastFrame.paramB = paramB;
+				return;
+			}
+			default:
+				// The other patterns are redrawn entirely whenever their parameters change
+				if(!haveParametersChanged) return;
+				break;
+		}
+	}
+
+	BitmapMarkEverythingDirty(bitmap);
+	lastFrame = {
+		.pattern = ANIMATED_DEBUG_PATTERN,
+		.pixelBuffer = bitmap.pixelBuffer,
+		.width = bitmap.width,
+		.height = bitmap.height,
+		.paramA = paramA,
+		.paramB = paramB,
+	};
 	switch(ANIMATED_DEBUG_PATTERN) {
 		case PATTERN_SHIFTING_GRADIENT:
 			DebugDrawUseMarchingGradientPattern(bitmap, paramA, paramB);
@@ -30,10 +30,44 @@ INTERNAL void DebugDumpCPUID() {
 	printf("\n");
 }
 
+INTERNAL void DebugDumpHardwareCounters() {
+	hardware_counter_group_t counters;
+	if(!PlatformOpenHardwareCounters(counters)) {
+		printf("Hardware counters: N/A (check /proc/sys/kernel/perf_event_paranoid)\n");
+		return;
+	}
+
+	// NOTE: Strided reads over a buffer that doesn't fit into the cache, so that there's something to measure
+	constexpr size_t BUFFER_SIZE = 64 * 1024 * 1024;
+	constexpr size_t STRIDE = 4096 + 64;
+	uint8* buffer = (uint8*)calloc(BUFFER_SIZE, 1);
+	hardware_counter_values_t before = {};
+	hardware_counter_values_t after = {};
+	hardware_counter_values_t delta = {};
+	PlatformReadHardwareCounters(counters, before);
+	volatile uint64 checksum = 0;
+	for(size_t offset = 0; offset < BUFFER_SIZE; offset += STRIDE)
+		checksum += buffer[offset];
+	PlatformReadHardwareCounters(counters, after);
+	HardwareCountersGetDelta(before, after, delta);
+	free(buffer);
+
+	for(int counter = 0; counter < HARDWARE_COUNTER_COUNT; ++counter) {
+		if(!HardwareCounterIsAvailable(counters, (hardware_counter_t)counter)) {
+			printf("%s: N/A\n", HARDWARE_COUNTER_NAMES[counter]);
+			continue;
+		}
+		printf("%s: %llu\n", HARDWARE_COUNTER_NAMES[counter], (unsigned long long)delta.values[counter]);
+	}
+	printf("IPC: %.2f\n", HardwareCountersGetInstructionsPerCycle(delta));
+	PlatformCloseHardwareCounters(counters);
+}
+
 INTERNAL void PlatformRuntimeMain() {
 	printf("There is no platform runtime for Linux yet. Instead, behold this placeholder program :3\n");
 
 	DebugDumpCPUID();
+	DebugDumpHardwareCounters();
 	// TODO: Maybe dump some of the other CPU details also? Not really useful right now...
 
 	unsigned eax = 0;
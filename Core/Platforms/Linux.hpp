@@ -1 +1,203 @@
-// PLACEHOLDER
\ No newline at end of file
+#pragma once
+
+#include <dlfcn.h>
+#include <errno.h>
+#include <linux/perf_event.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdio.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+constexpr uint64 NANOSECONDS_PER_SECOND = 1000000000ULL;
+
+INTERNAL inline uint64 PlatformGetMonotonicTicks() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64)now.tv_sec * NANOSECONDS_PER_SECOND + (uint64)now.tv_nsec;
+}
+
+INTERNAL inline uint64 PlatformGetMonotonicTicksPerSecond() {
+	return NANOSECONDS_PER_SECOND;
+}
+
+INTERNAL inline uint64 PlatformGetCurrentThreadID() {
+	return (uint64)syscall(SYS_gettid);
+}
+
+INTERNAL size_t PlatformCountResidentPages(void* startAddress, size_t pageCount, size_t pageSize) {
+	constexpr size_t MAX_QUERIED_PAGES = 256;
+	unsigned char residencyFlags[MAX_QUERIED_PAGES];
+	size_t residentPageCount = 0;
+	for(size_t firstPage = 0; firstPage < pageCount; firstPage += MAX_QUERIED_PAGES) {
+		size_t batchSize = Min(pageCount - firstPage, MAX_QUERIED_PAGES);
+		void* batchStartAddress = (uint8*)startAddress + firstPage * pageSize;
+		if(mincore(batchStartAddress, batchSize * pageSize, residencyFlags) != 0) break; // Unmapped range (nothing to count)
+
+		for(size_t index = 0; index < batchSize; ++index) {
+			if(residencyFlags[index] & 0x1) residentPageCount++;
+		}
+	}
+	return residentPageCount;
+}
+
+// See https://man7.org/linux/man-pages/man2/perf_event_open.2.html
+INTERNAL inline uint64 PlatformGetHardwareCacheEventConfig(uint64 cache, uint64 operation, uint64 result) {
+	return cache | (operation << 8) | (result << 16);
+}
+
+INTERNAL bool PlatformOpenHardwareCounters(hardware_counter_group_t& group) {
+	struct {
+		uint32 type;
+		uint64 config;
+	} events[HARDWARE_COUNTER_COUNT] = {
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+		{ PERF_TYPE_HW_CACHE, PlatformGetHardwareCacheEventConfig(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS) },
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+		{ PERF_TYPE_HW_CACHE, PlatformGetHardwareCacheEventConfig(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS) },
+	};
+
+	group = {};
+	group.leaderHandle = -1;
+	for(int counter = 0; counter < HARDWARE_COUNTER_COUNT; ++counter) {
+		struct perf_event_attr attributes = {};
+		attributes.size = sizeof(attributes);
+		attributes.type = events[counter].type;
+		attributes.config = events[counter].config;
+		attributes.disabled = (group.leaderHandle == -1); // Members follow the leader (so they're all scheduled together)
+		attributes.exclude_kernel = 1; // Required unless perf_event_paranoid is lowered
+		attributes.exclude_hv = 1;
+		attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+		// NOTE: Missing permissions (EACCES), unsupported events (ENOENT), or no PMU at all (e.g., in VMs) just disable the counter
+		long fileDescriptor = syscall(SYS_perf_event_open, &attributes, 0, -1, (int)group.leaderHandle, 0);
+		group.handles[counter] = fileDescriptor;
+		if(fileDescriptor == -1) continue;
+
+		if(group.leaderHandle == -1) group.leaderHandle = fileDescriptor;
+		group.availableCounterMask |= (1u << counter);
+	}
+
+	if(group.leaderHandle == -1) return false;
+
+	ioctl((int)group.leaderHandle, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+	ioctl((int)group.leaderHandle, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	return true;
+}
+
+INTERNAL void PlatformReadHardwareCounters(hardware_counter_group_t& group, hardware_counter_values_t& values) {
+	if(group.availableCounterMask == 0) return;
+
+	// Layout: { nr, time_enabled, time_running, values[nr] } - in the order the counters were added to the group
+	constexpr int GROUP_HEADER_SIZE = 3;
+	uint64 buffer[GROUP_HEADER_SIZE + HARDWARE_COUNTER_COUNT];
+	ssize_t bytesRead = read((int)group.leaderHandle, buffer, sizeof(buffer));
+	if(bytesRead < (ssize_t)(GROUP_HEADER_SIZE * sizeof(uint64))) return;
+
+	// NOTE: If the PMU is oversubscribed, the kernel multiplexes the group and the raw counts must be extrapolated
+	uint64 timeEnabled = buffer[1];
+	uint64 timeRunning = buffer[2];
+	double scale = (timeRunning > 0 && timeRunning < timeEnabled) ? (double)timeEnabled / (double)timeRunning : 1.0;
+
+	uint64 valueCount = Min(buffer[0], (uint64)HARDWARE_COUNTER_COUNT);
+	uint64 valueIndex = 0;
+	for(int counter = 0; counter < HARDWARE_COUNTER_COUNT && valueIndex < valueCount; ++counter) {
+		if(!HardwareCounterIsAvailable(group, (hardware_counter_t)counter)) continue;
+		values.values[counter] = (uint64)((double)buffer[GROUP_HEADER_SIZE + valueIndex] * scale);
+		valueIndex++;
+	}
+}
+
+INTERNAL void PlatformCloseHardwareCounters(hardware_counter_group_t& group) {
+	for(int counter = 0; counter < HARDWARE_COUNTER_COUNT; ++counter) {
+		if(HardwareCounterIsAvailable(group, (hardware_counter_t)counter)) close((int)group.handles[counter]);
+	}
+	group = {};
+}
+
+INTERNAL void* PlatformAllocateMemory(size_t size) {
+	void* baseAddress = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	return (baseAddress == MAP_FAILED) ? NULL : baseAddress;
+}
+
+INTERNAL void PlatformFreeMemory(void* baseAddress, size_t size) {
+	munmap(baseAddress, size);
+}
+
+INTERNAL advance_simulation_fn_t PlatformLoadSimulationModule(const char* moduleDirectory, const char* appName) {
+	char modulePath[4096];
+	snprintf(modulePath, sizeof(modulePath), "%sRagLite%s.so", moduleDirectory, appName);
+
+	// NOTE: The module is never unloaded (there's no hot reloading yet, so it remains in use until the process exits)
+	void* module = dlopen(modulePath, RTLD_NOW | RTLD_LOCAL);
+	if(!module) return NULL;
+	return (advance_simulation_fn_t)dlsym(module, "AdvanceSimulation");
+}
+
+INTERNAL inline void PlatformAttachParentConsole() {
+	// NOTE: Console applications already share the terminal with their parent process
+}
+
+typedef void (*platform_thread_entry_t)(void* argument);
+typedef struct platform_thread {
+	platform_thread_entry_t entry;
+	void* argument;
+	pthread_t handle;
+} platform_thread_t;
+
+INTERNAL void* PlatformRunThreadEntry(void* parameter) {
+	platform_thread_t* thread = (platform_thread_t*)parameter;
+	thread->entry(thread->argument);
+	return NULL;
+}
+
+// NOTE: The thread object is passed to the new thread, so it must remain valid until the thread has been joined
+INTERNAL bool PlatformCreateThread(platform_thread_t& thread, platform_thread_entry_t entry, void* argument) {
+	thread.entry = entry;
+	thread.argument = argument;
+	return pthread_create(&thread.handle, NULL, PlatformRunThreadEntry, &thread) == 0;
+}
+
+INTERNAL void PlatformJoinThread(platform_thread_t& thread) {
+	pthread_join(thread.handle, NULL);
+}
+
+INTERNAL inline void PlatformSleepMilliseconds(uint32 duration) {
+	struct timespec interval = {
+		.tv_sec = (time_t)(duration / 1000),
+		.tv_nsec = (long)(duration % 1000) * 1000000L,
+	};
+	nanosleep(&interval, NULL);
+}
+
+typedef struct platform_semaphore {
+	sem_t handle;
+} platform_semaphore_t;
+
+INTERNAL bool PlatformCreateSemaphore(platform_semaphore_t& semaphore) {
+	return sem_init(&semaphore.handle, 0, 0) == 0;
+}
+
+INTERNAL void PlatformSignalSemaphore(platform_semaphore_t& semaphore) {
+	sem_post(&semaphore.handle);
+}
+
+INTERNAL void PlatformWaitForSemaphore(platform_semaphore_t& semaphore) {
+	while(sem_wait(&semaphore.handle) == -1 && errno == EINTR) {
+		// Interrupted by a signal handler (the count wasn't decremented, so keep waiting)
+	}
+}
+
+INTERNAL void PlatformDestroySemaphore(platform_semaphore_t& semaphore) {
+	sem_destroy(&semaphore.handle);
+}
+
+INTERNAL uint32 PlatformGetProcessorCount() {
+	long processorCount = sysconf(_SC_NPROCESSORS_ONLN);
+	return (processorCount > 0) ? (uint32)processorCount : 1;
+}
\ No newline at end of file
@@ -1 +1,159 @@
-// PLACEHOLDER
\ No newline at end of file
+#pragma once
+
+#include <dispatch/dispatch.h>
+#include <dlfcn.h>
+#include <libproc.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+
+constexpr uint64 NANOSECONDS_PER_SECOND = 1000000000ULL;
+
+INTERNAL inline uint64 PlatformGetMonotonicTicks() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64)now.tv_sec * NANOSECONDS_PER_SECOND + (uint64)now.tv_nsec;
+}
+
+INTERNAL inline uint64 PlatformGetMonotonicTicksPerSecond() {
+	return NANOSECONDS_PER_SECOND;
+}
+
+INTERNAL inline uint64 PlatformGetCurrentThreadID() {
+	uint64 threadID = 0;
+	pthread_threadid_np(NULL, &threadID);
+	return threadID;
+}
+
+INTERNAL size_t PlatformCountResidentPages(void* startAddress, size_t pageCount, size_t pageSize) {
+	constexpr size_t MAX_QUERIED_PAGES = 256;
+	char residencyFlags[MAX_QUERIED_PAGES];
+	size_t residentPageCount = 0;
+	for(size_t firstPage = 0; firstPage < pageCount; firstPage += MAX_QUERIED_PAGES) {
+		size_t batchSize = Min(pageCount - firstPage, MAX_QUERIED_PAGES);
+		void* batchStartAddress = (uint8*)startAddress + firstPage * pageSize;
+		if(mincore(batchStartAddress, batchSize * pageSize, residencyFlags) != 0) break; // Unmapped range (nothing to count)
+
+		for(size_t index = 0; index < batchSize; ++index) {
+			if(residencyFlags[index] & MINCORE_INCORE) residentPageCount++;
+		}
+	}
+	return residentPageCount;
+}
+
+INTERNAL inline bool PlatformQueryResourceUsage(rusage_info_v4& usage) {
+	return proc_pid_rusage(getpid(), RUSAGE_INFO_V4, (rusage_info_t*)&usage) == 0;
+}
+
+// NOTE: Configuring PMU events requires private frameworks (kperf), but the kernel tracks cycles and instructions anyway.
+// These are accumulated for the entire process, so they only match the calling thread if no other threads are busy
+INTERNAL bool PlatformOpenHardwareCounters(hardware_counter_group_t& group) {
+	group = {};
+	rusage_info_v4 usage = {};
+	if(!PlatformQueryResourceUsage(usage)) return false;
+
+	// Older kernels (and some virtual machines) leave these fields zeroed instead of failing the query
+	if(usage.ri_cycles > 0) group.availableCounterMask |= (1u << HARDWARE_COUNTER_CYCLES);
+	if(usage.ri_instructions > 0) group.availableCounterMask |= (1u << HARDWARE_COUNTER_INSTRUCTIONS);
+	return group.availableCounterMask != 0;
+}
+
+INTERNAL void PlatformReadHardwareCounters(hardware_counter_group_t& group, hardware_counter_values_t& values) {
+	if(group.availableCounterMask == 0) return;
+
+	rusage_info_v4 usage = {};
+	if(!PlatformQueryResourceUsage(usage)) return;
+
+	if(HardwareCounterIsAvailable(group, HARDWARE_COUNTER_CYCLES)) values.values[HARDWARE_COUNTER_CYCLES] = usage.ri_cycles;
+	if(HardwareCounterIsAvailable(group, HARDWARE_COUNTER_INSTRUCTIONS)) values.values[HARDWARE_COUNTER_INSTRUCTIONS] = usage.ri_instructions;
+}
+
+INTERNAL void PlatformCloseHardwareCounters(hardware_counter_group_t& group) {
+	group = {};
+}
+
+INTERNAL void* PlatformAllocateMemory(size_t size) {
+	void* baseAddress = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	return (baseAddress == MAP_FAILED) ? NULL : baseAddress;
+}
+
+INTERNAL void PlatformFreeMemory(void* baseAddress, size_t size) {
+	munmap(baseAddress, size);
+}
+
+INTERNAL advance_simulation_fn_t PlatformLoadSimulationModule(const char* moduleDirectory, const char* appName) {
+	char modulePath[4096];
+	snprintf(modulePath, sizeof(modulePath), "%sRagLite%s.dylib", moduleDirectory, appName);
+
+	// NOTE: The module is never unloaded (there's no hot reloading yet, so it remains in use until the process exits)
+	void* module = dlopen(modulePath, RTLD_NOW | RTLD_LOCAL);
+	if(!module) return NULL;
+	return (advance_simulation_fn_t)dlsym(module, "AdvanceSimulation");
+}
+
+INTERNAL inline void PlatformAttachParentConsole() {
+	// NOTE: Console applications already share the terminal with their parent process
+}
+
+typedef void (*platform_thread_entry_t)(void* argument);
+typedef struct platform_thread {
+	platform_thread_entry_t entry;
+	void* argument;
+	pthread_t handle;
+} platform_thread_t;
+
+INTERNAL void* PlatformRunThreadEntry(void* parameter) {
+	platform_thread_t* thread = (platform_thread_t*)parameter;
+	thread->entry(thread->argument);
+	return NULL;
+}
+
+// NOTE: The thread object is passed to the new thread, so it must remain valid until the thread has been joined
+INTERNAL bool PlatformCreateThread(platform_thread_t& thread, platform_thread_entry_t entry, void* argument) {
+	thread.entry = entry;
+	thread.argument = argument;
+	return pthread_create(&thread.handle, NULL, PlatformRunThreadEntry, &thread) == 0;
+}
+
+INTERNAL void PlatformJoinThread(platform_thread_t& thread) {
+	pthread_join(thread.handle, NULL);
+}
+
+INTERNAL inline void PlatformSleepMilliseconds(uint32 duration) {
+	struct timespec interval = {
+		.tv_sec = (time_t)(duration / 1000),
+		.tv_nsec = (long)(duration % 1000) * 1000000L,
+	};
+	nanosleep(&interval, NULL);
+}
+
+// NOTE: Unnamed POSIX semaphores aren't supported on this platform (sem_init always fails), but GCD provides the same thing
+typedef struct platform_semaphore {
+	dispatch_semaphore_t handle;
+} platform_semaphore_t;
+
+INTERNAL bool PlatformCreateSemaphore(platform_semaphore_t& semaphore) {
+	semaphore.handle = dispatch_semaphore_create(0);
+	return semaphore.handle != NULL;
+}
+
+INTERNAL void PlatformSignalSemaphore(platform_semaphore_t& semaphore) {
+	dispatch_semaphore_signal(semaphore.handle);
+}
+
+INTERNAL void PlatformWaitForSemaphore(platform_semaphore_t& semaphore) {
+	dispatch_semaphore_wait(semaphore.handle, DISPATCH_TIME_FOREVER);
+}
+
+INTERNAL void PlatformDestroySemaphore(platform_semaphore_t& semaphore) {
+	dispatch_release(semaphore.handle);
+	semaphore.handle = NULL;
+}
+
+INTERNAL uint32 PlatformGetProcessorCount() {
+	long processorCount = sysconf(_SC_NPROCESSORS_ONLN);
+	return (processorCount > 0) ? (uint32)processorCount : 1;
+}
\ No newline at end of file
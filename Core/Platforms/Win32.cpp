@@ -81,13 +81,53 @@ INTERNAL const char* ArchitectureToDebugName(WORD wProcessorArchitecture) {
 
 #include "Win32/DebugDraw.cpp"
 
+constexpr const char* PROFILER_TRACE_FILE_PATH = "RagLite2-Trace.json";
+constexpr const char* RUNTIME_LOG_FILE_PATH = "RagLite2.log";
+constexpr size_t PROFILER_TRACE_EVENT_SIZE = 256; // Conservative estimate (most events are much shorter)
+
+INTERNAL void PlatformExportProfilerTrace(const char* fileSystemPath) {
+	size_t capacity = MAX_PROFILED_THREADS * PROFILER_RING_BUFFER_SIZE * PROFILER_TRACE_EVENT_SIZE;
+	char* traceBuffer = (char*)VirtualAlloc(NULL, capacity, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+	if(!traceBuffer) return;
+
+	bool isTruncated = false;
+	size_t traceSize = ProfilerExportChromeTrace(traceBuffer, capacity, isTruncated);
+	platform_handle_t fileHandle = PlatformOpenFileHandle(fileSystemPath, PlatformPolicyOverwrite());
+	size_t writtenSize = PlatformWriteFileContents(fileHandle, traceBuffer, traceSize);
+	PlatformCloseFileHandle(fileHandle);
+	LOG("Exported profiler trace to %s (%zu of %zu bytes written)\n", fileSystemPath, writtenSize, traceSize);
+	if(isTruncated) LOG("Profiler trace was truncated (some events didn't fit into %zu bytes)\n", capacity);
+
+	VirtualFree(traceBuffer, 0, MEM_RELEASE);
+}
+
 INTERNAL void PlatformRunSimulationStep() {
+	PROFILE_FUNCTION();
 	gamepad_state_t controllerInputs = {};
 	GamePadPollControllers(controllerInputs);
-	AdvanceSimulation(PLACEHOLDER_DEMO_APP, controllerInputs, GDI_BACKBUFFER.bitmap, CPU_PERFORMANCE_METRICS.applicationUptime, MAIN_MEMORY, TRANSIENT_MEMORY);
+
+	bool usesInternalResolution = (INTERNAL_RESOLUTION_SCALE < 1.0f);
+	offscreen_buffer_t& renderTarget = usesInternalResolution ? INTERNAL_RENDER_TARGET : GDI_BACKBUFFER.bitmap;
+	{
+		// NOTE: The application may live in a separate module (with its own profiler state), so it's measured from here
+		PROFILE_ZONE("AdvanceSimulation");
+		AdvanceSimulation(PLACEHOLDER_DEMO_APP, controllerInputs, renderTarget, CPU_PERFORMANCE_METRICS.applicationUptime, MAIN_MEMORY, TRANSIENT_MEMORY);
+	}
+
+	if(!usesInternalResolution) {
+		CPU_PERFORMANCE_METRICS.upscalingTime = 0;
+		return;
+	}
+
+	PROFILE_ZONE("BitmapUpscale");
+	hardware_tick_t before = PerformanceMetricsNow();
+	BitmapUpscale(INTERNAL_RENDER_TARGET, GDI_BACKBUFFER.bitmap, SELECTED_UPSCALING_MODE);
+	BitmapClearDirtyRegions(INTERNAL_RENDER_TARGET);
+	CPU_PERFORMANCE_METRICS.upscalingTime = PerformanceMetricsGetTimeSince(before);
 }
 
 INTERNAL void SurfacePresentFrameBuffer(gdi_surface_t& surface, gdi_offscreen_buffer_t& backBuffer) {
+	PROFILE_FUNCTION();
 	if(!surface.displayDeviceContext || !surface.offscreenDeviceContext || !backBuffer.handle) {
 		// Minimized or not yet initialized
 		return;
@@ -97,37 +137,70 @@ INTERNAL void SurfacePresentFrameBuffer(gdi_surface_t& surface, gdi_offscreen_bu
 	int srcH = backBuffer.bitmap.height;
 	int destW = surface.width;
 	int destH = surface.height;
-	BOOL success = StretchBlt(surface.displayDeviceContext, 0, 0, destW, destH, surface.offscreenDeviceContext,
-		0, 0, srcW, srcH, SRCCOPY);
-	ASSUME(success, "StretchBlt failed (multi-monitor setup with mismatching source/destination HDCs?)");
+	size_t dirtyPixelCount = BitmapGetDirtyPixelCount(backBuffer.bitmap);
+	CPU_PERFORMANCE_METRICS.surfaceDirtyRatio = (percentage)dirtyPixelCount / (percentage)((size_t)srcW * (size_t)srcH);
+
+	// NOTE: Only the regions that changed since the last present need to be copied (the window retains the rest)
+	dirty_region_list_t& dirtyRegions = backBuffer.bitmap.dirtyRegions;
+	for(int index = 0; index < dirtyRegions.count; ++index) {
+		bitmap_rectangle_t& source = dirtyRegions.rectangles[index];
+		// Round outwards so that scaled regions don't leave any gaps between them
+		int destLeft = (int)(((int64)source.left * destW) / srcW);
+		int destTop = (int)(((int64)source.top * destH) / srcH);
+		int destRight = (int)(((int64)source.right * destW + srcW - 1) / srcW);
+		int destBottom = (int)(((int64)source.bottom * destH + srcH - 1) / srcH);
+
+		BOOL success = StretchBlt(surface.displayDeviceContext, destLeft, destTop, destRight - destLeft, destBottom - destTop, surface.offscreenDeviceContext,
+			source.left, source.top, source.right - source.left, source.bottom - source.top, SRCCOPY);
+		ASSUME(success, "StretchBlt failed (multi-monitor setup with mismatching source/destination HDCs?)");
+	}
+	BitmapClearDirtyRegions(backBuffer.bitmap);
 }
 
 INTERNAL void SurfaceDrawDebugUI(gdi_surface_t& doubleBufferedWindowSurface) {
+	PROFILE_FUNCTION();
 	HDC offscreenDeviceContext = doubleBufferedWindowSurface.offscreenDeviceContext;
 	if(!offscreenDeviceContext) return;
 
+	ArenaResetAllocations(DEBUG_OVERLAY_TEXT_MEMORY);
 	DebugDrawMemoryUsageOverlay(offscreenDeviceContext);
 	DebugDrawProcessorUsageOverlay(offscreenDeviceContext);
 	DebugDrawKeyboardOverlay(offscreenDeviceContext);
 }
 
 INTERNAL void MainWindowRedrawEverything(HWND& window) {
+	PROFILE_FUNCTION();
 	if(IsIconic(window)) {
 		// Minimized - no point in drawing this frame
 		CPU_PERFORMANCE_METRICS.surfaceBlitTime = 0;
 		CPU_PERFORMANCE_METRICS.userInterfaceRenderTime = 0;
+		PerformanceMetricsSkipPhase(FRAME_PHASE_USER_INTERFACE_RENDER);
+		PerformanceMetricsSkipPhase(FRAME_PHASE_SURFACE_BLIT);
 		return;
 	}
 
 	hardware_tick_t before = PerformanceMetricsNow();
+	PerformanceMetricsBeginPhase();
 	SurfaceDrawDebugUI(GDI_SURFACE);
+	PerformanceMetricsEndPhase(FRAME_PHASE_USER_INTERFACE_RENDER);
 	CPU_PERFORMANCE_METRICS.userInterfaceRenderTime = PerformanceMetricsGetTimeSince(before);
 
 	before = PerformanceMetricsNow();
+	PerformanceMetricsBeginPhase();
 	SurfacePresentFrameBuffer(GDI_SURFACE, GDI_BACKBUFFER);
+	PerformanceMetricsEndPhase(FRAME_PHASE_SURFACE_BLIT);
 	CPU_PERFORMANCE_METRICS.surfaceBlitTime = PerformanceMetricsGetTimeSince(before);
 }
 
+INTERNAL void SurfaceResizeRenderTarget(offscreen_buffer_t& renderTarget, gdi_offscreen_buffer_t& backBuffer, percentage scale) {
+	// NOTE: The storage is sized for the full backbuffer, so that changing the scale never requires reallocating it
+	renderTarget.width = Max(1, (int)(backBuffer.bitmap.width * scale));
+	renderTarget.height = Max(1, (int)(backBuffer.bitmap.height * scale));
+	renderTarget.bytesPerPixel = 4;
+	renderTarget.stride = renderTarget.width * renderTarget.bytesPerPixel;
+	BitmapMarkEverythingDirty(renderTarget);
+}
+
 INTERNAL void SurfaceResizeBackBuffer(gdi_surface_t& surface, gdi_offscreen_buffer_t& backBuffer) {
 
 	DeleteObject(backBuffer.handle);
@@ -138,6 +211,7 @@ INTERNAL void SurfaceResizeBackBuffer(gdi_surface_t& surface, gdi_offscreen_buff
 	backBuffer.bitmap.height = surface.height;
 	backBuffer.bitmap.bytesPerPixel = 4;
 	backBuffer.bitmap.stride = surface.width * backBuffer.bitmap.bytesPerPixel;
+	backBuffer.bitmap.isSharedWithOverlays = true; // The debug UI is drawn into it after the application
 
 	ZeroMemory(&backBuffer.info, sizeof(backBuffer.info));
 	backBuffer.info.bmiHeader.biSize = sizeof(backBuffer.info.bmiHeader);
@@ -162,13 +236,30 @@ INTERNAL void SurfaceResizeBackBuffer(gdi_surface_t& surface, gdi_offscreen_buff
 	size_t count = (size_t)surface.width * (size_t)surface.height;
 	for(size_t i = 0; i < count; ++i)
 		pixelArray[i] = UNINITIALIZED_WINDOW_COLOR.bytes;
+	BitmapMarkEverythingDirty(backBuffer.bitmap);
+
+	// NOTE: Shrinking the window leaves the render target with some slack, which is cheaper than reallocating it
+	if(count > INTERNAL_RENDER_TARGET_CAPACITY) {
+		if(INTERNAL_RENDER_TARGET.pixelBuffer) VirtualFree(INTERNAL_RENDER_TARGET.pixelBuffer, 0, MEM_RELEASE);
+		INTERNAL_RENDER_TARGET.pixelBuffer = VirtualAlloc(NULL, count * sizeof(uint32), MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+		ASSUME(INTERNAL_RENDER_TARGET.pixelBuffer, "Failed to allocate the internal render target");
+		INTERNAL_RENDER_TARGET_CAPACITY = count;
+	}
+	SurfaceResizeRenderTarget(INTERNAL_RENDER_TARGET, backBuffer, INTERNAL_RESOLUTION_SCALE);
 }
 
 INTERNAL void MainWindowCreateFrameBuffers(HWND& window, gdi_surface_t& surface, gdi_offscreen_buffer_t& backBuffer) {
 	RECT clientRect;
 	GetClientRect(window, &clientRect);
-	surface.width = Max(1, clientRect.right - clientRect.left);
-	surface.height = Max(1, clientRect.bottom - clientRect.top);
+	int width = Max(1, clientRect.right - clientRect.left);
+	int height = Max(1, clientRect.bottom - clientRect.top);
+
+	// NOTE: Moving the window also ends up here, but the existing buffers remain usable in that case
+	bool hasSameDimensions = (width == surface.width && height == surface.height);
+	if(hasSameDimensions && backBuffer.handle) return;
+
+	surface.width = width;
+	surface.height = height;
 
 	surface.displayDeviceContext = GetDC(window);
 	ASSUME(surface.displayDeviceContext, "Failed to get GDI device drawing context");
@@ -195,6 +286,8 @@ LRESULT CALLBACK MainWindowProcessIncomingMessage(HWND window, UINT message, WPA
 		case WM_PAINT: {
 			PAINTSTRUCT paintInfo;
 			BeginPaint(window, &paintInfo);
+			// NOTE: The OS may have discarded parts of the window that weren't modified by the application
+			BitmapMarkDirtyRectangle(GDI_BACKBUFFER.bitmap, paintInfo.rcPaint.left, paintInfo.rcPaint.top, paintInfo.rcPaint.right, paintInfo.rcPaint.bottom);
 			MainWindowRedrawEverything(window);
 			EndPaint(window, &paintInfo);
 			return 0;
@@ -235,6 +328,31 @@ LRESULT CALLBACK MainWindowProcessIncomingMessage(HWND window, UINT message, WPA
 					if(wasKeyDown && !isKeyDown) {
 						APPLICATION_USES_GAMEPAD = !APPLICATION_USES_GAMEPAD;
 					}
+				} else if(virtualKeyCode == 'R') {
+					if(wasKeyDown && !isKeyDown) {
+						size_t presetCount = sizeof(INTERNAL_RESOLUTION_PRESETS) / sizeof(INTERNAL_RESOLUTION_PRESETS[0]);
+						size_t presetIndex = 0;
+						while(presetIndex < presetCount && INTERNAL_RESOLUTION_PRESETS[presetIndex] != INTERNAL_RESOLUTION_SCALE)
+							presetIndex++;
+						INTERNAL_RESOLUTION_SCALE = INTERNAL_RESOLUTION_PRESETS[(presetIndex + 1) % presetCount];
+						SurfaceResizeRenderTarget(INTERNAL_RENDER_TARGET, GDI_BACKBUFFER, INTERNAL_RESOLUTION_SCALE);
+						// NOTE: Manually selecting a resolution would be pointless if it was immediately readjusted
+						APPLICATION_USES_ADAPTIVE_RESOLUTION = false;
+					}
+				} else if(virtualKeyCode == 'T') {
+					if(wasKeyDown && !isKeyDown) {
+						APPLICATION_USES_ADAPTIVE_RESOLUTION = !APPLICATION_USES_ADAPTIVE_RESOLUTION;
+						ADAPTIVE_RESOLUTION.scale = INTERNAL_RESOLUTION_SCALE;
+					}
+				} else if(virtualKeyCode == 'F') {
+					if(wasKeyDown && !isKeyDown) {
+						SELECTED_UPSCALING_MODE = (upscaling_mode_t)((SELECTED_UPSCALING_MODE + 1) % UPSCALE_MODE_COUNT);
+						BitmapMarkEverythingDirty(INTERNAL_RENDER_TARGET);
+					}
+				} else if(virtualKeyCode == 'P') {
+					if(wasKeyDown && !isKeyDown) {
+						PlatformExportProfilerTrace(PROFILER_TRACE_FILE_PATH);
+					}
 				} else if(virtualKeyCode == 'Q') {
 				} else if(virtualKeyCode == 'E') {
 				} else if(virtualKeyCode == VK_UP) {
@@ -288,6 +406,11 @@ GLOBAL UINT requestedSchedulerGranularityInMilliseconds = 1;
 INTERNAL void PlatformDoSetup() {
 	HINSTANCE instance = GetModuleHandle(NULL);
 	applicationStartTime = PerformanceMetricsNow();
+	ProfilerInitialize();
+	// NOTE: There's no console to write to, and the log is optional anyway (messages are silently dropped without it)
+	FILE* logFile = fopen(RUNTIME_LOG_FILE_PATH, "w");
+	if(logFile) LoggerInitialize(logFile);
+	LOG("Starting RagLite2 (commit: %s)\n", RAGLITE_COMMIT_HASH);
 	IntrinsicsReadCPUID();
 	ReadKernelVersionInfo();
 
@@ -301,16 +424,18 @@ INTERNAL void PlatformDoSetup() {
 	CPU_PERFORMANCE_INFO.pageSize = sysInfo.dwPageSize;
 	CPU_PERFORMANCE_INFO.allocationGranularity = sysInfo.dwAllocationGranularity;
 
-	LARGE_INTEGER ticksPerSecond;
-	QueryPerformanceFrequency(&ticksPerSecond);
-	MONOTONIC_CLOCK_SPEED = ticksPerSecond.QuadPart;
+	MONOTONIC_CLOCK_SPEED = PlatformGetMonotonicTicksPerSecond();
 	lastUpdateTime = PerformanceMetricsNow();
+	PlatformOpenHardwareCounters(HARDWARE_COUNTERS); // Optional (the overlay just shows them as unavailable)
 
 	// TODO Override via CLI arguments or something? (Can also compute based on available RAM)
 	constexpr size_t MAIN_MEMORY_SIZE = Megabytes(85);
 	constexpr size_t TRANSIENT_MEMORY_SIZE = Megabytes(1596) + Kilobytes(896);
 	SystemMemoryInitializeArenas(MAIN_MEMORY_SIZE, TRANSIENT_MEMORY_SIZE);
 
+	bool didBakeGlyphAtlas = GlyphAtlasBake(DEBUG_OVERLAY_GLYPH_ATLAS, ROBOTO_REGULAR_13PX);
+	ASSUME(didBakeGlyphAtlas, "Failed to bake the glyph atlas (font too large for the atlas?)");
+
 	WNDCLASSEX windowClass = {};
 	// TODO Is this really a good idea? Beware the CS_OWNDC footguns...
 	// TODO https://devblogs.microsoft.com/oldnewthing/20060601-06/?p=31003
@@ -339,9 +464,10 @@ INTERNAL void PlatformDoSetup() {
 	String windowTitle = CountedString(executableFileSystemPath);
 	PathStringToBaseNameInPlace(windowTitle);
 	PathStringStripFileExtensionInPlace(windowTitle);
-	StringAppend(windowTitle, " [");
-	StringAppend(windowTitle, RAGLITE_COMMIT_HASH);
-	StringAppend(windowTitle, "]");
+	size_t windowTitleCapacity = MAX_PATH - (windowTitle.buffer - executableFileSystemPath);
+	StringAppend(windowTitle, windowTitleCapacity, " [");
+	StringAppend(windowTitle, windowTitleCapacity, RAGLITE_COMMIT_HASH);
+	StringAppend(windowTitle, windowTitleCapacity, "]");
 	mainWindow = CreateWindowExA(
 		0, windowClass.lpszClassName, windowTitle.buffer,
 		WS_OVERLAPPEDWINDOW | WS_VISIBLE | WS_MAXIMIZE, CW_USEDEFAULT,
@@ -351,6 +477,8 @@ INTERNAL void PlatformDoSetup() {
 	MainWindowCreateFrameBuffers(mainWindow, GDI_SURFACE, GDI_BACKBUFFER);
 
 	CPU_PERFORMANCE_INFO.applicationLaunchTime = PerformanceMetricsGetTimeSince(applicationStartTime);
+	LOG("Finished setup in %.2f ms (CPU: %s, %lu logical processors)\n", CPU_PERFORMANCE_INFO.applicationLaunchTime,
+		CPU_BRAND_STRING, CPU_PERFORMANCE_INFO.numberOfProcessors);
 }
 
 INTERNAL bool PlatformShouldExit() {
@@ -358,22 +486,30 @@ INTERNAL bool PlatformShouldExit() {
 }
 
 INTERNAL void PlatformDoNextTick() {
+	PROFILE_FUNCTION();
 	lastUpdateTime = PerformanceMetricsNow();
 	CPU_PERFORMANCE_METRICS.applicationUptime = PerformanceMetricsGetTimeSince(applicationStartTime);
 
-	MSG message;
-	while(PeekMessage(&message, 0, 0, 0, PM_REMOVE)) {
-		TranslateMessage(&message);
-		DispatchMessageA(&message);
-		if(message.message == WM_QUIT)
-			APPLICATION_SHOULD_EXIT = true;
+	PerformanceMetricsBeginPhase();
+	{
+		PROFILE_ZONE("ProcessWindowMessages");
+		MSG message;
+		while(PeekMessage(&message, 0, 0, 0, PM_REMOVE)) {
+			TranslateMessage(&message);
+			DispatchMessageA(&message);
+			if(message.message == WM_QUIT)
+				APPLICATION_SHOULD_EXIT = true;
+		}
 	}
+	PerformanceMetricsEndPhase(FRAME_PHASE_MESSAGE_PROCESSING);
 	CPU_PERFORMANCE_METRICS.messageProcessingTime = PerformanceMetricsGetTimeSince(lastUpdateTime);
 
 	hardware_tick_t before = PerformanceMetricsNow();
+	PerformanceMetricsBeginPhase();
 	if(!APPLICATION_SHOULD_PAUSE) {
 		PlatformRunSimulationStep();
 	}
+	PerformanceMetricsEndPhase(FRAME_PHASE_SIMULATION_STEP);
 	CPU_PERFORMANCE_METRICS.simulationStepTime = PerformanceMetricsGetTimeSince(before);
 
 	MainWindowRedrawEverything(mainWindow);
@@ -381,17 +517,34 @@ INTERNAL void PlatformDoNextTick() {
 	milliseconds maxResponsiveSleepTime = MAX_FRAME_TIME;
 	milliseconds sleepTime = maxResponsiveSleepTime - CPU_PERFORMANCE_METRICS.frameTime;
 	hardware_tick_t beforeSleep = PerformanceMetricsNow();
-	if(sleepTime > 0) Sleep((DWORD)sleepTime);
+	if(sleepTime > 0) {
+		PROFILE_ZONE("Sleep");
+		Sleep((DWORD)sleepTime);
+	}
 	CPU_PERFORMANCE_METRICS.sleepTime = sleepTime;
 	CPU_PERFORMANCE_METRICS.suspendedTime = PerformanceMetricsGetTimeSince(beforeSleep);
 
 	milliseconds frameTime = PerformanceMetricsGetTimeSince(lastUpdateTime);
 	CPU_PERFORMANCE_METRICS.frameTime = frameTime;
 
+	if(APPLICATION_USES_ADAPTIVE_RESOLUTION && !APPLICATION_SHOULD_PAUSE) {
+		// NOTE: Only the simulation step (rendering and upscaling) depends on the internal resolution, whereas the
+		// overlays and surface blit always operate on the full backbuffer and can't be sped up by lowering the scale
+		milliseconds workTime = CPU_PERFORMANCE_METRICS.simulationStepTime;
+		if(AdaptiveResolutionUpdate(ADAPTIVE_RESOLUTION, workTime, MAX_FRAME_TIME)) {
+			INTERNAL_RESOLUTION_SCALE = ADAPTIVE_RESOLUTION.scale;
+			SurfaceResizeRenderTarget(INTERNAL_RENDER_TARGET, GDI_BACKBUFFER, INTERNAL_RESOLUTION_SCALE);
+		}
+	}
+	CPU_PERFORMANCE_METRICS.internalResolutionScale = INTERNAL_RESOLUTION_SCALE;
+
 	PerformanceMetricsRecordSample(CPU_PERFORMANCE_METRICS, PERFORMANCE_METRICS_HISTORY);
 }
 
 INTERNAL void PlatformDoShutdown() {
+	LOG("Shutting down after %.0f ms\n", CPU_PERFORMANCE_METRICS.applicationUptime);
+	LoggerShutdown();
+	PlatformCloseHardwareCounters(HARDWARE_COUNTERS);
 	timeEndPeriod(requestedSchedulerGranularityInMilliseconds);
 }
 
@@ -399,6 +552,7 @@ INTERNAL void PlatformRuntimeMain() {
 	PlatformDoSetup();
 	while(!PlatformShouldExit()) {
 		PlatformDoNextTick();
+		ProfilerCollectFrame(PROFILER_LAST_FRAME);
 	}
 	PlatformDoShutdown();
 }
\ No newline at end of file
@@ -83,6 +83,13 @@ INTERNAL inline platform_policy_t PlatformPolicyReadWrite() {
 	return policy;
 }
 
+// Same as read/write, except that existing files are truncated when opened (their previous contents are discarded)
+INTERNAL inline platform_policy_t PlatformPolicyOverwrite() {
+	platform_policy_t policy = PlatformPolicyReadWrite();
+	policy.creationDisposition = CREATE_ALWAYS;
+	return policy;
+}
+
 INTERNAL platform_handle_t PlatformOpenFileHandle(const char* fileSystemPath, platform_policy_t modePreset) {
 	platform_handle_t fileHandle = {};
 
@@ -125,4 +132,194 @@ INTERNAL size_t PlatformGetFileSize(platform_handle_t& fileHandle) {
 	}
 
 	return (size_t)fileSize.QuadPart;
+}
+
+// NOTE: The view keeps the mapping alive on its own, so the file handle may be closed before unmapping it
+INTERNAL const uint8* PlatformMapReadOnlyFile(platform_handle_t& fileHandle) {
+	if(!PlatformIsValidFileHandle(fileHandle)) return NULL;
+
+	HANDLE mappingHandle = CreateFileMappingA(fileHandle.handle, NULL, PAGE_READONLY, 0, 0, NULL);
+	if(!mappingHandle) {
+		PlatformSetFileError(fileHandle, "CreateFileMapping returned NULL", FROM_HERE);
+		return NULL;
+	}
+
+	void* baseAddress = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+	if(!baseAddress) PlatformSetFileError(fileHandle, "MapViewOfFile returned NULL", FROM_HERE);
+	CloseHandle(mappingHandle);
+
+	return (const uint8*)baseAddress;
+}
+
+INTERNAL void PlatformUnmapFile(const uint8* baseAddress) {
+	if(!baseAddress) return;
+	UnmapViewOfFile(baseAddress);
+}
+
+INTERNAL inline uint64 PlatformGetMonotonicTicks() {
+	LARGE_INTEGER highResolutionTimestamp;
+	QueryPerformanceCounter(&highResolutionTimestamp);
+	return (uint64)highResolutionTimestamp.QuadPart;
+}
+
+INTERNAL inline uint64 PlatformGetMonotonicTicksPerSecond() {
+	LARGE_INTEGER ticksPerSecond;
+	QueryPerformanceFrequency(&ticksPerSecond);
+	return (uint64)ticksPerSecond.QuadPart;
+}
+
+INTERNAL size_t PlatformCountResidentPages(void* startAddress, size_t pageCount, size_t pageSize) {
+	constexpr size_t MAX_QUERIED_PAGES = 256;
+	PSAPI_WORKING_SET_EX_INFORMATION workingSetEntries[MAX_QUERIED_PAGES];
+	HANDLE process = GetCurrentProcess();
+	size_t residentPageCount = 0;
+	for(size_t firstPage = 0; firstPage < pageCount; firstPage += MAX_QUERIED_PAGES) {
+		size_t batchSize = Min(pageCount - firstPage, MAX_QUERIED_PAGES);
+		for(size_t index = 0; index < batchSize; ++index) {
+			workingSetEntries[index].VirtualAddress = (uint8*)startAddress + (firstPage + index) * pageSize;
+		}
+
+		DWORD bufferSize = (DWORD)(batchSize * sizeof(PSAPI_WORKING_SET_EX_INFORMATION));
+		if(!QueryWorkingSetEx(process, workingSetEntries, bufferSize)) break;
+
+		for(size_t index = 0; index < batchSize; ++index) {
+			if(workingSetEntries[index].VirtualAttributes.Valid) residentPageCount++;
+		}
+	}
+	return residentPageCount;
+}
+
+INTERNAL inline uint64 PlatformGetCurrentThreadID() {
+	return (uint64)GetCurrentThreadId();
+}
+
+typedef void (*platform_thread_entry_t)(void* argument);
+typedef struct platform_thread {
+	platform_thread_entry_t entry;
+	void* argument;
+	HANDLE handle;
+} platform_thread_t;
+
+INTERNAL DWORD WINAPI PlatformRunThreadEntry(LPVOID parameter) {
+	platform_thread_t* thread = (platform_thread_t*)parameter;
+	thread->entry(thread->argument);
+	return 0;
+}
+
+// NOTE: The thread object is passed to the new thread, so it must remain valid until the thread has been joined
+INTERNAL bool PlatformCreateThread(platform_thread_t& thread, platform_thread_entry_t entry, void* argument) {
+	thread.entry = entry;
+	thread.argument = argument;
+	thread.handle = CreateThread(NULL, 0, PlatformRunThreadEntry, &thread, 0, NULL);
+	return thread.handle != NULL;
+}
+
+INTERNAL void PlatformJoinThread(platform_thread_t& thread) {
+	WaitForSingleObject(thread.handle, INFINITE);
+	CloseHandle(thread.handle);
+	thread.handle = NULL;
+}
+
+INTERNAL inline void PlatformSleepMilliseconds(uint32 duration) {
+	Sleep(duration);
+}
+
+typedef struct platform_semaphore {
+	HANDLE handle;
+} platform_semaphore_t;
+
+INTERNAL bool PlatformCreateSemaphore(platform_semaphore_t& semaphore) {
+	semaphore.handle = CreateSemaphoreA(NULL, 0, MAXLONG, NULL);
+	return semaphore.handle != NULL;
+}
+
+INTERNAL void PlatformSignalSemaphore(platform_semaphore_t& semaphore) {
+	ReleaseSemaphore(semaphore.handle, 1, NULL);
+}
+
+INTERNAL void PlatformWaitForSemaphore(platform_semaphore_t& semaphore) {
+	WaitForSingleObject(semaphore.handle, INFINITE);
+}
+
+INTERNAL void PlatformDestroySemaphore(platform_semaphore_t& semaphore) {
+	CloseHandle(semaphore.handle);
+	semaphore.handle = NULL;
+}
+
+INTERNAL uint32 PlatformGetProcessorCount() {
+	SYSTEM_INFO systemInfo;
+	GetSystemInfo(&systemInfo);
+	return (uint32)systemInfo.dwNumberOfProcessors;
+}
+
+INTERNAL void* PlatformAllocateMemory(size_t size) {
+	return VirtualAlloc(NULL, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+}
+
+INTERNAL void PlatformFreeMemory(void* baseAddress, size_t size) {
+	VirtualFree(baseAddress, 0, MEM_RELEASE);
+}
+
+INTERNAL advance_simulation_fn_t PlatformLoadSimulationModule(const char* moduleDirectory, const char* appName) {
+#ifdef NDEBUG
+	const char* buildSuffix = "";
+#else
+	const char* buildSuffix = "Dbg";
+#endif
+	char modulePath[MAX_PATH];
+	StringCbPrintfA(modulePath, sizeof(modulePath), "%sRagLite%s%s.dll", moduleDirectory, appName, buildSuffix);
+
+	// NOTE: The module is never unloaded (there's no hot reloading yet, so it remains in use until the process exits)
+	HMODULE module = LoadLibraryA(modulePath);
+	if(!module) return NULL;
+	return (advance_simulation_fn_t)GetProcAddress(module, "AdvanceSimulation");
+}
+
+INTERNAL inline void PlatformAttachParentConsole() {
+	// NOTE: GUI applications don't inherit the console, so nothing would be visible unless the output was redirected
+	if(GetStdHandle(STD_OUTPUT_HANDLE)) return;
+	if(!AttachConsole(ATTACH_PARENT_PROCESS)) return;
+	freopen("CONOUT$", "w", stdout);
+	freopen("CONOUT$", "w", stderr);
+}
+
+// NOTE: Reading the other PMU events requires a kernel driver (or ETW sessions with admin rights), so only cycles are available
+INTERNAL bool PlatformOpenHardwareCounters(hardware_counter_group_t& group) {
+	group = {};
+	ULONG64 cycleTime;
+	if(!QueryThreadCycleTime(GetCurrentThread(), &cycleTime)) return false;
+
+	group.availableCounterMask = (1u << HARDWARE_COUNTER_CYCLES);
+	return true;
+}
+
+INTERNAL void PlatformReadHardwareCounters(hardware_counter_group_t& group, hardware_counter_values_t& values) {
+	if(!HardwareCounterIsAvailable(group, HARDWARE_COUNTER_CYCLES)) return;
+
+	ULONG64 cycleTime = 0;
+	QueryThreadCycleTime(GetCurrentThread(), &cycleTime);
+	values.values[HARDWARE_COUNTER_CYCLES] = (uint64)cycleTime;
+}
+
+INTERNAL void PlatformCloseHardwareCounters(hardware_counter_group_t& group) {
+	group = {};
+}
+
+INTERNAL size_t PlatformWriteFileContents(platform_handle_t& fileHandle, const void* buffer, size_t size) {
+	if(!PlatformIsValidFileHandle(fileHandle)) return 0;
+
+	DWORD bytesWritten = 0;
+	BOOL success = WriteFile(fileHandle.handle, buffer, (DWORD)size, &bytesWritten, NULL);
+	if(!success) {
+		PlatformSetFileError(fileHandle, "WriteFile returned FALSE", FROM_HERE);
+		return 0;
+	}
+
+	return (size_t)bytesWritten;
+}
+
+// Returns true if the directory exists afterwards (parent directories must be created first)
+INTERNAL bool PlatformCreateDirectory(const char* fileSystemPath) {
+	if(CreateDirectoryA(fileSystemPath, NULL)) return true;
+	return GetLastError() == ERROR_ALREADY_EXISTS;
 }
\ No newline at end of file
@@ -3,7 +3,22 @@ GLOBAL int DEBUG_OVERLAY_LINE_HEIGHT = 18;
 constexpr int DEBUG_OVERLAY_MARGIN_SIZE = 8;
 constexpr int DEBUG_OVERLAY_PADDING_SIZE = 8;
 
-constexpr size_t LINE_COUNT = 57;
+constexpr size_t LINE_COUNT = 78;
+constexpr size_t DEBUG_OVERLAY_LINE_CAPACITY = 256;
+
+// NOTE: Overlay text is rebuilt every frame, so it gets a small arena of its own (instead of using the application's memory)
+constexpr size_t DEBUG_OVERLAY_TEXT_MEMORY_SIZE = Kilobytes(4);
+GLOBAL uint8 DEBUG_OVERLAY_TEXT_STORAGE[DEBUG_OVERLAY_TEXT_MEMORY_SIZE];
+GLOBAL memory_arena_t DEBUG_OVERLAY_TEXT_MEMORY = {
+	.displayName = StringLiteral("Debug Overlay Text"),
+	.lifetime = RESET_AFTER_EACH_FRAME,
+	.usage = PREALLOCATED_ON_LOAD,
+	.baseAddress = DEBUG_OVERLAY_TEXT_STORAGE,
+	.reservedSize = DEBUG_OVERLAY_TEXT_MEMORY_SIZE,
+	.committedSize = DEBUG_OVERLAY_TEXT_MEMORY_SIZE,
+	.used = 0,
+	.allocationCount = 0
+};
 
 constexpr int PROGRESS_BAR_HEIGHT = 16;
 constexpr int PROGRESS_BAR_WIDTH = 256;
@@ -48,6 +63,8 @@ constexpr gdi_color_t UI_TEXT_COLOR = RGB_COLOR_WHITE;
 constexpr gdi_color_t UI_HIGHLIGHT_COLOR = RGB_COLOR_RED;
 
 constexpr gdi_color_t USED_MEMORY_BLOCK_COLOR = RGB_COLOR_GREEN;
+constexpr gdi_color_t PAGED_OUT_MEMORY_BLOCK_COLOR = RGB_COLOR_DARKGREEN;
+constexpr gdi_color_t RESIDENT_MEMORY_BLOCK_COLOR = RGB_COLOR_TURQUOISE;
 constexpr gdi_color_t COMMITTED_MEMORY_BLOCK_COLOR = RGB_COLOR_GRAY;
 constexpr gdi_color_t RESERVED_MEMORY_BLOCK_COLOR = RGB_COLOR_DARK;
 
@@ -96,190 +113,6 @@ INTERNAL inline bool DebugDrawIsRectangleOffscreen(RECT& rectangle) {
 
 constexpr int32 UI_BORDER_WIDTH = 1;
 
-INTERNAL inline int DoubleGetIntegerPart(double number) {
-	return (int)floor(number);
-}
-
-INTERNAL inline double DoubleGetDecimalPart(double number) {
-	return number - floor(number);
-}
-
-INTERNAL inline double DoubleGetReverseDecimalPart(double number) {
-	return 1.0 - DoubleGetDecimalPart(number);
-}
-
-INTERNAL inline void DebugDrawBlendPixelRGBA(gdi_color_t& source, gdi_color_t& destination, gdi_color_t& blended) {
-	// TODO: Improve performance, accuracy/gamma, SSE etc. (don't try this at home, use the GPU instead)
-	if(source.alpha == 0) {
-		blended.red = destination.red;
-		blended.blue = destination.blue;
-		blended.green = destination.green;
-		blended.alpha = destination.alpha;
-		return;
-	}
-
-	if(source.alpha == 255) {
-		blended.red = source.red;
-		blended.blue = source.blue;
-		blended.green = source.green;
-		blended.alpha = 255;
-		return;
-	}
-
-	uint8 oneMinusAlpha = 255 - source.alpha;
-	int r = ((int)source.red * (int)source.alpha + (int)destination.red * oneMinusAlpha + 127) / 255;
-	int g = ((int)source.green * (int)source.alpha + (int)destination.green * oneMinusAlpha + 127) / 255;
-	int b = ((int)source.blue * (int)source.alpha + (int)destination.blue * oneMinusAlpha + 127) / 255;
-
-	int a = ((int)source.alpha * 255 + (int)destination.alpha * oneMinusAlpha + 127) / 255;
-
-	blended.red = ClampToInterval((uint8)r, 0, 255);
-	blended.green = ClampToInterval((uint8)g, 0, 255);
-	blended.blue = ClampToInterval((uint8)b, 0, 255);
-	blended.alpha = ClampToInterval((uint8)a, 0, 255);
-}
-
-INTERNAL inline void DebugDrawSetPixelColor(int x, int y, gdi_color_t source) {
-	if(x < 0 || y < 0 || x >= (int)GDI_BACKBUFFER.bitmap.width || y >= (int)GDI_BACKBUFFER.bitmap.height) {
-		return;
-	}
-
-	if(source.alpha == 0) {
-		return;
-	}
-
-	uint32* pixelArray = (uint32*)GDI_BACKBUFFER.bitmap.pixelBuffer;
-	DebugDrawClipPointToScreen(GDI_BACKBUFFER, x, y);
-	size_t pixelIndex = (size_t)x + (size_t)y * (size_t)GDI_BACKBUFFER.bitmap.width;
-	gdi_color_t blended = source;
-	if(source.alpha == 255) {
-		blended = source;
-		blended.alpha = 255;
-		pixelArray[pixelIndex] = blended.bytes;
-		return;
-	}
-
-	gdi_color_t destination = { .bytes = pixelArray[pixelIndex] };
-	DebugDrawBlendPixelRGBA(source, destination, blended);
-	pixelArray[pixelIndex] = blended.bytes;
-}
-
-INTERNAL inline void DebugDrawPlotAntiAliased(int x, int y, double alpha, gdi_color_t color) {
-	if(alpha <= 0.0) return;
-	if(alpha > 1.0) alpha = 1.0;
-	color.alpha = (uint8)ClampToInterval((int)round(255.0 * alpha), 0, 255);
-	DebugDrawSetPixelColor(x, y, color);
-}
-
-// Xiaolin Wu's Anti-Aliased Line Drawing Algorithm
-INTERNAL void DebugDrawColoredLineWAA(double x0, double y0, double x1, double y1, gdi_color_t color) {
-	bool isSteepLine = fabs(y1 - y0) > fabs(x1 - x0);
-
-	if(isSteepLine) {
-		Swap(x0, y0, double);
-		Swap(x1, y1, double);
-	}
-
-	if(x0 > x1) {
-		Swap(x0, x1, double);
-		Swap(y0, y1, double);
-	}
-
-	double deltaX = x1 - x0;
-	double deltaY = y1 - y0;
-	double gradient = (deltaX == 0.0) ? 1.0 : deltaY / deltaX;
-
-	// First endpoint
-	double xEnd = round(x0);
-	double yEnd = y0 + gradient * (xEnd - x0);
-	double xGap = DoubleGetReverseDecimalPart(x0 + 0.5);
-	int xPixel1 = (int)xEnd;
-	int yPixel1 = DoubleGetIntegerPart(yEnd);
-
-	if(isSteepLine) {
-		DebugDrawPlotAntiAliased(yPixel1, xPixel1, DoubleGetReverseDecimalPart(yEnd) * xGap, color);
-		DebugDrawPlotAntiAliased(yPixel1 + 1, xPixel1, DoubleGetDecimalPart(yEnd) * xGap, color);
-	} else {
-		DebugDrawPlotAntiAliased(xPixel1, yPixel1, DoubleGetReverseDecimalPart(yEnd) * xGap, color);
-		DebugDrawPlotAntiAliased(xPixel1, yPixel1 + 1, DoubleGetDecimalPart(yEnd) * xGap, color);
-	}
-
-	double errY = yEnd + gradient;
-
-	// Second endpoint
-	xEnd = round(x1);
-	yEnd = y1 + gradient * (xEnd - x1);
-	xGap = DoubleGetDecimalPart(x1 + 0.5);
-	int xPixel2 = (int)xEnd;
-	int yPixel2 = DoubleGetIntegerPart(yEnd);
-
-	if(isSteepLine) {
-		DebugDrawPlotAntiAliased(yPixel2, xPixel2, DoubleGetReverseDecimalPart(yEnd) * xGap, color);
-		DebugDrawPlotAntiAliased(yPixel2 + 1, xPixel2, DoubleGetDecimalPart(yEnd) * xGap, color);
-	} else {
-		DebugDrawPlotAntiAliased(xPixel2, yPixel2, DoubleGetReverseDecimalPart(yEnd) * xGap, color);
-		DebugDrawPlotAntiAliased(xPixel2, yPixel2 + 1, DoubleGetDecimalPart(yEnd) * xGap, color);
-	}
-
-	// Main loop
-	if(isSteepLine) {
-		for(int x = xPixel1 + 1; x < xPixel2; x++) {
-			DebugDrawPlotAntiAliased(DoubleGetIntegerPart(errY), x, DoubleGetReverseDecimalPart(errY), color);
-			DebugDrawPlotAntiAliased(DoubleGetIntegerPart(errY) + 1, x, DoubleGetDecimalPart(errY), color);
-			errY += gradient;
-		}
-	} else {
-		for(int x = xPixel1 + 1; x < xPixel2; x++) {
-			DebugDrawPlotAntiAliased(x, DoubleGetIntegerPart(errY), DoubleGetReverseDecimalPart(errY), color);
-			DebugDrawPlotAntiAliased(x, DoubleGetIntegerPart(errY) + 1, DoubleGetDecimalPart(errY), color);
-			errY += gradient;
-		}
-	}
-}
-
-// Digital Differential Analyzer Line Drawing Algorithm
-INTERNAL void DebugDrawColoredLineDDA(double startX, double startY, double endX, double endY, gdi_color_t color) {
-	double deltaX = endX - startX;
-	double deltaY = endY - startY;
-	double absDeltaX = fabs(deltaX);
-	double absDeltaY = fabs(deltaY);
-
-	int steps = (absDeltaX > absDeltaY) ? (int)absDeltaX : (int)absDeltaY;
-	double xIncrement = deltaX / steps;
-	double yIncrement = deltaY / steps;
-
-	double x = startX;
-	double y = startY;
-	for(int i = 0; i <= steps; i++) {
-		DebugDrawSetPixelColor((int)round(x), (int)round(y), color);
-		x += xIncrement;
-		y += yIncrement;
-	}
-}
-
-// Bresenham's Integer Line Drawing Algorithm
-INTERNAL void DebugDrawColoredLineBHI(int x0, int y0, int x1, int y1, gdi_color_t color) {
-	int deltaX = abs(x1 - x0);
-	int stepX = (x0 < x1) ? 1 : -1;
-	int deltaY = -abs(y1 - y0);
-	int stepY = (y0 < y1) ? 1 : -1;
-	int accumulatedError = deltaX + deltaY;
-
-	while(true) {
-		DebugDrawSetPixelColor(x0, y0, color);
-		if(x0 == x1 && y0 == y1) break;
-		int errorThreshold = 2 * accumulatedError;
-		if(errorThreshold >= deltaY) {
-			accumulatedError += deltaY;
-			x0 += stepX;
-		}
-		if(errorThreshold <= deltaX) {
-			accumulatedError += deltaX;
-			y0 += stepY;
-		}
-	}
-}
-
 constexpr int32 DEFAULT_LINE_WIDTH = 1;
 INTERNAL inline void DebugDrawColoredLineGDI(HDC& displayDeviceContext, int startX, int startY, int endX, int endY, gdi_color_t color) {
 	// TODO: Cache the pens, or select from an array of preallocated ones to begin with
@@ -288,6 +121,7 @@ INTERNAL inline void DebugDrawColoredLineGDI(HDC& displayDeviceContext, int star
 
 	MoveToEx(displayDeviceContext, startX, startY, NULL);
 	LineTo(displayDeviceContext, endX, endY);
+	BitmapMarkDirtyRectangle(GDI_BACKBUFFER.bitmap, Min(startX, endX), Min(startY, endY), Max(startX, endX) + 1, Max(startY, endY) + 1);
 
 	SelectObject(displayDeviceContext, oldPen);
 	DeleteObject(graphPen);
@@ -303,13 +137,13 @@ INTERNAL inline void DebugDrawColoredLine(HDC& displayDeviceContext, int startX,
 			DebugDrawColoredLineGDI(displayDeviceContext, startX, startY, endX, endY, color);
 		} break;
 		case BRESENHAM_INTEGER_LINE: {
-			DebugDrawColoredLineBHI(startX, startY, endX, endY, color);
+			BitmapDrawLineBresenham(GDI_BACKBUFFER.bitmap, startX, startY, endX, endY, color);
 		} break;
 		case DDA_FLOAT_LINE: {
-			DebugDrawColoredLineDDA(startX, startY, endX, endY, color);
+			BitmapDrawLineDDA(GDI_BACKBUFFER.bitmap, startX, startY, endX, endY, color);
 		} break;
 		case WU_FLOAT_LINE: {
-			DebugDrawColoredLineWAA(startX, startY, endX, endY, color);
+			BitmapDrawLineWu(GDI_BACKBUFFER.bitmap, startX, startY, endX, endY, color);
 		} break;
 	}
 }
@@ -324,6 +158,7 @@ INTERNAL inline void DebugDrawVerticalLine(HDC& displayDeviceContext, int startX
 	uint32* pixelArray = (uint32*)GDI_BACKBUFFER.bitmap.pixelBuffer;
 	DebugDrawClipPointToScreen(GDI_BACKBUFFER, startX, minY);
 	DebugDrawClipPointToScreen(GDI_BACKBUFFER, endX, maxY);
+	BitmapMarkDirtyRectangle(GDI_BACKBUFFER.bitmap, startX, minY, startX + 1, maxY + 1);
 	for(size_t y = minY; y <= maxY; ++y) { // For now: End is inclusive (GDI convention)
 		pixelArray[startX + y * GDI_BACKBUFFER.bitmap.width] = color.bytes;
 	}
@@ -334,6 +169,7 @@ INTERNAL inline void DebugDrawSolidColorRectangle(HDC& displayDeviceContext, REC
 
 	uint32* pixelArray = (uint32*)GDI_BACKBUFFER.bitmap.pixelBuffer;
 	DebugDrawClipRectangleToScreen(GDI_BACKBUFFER, rectangle);
+	BitmapMarkDirtyRectangle(GDI_BACKBUFFER.bitmap, rectangle.left, rectangle.top, rectangle.right, rectangle.bottom);
 
 	for(size_t y = rectangle.top; y < rectangle.bottom; ++y) {
 		for(size_t x = rectangle.left; x < rectangle.right; ++x) {
@@ -347,6 +183,7 @@ INTERNAL inline void DebugDrawFramedColorRectangle(HDC& displayDeviceContext, RE
 
 	uint32* pixelArray = (uint32*)GDI_BACKBUFFER.bitmap.pixelBuffer;
 	DebugDrawClipRectangleToScreen(GDI_BACKBUFFER, rectangle);
+	BitmapMarkDirtyRectangle(GDI_BACKBUFFER.bitmap, rectangle.left, rectangle.top, rectangle.right + 1, rectangle.bottom + 1);
 
 	// Top edge
 	for(int x = rectangle.left; x < rectangle.right; ++x) {
@@ -365,6 +202,196 @@ INTERNAL inline void DebugDrawFramedColorRectangle(HDC& displayDeviceContext, RE
 	}
 }
 
+INTERNAL inline int DebugDrawText(int x, int y, const char* text, int length) {
+	// NOTE: GDI's font rendering is far too slow to redraw every line of the overlays in each frame
+	return BitmapDrawText(GDI_BACKBUFFER.bitmap, DEBUG_OVERLAY_GLYPH_ATLAS, DEBUG_OVERLAY_TEXT_CACHE, x, y, text, length, UI_TEXT_COLOR);
+}
+
+INTERNAL inline void DebugDrawCenteredText(const char* text, RECT& textArea) {
+	int length = lstrlenA(text);
+	int textWidth = GlyphAtlasMeasureText(DEBUG_OVERLAY_GLYPH_ATLAS, text, length);
+	int x = textArea.left + (textArea.right - textArea.left - textWidth) / 2;
+	int y = textArea.top + (textArea.bottom - textArea.top - DEBUG_OVERLAY_GLYPH_ATLAS.lineHeight) / 2;
+	DebugDrawText(x, y, text, length);
+}
+
+// NOTE: One column per sample, in the same order as on screen (the strip scrolls by one column whenever a sample is recorded)
+constexpr int MAX_HISTORY_GRAPH_WIDTH = 1024;
+constexpr int MAX_HISTORY_GRAPH_HEIGHT = 128;
+typedef struct history_graph_cache {
+	offscreen_buffer_t strip;
+	uint32 pixels[MAX_HISTORY_GRAPH_WIDTH * MAX_HISTORY_GRAPH_HEIGHT];
+	milliseconds cachedMaxFrameTime;
+	line_drawing_style_t cachedLineDrawingMethod;
+	uint64 cachedSampleCount;
+	bool isValid;
+} history_graph_cache_t;
+
+GLOBAL history_graph_cache_t HISTORY_GRAPH_CACHES[HISTORY_GRAPH_STYLE_COUNT] = {};
+
+INTERNAL inline bool HistoryGraphHasSample(uint32 recordIndex) {
+	return PERFORMANCE_METRICS_HISTORY.recordedSamples[recordIndex].frameTime >= EPSILON;
+}
+
+// The newest sample is always shown in the rightmost column (panels narrower than the history only show the most recent samples)
+INTERNAL inline bool HistoryGraphGetColumnRecordIndex(history_graph_cache_t& cache, int columnX, uint32& recordIndex) {
+	int sampleOffset = columnX + PERFORMANCE_HISTORY_SIZE - cache.strip.width;
+	if(sampleOffset < 0 || sampleOffset >= PERFORMANCE_HISTORY_SIZE) return false;
+	recordIndex = (PERFORMANCE_METRICS_HISTORY.oldestRecordedSampleIndex + sampleOffset) % PERFORMANCE_HISTORY_SIZE;
+	return true;
+}
+
+INTERNAL inline int HistoryGraphGetFrameTimeY(history_graph_cache_t& cache, uint32 recordIndex, percentage graphScale) {
+	milliseconds frameTime = PERFORMANCE_METRICS_HISTORY.recordedSamples[recordIndex].frameTime;
+	int lineY = cache.strip.height - (int)(frameTime * graphScale);
+	return ClampToInterval(lineY, 0, cache.strip.height - 1);
+}
+
+INTERNAL inline void HistoryGraphDrawVerticalLine(offscreen_buffer_t& column, int startY, int endY, gdi_color_t color) {
+	int minY = ClampToInterval(Min(startY, endY), 0, column.height - 1);
+	int maxY = ClampToInterval(Max(startY, endY), 0, column.height - 1);
+	for(int y = minY; y <= maxY; ++y) { // End is inclusive (same as DebugDrawVerticalLine)
+		*BitmapGetPixelAddress(column, 0, y) = color.bytes;
+	}
+}
+
+INTERNAL inline void HistoryGraphDrawLine(offscreen_buffer_t& column, int startX, int startY, int endX, int endY, gdi_color_t color) {
+	switch(SELECTED_LINE_DRAWING_METHOD) {
+		case DDA_FLOAT_LINE: {
+			BitmapDrawLineDDA(column, startX, startY, endX, endY, color);
+		} break;
+		case WU_FLOAT_LINE: {
+			BitmapDrawLineWu(column, startX, startY, endX, endY, color);
+		} break;
+		default: { // GDI can't draw into the cache (so those graphs are always plotted directly instead)
+			BitmapDrawLineBresenham(column, startX, startY, endX, endY, color);
+		} break;
+	}
+}
+
+// Replays everything the full redraw would have plotted in this column (in the same order, since lines may be blended)
+INTERNAL void HistoryGraphRedrawColumn(history_graph_cache_t& cache, history_graph_style_t chartType, int columnX, percentage graphScale) {
+	offscreen_buffer_t column = cache.strip;
+	column.pixelBuffer = BitmapGetPixelAddress(cache.strip, columnX, 0);
+	column.width = 1;
+	column.dirtyRegions = {};
+
+	// NOTE: The background is treated as transparent when blitting, so that static decorations can be drawn underneath
+	HistoryGraphDrawVerticalLine(column, 0, column.height - 1, UI_BACKGROUND_COLOR);
+	uint32 recordIndex;
+	if(!HistoryGraphGetColumnRecordIndex(cache, columnX, recordIndex) || !HistoryGraphHasSample(recordIndex)) return;
+
+	performance_metrics_t recorded = PERFORMANCE_METRICS_HISTORY.recordedSamples[recordIndex];
+	switch(chartType) {
+		case XY_LINES_PLOTTED: {
+			uint32 oldestIndex = PERFORMANCE_METRICS_HISTORY.oldestRecordedSampleIndex;
+			uint32 newestIndex = (oldestIndex + PERFORMANCE_HISTORY_SIZE - 1) % PERFORMANCE_HISTORY_SIZE;
+			uint32 previousIndex = (recordIndex + PERFORMANCE_HISTORY_SIZE - 1) % PERFORMANCE_HISTORY_SIZE;
+			uint32 nextIndex = (recordIndex + 1) % PERFORMANCE_HISTORY_SIZE;
+			int lineEndY = HistoryGraphGetFrameTimeY(cache, recordIndex, graphScale);
+
+			// Segment ending in this column (the oldest sample is connected to the bottom edge instead)
+			if(recordIndex == oldestIndex || !HistoryGraphHasSample(previousIndex)) {
+				HistoryGraphDrawLine(column, 0, column.height - 1, 0, lineEndY, RGB_COLOR_CYAN);
+			} else {
+				int lineStartX = (recordIndex == 0) ? 0 : -1; // There's no previous line to connect to (same as the full redraw)
+				int lineStartY = HistoryGraphGetFrameTimeY(cache, previousIndex, graphScale);
+				HistoryGraphDrawLine(column, lineStartX, lineStartY, 0, lineEndY, RGB_COLOR_CYAN);
+			}
+
+			// Segment starting in this column (the one leading into the first record is drawn entirely in the next column)
+			if(recordIndex != newestIndex && nextIndex != 0 && HistoryGraphHasSample(nextIndex)) {
+				int nextLineY = HistoryGraphGetFrameTimeY(cache, nextIndex, graphScale);
+				HistoryGraphDrawLine(column, 0, lineEndY, 1, nextLineY, RGB_COLOR_CYAN);
+			}
+		} break;
+
+		case AREA_PERCENT_STACKED: {
+			milliseconds stackedTimes[] = { recorded.userInterfaceRenderTime, recorded.simulationStepTime, recorded.surfaceBlitTime,
+				recorded.suspendedTime, recorded.messageProcessingTime };
+			gdi_color_t stackedColors[] = { RGB_COLOR_GOLD, RGB_COLOR_VIOLET, RGB_COLOR_TURQUOISE, RGB_COLOR_DARKGREEN, RGB_COLOR_ORANGE };
+			int barHeight = column.height;
+			int lineStartY = column.height - UI_BORDER_WIDTH;
+			constexpr int STACKED_AREA_COUNT = sizeof(stackedTimes) / sizeof(milliseconds);
+			for(int index = 0; index < STACKED_AREA_COUNT; ++index) {
+				percentage filled = (percentage)(stackedTimes[index] / recorded.frameTime);
+				int lineEndY = ClampToInterval(lineStartY - (int)(filled * barHeight) + 1, 0, column.height - 1);
+				HistoryGraphDrawVerticalLine(column, lineStartY, lineEndY, stackedColors[index]);
+				lineStartY = lineEndY;
+			}
+			HistoryGraphDrawVerticalLine(column, lineStartY, 0, RGB_COLOR_GRAY);
+		} break;
+	}
+}
+
+INTERNAL void HistoryGraphCacheUpdate(history_graph_cache_t& cache, history_graph_style_t chartType, int innerWidth, int innerHeight, milliseconds maxFrameTime) {
+	ASSUME(innerWidth <= MAX_HISTORY_GRAPH_WIDTH && innerHeight <= MAX_HISTORY_GRAPH_HEIGHT, "History graph panel exceeds the cached strip");
+	percentage graphScale = (percentage)(innerHeight / maxFrameTime);
+	uint64 newSampleCount = PERFORMANCE_METRICS_HISTORY.recordedSampleCount - cache.cachedSampleCount;
+
+	// NOTE: Rescaling moves every sample, so there's no way around replotting the entire history in that case
+	bool needsFullRedraw = !cache.isValid || cache.strip.height != innerHeight || cache.strip.width != innerWidth;
+	needsFullRedraw = needsFullRedraw || newSampleCount >= (uint64)innerWidth;
+	if(chartType == XY_LINES_PLOTTED) {
+		needsFullRedraw = needsFullRedraw || cache.cachedMaxFrameTime != maxFrameTime;
+		needsFullRedraw = needsFullRedraw || cache.cachedLineDrawingMethod != SELECTED_LINE_DRAWING_METHOD;
+	}
+
+	if(needsFullRedraw) {
+		cache.strip = {
+			.width = innerWidth,
+			.height = innerHeight,
+			.bytesPerPixel = sizeof(uint32),
+			.stride = innerWidth * (int)sizeof(uint32),
+			.pixelBuffer = cache.pixels,
+		};
+		for(int columnX = 0; columnX < innerWidth; ++columnX)
+			HistoryGraphRedrawColumn(cache, chartType, columnX, graphScale);
+	} else if(newSampleCount > 0) {
+		// Older samples keep their pixels and merely scroll to the left, so only the new columns need to be plotted
+		int scrolledWidth = innerWidth - (int)newSampleCount;
+		for(int y = 0; y < innerHeight; ++y) {
+			uint32* row = BitmapGetPixelAddress(cache.strip, 0, y);
+			memmove(row, row + newSampleCount, scrolledWidth * sizeof(uint32));
+		}
+		for(int columnX = scrolledWidth; columnX < innerWidth; ++columnX)
+			HistoryGraphRedrawColumn(cache, chartType, columnX, graphScale);
+
+		if(chartType == XY_LINES_PLOTTED) {
+			// The previously newest sample now connects to the next one, and the oldest one (if shown) to the bottom edge
+			if(scrolledWidth > 0) HistoryGraphRedrawColumn(cache, chartType, scrolledWidth - 1, graphScale);
+			int oldestColumnX = innerWidth - PERFORMANCE_HISTORY_SIZE;
+			if(oldestColumnX >= 0 && oldestColumnX < scrolledWidth - 1) HistoryGraphRedrawColumn(cache, chartType, oldestColumnX, graphScale);
+		}
+	}
+
+	cache.cachedMaxFrameTime = maxFrameTime;
+	cache.cachedLineDrawingMethod = SELECTED_LINE_DRAWING_METHOD;
+	cache.cachedSampleCount = PERFORMANCE_METRICS_HISTORY.recordedSampleCount;
+	cache.isValid = true;
+}
+
+INTERNAL void HistoryGraphCacheBlit(history_graph_cache_t& cache, RECT& panelRect) {
+	if(DebugDrawIsRectangleOffscreen(panelRect)) return;
+
+	RECT visibleRect = {
+		Max(panelRect.left, 0),
+		Max(panelRect.top, 0),
+		Min(panelRect.right, GDI_BACKBUFFER.bitmap.width),
+		Min(panelRect.bottom, GDI_BACKBUFFER.bitmap.height)
+	};
+
+	for(int y = visibleRect.top; y < visibleRect.bottom; ++y) {
+		uint32* sourceRow = BitmapGetPixelAddress(cache.strip, 0, y - panelRect.top);
+		uint32* destinationRow = BitmapGetPixelAddress(GDI_BACKBUFFER.bitmap, 0, y);
+		for(int x = visibleRect.left; x < visibleRect.right; ++x) {
+			uint32 pixel = sourceRow[x - panelRect.left];
+			if(pixel != UI_BACKGROUND_COLOR.bytes) destinationRow[x] = pixel;
+		}
+	}
+	BitmapMarkDirtyRectangle(GDI_BACKBUFFER.bitmap, visibleRect.left, visibleRect.top, visibleRect.right, visibleRect.bottom);
+}
+
 INTERNAL void DebugDrawHistoryGraph(HDC& displayDeviceContext, int topLeftX, int topLeftY, int panelWidth, int panelHeight, history_graph_style_t chartType) {
 	RECT borderRect = { topLeftX, topLeftY, topLeftX + panelWidth, topLeftY + panelHeight };
 	DebugDrawSolidColorRectangle(displayDeviceContext, borderRect, RGB_COLOR_WHITE);
@@ -378,6 +405,27 @@ INTERNAL void DebugDrawHistoryGraph(HDC& displayDeviceContext, int topLeftX, int
 	percentage graphScale = (percentage)(innerHeight / maxFrameTime);
 	if(maxFrameTime < EPSILON) return;
 
+	// NOTE: GDI lines can't be drawn into the cache, and substituting another algorithm would change their appearance
+	bool usesCachedGraph = DEBUG_OVERLAY_USES_INCREMENTAL_GRAPHS;
+	if(chartType == XY_LINES_PLOTTED && SELECTED_LINE_DRAWING_METHOD == DEFAULT_GDI_LINE) usesCachedGraph = false;
+
+	if(usesCachedGraph) {
+		history_graph_cache_t& cache = HISTORY_GRAPH_CACHES[chartType];
+		HistoryGraphCacheUpdate(cache, chartType, innerWidth, innerHeight, maxFrameTime);
+		if(chartType == XY_LINES_PLOTTED) {
+			int fpsTargetLineOffsetY = panelRect.bottom - (int)(MAX_FRAME_TIME * graphScale);
+			DebugDrawColoredLine(displayDeviceContext, panelRect.left, fpsTargetLineOffsetY, panelRect.right, fpsTargetLineOffsetY, RGB_COLOR_LIGHTGRAY);
+		}
+		HistoryGraphCacheBlit(cache, panelRect);
+		if(chartType == XY_LINES_PLOTTED) {
+			int cutoffLineX = panelRect.left + PERFORMANCE_METRICS_HISTORY.oldestRecordedSampleIndex * panelWidth / PERFORMANCE_HISTORY_SIZE;
+			int cutoffLineY = panelRect.bottom;
+			DebugDrawClipPointToRectangle(cutoffLineX, cutoffLineY, panelRect);
+			DebugDrawVerticalLine(displayDeviceContext, cutoffLineX, cutoffLineY, cutoffLineX, panelRect.top, RGB_COLOR_DARKGREEN);
+		}
+		return;
+	}
+
 	switch(chartType) {
 
 		case XY_LINES_PLOTTED: {
@@ -462,6 +510,32 @@ INTERNAL void DebugDrawHistoryGraph(HDC& displayDeviceContext, int topLeftX, int
 	}
 }
 
+// NOTE: The scale only changes in discrete steps, so bars are easier to read than connecting the samples with lines
+INTERNAL void DebugDrawResolutionScaleHistory(HDC& displayDeviceContext, int topLeftX, int topLeftY, int panelWidth, int panelHeight) {
+	RECT borderRect = { topLeftX, topLeftY, topLeftX + panelWidth, topLeftY + panelHeight };
+	DebugDrawSolidColorRectangle(displayDeviceContext, borderRect, RGB_COLOR_WHITE);
+
+	RECT panelRect = { borderRect.left + UI_BORDER_WIDTH, borderRect.top + UI_BORDER_WIDTH, borderRect.right - UI_BORDER_WIDTH, borderRect.bottom - UI_BORDER_WIDTH };
+	DebugDrawSolidColorRectangle(displayDeviceContext, panelRect, UI_BACKGROUND_COLOR);
+
+	int innerWidth = panelRect.right - panelRect.left;
+	int innerHeight = panelRect.bottom - panelRect.top;
+	for(int x = 0; x < innerWidth; ++x) {
+		// Same mapping as the history graphs (the last sample that falls into a column is the one that's shown)
+		uint32 offset = Min((uint32)(((x + 1) * PERFORMANCE_HISTORY_SIZE - 1) / innerWidth), PERFORMANCE_HISTORY_SIZE - 1);
+		uint32 recordIndex = (PERFORMANCE_METRICS_HISTORY.oldestRecordedSampleIndex + offset) % PERFORMANCE_HISTORY_SIZE;
+		performance_metrics_t recorded = PERFORMANCE_METRICS_HISTORY.recordedSamples[recordIndex];
+		if(recorded.frameTime < EPSILON) continue;
+
+		int barHeight = Max(1, (int)(recorded.internalResolutionScale * innerHeight));
+		int lineX = panelRect.left + x;
+		int lineStartY = panelRect.bottom - 1;
+		int lineEndY = panelRect.bottom - barHeight;
+		DebugDrawClipPointToRectangle(lineX, lineEndY, panelRect);
+		DebugDrawVerticalLine(displayDeviceContext, lineX, lineStartY, lineX, lineEndY, RGB_COLOR_PURPLE);
+	}
+}
+
 inline gdi_color_t ProgressBarGetDeficitColor(int percent) {
 	if(percent < 50) return RGB_COLOR_GREEN;
 	if(percent < 75) return RGB_COLOR_YELLOW;
@@ -494,7 +568,22 @@ INTERNAL inline void DrawProgressBar(HDC& displayDeviceContext, progress_bar_t&
 	DrawProgressBarWithColors(displayDeviceContext, bar, foregroundColor);
 }
 
-INTERNAL void DebugDrawMemoryArenaHeatmap(HDC& displayDeviceContext, memory_arena_t& arena, int startX, int startY, int width, int height) {
+INTERNAL inline gdi_color_t ArenaBlockStateToColor(arena_block_state_t state) {
+	switch(state) {
+		case BLOCK_USED_RESIDENT:
+			return USED_MEMORY_BLOCK_COLOR;
+		case BLOCK_USED_NOT_RESIDENT:
+			return PAGED_OUT_MEMORY_BLOCK_COLOR;
+		case BLOCK_COMMITTED_RESIDENT:
+			return RESIDENT_MEMORY_BLOCK_COLOR;
+		case BLOCK_COMMITTED:
+			return COMMITTED_MEMORY_BLOCK_COLOR;
+		default:
+			return RESERVED_MEMORY_BLOCK_COLOR;
+	}
+}
+
+INTERNAL void DebugDrawMemoryArenaHeatmap(HDC& displayDeviceContext, memory_arena_t& arena, arena_residency_map_t& residency, int startX, int startY, int width, int height) {
 	LONG lineY = startY + DEBUG_OVERLAY_PADDING_SIZE;
 
 	RECT borderRect = { startX, startY, startX + width, startY + height };
@@ -503,25 +592,30 @@ INTERNAL void DebugDrawMemoryArenaHeatmap(HDC& displayDeviceContext, memory_aren
 	RECT panelRect = { borderRect.left + UI_BORDER_WIDTH, borderRect.top + UI_BORDER_WIDTH, borderRect.right - UI_BORDER_WIDTH, borderRect.bottom - UI_BORDER_WIDTH };
 	DebugDrawSolidColorRectangle(displayDeviceContext, panelRect, UI_PANEL_COLOR);
 
-	constexpr size_t FORMAT_BUFFER_SIZE = 256;
-	char formatBuffer[FORMAT_BUFFER_SIZE];
-
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Name: %s", arena.displayName.buffer);
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	string_builder_t line = StringBuilderCreate(DEBUG_OVERLAY_TEXT_MEMORY, DEBUG_OVERLAY_LINE_CAPACITY);
+	StringBuilderAppendLiteral(line, "Name: ");
+	StringBuilderAppendString(line, arena.displayName);
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	String lifetime = ArenaLifetimeToString(arena);
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Lifetime: %s", lifetime.buffer);
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Lifetime: ");
+	StringBuilderAppendString(line, lifetime);
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	String usage = ArenaUsageToString(arena);
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Usage: %s", usage.buffer);
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Usage: ");
+	StringBuilderAppendString(line, usage);
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Base: 0x%p", arena.baseAddress);
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Base: 0x");
+	StringBuilderAppendHex(line, (uint64)arena.baseAddress, 2 * PLATFORM_POINTER_SIZE);
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
@@ -529,10 +623,15 @@ INTERNAL void DebugDrawMemoryArenaHeatmap(HDC& displayDeviceContext, memory_aren
 	double committed = (double)arena.committedSize / Megabytes(1);
 	double reserved = (double)arena.reservedSize / Megabytes(1);
 	percentage committedPercent = DoubleToFloat(committed / Max(reserved, EPSILON));
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Committed: %d MB / %d MB (%d%%)",
-		(int)(committed),
-		(int)(reserved), Percent(committedPercent));
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Committed: ");
+	StringBuilderAppendSigned(line, (int)(committed));
+	StringBuilderAppendLiteral(line, " MB / ");
+	StringBuilderAppendSigned(line, (int)(reserved));
+	StringBuilderAppendLiteral(line, " MB (");
+	StringBuilderAppendSigned(line, Percent(committedPercent));
+	StringBuilderAppendLiteral(line, "%)");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	progress_bar_t progressBar = { .x = startX + DEBUG_OVERLAY_PADDING_SIZE, .y = lineY, .width = PROGRESS_BAR_WIDTH, .height = PROGRESS_BAR_HEIGHT, .percent = Percent(committedPercent) };
@@ -541,18 +640,36 @@ INTERNAL void DebugDrawMemoryArenaHeatmap(HDC& displayDeviceContext, memory_aren
 
 	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
 	percentage usedPercent = DoubleToFloat((double)(arena.used) / Max(arena.committedSize, EPSILON));
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Allocated: %d MB / %d MB (%d%%)",
-		(int)(arena.used / Megabytes(1)),
-		(int)(arena.committedSize / Megabytes(1)), Percent(usedPercent));
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Allocated: ");
+	StringBuilderAppendSigned(line, (int)(arena.used / Megabytes(1)));
+	StringBuilderAppendLiteral(line, " MB / ");
+	StringBuilderAppendSigned(line, (int)(arena.committedSize / Megabytes(1)));
+	StringBuilderAppendLiteral(line, " MB (");
+	StringBuilderAppendSigned(line, Percent(usedPercent));
+	StringBuilderAppendLiteral(line, "%)");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	progressBar = { .x = startX + DEBUG_OVERLAY_PADDING_SIZE, .y = lineY, .width = PROGRESS_BAR_WIDTH, .height = PROGRESS_BAR_HEIGHT, .percent = Percent(usedPercent) };
 	DrawProgressBar(displayDeviceContext, progressBar);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
-	const size_t blockSize = CPU_PERFORMANCE_INFO.allocationGranularity;
-	size_t totalBlocks = arena.reservedSize / blockSize;
+	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
+	percentage residentPercent = DoubleToFloat((double)(residency.residentSize) / Max(arena.committedSize, EPSILON));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Resident: ");
+	StringBuilderAppendSigned(line, (int)(residency.residentSize / Megabytes(1)));
+	StringBuilderAppendLiteral(line, " MB / ");
+	StringBuilderAppendSigned(line, (int)(arena.committedSize / Megabytes(1)));
+	StringBuilderAppendLiteral(line, " MB (");
+	StringBuilderAppendSigned(line, Percent(residentPercent));
+	StringBuilderAppendLiteral(line, "%)");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
+	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
+
+	const size_t blockSize = residency.blockSize;
+	size_t totalBlocks = residency.blockCount;
 	size_t usedBlocks = arena.used / blockSize;
 	size_t committedBlocks = arena.committedSize / blockSize;
 
@@ -563,12 +680,31 @@ INTERNAL void DebugDrawMemoryArenaHeatmap(HDC& displayDeviceContext, memory_aren
 	int avgAllocationSize = 0;
 	int totalAllocationSize = 0;
 	int avgAllocationsPerSecond = 0;
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Allocations: %d - %d - %d - %d - %d", arena.allocationCount, totalAllocationCount, totalAllocationSize, avgAllocationSize, avgAllocationsPerSecond);
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Allocations: ");
+	StringBuilderAppendUnsigned(line, arena.allocationCount);
+	StringBuilderAppendLiteral(line, " - ");
+	StringBuilderAppendSigned(line, totalAllocationCount);
+	StringBuilderAppendLiteral(line, " - ");
+	StringBuilderAppendSigned(line, totalAllocationSize);
+	StringBuilderAppendLiteral(line, " - ");
+	StringBuilderAppendSigned(line, avgAllocationSize);
+	StringBuilderAppendLiteral(line, " - ");
+	StringBuilderAppendSigned(line, avgAllocationsPerSecond);
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Blocks: %d / %d / %d (%d KB each)", usedBlocks, committedBlocks, totalBlocks, blockSize / Kilobytes(1));
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Blocks: ");
+	StringBuilderAppendUnsigned(line, usedBlocks);
+	StringBuilderAppendLiteral(line, " / ");
+	StringBuilderAppendUnsigned(line, committedBlocks);
+	StringBuilderAppendLiteral(line, " / ");
+	StringBuilderAppendUnsigned(line, totalBlocks);
+	StringBuilderAppendLiteral(line, " (");
+	StringBuilderAppendSigned(line, blockSize / Kilobytes(1));
+	StringBuilderAppendLiteral(line, " KB each)");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	LONG ARENA_BLOCK_GAP = 1;
@@ -584,33 +720,39 @@ INTERNAL void DebugDrawMemoryArenaHeatmap(HDC& displayDeviceContext, memory_aren
 	//-------------------------------------------------
 	// Blocks
 	//-------------------------------------------------
-	for(LONG blockID = 0; blockID < totalBlocks; ++blockID) {
-		gdi_color_t color;
-		if(blockID < usedBlocks) {
-			color = USED_MEMORY_BLOCK_COLOR;
-		} else if(blockID < committedBlocks) {
-			color = COMMITTED_MEMORY_BLOCK_COLOR;
-		} else {
-			color = RESERVED_MEMORY_BLOCK_COLOR;
+	// NOTE: Adjacent blocks sharing the same state are drawn as a single span (which also fills the gaps between them)
+	for(size_t rowID = 0; rowID * blocksPerRow < totalBlocks; ++rowID) {
+		LONG rowTop = arenaStartY + (LONG)rowID * (ARENA_BLOCK_HEIGHT + ARENA_BLOCK_GAP);
+		LONG rowBottom = rowTop + ARENA_BLOCK_HEIGHT;
+		// For simplicity, just cut off any rows that don't actually fit the container
+		bool rowWillFitEntirely = (rowBottom + DEBUG_OVERLAY_PADDING_SIZE < startY + height);
+		if(!rowWillFitEntirely) break;
+
+		size_t firstBlockInRow = rowID * blocksPerRow;
+		size_t lastBlockInRow = Min(firstBlockInRow + blocksPerRow, totalBlocks);
+		size_t spanStart = firstBlockInRow;
+		while(spanStart < lastBlockInRow) {
+			arena_block_state_t state = ArenaResidencyMapGetBlockState(residency, arena, spanStart);
+			size_t spanEnd = spanStart + 1;
+			while(spanEnd < lastBlockInRow && ArenaResidencyMapGetBlockState(residency, arena, spanEnd) == state)
+				spanEnd++;
+
+			LONG firstColumn = (LONG)(spanStart - firstBlockInRow);
+			LONG lastColumn = (LONG)(spanEnd - firstBlockInRow - 1);
+			RECT span = {
+				arenaStartX + firstColumn * (ARENA_BLOCK_WIDTH + ARENA_BLOCK_GAP),
+				rowTop,
+				arenaStartX + lastColumn * (ARENA_BLOCK_WIDTH + ARENA_BLOCK_GAP) + ARENA_BLOCK_WIDTH,
+				rowBottom
+			};
+			DebugDrawSolidColorRectangle(displayDeviceContext, span, ArenaBlockStateToColor(state));
+			spanStart = spanEnd;
 		}
-
-		RECT block = {
-			arenaStartX + (blockID % blocksPerRow) * (ARENA_BLOCK_WIDTH + ARENA_BLOCK_GAP),
-			arenaStartY + (blockID / blocksPerRow) * (ARENA_BLOCK_HEIGHT + ARENA_BLOCK_GAP),
-			arenaStartX + (blockID % blocksPerRow) * (ARENA_BLOCK_WIDTH + ARENA_BLOCK_GAP) + ARENA_BLOCK_WIDTH,
-			arenaStartY + (blockID / blocksPerRow) * (ARENA_BLOCK_HEIGHT + ARENA_BLOCK_GAP) + ARENA_BLOCK_HEIGHT
-		};
-		// For simplicity, just cut off any boxes that don't actually fit the container
-		bool boxWillFitEntirely = (block.bottom + DEBUG_OVERLAY_PADDING_SIZE < startY + height);
-		if(boxWillFitEntirely) DebugDrawSolidColorRectangle(displayDeviceContext, block, color);
 	}
 }
 
 INTERNAL void DebugDrawMemoryUsageOverlay(HDC& displayDeviceContext) {
-	SetBkMode(displayDeviceContext, TRANSPARENT);
-	HFONT font = (HFONT)GetStockObject(ANSI_VAR_FONT);
-	HFONT oldFont = (HFONT)SelectObject(displayDeviceContext, font);
-
+	PROFILE_FUNCTION();
 	int startX = 0 + DEBUG_OVERLAY_MARGIN_SIZE;
 	int startY = 300;
 	RECT backgroundPanelRect = {
@@ -621,16 +763,20 @@ INTERNAL void DebugDrawMemoryUsageOverlay(HDC& displayDeviceContext) {
 	};
 	DebugDrawSolidColorRectangle(displayDeviceContext, backgroundPanelRect, UI_PANEL_COLOR);
 
-	SetTextColor(displayDeviceContext, ColorRef(UI_TEXT_COLOR));
 	LONG lineY = startY + DEBUG_OVERLAY_PADDING_SIZE;
 
 	//-------------------------------------------------
 	// Arena stats
 	//-------------------------------------------------
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY,
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY,
 		"=== MEMORY ARENAS ===", lstrlenA("=== MEMORY ARENAS ==="));
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
+	size_t allocationGranularity = CPU_PERFORMANCE_INFO.allocationGranularity;
+	size_t pageSize = CPU_PERFORMANCE_INFO.pageSize;
+	SystemMemorySampleResidency(MAIN_MEMORY_RESIDENCY, MAIN_MEMORY, allocationGranularity, pageSize, RESIDENCY_SAMPLED_BLOCKS_PER_FRAME);
+	SystemMemorySampleResidency(TRANSIENT_MEMORY_RESIDENCY, TRANSIENT_MEMORY, allocationGranularity, pageSize, RESIDENCY_SAMPLED_BLOCKS_PER_FRAME);
+
 	int headerHeight = lineY - startY;
 	int availableHeight = MEMORY_OVERLAY_HEIGHT - headerHeight - DEBUG_OVERLAY_MARGIN_SIZE;
 	constexpr int MAIN_MEMORY_PANELS = 1;
@@ -643,23 +789,18 @@ INTERNAL void DebugDrawMemoryUsageOverlay(HDC& displayDeviceContext) {
 	startX += DEBUG_OVERLAY_PADDING_SIZE;
 
 	heatmapWidth = MAIN_MEMORY_PANELS * heatmapWidth + (MAIN_MEMORY_PANELS - 1) * DEBUG_OVERLAY_MARGIN_SIZE;
-	DebugDrawMemoryArenaHeatmap(displayDeviceContext, MAIN_MEMORY, startX, lineY, heatmapWidth, heatmapHeight);
+	DebugDrawMemoryArenaHeatmap(displayDeviceContext, MAIN_MEMORY, MAIN_MEMORY_RESIDENCY, startX, lineY, heatmapWidth, heatmapHeight);
 	startX += heatmapWidth;
 	startX += DEBUG_OVERLAY_MARGIN_SIZE;
 
 	heatmapWidth = TRANSIENT_MEMORY_PANELS * heatmapWidth + (TRANSIENT_MEMORY_PANELS - 1) * DEBUG_OVERLAY_MARGIN_SIZE;
-	DebugDrawMemoryArenaHeatmap(displayDeviceContext, TRANSIENT_MEMORY, startX, lineY, heatmapWidth, heatmapHeight);
+	DebugDrawMemoryArenaHeatmap(displayDeviceContext, TRANSIENT_MEMORY, TRANSIENT_MEMORY_RESIDENCY, startX, lineY, heatmapWidth, heatmapHeight);
 	startX += heatmapWidth;
 	startX += DEBUG_OVERLAY_PADDING_SIZE;
-
-	SelectObject(displayDeviceContext, oldFont);
 }
 
 INTERNAL void DebugDrawProcessorUsageOverlay(HDC& displayDeviceContext) {
-	SetBkMode(displayDeviceContext, TRANSPARENT);
-	HFONT font = (HFONT)GetStockObject(ANSI_VAR_FONT);
-	HFONT oldFont = (HFONT)SelectObject(displayDeviceContext, font);
-
+	PROFILE_FUNCTION();
 	int startX = DISPLAY_SCREEN_WIDTH - PERFORMANCE_OVERLAY_WIDTH - DEBUG_OVERLAY_MARGIN_SIZE;
 	int startY = DEBUG_OVERLAY_MARGIN_SIZE;
 	RECT panelRect = {
@@ -670,23 +811,28 @@ INTERNAL void DebugDrawProcessorUsageOverlay(HDC& displayDeviceContext) {
 	};
 	DebugDrawSolidColorRectangle(displayDeviceContext, panelRect, UI_PANEL_COLOR);
 
-	SetTextColor(displayDeviceContext, ColorRef(UI_TEXT_COLOR));
 
-	constexpr size_t FORMAT_BUFFER_SIZE = 256;
-	char formatBuffer[FORMAT_BUFFER_SIZE];
-	char uptimeBuffer[FORMAT_BUFFER_SIZE];
+	string_builder_t line = StringBuilderCreate(DEBUG_OVERLAY_TEXT_MEMORY, DEBUG_OVERLAY_LINE_CAPACITY);
+	constexpr size_t UPTIME_BUFFER_SIZE = 64;
+	char uptimeBuffer[UPTIME_BUFFER_SIZE];
 	int lineY = startY + DEBUG_OVERLAY_PADDING_SIZE;
-	StrFromTimeIntervalA(uptimeBuffer, FORMAT_BUFFER_SIZE, (DWORD)CPU_PERFORMANCE_METRICS.applicationUptime, FOUR_DIGITS);
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Uptime:%s", uptimeBuffer);
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StrFromTimeIntervalA(uptimeBuffer, UPTIME_BUFFER_SIZE, (DWORD)CPU_PERFORMANCE_METRICS.applicationUptime, FOUR_DIGITS);
+	StringBuilderAppendLiteral(line, "Uptime:");
+	StringBuilderAppendCString(line, uptimeBuffer);
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Startup Time: %.0f ms", CPU_PERFORMANCE_INFO.applicationLaunchTime);
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Startup Time: ");
+	StringBuilderAppendDouble(line, CPU_PERFORMANCE_INFO.applicationLaunchTime, ZERO_DIGITS);
+	StringBuilderAppendLiteral(line, " ms");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "GDI Objects: %d", GetGuiResources(GetCurrentProcess(), GR_GDIOBJECTS));
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "GDI Objects: ");
+	StringBuilderAppendSigned(line, GetGuiResources(GetCurrentProcess(), GR_GDIOBJECTS));
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	//-------------------------------------------------
@@ -694,15 +840,18 @@ INTERNAL void DebugDrawProcessorUsageOverlay(HDC& displayDeviceContext) {
 	//-------------------------------------------------
 	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
 	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY,
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY,
 		"=== CPU UTILIZATION ===", lstrlenA("=== CPU UTILIZATION ==="));
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	percentage processorUsageAllCores = GetProcessorUsageAllCores();
 	percentage processorUsageSingleCore = processorUsageAllCores * CPU_PERFORMANCE_INFO.numberOfProcessors;
 	int cpuUsage = Percent(processorUsageSingleCore);
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Main Thread (Single Core): %d%%", cpuUsage);
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Main Thread (Single Core): ");
+	StringBuilderAppendSigned(line, cpuUsage);
+	StringBuilderAppendCharacter(line, '%');
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	progress_bar_t progressBar = { .x = startX + DEBUG_OVERLAY_PADDING_SIZE, .y = lineY, .width = PROGRESS_BAR_WIDTH, .height = PROGRESS_BAR_HEIGHT, .percent = cpuUsage };
@@ -711,8 +860,11 @@ INTERNAL void DebugDrawProcessorUsageOverlay(HDC& displayDeviceContext) {
 
 	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
 	cpuUsage = Percent(processorUsageAllCores);
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Process (All Cores): %d%%", cpuUsage);
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Process (All Cores): ");
+	StringBuilderAppendSigned(line, cpuUsage);
+	StringBuilderAppendCharacter(line, '%');
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	progressBar.y = lineY;
@@ -725,18 +877,70 @@ INTERNAL void DebugDrawProcessorUsageOverlay(HDC& displayDeviceContext) {
 	//-------------------------------------------------
 	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
 	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY,
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY,
 		"=== FRAME STATS ===", lstrlenA("=== FRAME STATS ==="));
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
-	char timeBuffer[32];
 
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Frame Time: %.0f ms", CPU_PERFORMANCE_METRICS.frameTime);
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Frame Time: ");
+	StringBuilderAppendDouble(line, CPU_PERFORMANCE_METRICS.frameTime, ZERO_DIGITS);
+	StringBuilderAppendLiteral(line, " ms");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Highest Recorded Inter-Frame Delay: %.0f ms", PERFORMANCE_METRICS_HISTORY.highestObservedFrameTime);
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Highest Recorded Inter-Frame Delay: ");
+	StringBuilderAppendDouble(line, PERFORMANCE_METRICS_HISTORY.highestObservedFrameTime, ZERO_DIGITS);
+	StringBuilderAppendLiteral(line, " ms");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
+	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
+
+	milliseconds framePercentiles[REPORTED_PERCENTILE_COUNT];
+	PerformanceMetricsGetRecentPercentiles(PERFORMANCE_METRICS_HISTORY, METRIC_FRAME_TIME, framePercentiles);
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Last ");
+	StringBuilderAppendSigned(line, HISTOGRAM_WINDOW_SLICE_COUNT);
+	StringBuilderAppendLiteral(line, " sec: ");
+	StringBuilderAppendDouble(line, framePercentiles[0], ONE_DIGIT);
+	StringBuilderAppendLiteral(line, " / ");
+	StringBuilderAppendDouble(line, framePercentiles[1], ONE_DIGIT);
+	StringBuilderAppendLiteral(line, " / ");
+	StringBuilderAppendDouble(line, framePercentiles[2], ONE_DIGIT);
+	StringBuilderAppendLiteral(line, " / ");
+	StringBuilderAppendDouble(line, framePercentiles[3], ONE_DIGIT);
+	StringBuilderAppendLiteral(line, " ms");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
+	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
+
+	PerformanceMetricsGetRunPercentiles(PERFORMANCE_METRICS_HISTORY, METRIC_FRAME_TIME, framePercentiles);
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Entire Run: ");
+	StringBuilderAppendDouble(line, framePercentiles[0], ONE_DIGIT);
+	StringBuilderAppendLiteral(line, " / ");
+	StringBuilderAppendDouble(line, framePercentiles[1], ONE_DIGIT);
+	StringBuilderAppendLiteral(line, " / ");
+	StringBuilderAppendDouble(line, framePercentiles[2], ONE_DIGIT);
+	StringBuilderAppendLiteral(line, " / ");
+	StringBuilderAppendDouble(line, framePercentiles[3], ONE_DIGIT);
+	StringBuilderAppendLiteral(line, " ms");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
+	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
+
+	// NOTE: Frames are paced to the budget, so only those that overshoot it by a noticeable margin count as stutters
+	constexpr percentage STUTTER_THRESHOLD = 1.5f;
+	latency_histogram_t& runFrameTimes = PERFORMANCE_METRICS_HISTORY.runHistograms[METRIC_FRAME_TIME];
+	uint64 stutterCount = HistogramCountValuesAbove(runFrameTimes, STUTTER_THRESHOLD * MAX_FRAME_TIME);
+	percentage stutterRatio = (percentage)stutterCount / (percentage)Max(runFrameTimes.totalCount, 1);
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Stutters: ");
+	StringBuilderAppendUnsigned(line, stutterCount);
+	StringBuilderAppendLiteral(line, " frames (");
+	StringBuilderAppendDouble(line, stutterRatio * 100.0f, TWO_DIGITS);
+	StringBuilderAppendLiteral(line, "%) above ");
+	StringBuilderAppendDouble(line, STUTTER_THRESHOLD * MAX_FRAME_TIME, ZERO_DIGITS);
+	StringBuilderAppendLiteral(line, " ms");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	int historyGraphHeight = DEBUG_OVERLAY_LINE_HEIGHT * 3;
@@ -746,21 +950,24 @@ INTERNAL void DebugDrawProcessorUsageOverlay(HDC& displayDeviceContext) {
 	lineY += historyGraphHeight + DEBUG_OVERLAY_MARGIN_SIZE;
 
 	FPS frameRate = MILLISECONDS_PER_SECOND / CPU_PERFORMANCE_METRICS.frameTime;
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Uncapped Frame Rate: %.0f FPS (Target: %.0f FPS)", frameRate, TARGET_FRAME_RATE);
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Uncapped Frame Rate: ");
+	StringBuilderAppendDouble(line, frameRate, ZERO_DIGITS);
+	StringBuilderAppendLiteral(line, " FPS (Target: ");
+	StringBuilderAppendDouble(line, TARGET_FRAME_RATE, ZERO_DIGITS);
+	StringBuilderAppendLiteral(line, " FPS)");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
 	percentage frameBudgetUtilization = CPU_PERFORMANCE_METRICS.frameTime / MAX_FRAME_TIME;
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Frame Budget: ");
-	DoubleToString(timeBuffer, MAX_FRAME_TIME, ZERO_DIGITS);
-	StringCchCatA(formatBuffer, FORMAT_BUFFER_SIZE, timeBuffer);
-	StringCchCatA(formatBuffer, FORMAT_BUFFER_SIZE, " ms");
-	StringCchCatA(formatBuffer, FORMAT_BUFFER_SIZE, " (Used: ");
-	DoubleToString(timeBuffer, Percent(frameBudgetUtilization), ZERO_DIGITS);
-	StringCchCatA(formatBuffer, FORMAT_BUFFER_SIZE, timeBuffer);
-	StringCchCatA(formatBuffer, FORMAT_BUFFER_SIZE, "%)");
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Frame Budget: ");
+	StringBuilderAppendDouble(line, MAX_FRAME_TIME, ZERO_DIGITS);
+	StringBuilderAppendLiteral(line, " ms (Used: ");
+	StringBuilderAppendSigned(line, Percent(frameBudgetUtilization));
+	StringBuilderAppendLiteral(line, "%)");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	progressBar.y = lineY;
@@ -771,41 +978,84 @@ INTERNAL void DebugDrawProcessorUsageOverlay(HDC& displayDeviceContext) {
 	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
 
 	percentage percent = CPU_PERFORMANCE_METRICS.messageProcessingTime / CPU_PERFORMANCE_METRICS.frameTime;
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Message Processing: %.0f ms (%d%%)", CPU_PERFORMANCE_METRICS.messageProcessingTime, Percent(percent));
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Message Processing: ");
+	StringBuilderAppendDouble(line, CPU_PERFORMANCE_METRICS.messageProcessingTime, ZERO_DIGITS);
+	StringBuilderAppendLiteral(line, " ms (");
+	StringBuilderAppendSigned(line, Percent(percent));
+	StringBuilderAppendLiteral(line, "%)");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	percent = CPU_PERFORMANCE_METRICS.userInterfaceRenderTime / CPU_PERFORMANCE_METRICS.frameTime;
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "User Interface: %.0f ms (%d%%)", CPU_PERFORMANCE_METRICS.userInterfaceRenderTime,
-		Percent(percent));
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "User Interface: ");
+	StringBuilderAppendDouble(line, CPU_PERFORMANCE_METRICS.userInterfaceRenderTime, ZERO_DIGITS);
+	StringBuilderAppendLiteral(line, " ms (");
+	StringBuilderAppendSigned(line, Percent(percent));
+	StringBuilderAppendLiteral(line, "%)");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	percent = CPU_PERFORMANCE_METRICS.surfaceBlitTime / CPU_PERFORMANCE_METRICS.frameTime;
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Surface Blit: %.0f ms (%d%%)", CPU_PERFORMANCE_METRICS.surfaceBlitTime,
-		Percent(percent));
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Surface Blit: ");
+	StringBuilderAppendDouble(line, CPU_PERFORMANCE_METRICS.surfaceBlitTime, ZERO_DIGITS);
+	StringBuilderAppendLiteral(line, " ms (");
+	StringBuilderAppendSigned(line, Percent(percent));
+	StringBuilderAppendLiteral(line, "%, ");
+	StringBuilderAppendSigned(line, Percent(CPU_PERFORMANCE_METRICS.surfaceDirtyRatio));
+	StringBuilderAppendLiteral(line, "% dirty)");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	percent = CPU_PERFORMANCE_METRICS.simulationStepTime / CPU_PERFORMANCE_METRICS.frameTime;
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Simulation Step: %.0f ms (%d%%)", CPU_PERFORMANCE_METRICS.simulationStepTime,
-		Percent(percent));
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Simulation Step: ");
+	StringBuilderAppendDouble(line, CPU_PERFORMANCE_METRICS.simulationStepTime, ZERO_DIGITS);
+	StringBuilderAppendLiteral(line, " ms (");
+	StringBuilderAppendSigned(line, Percent(percent));
+	StringBuilderAppendLiteral(line, "%)");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Sleep: ");
-	DoubleToString(timeBuffer, CPU_PERFORMANCE_METRICS.sleepTime, ZERO_DIGITS);
-	StringCchCatA(formatBuffer, FORMAT_BUFFER_SIZE, timeBuffer);
-	StringCchCatA(formatBuffer, FORMAT_BUFFER_SIZE, " ms (Suspended: ");
-	DoubleToString(timeBuffer, CPU_PERFORMANCE_METRICS.suspendedTime, ZERO_DIGITS);
-	StringCchCatA(formatBuffer, FORMAT_BUFFER_SIZE, timeBuffer);
-	StringCchCatA(formatBuffer, FORMAT_BUFFER_SIZE, " ms)");
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Upscaling: ");
+	StringBuilderAppendDouble(line, CPU_PERFORMANCE_METRICS.upscalingTime, ZERO_DIGITS);
+	StringBuilderAppendLiteral(line, " ms (");
+	StringBuilderAppendSigned(line, INTERNAL_RENDER_TARGET.width);
+	StringBuilderAppendCharacter(line, 'x');
+	StringBuilderAppendSigned(line, INTERNAL_RENDER_TARGET.height);
+	StringBuilderAppendLiteral(line, ", ");
+	StringBuilderAppendCString(line, UpscalingModeToString(SELECTED_UPSCALING_MODE));
+	if(APPLICATION_USES_ADAPTIVE_RESOLUTION) StringBuilderAppendLiteral(line, ", Adaptive");
+	StringBuilderAppendCharacter(line, ')');
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
+	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
+
+	int scaleGraphHeight = DEBUG_OVERLAY_LINE_HEIGHT;
+	DebugDrawResolutionScaleHistory(displayDeviceContext,
+		startX + DEBUG_OVERLAY_PADDING_SIZE, lineY,
+		PROGRESS_BAR_WIDTH, scaleGraphHeight);
+	lineY += scaleGraphHeight + DEBUG_OVERLAY_MARGIN_SIZE;
+
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Sleep: ");
+	StringBuilderAppendDouble(line, CPU_PERFORMANCE_METRICS.sleepTime, ZERO_DIGITS);
+	StringBuilderAppendLiteral(line, " ms (Suspended: ");
+	StringBuilderAppendDouble(line, CPU_PERFORMANCE_METRICS.suspendedTime, ZERO_DIGITS);
+	StringBuilderAppendLiteral(line, " ms)");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "History (%d samples over %d sec):", PERFORMANCE_HISTORY_SIZE, PERFORMANCE_HISTORY_SECONDS);
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "History (");
+	StringBuilderAppendSigned(line, PERFORMANCE_HISTORY_SIZE);
+	StringBuilderAppendLiteral(line, " samples over ");
+	StringBuilderAppendSigned(line, PERFORMANCE_HISTORY_SECONDS);
+	StringBuilderAppendLiteral(line, " sec):");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	int breakdownGraphHeight = DEBUG_OVERLAY_LINE_HEIGHT * 3;
@@ -814,12 +1064,88 @@ INTERNAL void DebugDrawProcessorUsageOverlay(HDC& displayDeviceContext) {
 		PROGRESS_BAR_WIDTH, breakdownGraphHeight, AREA_PERCENT_STACKED);
 	lineY += breakdownGraphHeight + DEBUG_OVERLAY_MARGIN_SIZE;
 
+	//-------------------------------------------------
+	// Profiler zones
+	//-------------------------------------------------
+	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "=== PROFILER ZONES (");
+	StringBuilderAppendSigned(line, PROFILER_LAST_FRAME.droppedZoneCount);
+	StringBuilderAppendLiteral(line, " dropped) ===");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
+	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
+
+	// NOTE: Nodes are stored in the order they were first entered, so this is already a depth-first traversal
+	constexpr int MAX_DISPLAYED_PROFILER_ZONES = 8;
+	constexpr int PROFILER_ZONE_INDENTATION = 2;
+	int displayedZoneCount = Min(PROFILER_LAST_FRAME.nodeCount, MAX_DISPLAYED_PROFILER_ZONES);
+	for(int nodeIndex = 0; nodeIndex < displayedZoneCount; ++nodeIndex) {
+		profiler_frame_node_t& node = PROFILER_LAST_FRAME.nodes[nodeIndex];
+		milliseconds zoneTime = (milliseconds)node.totalTicks * MILLISECONDS_PER_SECOND / MONOTONIC_CLOCK_SPEED;
+		StringBuilderReset(line);
+		StringBuilderAppendRepeatedCharacter(line, ' ', node.depth * PROFILER_ZONE_INDENTATION);
+		StringBuilderAppendCString(line, node.name);
+		StringBuilderAppendLiteral(line, ": ");
+		StringBuilderAppendDouble(line, zoneTime, TWO_DIGITS);
+		StringBuilderAppendLiteral(line, " ms (");
+		StringBuilderAppendUnsigned(line, node.callCount);
+		StringBuilderAppendLiteral(line, "x)");
+		DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
+		lineY += DEBUG_OVERLAY_LINE_HEIGHT;
+	}
+	lineY += (MAX_DISPLAYED_PROFILER_ZONES - displayedZoneCount) * DEBUG_OVERLAY_LINE_HEIGHT;
+
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY,
+		"=== HARDWARE COUNTERS ===", lstrlenA("=== HARDWARE COUNTERS ==="));
+	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
+
+	if(HARDWARE_COUNTERS.availableCounterMask == 0) {
+		StringBuilderReset(line);
+		StringBuilderAppendLiteral(line, "N/A (missing permissions or unsupported platform)");
+		DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
+	} else if(!HardwareCounterIsAvailable(HARDWARE_COUNTERS, HARDWARE_COUNTER_INSTRUCTIONS)) {
+		// NOTE: Without instructions, the cycle counts are all there is to show (misses are reported per 1k instructions)
+		hardware_counter_values_t* phaseCounters = CPU_PERFORMANCE_METRICS.phaseCounters;
+		StringBuilderReset(line);
+		StringBuilderAppendLiteral(line, "Mcycles: ");
+		StringBuilderAppendDouble(line, phaseCounters[FRAME_PHASE_MESSAGE_PROCESSING].values[HARDWARE_COUNTER_CYCLES] / 1e6, TWO_DIGITS);
+		StringBuilderAppendLiteral(line, " / ");
+		StringBuilderAppendDouble(line, phaseCounters[FRAME_PHASE_SIMULATION_STEP].values[HARDWARE_COUNTER_CYCLES] / 1e6, TWO_DIGITS);
+		StringBuilderAppendLiteral(line, " / ");
+		StringBuilderAppendDouble(line, phaseCounters[FRAME_PHASE_USER_INTERFACE_RENDER].values[HARDWARE_COUNTER_CYCLES] / 1e6, TWO_DIGITS);
+		StringBuilderAppendLiteral(line, " / ");
+		StringBuilderAppendDouble(line, phaseCounters[FRAME_PHASE_SURFACE_BLIT].values[HARDWARE_COUNTER_CYCLES] / 1e6, TWO_DIGITS);
+		StringBuilderAppendLiteral(line, " (no other counters)");
+		DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
+	}
+	if(HardwareCounterIsAvailable(HARDWARE_COUNTERS, HARDWARE_COUNTER_INSTRUCTIONS)) {
+		for(int phase = 0; phase < FRAME_PHASE_COUNT; ++phase) {
+			hardware_counter_values_t& counters = CPU_PERFORMANCE_METRICS.phaseCounters[phase];
+			StringBuilderReset(line);
+			StringBuilderAppendCString(line, FRAME_PHASE_NAMES[phase]);
+			StringBuilderAppendLiteral(line, ": IPC ");
+			StringBuilderAppendDouble(line, HardwareCountersGetInstructionsPerCycle(counters), TWO_DIGITS);
+			StringBuilderAppendLiteral(line, ", MPKI L1D ");
+			StringBuilderAppendDouble(line, HardwareCountersGetMissesPerKiloInstruction(counters, HARDWARE_COUNTER_L1D_MISSES), ONE_DIGIT);
+			StringBuilderAppendLiteral(line, " LLC ");
+			StringBuilderAppendDouble(line, HardwareCountersGetMissesPerKiloInstruction(counters, HARDWARE_COUNTER_LLC_MISSES), TWO_DIGITS);
+			StringBuilderAppendLiteral(line, " BR ");
+			StringBuilderAppendDouble(line, HardwareCountersGetMissesPerKiloInstruction(counters, HARDWARE_COUNTER_BRANCH_MISSES), TWO_DIGITS);
+			StringBuilderAppendLiteral(line, " TLB ");
+			StringBuilderAppendDouble(line, HardwareCountersGetMissesPerKiloInstruction(counters, HARDWARE_COUNTER_DTLB_MISSES), TWO_DIGITS);
+			DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
+			lineY += DEBUG_OVERLAY_LINE_HEIGHT;
+		}
+	} else {
+		lineY += FRAME_PHASE_COUNT * DEBUG_OVERLAY_LINE_HEIGHT;
+	}
+
 	//-------------------------------------------------
 	// System stats
 	//-------------------------------------------------
 	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
 	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY,
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY,
 		"=== SYSTEM MEMORY ===", lstrlenA("=== SYSTEM MEMORY ==="));
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
@@ -831,27 +1157,43 @@ INTERNAL void DebugDrawProcessorUsageOverlay(HDC& displayDeviceContext) {
 		DWORD err = GetLastError();
 		LPTSTR errStr = FormatErrorString(err);
 
-		StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "N/A: %lu (%s)", err, errStr);
-		TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+		StringBuilderReset(line);
+		StringBuilderAppendLiteral(line, "N/A: ");
+		StringBuilderAppendUnsigned(line, err);
+		StringBuilderAppendLiteral(line, " (");
+		StringBuilderAppendCString(line, errStr);
+		StringBuilderAppendCharacter(line, ')');
+		DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 		lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 	} else {
-		StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Total Physical Memory: %d MB (%.0f GB)",
-			(int)(memoryUsageInfo.ullTotalPhys / Megabytes(1)),
-			(double)memoryUsageInfo.ullTotalPhys / Gigabytes(1));
-		TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+		StringBuilderReset(line);
+		StringBuilderAppendLiteral(line, "Total Physical Memory: ");
+		StringBuilderAppendSigned(line, (int)(memoryUsageInfo.ullTotalPhys / Megabytes(1)));
+		StringBuilderAppendLiteral(line, " MB (");
+		StringBuilderAppendDouble(line, (double)memoryUsageInfo.ullTotalPhys / Gigabytes(1), ZERO_DIGITS);
+		StringBuilderAppendLiteral(line, " GB)");
+		DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 		lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
-		StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Available Physical Memory: %d MB (%.0f GB)", (int)(memoryUsageInfo.ullAvailPhys / Megabytes(1)), (double)memoryUsageInfo.ullAvailPhys / Gigabytes(1));
-		TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+		StringBuilderReset(line);
+		StringBuilderAppendLiteral(line, "Available Physical Memory: ");
+		StringBuilderAppendSigned(line, (int)(memoryUsageInfo.ullAvailPhys / Megabytes(1)));
+		StringBuilderAppendLiteral(line, " MB (");
+		StringBuilderAppendDouble(line, (double)memoryUsageInfo.ullAvailPhys / Gigabytes(1), ZERO_DIGITS);
+		StringBuilderAppendLiteral(line, " GB)");
+		DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 		lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 		lineY += DEBUG_OVERLAY_MARGIN_SIZE;
-		StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Physical Memory Load: %d MB / %d MB (%d%%)",
-			(int)((memoryUsageInfo.ullTotalPhys - memoryUsageInfo.ullAvailPhys) / Megabytes(1)),
-
-			(int)(memoryUsageInfo.ullTotalPhys / Megabytes(1)),
-			memoryUsageInfo.dwMemoryLoad);
-		TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+		StringBuilderReset(line);
+		StringBuilderAppendLiteral(line, "Physical Memory Load: ");
+		StringBuilderAppendSigned(line, (int)((memoryUsageInfo.ullTotalPhys - memoryUsageInfo.ullAvailPhys) / Megabytes(1)));
+		StringBuilderAppendLiteral(line, " MB / ");
+		StringBuilderAppendSigned(line, (int)(memoryUsageInfo.ullTotalPhys / Megabytes(1)));
+		StringBuilderAppendLiteral(line, " MB (");
+		StringBuilderAppendSigned(line, memoryUsageInfo.dwMemoryLoad);
+		StringBuilderAppendLiteral(line, "%)");
+		DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 		lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 		int sysUsage = memoryUsageInfo.dwMemoryLoad;
@@ -865,62 +1207,88 @@ INTERNAL void DebugDrawProcessorUsageOverlay(HDC& displayDeviceContext) {
 		//-------------------------------------------------
 		lineY += DEBUG_OVERLAY_MARGIN_SIZE;
 		lineY += DEBUG_OVERLAY_MARGIN_SIZE;
-		TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY,
+		DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY,
 			"=== PROCESS MEMORY	 ===", lstrlenA("=== PROCESS MEMORY ==="));
 		lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 		if(GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc, sizeof(pmc))) {
-			StringCbPrintfA(formatBuffer,
-				FORMAT_BUFFER_SIZE,
-				"Total Virtual Memory: %d MB (%.0f GB)",
-				(int)(memoryUsageInfo.ullTotalPageFile / Megabytes(1)),
-				(double)memoryUsageInfo.ullTotalPageFile / Gigabytes(1));
-			TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+			StringBuilderReset(line);
+			StringBuilderAppendLiteral(line, "Total Virtual Memory: ");
+			StringBuilderAppendSigned(line, (int)(memoryUsageInfo.ullTotalPageFile / Megabytes(1)));
+			StringBuilderAppendLiteral(line, " MB (");
+			StringBuilderAppendDouble(line, (double)memoryUsageInfo.ullTotalPageFile / Gigabytes(1), ZERO_DIGITS);
+			StringBuilderAppendLiteral(line, " GB)");
+			DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 			lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
-			StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Available Virtual Memory: %d MB (%.0f GB)",
-				(int)(memoryUsageInfo.ullAvailPageFile / Megabytes(1)),
-				(double)memoryUsageInfo.ullAvailPageFile / Gigabytes(1));
-			TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+			StringBuilderReset(line);
+			StringBuilderAppendLiteral(line, "Available Virtual Memory: ");
+			StringBuilderAppendSigned(line, (int)(memoryUsageInfo.ullAvailPageFile / Megabytes(1)));
+			StringBuilderAppendLiteral(line, " MB (");
+			StringBuilderAppendDouble(line, (double)memoryUsageInfo.ullAvailPageFile / Gigabytes(1), ZERO_DIGITS);
+			StringBuilderAppendLiteral(line, " GB)");
+			DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 			lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 			lineY += DEBUG_OVERLAY_MARGIN_SIZE;
 			uint64 virtualMemoryUsed = memoryUsageInfo.ullTotalPageFile - memoryUsageInfo.ullAvailPageFile;
 			percentage virtualMemoryUsage = DoubleToFloat((double)virtualMemoryUsed / memoryUsageInfo.ullTotalPageFile);
 			progressBar = { .x = startX + DEBUG_OVERLAY_PADDING_SIZE, .y = lineY, .width = PROGRESS_BAR_WIDTH, .height = PROGRESS_BAR_HEIGHT, .percent = Percent(virtualMemoryUsage) };
-			StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Virtual Memory Load: %d MB / %d MB (%d%%)",
-				(int)(virtualMemoryUsed / Megabytes(1)),
-				(int)(memoryUsageInfo.ullTotalPageFile / Megabytes(1)),
-				progressBar.percent);
+			StringBuilderReset(line);
+			StringBuilderAppendLiteral(line, "Virtual Memory Load: ");
+			StringBuilderAppendSigned(line, (int)(virtualMemoryUsed / Megabytes(1)));
+			StringBuilderAppendLiteral(line, " MB / ");
+			StringBuilderAppendSigned(line, (int)(memoryUsageInfo.ullTotalPageFile / Megabytes(1)));
+			StringBuilderAppendLiteral(line, " MB (");
+			StringBuilderAppendSigned(line, progressBar.percent);
+			StringBuilderAppendLiteral(line, "%)");
 
 			progressBar.y += DEBUG_OVERLAY_LINE_HEIGHT;
-			TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+			DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 			lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 			DrawProgressBar(displayDeviceContext, progressBar);
 			lineY += DEBUG_OVERLAY_MARGIN_SIZE;
 
 			lineY += DEBUG_OVERLAY_LINE_HEIGHT;
-			StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Private Set: %d MB", (int)(pmc.PrivateUsage / Megabytes(1)));
-			TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+			StringBuilderReset(line);
+			StringBuilderAppendLiteral(line, "Private Set: ");
+			StringBuilderAppendSigned(line, (int)(pmc.PrivateUsage / Megabytes(1)));
+			StringBuilderAppendLiteral(line, " MB");
+			DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 			lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
-			StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Working Set: %d MB (Peak: %d MB)", (int)(pmc.WorkingSetSize / Megabytes(1)), (int)(pmc.PeakWorkingSetSize / Megabytes(1)));
-			TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+			StringBuilderReset(line);
+			StringBuilderAppendLiteral(line, "Working Set: ");
+			StringBuilderAppendSigned(line, (int)(pmc.WorkingSetSize / Megabytes(1)));
+			StringBuilderAppendLiteral(line, " MB (Peak: ");
+			StringBuilderAppendSigned(line, (int)(pmc.PeakWorkingSetSize / Megabytes(1)));
+			StringBuilderAppendLiteral(line, " MB)");
+			DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 			lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
-			StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Page File Usage: %d MB (Peak: %d MB)", (int)(pmc.PagefileUsage / Megabytes(1)), (int)(pmc.PeakPagefileUsage / Megabytes(1)));
-			TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+			StringBuilderReset(line);
+			StringBuilderAppendLiteral(line, "Page File Usage: ");
+			StringBuilderAppendSigned(line, (int)(pmc.PagefileUsage / Megabytes(1)));
+			StringBuilderAppendLiteral(line, " MB (Peak: ");
+			StringBuilderAppendSigned(line, (int)(pmc.PeakPagefileUsage / Megabytes(1)));
+			StringBuilderAppendLiteral(line, " MB)");
+			DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 			lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 			lineY += DEBUG_OVERLAY_MARGIN_SIZE;
 			size_t totalMemoryUsed = pmc.PrivateUsage + pmc.WorkingSetSize;
 			percentage procPercent = DoubleToFloat((double)(totalMemoryUsed) / memoryUsageInfo.ullTotalPhys);
-			StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Memory Usage: %d MB / %d MB (%d%%)",
-				(int)(totalMemoryUsed / Megabytes(1)),
-				(int)(memoryUsageInfo.ullTotalPhys / Megabytes(1)), Percent(procPercent));
-
-			TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE,
-				lineY, formatBuffer, lstrlenA(formatBuffer));
+			StringBuilderReset(line);
+			StringBuilderAppendLiteral(line, "Memory Usage: ");
+			StringBuilderAppendSigned(line, (int)(totalMemoryUsed / Megabytes(1)));
+			StringBuilderAppendLiteral(line, " MB / ");
+			StringBuilderAppendSigned(line, (int)(memoryUsageInfo.ullTotalPhys / Megabytes(1)));
+			StringBuilderAppendLiteral(line, " MB (");
+			StringBuilderAppendSigned(line, Percent(procPercent));
+			StringBuilderAppendLiteral(line, "%)");
+
+			DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE,
+				lineY, line.buffer, (int)line.length);
 			lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 			progressBar = { .x = startX + DEBUG_OVERLAY_PADDING_SIZE, .y = lineY, .width = PROGRESS_BAR_WIDTH, .height = PROGRESS_BAR_HEIGHT, .percent = Percent(procPercent) };
@@ -933,8 +1301,13 @@ INTERNAL void DebugDrawProcessorUsageOverlay(HDC& displayDeviceContext) {
 			DWORD err = GetLastError();
 			LPTSTR errStr = FormatErrorString(err);
 
-			StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "N/A: %lu (%s)", err, errStr);
-			TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+			StringBuilderReset(line);
+			StringBuilderAppendLiteral(line, "N/A: ");
+			StringBuilderAppendUnsigned(line, err);
+			StringBuilderAppendLiteral(line, " (");
+			StringBuilderAppendCString(line, errStr);
+			StringBuilderAppendCharacter(line, ')');
+			DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 			lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 		}
 	}
@@ -944,52 +1317,60 @@ INTERNAL void DebugDrawProcessorUsageOverlay(HDC& displayDeviceContext) {
 	//-------------------------------------------------
 	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
 	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY,
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY,
 		"=== HARDWARE INFORMATION ===", lstrlenA("=== HARDWARE INFORMATION ==="));
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE,
-		"%s",
-		NTDLL_VERSION_STRING);
+	StringBuilderReset(line);
+	StringBuilderAppendCString(line, NTDLL_VERSION_STRING);
 
-	TextOutA(displayDeviceContext,
+	DebugDrawText(
 		startX + DEBUG_OVERLAY_PADDING_SIZE,
 		lineY,
-		formatBuffer,
-		lstrlenA(formatBuffer));
+		line.buffer,
+		(int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "CPU: %s", CPU_BRAND_STRING);
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY,
-		formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "CPU: ");
+	StringBuilderAppendCString(line, CPU_BRAND_STRING);
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY,
+		line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	const char* arch = ArchitectureToDebugName(CPU_PERFORMANCE_INFO.processorArchitecture);
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Processor Architecture: %s (%d bit)", arch, BITS_PER_BYTE * PLATFORM_POINTER_SIZE);
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Processor Architecture: ");
+	StringBuilderAppendCString(line, arch);
+	StringBuilderAppendLiteral(line, " (");
+	StringBuilderAppendSigned(line, BITS_PER_BYTE * PLATFORM_POINTER_SIZE);
+	StringBuilderAppendLiteral(line, " bit)");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Number of Cores: %u", CPU_PERFORMANCE_INFO.numberOfProcessors);
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Number of Cores: ");
+	StringBuilderAppendUnsigned(line, CPU_PERFORMANCE_INFO.numberOfProcessors);
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
 
 	lineY += DEBUG_OVERLAY_MARGIN_SIZE;
-	StringCbPrintfA(formatBuffer, FORMAT_BUFFER_SIZE, "Page Size: %u KB (Allocation Granularity: %u KB)", CPU_PERFORMANCE_INFO.pageSize / Kilobytes(1), CPU_PERFORMANCE_INFO.allocationGranularity / Kilobytes(1));
-	TextOutA(displayDeviceContext, startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, formatBuffer, lstrlenA(formatBuffer));
+	StringBuilderReset(line);
+	StringBuilderAppendLiteral(line, "Page Size: ");
+	StringBuilderAppendUnsigned(line, CPU_PERFORMANCE_INFO.pageSize / Kilobytes(1));
+	StringBuilderAppendLiteral(line, " KB (Allocation Granularity: ");
+	StringBuilderAppendUnsigned(line, CPU_PERFORMANCE_INFO.allocationGranularity / Kilobytes(1));
+	StringBuilderAppendLiteral(line, " KB)");
+	DebugDrawText(startX + DEBUG_OVERLAY_PADDING_SIZE, lineY, line.buffer, (int)line.length);
 	lineY += DEBUG_OVERLAY_LINE_HEIGHT;
-
-	SelectObject(displayDeviceContext, oldFont);
 }
 
 constexpr int KEYBOARD_DEBUG_OVERLAY_CELL_WIDTH = 100;
 constexpr int KEYBOARD_DEBUG_OVERLAY_CELL_HEIGHT = 18;
 
 INTERNAL void DebugDrawKeyboardOverlay(HDC& displayDeviceContext) {
-	SetBkMode(displayDeviceContext, TRANSPARENT);
-	HFONT font = (HFONT)GetStockObject(ANSI_VAR_FONT);
-	HFONT oldFont = (HFONT)SelectObject(displayDeviceContext, font);
-
+	PROFILE_FUNCTION();
 	for(int virtualKeyCode = 0; virtualKeyCode < 256; ++virtualKeyCode) {
 		int column = virtualKeyCode % 16;
 		int row = virtualKeyCode / 16;
@@ -1007,11 +1388,7 @@ INTERNAL void DebugDrawKeyboardOverlay(HDC& displayDeviceContext) {
 
 		DebugDrawSolidColorRectangle(displayDeviceContext, textArea, backgroundColor);
 
-		SetTextColor(displayDeviceContext, ColorRef(UI_TEXT_COLOR));
 		const char* label = KeyCodeToDebugName(virtualKeyCode);
-		DrawTextA(displayDeviceContext, label, -1, &textArea,
-			DT_CENTER | DT_VCENTER | DT_SINGLELINE);
+		DebugDrawCenteredText(label, textArea);
 	}
-
-	SelectObject(displayDeviceContext, oldFont);
 }
@@ -15,17 +15,24 @@ typedef struct gdi_surface {
 
 GLOBAL gdi_offscreen_buffer_t GDI_BACKBUFFER = {};
 GLOBAL gdi_surface_t GDI_SURFACE = {};
+GLOBAL glyph_atlas_t DEBUG_OVERLAY_GLYPH_ATLAS = {};
+GLOBAL text_line_cache_t DEBUG_OVERLAY_TEXT_CACHE = {};
+GLOBAL arena_residency_map_t MAIN_MEMORY_RESIDENCY = {};
+GLOBAL arena_residency_map_t TRANSIENT_MEMORY_RESIDENCY = {};
 
-typedef union gdi_rgba_color {
-	// NOTE: For simplicity, ensure this matches the pixel format used by GDI bitmaps
-	struct {
-		uint8 blue;
-		uint8 green;
-		uint8 red;
-		uint8 alpha;
-	};
-	uint32 bytes;
-} gdi_color_t;
+// NOTE: Querying residency isn't free, so only a few blocks are sampled per frame (spreading out the sweep over time)
+constexpr size_t RESIDENCY_SAMPLED_BLOCKS_PER_FRAME = 256;
+
+// NOTE: The simulation renders at a reduced internal resolution if requested, which is then upscaled in software
+constexpr percentage INTERNAL_RESOLUTION_PRESETS[] = { 1.0f, 0.75f, 0.5f };
+GLOBAL offscreen_buffer_t INTERNAL_RENDER_TARGET = {};
+GLOBAL size_t INTERNAL_RENDER_TARGET_CAPACITY = 0; // In pixels (only ever grows)
+GLOBAL percentage INTERNAL_RESOLUTION_SCALE = 1.0f;
+GLOBAL upscaling_mode_t SELECTED_UPSCALING_MODE = UPSCALE_BILINEAR_FILTERED;
+GLOBAL bool APPLICATION_USES_ADAPTIVE_RESOLUTION = false; // Opt-in, since it trades image quality for frame time
+GLOBAL adaptive_resolution_t ADAPTIVE_RESOLUTION = { .scale = 1.0f, .minimumScale = 0.25f, .maximumScale = 1.0f };
+
+typedef rgba_color_t gdi_color_t;
 
 constexpr gdi_color_t UNINITIALIZED_WINDOW_COLOR = { .bytes = 0xFF202020 };
 
@@ -40,15 +47,10 @@ typedef struct gdi_progress_bar {
 typedef enum {
 	XY_LINES_PLOTTED,
 	AREA_PERCENT_STACKED,
+	HISTORY_GRAPH_STYLE_COUNT,
 } history_graph_style_t;
 
-typedef enum {
-	DEFAULT_GDI_LINE,
-	BRESENHAM_INTEGER_LINE,
-	DDA_FLOAT_LINE,
-	WU_FLOAT_LINE,
-	LINE_STYLE_COUNT,
-
-} line_drawing_style_t;
+// NOTE: Incremental graphs only draw the newest sample(s) into a cached strip, instead of replotting the entire history
+GLOBAL bool DEBUG_OVERLAY_USES_INCREMENTAL_GRAPHS = true;
 
 GLOBAL line_drawing_style_t SELECTED_LINE_DRAWING_METHOD = DEFAULT_GDI_LINE;
\ No newline at end of file
@@ -36,3 +36,25 @@ INTERNAL void SystemMemoryInitializeArenas(size_t mainMemorySize, size_t transie
 	MAIN_MEMORY.committedSize = mainMemorySize;
 	TRANSIENT_MEMORY.committedSize = transientMemorySize;
 }
+
+
+INTERNAL void SystemMemorySampleResidency(arena_residency_map_t& map, memory_arena_t& arena, size_t allocationGranularity, size_t pageSize, size_t maxSampledBlocks) {
+	if(map.blockCount == 0) ArenaResidencyMapInitialize(map, arena, allocationGranularity);
+
+	size_t pagesPerBlock = map.blockSize / pageSize;
+	for(size_t sampleCount = 0; sampleCount < maxSampledBlocks; ++sampleCount) {
+		size_t blockID = map.nextSampledBlock;
+		size_t blockOffset = blockID * map.blockSize;
+		size_t blockPageCount = Min(pagesPerBlock, (arena.reservedSize - blockOffset + pageSize - 1) / pageSize);
+		size_t residentPageCount = PlatformCountResidentPages((uint8*)arena.baseAddress + blockOffset, blockPageCount, pageSize);
+		map.isBlockResident[blockID] = (residentPageCount > 0);
+		map.pendingResidentSize += residentPageCount * pageSize;
+
+		map.nextSampledBlock++;
+		if(map.nextSampledBlock == map.blockCount) {
+			map.residentSize = map.pendingResidentSize;
+			map.pendingResidentSize = 0;
+			map.nextSampledBlock = 0;
+		}
+	}
+}
@@ -1,5 +1,21 @@
 typedef uint64 hardware_tick_t;
 
+// NOTE: Sleeping isn't a phase, since the hardware counters would only measure whatever the OS does in the meantime
+typedef enum : uint8 {
+	FRAME_PHASE_MESSAGE_PROCESSING,
+	FRAME_PHASE_SIMULATION_STEP,
+	FRAME_PHASE_USER_INTERFACE_RENDER,
+	FRAME_PHASE_SURFACE_BLIT,
+	FRAME_PHASE_COUNT,
+} frame_phase_t;
+
+GLOBAL const char* FRAME_PHASE_NAMES[FRAME_PHASE_COUNT] = {
+	"Messages",
+	"Simulation",
+	"Debug UI",
+	"Surface Blit",
+};
+
 typedef struct system_performance_metrics {
 	FILETIME prevSysKernel;
 	FILETIME prevSysUser;
@@ -14,6 +30,10 @@ typedef struct system_performance_metrics {
 	milliseconds userInterfaceRenderTime;
 	milliseconds simulationStepTime;
 	milliseconds surfaceBlitTime;
+	milliseconds upscalingTime;
+	percentage internalResolutionScale;
+	percentage surfaceDirtyRatio;
+	hardware_counter_values_t phaseCounters[FRAME_PHASE_COUNT];
 } performance_metrics_t;
 
 typedef struct system_performance_info {
@@ -24,18 +44,39 @@ typedef struct system_performance_info {
 	WORD processorArchitecture;
 } performance_info_t;
 
+// NOTE: Only the metrics that measure how long something took are tracked (which excludes uptime and planned sleeps)
+typedef enum : uint8 {
+	METRIC_FRAME_TIME,
+	METRIC_MESSAGE_PROCESSING_TIME,
+	METRIC_SUSPENDED_TIME,
+	METRIC_USER_INTERFACE_RENDER_TIME,
+	METRIC_SIMULATION_STEP_TIME,
+	METRIC_SURFACE_BLIT_TIME,
+	METRIC_UPSCALING_TIME,
+	TRACKED_METRIC_COUNT,
+} tracked_metric_t;
+
 constexpr uint32 PERFORMANCE_HISTORY_SECONDS = 10;
 constexpr uint32 PERFORMANCE_HISTORY_SIZE = 256 * ((uint32)(TARGET_FRAME_RATE * PERFORMANCE_HISTORY_SECONDS) / 256);
 typedef struct performance_history_cache {
 	performance_metrics_t recordedSamples[PERFORMANCE_HISTORY_SIZE];
 	milliseconds highestObservedFrameTime;
 	uint32 oldestRecordedSampleIndex;
+	uint64 recordedSampleCount;
+	// Unlike the raw samples, these never reset (so rare stutters remain visible in the tail percentiles)
+	latency_histogram_t runHistograms[TRACKED_METRIC_COUNT];
+	sliding_histogram_window_t recentHistograms[TRACKED_METRIC_COUNT];
 } performance_history_t;
 
+constexpr double REPORTED_PERCENTILES[] = { 50.0, 90.0, 99.0, 99.9 };
+constexpr int REPORTED_PERCENTILE_COUNT = sizeof(REPORTED_PERCENTILES) / sizeof(double);
+
 GLOBAL hardware_tick_t MONOTONIC_CLOCK_SPEED = {};
 GLOBAL performance_metrics_t CPU_PERFORMANCE_METRICS = {};
 GLOBAL performance_info_t CPU_PERFORMANCE_INFO = {};
 GLOBAL performance_history_t PERFORMANCE_METRICS_HISTORY = {};
+GLOBAL hardware_counter_group_t HARDWARE_COUNTERS = {};
+GLOBAL hardware_counter_values_t PHASE_START_COUNTERS = {};
 
 INTERNAL inline uint64 FileTimeToUnsigned64(FILETIME& fileTime) {
 	ULARGE_INTEGER converted;
@@ -76,9 +117,7 @@ INTERNAL percentage GetProcessorUsageAllCores() {
 }
 
 INTERNAL inline hardware_tick_t PerformanceMetricsNow() {
-	LARGE_INTEGER highResolutionTimestamp;
-	QueryPerformanceCounter(&highResolutionTimestamp);
-	return (hardware_tick_t)highResolutionTimestamp.QuadPart;
+	return (hardware_tick_t)PlatformGetMonotonicTicks();
 }
 
 INTERNAL inline seconds PerformanceMetricsElapsedSeconds(hardware_tick_t before) {
@@ -91,6 +130,49 @@ INTERNAL inline milliseconds PerformanceMetricsGetTimeSince(hardware_tick_t befo
 	return PerformanceMetricsElapsedSeconds(before) * MILLISECONDS_PER_SECOND;
 }
 
+INTERNAL inline void PerformanceMetricsBeginPhase() {
+	PlatformReadHardwareCounters(HARDWARE_COUNTERS, PHASE_START_COUNTERS);
+}
+
+INTERNAL inline void PerformanceMetricsEndPhase(frame_phase_t phase) {
+	hardware_counter_values_t now = {};
+	PlatformReadHardwareCounters(HARDWARE_COUNTERS, now);
+	HardwareCountersGetDelta(PHASE_START_COUNTERS, now, CPU_PERFORMANCE_METRICS.phaseCounters[phase]);
+}
+
+INTERNAL inline void PerformanceMetricsSkipPhase(frame_phase_t phase) {
+	CPU_PERFORMANCE_METRICS.phaseCounters[phase] = {};
+}
+
+INTERNAL milliseconds PerformanceMetricsGetTrackedValue(performance_metrics_t& metrics, tracked_metric_t metric) {
+	switch(metric) {
+		case METRIC_FRAME_TIME:
+			return metrics.frameTime;
+		case METRIC_MESSAGE_PROCESSING_TIME:
+			return metrics.messageProcessingTime;
+		case METRIC_SUSPENDED_TIME:
+			return metrics.suspendedTime;
+		case METRIC_USER_INTERFACE_RENDER_TIME:
+			return metrics.userInterfaceRenderTime;
+		case METRIC_SIMULATION_STEP_TIME:
+			return metrics.simulationStepTime;
+		case METRIC_SURFACE_BLIT_TIME:
+			return metrics.surfaceBlitTime;
+		case METRIC_UPSCALING_TIME:
+			return metrics.upscalingTime;
+		default:
+			return 0;
+	}
+}
+
+INTERNAL inline void PerformanceMetricsGetRunPercentiles(performance_history_t& history, tracked_metric_t metric, milliseconds* results) {
+	HistogramGetPercentiles(&history.runHistograms[metric], 1, REPORTED_PERCENTILES, results, REPORTED_PERCENTILE_COUNT);
+}
+
+INTERNAL inline void PerformanceMetricsGetRecentPercentiles(performance_history_t& history, tracked_metric_t metric, milliseconds* results) {
+	HistogramWindowGetPercentiles(history.recentHistograms[metric], REPORTED_PERCENTILES, results, REPORTED_PERCENTILE_COUNT);
+}
+
 INTERNAL inline void PerformanceMetricsRecordSample(performance_metrics_t metrics, performance_history_t& history) {
 	history.recordedSamples[history.oldestRecordedSampleIndex] = metrics;
 
@@ -102,4 +184,11 @@ INTERNAL inline void PerformanceMetricsRecordSample(performance_metrics_t metric
 	history.highestObservedFrameTime = Max(history.highestObservedFrameTime, metrics.frameTime);
 
 	history.oldestRecordedSampleIndex = (history.oldestRecordedSampleIndex + 1) % PERFORMANCE_HISTORY_SIZE;
+	history.recordedSampleCount++;
+
+	for(int metric = 0; metric < TRACKED_METRIC_COUNT; ++metric) {
+		milliseconds value = PerformanceMetricsGetTrackedValue(metrics, (tracked_metric_t)metric);
+		HistogramRecordValue(history.runHistograms[metric], value);
+		HistogramWindowRecordValue(history.recentHistograms[metric], metrics.applicationUptime, value);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,326 @@
+// NOTE: Each thread writes completed zones into its own ring buffer, so recording never needs to take a lock
+constexpr int MAX_PROFILED_THREADS = 4;
+constexpr uint64 PROFILER_RING_BUFFER_SIZE = 8192; // Must be a power of two
+constexpr int MAX_PROFILER_ZONE_DEPTH = 32;
+
+typedef struct profiler_zone_record {
+	const char* name;
+	const char* location;
+	uint64 startTicks;
+	uint64 endTicks;
+	uint32 depth;
+} profiler_zone_t;
+
+typedef struct profiler_thread_buffer {
+	profiler_zone_t records[PROFILER_RING_BUFFER_SIZE];
+	volatile uint64 writeIndex; // Only ever advanced by the owning thread
+	uint64 collectedIndex; // Only ever accessed by the thread that aggregates frames
+	uint64 threadID;
+	uint32 currentDepth;
+} profiler_thread_buffer_t;
+
+GLOBAL profiler_thread_buffer_t PROFILER_THREAD_BUFFERS[MAX_PROFILED_THREADS] = {};
+GLOBAL volatile long PROFILER_REGISTERED_THREAD_COUNT = 0;
+GLOBAL thread_local profiler_thread_buffer_t* PROFILER_CURRENT_THREAD_BUFFER = nullptr;
+GLOBAL uint64 PROFILER_START_TICKS = 0;
+
+#ifdef RAGLITE_COMPILER_MSVC
+// NOTE: Aligned 64-bit loads and stores are atomic on x64, and its memory model only requires a compiler barrier here
+INTERNAL inline void ProfilerAtomicStoreRelease(volatile uint64* destination, uint64 value) {
+	_ReadWriteBarrier();
+	*destination = value;
+}
+
+INTERNAL inline uint64 ProfilerAtomicLoadAcquire(volatile uint64* source) {
+	uint64 value = *source;
+	_ReadWriteBarrier();
+	return value;
+}
+
+// NOTE: Loads aren't reordered with other loads on x64, so preventing the compiler from doing it is sufficient
+INTERNAL inline void ProfilerAtomicFenceAcquire() {
+	_ReadWriteBarrier();
+}
+
+// Stores can still be reordered with later loads on x64, so this one requires an actual fence instruction
+INTERNAL inline void ProfilerAtomicFenceSequential() {
+	MemoryBarrier();
+}
+#else
+INTERNAL inline void ProfilerAtomicStoreRelease(volatile uint64* destination, uint64 value) {
+	__atomic_store_n(destination, value, __ATOMIC_RELEASE);
+}
+
+INTERNAL inline uint64 ProfilerAtomicLoadAcquire(volatile uint64* source) {
+	return __atomic_load_n(source, __ATOMIC_ACQUIRE);
+}
+
+INTERNAL inline void ProfilerAtomicFenceAcquire() {
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+}
+
+INTERNAL inline void ProfilerAtomicFenceSequential() {
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+#endif
+
+INTERNAL profiler_thread_buffer_t* ProfilerGetThreadBuffer() {
+	if(PROFILER_CURRENT_THREAD_BUFFER) return PROFILER_CURRENT_THREAD_BUFFER;
+
+	long slot = IntrinsicsAtomicIncrement(&PROFILER_REGISTERED_THREAD_COUNT) - 1;
+	if(slot >= MAX_PROFILED_THREADS) return nullptr; // Zones recorded by any additional threads are simply dropped
+
+	profiler_thread_buffer_t* buffer = &PROFILER_THREAD_BUFFERS[slot];
+	buffer->threadID = PlatformGetCurrentThreadID();
+	PROFILER_CURRENT_THREAD_BUFFER = buffer;
+	return buffer;
+}
+
+INTERNAL inline int ProfilerGetRegisteredThreadCount() {
+	return Min((int)PROFILER_REGISTERED_THREAD_COUNT, MAX_PROFILED_THREADS);
+}
+
+// Returns false if the writer has lapped the reader in the meantime (the record may have been overwritten)
+INTERNAL inline bool ProfilerReadZone(profiler_thread_buffer_t& buffer, uint64 index, profiler_zone_t& zone) {
+	zone = buffer.records[index & (PROFILER_RING_BUFFER_SIZE - 1)];
+	// The copy must be complete before checking whether the writer has since lapped it (seqlock-style validation)
+	ProfilerAtomicFenceAcquire();
+	uint64 writeIndex = ProfilerAtomicLoadAcquire(&buffer.writeIndex);
+	// NOTE: If the distance is exactly the ring size, then the slot is the one that's going to be written to next
+	return writeIndex - index < PROFILER_RING_BUFFER_SIZE;
+}
+
+typedef struct profiler_scoped_zone {
+	profiler_thread_buffer_t* buffer;
+	const char* name;
+	const char* location;
+	uint64 startTicks;
+
+	profiler_scoped_zone(const char* zoneName, const char* sourceLocation) {
+		buffer = ProfilerGetThreadBuffer();
+		name = zoneName;
+		location = sourceLocation;
+		if(buffer) buffer->currentDepth++;
+		startTicks = PlatformGetMonotonicTicks();
+	}
+
+	~profiler_scoped_zone() {
+		uint64 endTicks = PlatformGetMonotonicTicks();
+		if(!buffer) return;
+
+		buffer->currentDepth--;
+		uint64 writeIndex = buffer->writeIndex;
+		buffer->records[writeIndex & (PROFILER_RING_BUFFER_SIZE - 1)] = {
+			.name = name,
+			.location = location,
+			.startTicks = startTicks,
+			.endTicks = endTicks,
+			.depth = buffer->currentDepth,
+		};
+		ProfilerAtomicStoreRelease(&buffer->writeIndex, writeIndex + 1);
+	}
+} profiler_scoped_zone_t;
+
+#define PROFILER_CONCATENATE_EXPANDED(first, second) first##second
+#define PROFILER_CONCATENATE(first, second) PROFILER_CONCATENATE_EXPANDED(first, second)
+#define PROFILE_ZONE(name) profiler_scoped_zone_t PROFILER_CONCATENATE(profilerZone, __LINE__)(name, FROM_HERE)
+#define PROFILE_FUNCTION() PROFILE_ZONE(__func__)
+
+// NOTE: Zones with the same call path are merged, so that loops don't flood the hierarchy with identical entries
+constexpr int MAX_PROFILER_FRAME_NODES = 256;
+typedef struct profiler_frame_node {
+	const char* name;
+	const char* location;
+	uint64 threadID;
+	uint64 firstStartTicks;
+	uint64 totalTicks;
+	uint32 callCount;
+	uint32 depth;
+	int parentIndex;
+} profiler_frame_node_t;
+
+typedef struct profiler_frame_hierarchy {
+	profiler_frame_node_t nodes[MAX_PROFILER_FRAME_NODES];
+	int nodeCount;
+	uint32 droppedZoneCount;
+} profiler_frame_t;
+
+GLOBAL profiler_frame_t PROFILER_LAST_FRAME = {};
+
+INTERNAL int ProfilerFrameFindOrAddNode(profiler_frame_t& frame, profiler_zone_t& zone, uint64 threadID, int parentIndex) {
+	for(int index = frame.nodeCount - 1; index >= 0; --index) {
+		profiler_frame_node_t& node = frame.nodes[index];
+		if(node.parentIndex != parentIndex || node.threadID != threadID) continue;
+		if(node.location == zone.location && node.name == zone.name) return index;
+	}
+
+	if(frame.nodeCount == MAX_PROFILER_FRAME_NODES) return -1;
+	frame.nodes[frame.nodeCount] = {
+		.name = zone.name,
+		.location = zone.location,
+		.threadID = threadID,
+		.firstStartTicks = zone.startTicks,
+		.totalTicks = 0,
+		.callCount = 0,
+		.depth = zone.depth,
+		.parentIndex = parentIndex,
+	};
+	return frame.nodeCount++;
+}
+
+// Aggregates all zones that completed since the last call (nested zones complete before their parents do)
+INTERNAL void ProfilerCollectFrame(profiler_frame_t& frame) {
+	frame.nodeCount = 0;
+	frame.droppedZoneCount = 0;
+
+	constexpr int MAX_COLLECTED_ZONES = 1024;
+	profiler_zone_t zones[MAX_COLLECTED_ZONES];
+	for(int threadIndex = 0; threadIndex < ProfilerGetRegisteredThreadCount(); ++threadIndex) {
+		profiler_thread_buffer_t& buffer = PROFILER_THREAD_BUFFERS[threadIndex];
+		uint64 writeIndex = ProfilerAtomicLoadAcquire(&buffer.writeIndex);
+		uint64 oldestAvailable = (writeIndex > PROFILER_RING_BUFFER_SIZE) ? writeIndex - PROFILER_RING_BUFFER_SIZE : 0;
+		uint64 readIndex = Max(buffer.collectedIndex, oldestAvailable);
+		frame.droppedZoneCount += (uint32)(readIndex - buffer.collectedIndex);
+
+		int zoneCount = 0;
+		for(; readIndex < writeIndex; ++readIndex) {
+			profiler_zone_t zone;
+			bool isValid = ProfilerReadZone(buffer, readIndex, zone);
+			if(!isValid || zoneCount == MAX_COLLECTED_ZONES || zone.depth >= MAX_PROFILER_ZONE_DEPTH) {
+				frame.droppedZoneCount++;
+				continue;
+			}
+
+			// Order by start time (parents before their children), which is almost sorted already
+			int insertionIndex = zoneCount++;
+			while(insertionIndex > 0) {
+				profiler_zone_t& previous = zones[insertionIndex - 1];
+				bool isOrdered = previous.startTicks < zone.startTicks || (previous.startTicks == zone.startTicks && previous.depth <= zone.depth);
+				if(isOrdered) break;
+				zones[insertionIndex] = previous;
+				insertionIndex--;
+			}
+			zones[insertionIndex] = zone;
+		}
+		buffer.collectedIndex = writeIndex;
+
+		// NOTE: Zones whose parent is still open (or was dropped) are treated as roots
+		int parentIndices[MAX_PROFILER_ZONE_DEPTH + 1];
+		uint64 parentEndTicks[MAX_PROFILER_ZONE_DEPTH + 1];
+		for(int depth = 0; depth <= MAX_PROFILER_ZONE_DEPTH; ++depth) {
+			parentIndices[depth] = -1;
+			parentEndTicks[depth] = 0;
+		}
+		for(int zoneIndex = 0; zoneIndex < zoneCount; ++zoneIndex) {
+			profiler_zone_t& zone = zones[zoneIndex];
+			bool isNestedInParent = zone.endTicks <= parentEndTicks[zone.depth];
+			int parentIndex = isNestedInParent ? parentIndices[zone.depth] : -1;
+			int nodeIndex = ProfilerFrameFindOrAddNode(frame, zone, buffer.threadID, parentIndex);
+			if(nodeIndex < 0) {
+				frame.droppedZoneCount++;
+				continue;
+			}
+
+			frame.nodes[nodeIndex].totalTicks += zone.endTicks - zone.startTicks;
+			frame.nodes[nodeIndex].callCount++;
+			parentIndices[zone.depth + 1] = nodeIndex;
+			parentEndTicks[zone.depth + 1] = zone.endTicks;
+		}
+	}
+}
+
+typedef struct profiler_trace_writer {
+	char* buffer;
+	size_t capacity;
+	size_t used;
+	bool isTruncated;
+} profiler_trace_writer_t;
+
+INTERNAL inline void ProfilerTraceAppendString(profiler_trace_writer_t& writer, const char* text, bool escape) {
+	for(const char* character = text; *character != ASCII_NULL_TERMINATOR; ++character) {
+		bool needsEscape = escape && (*character == '"' || *character == ASCII_BACKWARD_SLASH);
+		if(writer.used + 2 >= writer.capacity) return;
+		if(needsEscape) writer.buffer[writer.used++] = ASCII_BACKWARD_SLASH;
+		writer.buffer[writer.used++] = *character;
+	}
+}
+
+INTERNAL inline void ProfilerTraceAppendMicroseconds(profiler_trace_writer_t& writer, uint64 ticks, uint64 ticksPerSecond) {
+	char digits[32];
+	uint64 nanoseconds = (uint64)((double)ticks * 1000000000.0 / (double)ticksPerSecond);
+	int length = 0;
+	uint64 integralPart = nanoseconds / 1000;
+	do {
+		digits[length++] = '0' + (char)(integralPart % 10);
+		integralPart /= 10;
+	} while(integralPart > 0);
+
+	char formatted[40];
+	int formattedLength = 0;
+	while(length > 0)
+		formatted[formattedLength++] = digits[--length];
+	formatted[formattedLength++] = ASCII_PERIOD_DOT;
+	uint64 fractionalPart = nanoseconds % 1000;
+	formatted[formattedLength++] = '0' + (char)(fractionalPart / 100);
+	formatted[formattedLength++] = '0' + (char)((fractionalPart / 10) % 10);
+	formatted[formattedLength++] = '0' + (char)(fractionalPart % 10);
+	formatted[formattedLength] = ASCII_NULL_TERMINATOR;
+	ProfilerTraceAppendString(writer, formatted, false);
+}
+
+// Writes all zones still held by the ring buffers as Chrome trace events (open the result in chrome://tracing or Perfetto)
+INTERNAL size_t ProfilerExportChromeTrace(char* buffer, size_t capacity, bool& isTruncated) {
+	profiler_trace_writer_t writer = { .buffer = buffer, .capacity = capacity, .used = 0, .isTruncated = false };
+	uint64 ticksPerSecond = PlatformGetMonotonicTicksPerSecond();
+	// NOTE: Viewers ignore unknown top-level fields, so the truncation can be recorded in the trace itself
+	constexpr char TRUNCATED_TRACE_FOOTER[] = "],\"otherData\":{\"truncated\":true}}";
+	constexpr size_t TRACE_FOOTER_SIZE = sizeof(TRUNCATED_TRACE_FOOTER) + 1;
+	ASSUME(capacity > TRACE_FOOTER_SIZE, "Insufficient space to export the profiler trace");
+
+	ProfilerTraceAppendString(writer, "{\"traceEvents\":[", false);
+	bool isFirstEvent = true;
+	for(int threadIndex = 0; threadIndex < ProfilerGetRegisteredThreadCount() && !writer.isTruncated; ++threadIndex) {
+		profiler_thread_buffer_t& buffer = PROFILER_THREAD_BUFFERS[threadIndex];
+		uint64 writeIndex = ProfilerAtomicLoadAcquire(&buffer.writeIndex);
+		uint64 readIndex = (writeIndex > PROFILER_RING_BUFFER_SIZE) ? writeIndex - PROFILER_RING_BUFFER_SIZE : 0;
+
+		char threadID[32];
+		DoubleToString(threadID, (double)buffer.threadID, ZERO_DIGITS);
+		for(; readIndex < writeIndex; ++readIndex) {
+			profiler_zone_t zone;
+			if(!ProfilerReadZone(buffer, readIndex, zone)) continue;
+
+			// NOTE: Events are only committed if they fit entirely, so that truncated traces remain valid JSON
+			size_t eventStart = writer.used;
+			if(!isFirstEvent) ProfilerTraceAppendString(writer, ",", false);
+			ProfilerTraceAppendString(writer, "{\"ph\":\"X\",\"pid\":1,\"tid\":", false);
+			ProfilerTraceAppendString(writer, threadID, false);
+			ProfilerTraceAppendString(writer, ",\"name\":\"", false);
+			ProfilerTraceAppendString(writer, zone.name, true);
+			ProfilerTraceAppendString(writer, "\",\"ts\":", false);
+			ProfilerTraceAppendMicroseconds(writer, zone.startTicks - PROFILER_START_TICKS, ticksPerSecond);
+			ProfilerTraceAppendString(writer, ",\"dur\":", false);
+			ProfilerTraceAppendMicroseconds(writer, zone.endTicks - zone.startTicks, ticksPerSecond);
+			ProfilerTraceAppendString(writer, ",\"args\":{\"location\":\"", false);
+			ProfilerTraceAppendString(writer, zone.location, true);
+			ProfilerTraceAppendString(writer, "\"}}", false);
+
+			if(writer.used + TRACE_FOOTER_SIZE >= writer.capacity) {
+				// Events from the remaining threads wouldn't fit either (and skipping ahead would leave gaps that look like idle time)
+				writer.used = eventStart;
+				writer.isTruncated = true;
+				break;
+			}
+			isFirstEvent = false;
+		}
+	}
+
+	ProfilerTraceAppendString(writer, writer.isTruncated ? TRUNCATED_TRACE_FOOTER : "]}", false);
+	writer.buffer[writer.used] = ASCII_NULL_TERMINATOR;
+	isTruncated = writer.isTruncated;
+	return writer.used;
+}
+
+INTERNAL inline void ProfilerInitialize() {
+	PROFILER_START_TICKS = PlatformGetMonotonicTicks();
+}
\ No newline at end of file
@@ -17,12 +17,20 @@ GLOBAL memory_arena_t TRANSIENT_MEMORY = {};
 #include "Platforms/Linux.cpp"
 #endif
 
+#include "HeadlessBenchmark.cpp"
+
 #ifdef RAGLITE_PLATFORM_WINDOWS
-int APIENTRY WinMain(HINSTANCE, HINSTANCE, LPSTR, int)
+int APIENTRY WinMain(HINSTANCE, HINSTANCE, LPSTR, int) {
+	int argc = __argc;
+	char** argv = __argv;
 #else
-int main()
+int main(int argc, char** argv) {
 #endif
-{
+	if(BenchmarkWasRequested(argc, argv)) {
+		PlatformAttachParentConsole();
+		return BenchmarkRunFromCommandLine(argc, argv);
+	}
+
 	PlatformRuntimeMain();
 	return 0;
 }
\ No newline at end of file
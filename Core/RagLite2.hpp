@@ -66,6 +66,24 @@ static_assert(PLATFORM_POINTER_SIZE == Bits(64), "Only 64-bit platforms are curr
 #include "Strings.hpp"
 
 #include "Memory.hpp"
+#include "StringBuilder.hpp"
+#include "StringInterning.hpp"
+#include "Transcoding.hpp"
+#include "Compression.hpp"
+
+typedef struct bitmap_rectangle {
+	int left;
+	int top;
+	int right; // Exclusive
+	int bottom; // Exclusive
+} bitmap_rectangle_t;
+
+// NOTE: Overlapping regions are merged, and overflowing the list collapses it into a single bounding box
+constexpr int MAX_DIRTY_RECTANGLES = 32;
+typedef struct dirty_region_list {
+	int count;
+	bitmap_rectangle_t rectangles[MAX_DIRTY_RECTANGLES];
+} dirty_region_list_t;
 
 typedef struct offscreen_bitmap {
 	int width;
@@ -73,6 +91,8 @@ typedef struct offscreen_bitmap {
 	int bytesPerPixel;
 	int stride;
 	void* pixelBuffer;
+	dirty_region_list_t dirtyRegions;
+	bool isSharedWithOverlays; // Something else draws on top, so the previous frame's pixels can't be reused
 } offscreen_buffer_t;
 
 typedef struct gamepad_controller_state {
@@ -85,6 +105,15 @@ typedef struct volatile_simulation_state {
 	int32 offsetY;
 } simulation_state_t;
 
+typedef void (*advance_simulation_fn_t)(simulation_state_t& simulation, gamepad_state_t& controllerInputs, offscreen_buffer_t& bitmap,
+	milliseconds uptime, memory_arena_t& persistentStorage, memory_arena_t& transientStorage);
+
+#include "Graphics.hpp"
+#include "GlyphAtlas.hpp"
+#include "HardwareCounters.hpp"
+#include "Histograms.hpp"
+#include "Upscaling.hpp"
+
 #ifdef RAGLITE_PLATFORM_WINDOWS
 #include "Platforms/Win32.hpp"
 #elifdef RAGLITE_PLATFORM_MACOS
@@ -92,3 +121,6 @@ typedef struct volatile_simulation_state {
 #elifdef RAGLITE_PLATFORM_LINUX
 #include "Platforms/Linux.hpp"
 #endif
+
+#include "Profiling.hpp"
+#include "Logging.hpp"
@@ -0,0 +1,117 @@
+// NOTE: Builders never grow - appending past the capacity truncates the result (and flags it) instead of allocating more
+typedef struct string_builder {
+	char* buffer;
+	size_t length;
+	size_t capacity; // Excluding the NULL terminator
+	bool wasTruncated;
+} string_builder_t;
+
+INTERNAL string_builder_t StringBuilderCreate(memory_arena_t& arena, size_t capacity) {
+	string_builder_t builder = {
+		.buffer = (char*)ArenaAllocateMemoryRegion(arena, capacity + sizeof(ASCII_NULL_TERMINATOR)),
+		.length = 0,
+		.capacity = capacity,
+		.wasTruncated = false,
+	};
+	builder.buffer[0] = ASCII_NULL_TERMINATOR;
+	return builder;
+}
+
+INTERNAL inline void StringBuilderReset(string_builder_t& builder) {
+	builder.length = 0;
+	builder.wasTruncated = false;
+	builder.buffer[0] = ASCII_NULL_TERMINATOR;
+}
+
+INTERNAL inline String StringBuilderToString(string_builder_t& builder) {
+	String countedString = {
+		.length = builder.length,
+		.buffer = builder.buffer,
+	};
+	return countedString;
+}
+
+INTERNAL inline void StringBuilderAppendBytes(string_builder_t& builder, const char* bytes, size_t byteCount) {
+	size_t remainingCapacity = builder.capacity - builder.length;
+	if(byteCount > remainingCapacity) {
+		byteCount = remainingCapacity;
+		builder.wasTruncated = true;
+	}
+
+	memcpy(builder.buffer + builder.length, bytes, byteCount);
+	builder.length += byteCount;
+	builder.buffer[builder.length] = ASCII_NULL_TERMINATOR;
+}
+
+// NOTE: The length of a literal is known at compile time, so there's no need to scan it for the NULL terminator
+#define StringBuilderAppendLiteral(builder, stringLiteral) \
+	StringBuilderAppendBytes(builder, stringLiteral, sizeof(stringLiteral) - sizeof(ASCII_NULL_TERMINATOR))
+
+INTERNAL inline void StringBuilderAppendString(string_builder_t& builder, String countedString) {
+	StringBuilderAppendBytes(builder, countedString.buffer, countedString.length);
+}
+
+INTERNAL inline void StringBuilderAppendCString(string_builder_t& builder, const char* nullTerminatedString) {
+	StringBuilderAppendBytes(builder, nullTerminatedString, StringLength(nullTerminatedString));
+}
+
+INTERNAL void StringBuilderAppendStrings(string_builder_t& builder, String* countedStrings, size_t stringCount) {
+	size_t totalLength = 0;
+	for(size_t index = 0; index < stringCount; ++index)
+		totalLength += countedStrings[index].length;
+
+	// NOTE: Checking the capacity once upfront means the common case is nothing but a series of copies
+	if(totalLength > builder.capacity - builder.length) {
+		for(size_t index = 0; index < stringCount; ++index)
+			StringBuilderAppendString(builder, countedStrings[index]);
+		return;
+	}
+
+	char* destination = builder.buffer + builder.length;
+	for(size_t index = 0; index < stringCount; ++index) {
+		memcpy(destination, countedStrings[index].buffer, countedStrings[index].length);
+		destination += countedStrings[index].length;
+	}
+	builder.length += totalLength;
+	builder.buffer[builder.length] = ASCII_NULL_TERMINATOR;
+}
+
+INTERNAL inline void StringBuilderAppendCharacter(string_builder_t& builder, char character) {
+	StringBuilderAppendBytes(builder, &character, 1);
+}
+
+INTERNAL void StringBuilderAppendRepeatedCharacter(string_builder_t& builder, char character, size_t repetitionCount) {
+	size_t remainingCapacity = builder.capacity - builder.length;
+	if(repetitionCount > remainingCapacity) {
+		repetitionCount = remainingCapacity;
+		builder.wasTruncated = true;
+	}
+
+	memset(builder.buffer + builder.length, character, repetitionCount);
+	builder.length += repetitionCount;
+	builder.buffer[builder.length] = ASCII_NULL_TERMINATOR;
+}
+
+INTERNAL inline void StringBuilderAppendUnsigned(string_builder_t& builder, uint64 numberToFormat) {
+	char scratch[MAX_FORMATTED_NUMBER_LENGTH];
+	int length = UnsignedToString(scratch, numberToFormat);
+	StringBuilderAppendBytes(builder, scratch, length);
+}
+
+INTERNAL inline void StringBuilderAppendSigned(string_builder_t& builder, int64 numberToFormat) {
+	char scratch[MAX_FORMATTED_NUMBER_LENGTH];
+	int length = SignedToString(scratch, numberToFormat);
+	StringBuilderAppendBytes(builder, scratch, length);
+}
+
+INTERNAL inline void StringBuilderAppendHex(string_builder_t& builder, uint64 numberToFormat, int minimumDigitCount) {
+	char scratch[MAX_FORMATTED_NUMBER_LENGTH];
+	int length = HexToString(scratch, numberToFormat, minimumDigitCount);
+	StringBuilderAppendBytes(builder, scratch, length);
+}
+
+INTERNAL inline void StringBuilderAppendDouble(string_builder_t& builder, double numberToFormat, format_precision_t precisionInDecimals) {
+	char scratch[MAX_FORMATTED_NUMBER_LENGTH];
+	int length = DoubleToString(scratch, numberToFormat, precisionInDecimals);
+	StringBuilderAppendBytes(builder, scratch, length);
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+// NOTE: Interned strings are stored exactly once, so that comparing (or looking up) them only requires comparing their IDs
+typedef uint32 string_id_t;
+constexpr string_id_t INVALID_STRING_ID = 0;
+
+typedef struct intern_table_slot {
+	uint32 hash;
+	string_id_t id; // Empty if invalid
+} intern_table_slot_t;
+
+typedef struct intern_table_entry {
+	uint32 offset;
+	uint32 length;
+} intern_table_entry_t;
+
+// TBD: The table doesn't grow (arenas can't free), so the capacity must be known upfront (e.g., from the archive's header)
+typedef struct string_intern_table {
+	intern_table_slot_t* slots;
+	intern_table_entry_t* entries; // Indexed by ID (the first entry is reserved)
+	char* characters;
+	uint32 slotMask;
+	uint32 entryCount;
+	uint32 maxEntryCount;
+	size_t usedCharacterCount;
+	size_t maxCharacterCount;
+} string_intern_table_t;
+
+// NOTE: Consumes eight bytes at a time - paths are short, so this mostly comes down to a handful of multiplications
+INTERNAL uint32 StringComputeHash(String& text) {
+	constexpr uint64 HASH_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+	uint64 hash = text.length * HASH_MULTIPLIER;
+	size_t index = 0;
+	for(; index + sizeof(uint64) <= text.length; index += sizeof(uint64)) {
+		uint64 chunk;
+		memcpy(&chunk, text.bytes + index, sizeof(chunk));
+		hash = (hash ^ chunk) * HASH_MULTIPLIER;
+		hash ^= hash >> 29;
+	}
+
+	uint64 remainder = 0;
+	memcpy(&remainder, text.bytes + index, text.length - index);
+	hash = (hash ^ remainder) * HASH_MULTIPLIER;
+	hash ^= hash >> 32;
+	return (uint32)hash;
+}
+
+// NOTE: Twice as many slots (rounded up to a power of two) must still be addressable using 32-bit indices
+constexpr uint32 MAX_INTERNED_STRING_COUNT = 1U << 30;
+
+INTERNAL inline uint32 InternTableGetSlotCount(uint32 maxStringCount) {
+	ASSUME(maxStringCount <= MAX_INTERNED_STRING_COUNT, "Exceeded the maximum number of strings that can be interned");
+	// Keeping the load factor at or below 50% keeps probe sequences short (even with linear probing)
+	uint64 requiredSlotCount = 2 * (uint64)Min(maxStringCount, MAX_INTERNED_STRING_COUNT);
+	uint32 slotCount = 16;
+	while(slotCount < requiredSlotCount)
+		slotCount *= 2;
+	return slotCount;
+}
+
+INTERNAL inline size_t InternTableGetRequiredMemorySize(uint32 maxStringCount, size_t maxCharacterCount) {
+	return InternTableGetSlotCount(maxStringCount) * sizeof(intern_table_slot_t) + (maxStringCount + 1) * sizeof(intern_table_entry_t) + maxCharacterCount;
+}
+
+INTERNAL void InternTableInitialize(string_intern_table_t& table, memory_arena_t& arena, uint32 maxStringCount, size_t maxCharacterCount) {
+	ASSUME(maxCharacterCount <= UINT32_MAX, "Interned string storage is addressed using 32-bit offsets");
+
+	uint32 slotCount = InternTableGetSlotCount(maxStringCount);
+	table.slots = (intern_table_slot_t*)ArenaAllocateMemoryRegion(arena, slotCount * sizeof(intern_table_slot_t));
+	table.entries = (intern_table_entry_t*)ArenaAllocateMemoryRegion(arena, (maxStringCount + 1) * sizeof(intern_table_entry_t));
+	table.characters = (char*)ArenaAllocateMemoryRegion(arena, maxCharacterCount);
+	memset(table.slots, 0, slotCount * sizeof(intern_table_slot_t));
+	table.entries[INVALID_STRING_ID] = {};
+
+	table.slotMask = slotCount - 1;
+	table.entryCount = 1;
+	table.maxEntryCount = maxStringCount + 1;
+	table.usedCharacterCount = 0;
+	table.maxCharacterCount = maxCharacterCount;
+}
+
+INTERNAL inline String InternTableGetString(string_intern_table_t& table, string_id_t id) {
+	ASSUME(id != INVALID_STRING_ID && id < table.entryCount, "Attempting to look up a string that was never interned");
+	intern_table_entry_t& entry = table.entries[id];
+	String countedString = {
+		.length = entry.length,
+		.buffer = table.characters + entry.offset,
+	};
+	return countedString;
+}
+
+INTERNAL inline bool InternTableSlotMatches(string_intern_table_t& table, intern_table_slot_t& slot, String& text, uint32 hash) {
+	if(slot.hash != hash) return false;
+	intern_table_entry_t& entry = table.entries[slot.id];
+	return entry.length == text.length && memcmp(table.characters + entry.offset, text.buffer, text.length) == 0;
+}
+
+INTERNAL string_id_t InternTableFindWithHash(string_intern_table_t& table, String& text, uint32 hash) {
+	for(uint32 slotIndex = hash & table.slotMask;; slotIndex = (slotIndex + 1) & table.slotMask) {
+		intern_table_slot_t& slot = table.slots[slotIndex];
+		if(slot.id == INVALID_STRING_ID) return INVALID_STRING_ID;
+		if(InternTableSlotMatches(table, slot, text, hash)) return slot.id;
+	}
+}
+
+INTERNAL inline string_id_t InternTableFind(string_intern_table_t& table, String& text) {
+	return InternTableFindWithHash(table, text, StringComputeHash(text));
+}
+
+// Returns the existing ID if the string was already interned (otherwise, a copy is stored and assigned the next ID)
+INTERNAL string_id_t InternTableInsertWithHash(string_intern_table_t& table, String& text, uint32 hash) {
+	uint32 slotIndex = hash & table.slotMask;
+	for(;; slotIndex = (slotIndex + 1) & table.slotMask) {
+		intern_table_slot_t& slot = table.slots[slotIndex];
+		if(slot.id == INVALID_STRING_ID) break;
+		if(InternTableSlotMatches(table, slot, text, hash)) return slot.id;
+	}
+
+	ASSUME(table.entryCount < table.maxEntryCount, "Exceeded the maximum number of interned strings");
+	size_t requiredCharacterCount = text.length + sizeof(ASCII_NULL_TERMINATOR);
+	ASSUME(table.usedCharacterCount + requiredCharacterCount <= table.maxCharacterCount, "Exceeded the interned string storage");
+
+	// NOTE: Stored strings are NULL-terminated as well, so that they can be passed to C APIs directly
+	char* storedCharacters = table.characters + table.usedCharacterCount;
+	memcpy(storedCharacters, text.buffer, text.length);
+	storedCharacters[text.length] = ASCII_NULL_TERMINATOR;
+
+	string_id_t id = table.entryCount++;
+	table.entries[id] = {
+		.offset = (uint32)table.usedCharacterCount,
+		.length = (uint32)text.length,
+	};
+	table.usedCharacterCount += requiredCharacterCount;
+	table.slots[slotIndex] = {
+		.hash = hash,
+		.id = id,
+	};
+	return id;
+}
+
+INTERNAL inline string_id_t InternTableInsert(string_intern_table_t& table, String& text) {
+	return InternTableInsertWithHash(table, text, StringComputeHash(text));
+}
+
+INTERNAL inline uint32 InternTableGetStringCount(string_intern_table_t& table) {
+	return table.entryCount - 1;
+}
\ No newline at end of file
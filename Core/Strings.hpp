@@ -6,48 +6,155 @@ constexpr format_precision_t THREE_DIGITS = 3;
 constexpr format_precision_t FOUR_DIGITS = 4;
 constexpr format_precision_t DEFAULT_PRECISION = TWO_DIGITS;
 
-INTERNAL int DoubleToString(char* buffer, double numberToFormat, format_precision_t precisionInDecimals) {
-	if(numberToFormat < 0) {
-		*buffer++ = '-';
-		numberToFormat = -numberToFormat;
+constexpr char ASCII_NULL_TERMINATOR = '\0';
+constexpr char ASCII_FORWARD_SLASH = '/';
+constexpr char ASCII_BACKWARD_SLASH = '\\';
+constexpr char ASCII_PERIOD_DOT = '.';
+
+constexpr format_precision_t MAX_FORMAT_PRECISION = 9;
+// NOTE: Sufficient for any 64-bit integer or double (including the sign, decimals, exponent, and NULL terminator)
+constexpr size_t MAX_FORMATTED_NUMBER_LENGTH = 32;
+
+GLOBAL const uint64 POWERS_OF_TEN[MAX_FORMAT_PRECISION + 1] = {
+	1ULL,
+	10ULL,
+	100ULL,
+	1000ULL,
+	10000ULL,
+	100000ULL,
+	1000000ULL,
+	10000000ULL,
+	100000000ULL,
+	1000000000ULL,
+};
+
+// NOTE: Emitting two digits per division halves the number of (slow) 64-bit divisions, which dominate the cost
+GLOBAL const char DECIMAL_DIGIT_PAIRS[] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+GLOBAL const char HEXADECIMAL_DIGITS[] = "0123456789ABCDEF";
+
+// Writes exactly digitCount digits (zero-padded) ending right before the given position
+INTERNAL inline char* FormatDigitsBackwards(char* end, uint64 numberToFormat, int digitCount) {
+	while(digitCount >= 2) {
+		uint64 pairIndex = (numberToFormat % 100) * 2;
+		numberToFormat /= 100;
+		*--end = DECIMAL_DIGIT_PAIRS[pairIndex + 1];
+		*--end = DECIMAL_DIGIT_PAIRS[pairIndex];
+		digitCount -= 2;
 	}
+	if(digitCount == 1) *--end = '0' + (char)(numberToFormat % 10);
+	return end;
+}
 
-	uint32 integralPart
-		= (uint32)numberToFormat;
-	double fractionalPart = numberToFormat - (double)integralPart;
+INTERNAL inline int CountDecimalDigits(uint64 numberToFormat) {
+	int digitCount = 1;
+	while(numberToFormat >= 100) {
+		numberToFormat /= 100;
+		digitCount += 2;
+	}
+	return digitCount + (numberToFormat >= 10);
+}
 
-	char scratch[32];
-	int length = 0;
-	do {
-		scratch[length++] = '0' + (int)(integralPart % 10);
-		integralPart
-			/= 10;
-	} while(integralPart
-		> 0);
+INTERNAL int UnsignedToString(char* buffer, uint64 numberToFormat) {
+	int length = CountDecimalDigits(numberToFormat);
+	FormatDigitsBackwards(buffer + length, numberToFormat, length);
+	buffer[length] = ASCII_NULL_TERMINATOR;
+	return length;
+}
+
+INTERNAL int SignedToString(char* buffer, int64 numberToFormat) {
+	if(numberToFormat >= 0) return UnsignedToString(buffer, (uint64)numberToFormat);
+	*buffer = '-';
+	// NOTE: Negating in unsigned arithmetic also works for the lowest value (which has no positive counterpart)
+	return 1 + UnsignedToString(buffer + 1, 0 - (uint64)numberToFormat);
+}
+
+INTERNAL int HexToString(char* buffer, uint64 numberToFormat, int minimumDigitCount) {
+	int length = 1;
+	while(length < 16 && (numberToFormat >> (4 * length)) != 0)
+		++length;
+	length = Max(length, ClampToInterval(minimumDigitCount, 1, 16));
 
 	for(int index = length - 1; index >= 0; --index) {
-		*buffer++ = scratch[index];
+		buffer[index] = HEXADECIMAL_DIGITS[numberToFormat & 0xF];
+		numberToFormat >>= 4;
 	}
+	buffer[length] = ASCII_NULL_TERMINATOR;
+	return length;
+}
 
+INTERNAL int FixedPointToString(char* buffer, uint64 integralPart, uint64 fractionalDigits, format_precision_t precisionInDecimals) {
+	int length = UnsignedToString(buffer, integralPart);
 	if(precisionInDecimals > 0) {
-		*buffer++ = '.';
-		for(int d = 0; d < precisionInDecimals; d++) {
-			fractionalPart *= 10.0;
-			int digit = (int)fractionalPart;
-			*buffer++ = '0' + (char)digit;
-			fractionalPart -= digit;
+		buffer[length++] = ASCII_PERIOD_DOT;
+		length += precisionInDecimals;
+		FormatDigitsBackwards(buffer + length, fractionalDigits, precisionInDecimals);
+	}
+	buffer[length] = ASCII_NULL_TERMINATOR;
+	return length;
+}
+
+// NOTE: Locale-independent and rounded to nearest (ties may differ from printf, which rounds the exact binary value instead)
+INTERNAL int DoubleToString(char* buffer, double numberToFormat, format_precision_t precisionInDecimals) {
+	char* start = buffer;
+	if(isnan(numberToFormat)) {
+		memcpy(buffer, "nan", sizeof("nan"));
+		return (int)(sizeof("nan") - 1);
+	}
+
+	if(numberToFormat < 0) {
+		*buffer++ = '-';
+		numberToFormat = -numberToFormat;
+	}
+
+	if(isinf(numberToFormat)) {
+		memcpy(buffer, "inf", sizeof("inf"));
+		return (int)(buffer - start) + (int)(sizeof("inf") - 1);
+	}
+
+	precisionInDecimals = Min(precisionInDecimals, MAX_FORMAT_PRECISION);
+	uint64 scale = POWERS_OF_TEN[precisionInDecimals];
+	constexpr double FIXED_POINT_LIMIT = 18446744073709551616.0; // 2^64
+	if(numberToFormat < FIXED_POINT_LIMIT) {
+		// NOTE: Splitting off the integral part first is exact, so only the (small) fraction is subject to rounding errors
+		uint64 integralPart = (uint64)numberToFormat;
+		double fractionalPart = numberToFormat - (double)integralPart;
+		uint64 fractionalDigits = (uint64)(fractionalPart * (double)scale + 0.5);
+		if(fractionalDigits >= scale) {
+			integralPart++;
+			fractionalDigits -= scale;
 		}
+		buffer += FixedPointToString(buffer, integralPart, fractionalDigits, precisionInDecimals);
+		return (int)(buffer - start);
 	}
 
-	*buffer = '\0';
-	return (int)(buffer - scratch);
+	// NOTE: Numbers this large are rare enough (and inaccurate anyway) to justify switching to scientific notation here
+	int exponent = 0;
+	while(numberToFormat >= 10.0) {
+		numberToFormat /= 10.0;
+		++exponent;
+	}
+	uint64 mantissa = (uint64)(numberToFormat * (double)scale + 0.5);
+	if(mantissa >= 10 * scale) {
+		mantissa /= 10;
+		++exponent;
+	}
+	buffer += FixedPointToString(buffer, mantissa / scale, mantissa % scale, precisionInDecimals);
+	*buffer++ = 'e';
+	*buffer++ = '+';
+	buffer += UnsignedToString(buffer, (uint64)exponent);
+	return (int)(buffer - start);
 }
 
-constexpr char ASCII_NULL_TERMINATOR = '\0';
-constexpr char ASCII_FORWARD_SLASH = '/';
-constexpr char ASCII_BACKWARD_SLASH = '\\';
-constexpr char ASCII_PERIOD_DOT = '.';
-
 typedef struct counted_string {
 	size_t length;
 	union {
@@ -58,11 +165,50 @@ typedef struct counted_string {
 
 typedef counted_string_t String;
 
-INTERNAL size_t StringLength(const char* nullTerminatedString) {
+constexpr size_t STRING_INDEX_NOT_FOUND = (size_t)-1;
+
+// NOTE: Aligned loads can't cross a page boundary, so scanning past the terminator (or before the start) will never fault
+// The address sanitizer still reports those bytes as out of bounds, which is why it's disabled for these functions
+#ifdef RAGLITE_INTRINSICS_AVX2
+RAGLITE_TARGET_AVX2 RAGLITE_NO_SANITIZE_ADDRESS INTERNAL size_t StringLengthAVX2(const char* nullTerminatedString) {
+	size_t misalignment = (size_t)nullTerminatedString & 31;
+	const char* chunk = nullTerminatedString - misalignment;
+	__m256i zero = _mm256_setzero_si256();
+	uint32 mask = (uint32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256((const __m256i*)chunk), zero));
+	mask >>= misalignment; // Bytes before the start of the string
+	if(mask != 0) return IntrinsicsFindLowestSetBit(mask);
+
+	while(true) {
+		chunk += 32;
+		mask = (uint32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256((const __m256i*)chunk), zero));
+		if(mask != 0) return (size_t)(chunk - nullTerminatedString) + IntrinsicsFindLowestSetBit(mask);
+	}
+}
+#endif
+
+RAGLITE_NO_SANITIZE_ADDRESS INTERNAL size_t StringLength(const char* nullTerminatedString) {
+#ifdef RAGLITE_INTRINSICS_AVX2
+	if(IntrinsicsSupportsAVX2()) return StringLengthAVX2(nullTerminatedString);
+#endif
+#ifdef RAGLITE_INTRINSICS_SSE2
+	size_t misalignment = (size_t)nullTerminatedString & 15;
+	const char* chunk = nullTerminatedString - misalignment;
+	__m128i zero = _mm_setzero_si128();
+	uint32 mask = (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i*)chunk), zero));
+	mask >>= misalignment; // Bytes before the start of the string
+	if(mask != 0) return IntrinsicsFindLowestSetBit(mask);
+
+	while(true) {
+		chunk += 16;
+		mask = (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i*)chunk), zero));
+		if(mask != 0) return (size_t)(chunk - nullTerminatedString) + IntrinsicsFindLowestSetBit(mask);
+	}
+#else
 	size_t length = 0;
 	while(nullTerminatedString[length] != ASCII_NULL_TERMINATOR)
 		++length;
 	return length;
+#endif
 }
 
 inline void StringEnsureNullTermination(String& countedString) {
@@ -95,41 +241,232 @@ String StringCreateFromSlice(uint8* byteArray, size_t length) {
 	(char*)(nullTerminatedStringLiteral),                                \
 }
 
+#ifdef RAGLITE_INTRINSICS_AVX2
+RAGLITE_TARGET_AVX2 INTERNAL size_t StringFindLastOfEitherAVX2(String& text, size_t& remainingLength, char first, char second) {
+	__m256i firstCharacters = _mm256_set1_epi8(first);
+	__m256i secondCharacters = _mm256_set1_epi8(second);
+	while(remainingLength >= 32) {
+		__m256i characters = _mm256_loadu_si256((const __m256i*)(text.buffer + remainingLength - 32));
+		__m256i matches = _mm256_or_si256(_mm256_cmpeq_epi8(characters, firstCharacters), _mm256_cmpeq_epi8(characters, secondCharacters));
+		uint32 mask = (uint32)_mm256_movemask_epi8(matches);
+		if(mask != 0) return remainingLength - 32 + IntrinsicsFindHighestSetBit(mask);
+		remainingLength -= 32;
+	}
+	return STRING_INDEX_NOT_FOUND;
+}
+#endif
+
+// Scans backwards (in bulk) since path components of interest are usually near the end
+INTERNAL size_t StringFindLastOfEither(String& text, char first, char second) {
+	size_t remainingLength = text.length;
+#ifdef RAGLITE_INTRINSICS_AVX2
+	if(IntrinsicsSupportsAVX2()) {
+		size_t index = StringFindLastOfEitherAVX2(text, remainingLength, first, second);
+		if(index != STRING_INDEX_NOT_FOUND) return index;
+	}
+#endif
+#ifdef RAGLITE_INTRINSICS_SSE2
+	__m128i firstCharacters = _mm_set1_epi8(first);
+	__m128i secondCharacters = _mm_set1_epi8(second);
+	while(remainingLength >= 16) {
+		__m128i characters = _mm_loadu_si128((const __m128i*)(text.buffer + remainingLength - 16));
+		__m128i matches = _mm_or_si128(_mm_cmpeq_epi8(characters, firstCharacters), _mm_cmpeq_epi8(characters, secondCharacters));
+		uint32 mask = (uint32)_mm_movemask_epi8(matches);
+		if(mask != 0) return remainingLength - 16 + IntrinsicsFindHighestSetBit(mask);
+		remainingLength -= 16;
+	}
+#endif
+	while(remainingLength > 0) {
+		char charAt = text.buffer[--remainingLength];
+		if(charAt == first || charAt == second) return remainingLength;
+	}
+	return STRING_INDEX_NOT_FOUND;
+}
+
+INTERNAL inline size_t StringFindLastOf(String& text, char character) {
+	return StringFindLastOfEither(text, character, character);
+}
+
+INTERNAL inline size_t PathStringFindLastSeparator(String& fileSystemPath) {
+	return StringFindLastOfEither(fileSystemPath, ASCII_FORWARD_SLASH, ASCII_BACKWARD_SLASH);
+}
+
 INTERNAL void PathStringToBaseNameInPlace(String& fileSystemPath) {
 	if(fileSystemPath.length == 0 || fileSystemPath.buffer == NULL) return;
 
-	for(size_t baseNameStartIndex = fileSystemPath.length; baseNameStartIndex > 0; --baseNameStartIndex) {
-		char charAt = fileSystemPath.buffer[baseNameStartIndex - 1];
-		if(charAt == ASCII_FORWARD_SLASH || charAt == ASCII_BACKWARD_SLASH) {
-			fileSystemPath.buffer += baseNameStartIndex;
-			fileSystemPath.length -= baseNameStartIndex;
-			StringEnsureNullTermination(fileSystemPath);
-			return;
-		}
-	}
+	size_t separatorIndex = PathStringFindLastSeparator(fileSystemPath);
+	if(separatorIndex == STRING_INDEX_NOT_FOUND) return;
+
+	size_t baseNameStartIndex = separatorIndex + 1;
+	fileSystemPath.buffer += baseNameStartIndex;
+	fileSystemPath.length -= baseNameStartIndex;
+	StringEnsureNullTermination(fileSystemPath);
 }
 
 INTERNAL void PathStringStripFileExtensionInPlace(String& fileSystemPath) {
-	size_t length = fileSystemPath.length;
-	for(size_t offset = 0; offset < length; ++offset) {
-		size_t lastScannedCharIndex = length - offset - 1;
-		char charAt = fileSystemPath.bytes[lastScannedCharIndex];
-		if(charAt == ASCII_PERIOD_DOT) {
-			fileSystemPath.length = lastScannedCharIndex;
-			StringEnsureNullTermination(fileSystemPath);
-			return;
-		}
+	size_t extensionStartIndex = StringFindLastOf(fileSystemPath, ASCII_PERIOD_DOT);
+	if(extensionStartIndex == STRING_INDEX_NOT_FOUND) return;
+
+	fileSystemPath.length = extensionStartIndex;
+	StringEnsureNullTermination(fileSystemPath);
+}
+
+constexpr char ASCII_CASE_BIT = 0x20;
+
+INTERNAL inline char CharacterToLowerCase(char character) {
+	bool isUpperCase = (uint8)(character - 'A') < 26;
+	return isUpperCase ? (char)(character | ASCII_CASE_BIT) : character;
+}
+
+// NOTE: Multi-byte characters always have the high bit set in their first byte (but CP949 trail bytes may be plain ASCII)
+INTERNAL bool StringIsASCII(String& text) {
+	size_t index = 0;
+#ifdef RAGLITE_INTRINSICS_SSE2
+	for(; index + 16 <= text.length; index += 16) {
+		if(_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(text.buffer + index))) != 0) return false;
+	}
+#endif
+	for(; index < text.length; ++index) {
+		if((uint8)text.buffer[index] & 0x80) return false;
 	}
+	return true;
 }
 
-INTERNAL void StringAppend(String& prefix, const char* suffix) {
-	size_t suffixLength = StringLength(suffix);
-	// TODO: Assumes there's enough space to safely append - revisit later
-	size_t lastIndex = prefix.length;
-	for(size_t appendedByteCount = 0; appendedByteCount < suffixLength; ++appendedByteCount) {
-		prefix.buffer[lastIndex + appendedByteCount] = suffix[appendedByteCount];
-		prefix.length++;
+// NOTE: Only ASCII letters are affected - CP949 trail bytes may overlap with them, so don't use this on non-ASCII (Korean) text
+#ifdef RAGLITE_INTRINSICS_SSE2
+INTERNAL inline __m128i StringToLowerCaseSSE2(__m128i characters) {
+	// Shifting 'A' to the lowest signed value means a single (signed) comparison can detect the entire range of letters
+	__m128i shiftedCharacters = _mm_add_epi8(characters, _mm_set1_epi8((char)(128 - 'A')));
+	__m128i isUpperCase = _mm_cmplt_epi8(shiftedCharacters, _mm_set1_epi8((char)(-128 + 26)));
+	return _mm_or_si128(characters, _mm_and_si128(isUpperCase, _mm_set1_epi8(ASCII_CASE_BIT)));
+}
+#endif
+
+#ifdef RAGLITE_INTRINSICS_AVX2
+RAGLITE_TARGET_AVX2 INTERNAL inline __m256i StringToLowerCaseAVX2(__m256i characters) {
+	__m256i shiftedCharacters = _mm256_add_epi8(characters, _mm256_set1_epi8((char)(128 - 'A')));
+	__m256i isUpperCase = _mm256_cmpgt_epi8(_mm256_set1_epi8((char)(-128 + 26)), shiftedCharacters);
+	return _mm256_or_si256(characters, _mm256_and_si256(isUpperCase, _mm256_set1_epi8(ASCII_CASE_BIT)));
+}
+
+// Returns the number of bytes compared (or STRING_INDEX_NOT_FOUND if they weren't equal)
+RAGLITE_TARGET_AVX2 INTERNAL size_t StringEqualsIgnoreCaseAVX2(String& first, String& second) {
+	size_t index = 0;
+	for(; index + 32 <= first.length; index += 32) {
+		__m256i firstCharacters = StringToLowerCaseAVX2(_mm256_loadu_si256((const __m256i*)(first.buffer + index)));
+		__m256i secondCharacters = StringToLowerCaseAVX2(_mm256_loadu_si256((const __m256i*)(second.buffer + index)));
+		uint32 mask = (uint32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(firstCharacters, secondCharacters));
+		if(mask != 0xFFFFFFFF) return STRING_INDEX_NOT_FOUND;
 	}
+	return index;
+}
+
+RAGLITE_TARGET_AVX2 INTERNAL size_t StringLowerCaseAndReplaceInPlaceAVX2(String& text, char original, char replacement) {
+	__m256i originalCharacters = _mm256_set1_epi8(original);
+	__m256i replacementCharacters = _mm256_set1_epi8(replacement);
+	size_t index = 0;
+	for(; index + 32 <= text.length; index += 32) {
+		__m256i characters = StringToLowerCaseAVX2(_mm256_loadu_si256((const __m256i*)(text.buffer + index)));
+		characters = _mm256_blendv_epi8(characters, replacementCharacters, _mm256_cmpeq_epi8(characters, originalCharacters));
+		_mm256_storeu_si256((__m256i*)(text.buffer + index), characters);
+	}
+	return index;
+}
+#endif
+
+INTERNAL bool StringEqualsIgnoreCase(String& first, String& second) {
+	if(first.length != second.length) return false;
+
+	size_t index = 0;
+#ifdef RAGLITE_INTRINSICS_AVX2
+	if(IntrinsicsSupportsAVX2()) {
+		index = StringEqualsIgnoreCaseAVX2(first, second);
+		if(index == STRING_INDEX_NOT_FOUND) return false;
+	}
+#endif
+#ifdef RAGLITE_INTRINSICS_SSE2
+	for(; index + 16 <= first.length; index += 16) {
+		__m128i firstCharacters = StringToLowerCaseSSE2(_mm_loadu_si128((const __m128i*)(first.buffer + index)));
+		__m128i secondCharacters = StringToLowerCaseSSE2(_mm_loadu_si128((const __m128i*)(second.buffer + index)));
+		if(_mm_movemask_epi8(_mm_cmpeq_epi8(firstCharacters, secondCharacters)) != 0xFFFF) return false;
+	}
+#endif
+	for(; index < first.length; ++index) {
+		if(CharacterToLowerCase(first.buffer[index]) != CharacterToLowerCase(second.buffer[index])) return false;
+	}
+	return true;
+}
+
+// Replacement happens after lowercasing, so the original character should be lowercase (or not a letter at all)
+INTERNAL void StringLowerCaseAndReplaceInPlace(String& text, char original, char replacement) {
+	size_t index = 0;
+#ifdef RAGLITE_INTRINSICS_AVX2
+	if(IntrinsicsSupportsAVX2()) index = StringLowerCaseAndReplaceInPlaceAVX2(text, original, replacement);
+#endif
+#ifdef RAGLITE_INTRINSICS_SSE2
+	__m128i originalCharacters = _mm_set1_epi8(original);
+	__m128i replacementCharacters = _mm_set1_epi8(replacement);
+	for(; index + 16 <= text.length; index += 16) {
+		__m128i characters = StringToLowerCaseSSE2(_mm_loadu_si128((const __m128i*)(text.buffer + index)));
+		__m128i isOriginal = _mm_cmpeq_epi8(characters, originalCharacters);
+		characters = _mm_or_si128(_mm_andnot_si128(isOriginal, characters), _mm_and_si128(isOriginal, replacementCharacters));
+		_mm_storeu_si128((__m128i*)(text.buffer + index), characters);
+	}
+#endif
+	for(; index < text.length; ++index) {
+		char character = CharacterToLowerCase(text.buffer[index]);
+		text.buffer[index] = (character == original) ? replacement : character;
+	}
+}
+
+INTERNAL inline void StringToLowerCaseInPlace(String& text) {
+	StringLowerCaseAndReplaceInPlace(text, ASCII_NULL_TERMINATOR, ASCII_NULL_TERMINATOR);
+}
+
+INTERNAL size_t PathStringFindDuplicateSeparator(String& fileSystemPath) {
+	size_t index = 0;
+#ifdef RAGLITE_INTRINSICS_SSE2
+	__m128i separators = _mm_set1_epi8(ASCII_FORWARD_SLASH);
+	for(; index + 17 <= fileSystemPath.length; index += 16) {
+		__m128i characters = _mm_loadu_si128((const __m128i*)(fileSystemPath.buffer + index));
+		__m128i nextCharacters = _mm_loadu_si128((const __m128i*)(fileSystemPath.buffer + index + 1));
+		__m128i isDuplicate = _mm_and_si128(_mm_cmpeq_epi8(characters, separators), _mm_cmpeq_epi8(nextCharacters, separators));
+		uint32 mask = (uint32)_mm_movemask_epi8(isDuplicate);
+		if(mask != 0) return index + IntrinsicsFindLowestSetBit(mask);
+	}
+#endif
+	for(; index + 1 < fileSystemPath.length; ++index) {
+		if(fileSystemPath.buffer[index] == ASCII_FORWARD_SLASH && fileSystemPath.buffer[index + 1] == ASCII_FORWARD_SLASH) return index;
+	}
+	return STRING_INDEX_NOT_FOUND;
+}
+
+// Archive paths are case-insensitive and use both kinds of separators (sometimes even duplicated), so they need to be normalized
+INTERNAL void PathStringNormalizeInPlace(String& fileSystemPath) {
+	StringLowerCaseAndReplaceInPlace(fileSystemPath, ASCII_BACKWARD_SLASH, ASCII_FORWARD_SLASH);
+
+	size_t duplicateIndex = PathStringFindDuplicateSeparator(fileSystemPath);
+	if(duplicateIndex == STRING_INDEX_NOT_FOUND) return;
+
+	// NOTE: Duplicates are rare, so compacting the remainder one byte at a time is fine
+	size_t writeIndex = duplicateIndex + 1;
+	for(size_t readIndex = duplicateIndex + 2; readIndex < fileSystemPath.length; ++readIndex) {
+		char character = fileSystemPath.buffer[readIndex];
+		if(character == ASCII_FORWARD_SLASH && fileSystemPath.buffer[writeIndex - 1] == ASCII_FORWARD_SLASH) continue;
+		fileSystemPath.buffer[writeIndex++] = character;
+	}
+	fileSystemPath.length = writeIndex;
+}
+
+// NOTE: The capacity refers to the entire buffer (including the NULL terminator) - the suffix is truncated if it doesn't fit
+INTERNAL bool StringAppend(String& prefix, size_t capacity, const char* suffix) {
+	ASSUME(prefix.length < capacity, "Attempting to append to a string that already exceeds its capacity");
+	size_t suffixLength = StringLength(suffix);
+	size_t remainingCapacity = capacity - prefix.length - sizeof(ASCII_NULL_TERMINATOR);
+	size_t appendedByteCount = Min(suffixLength, remainingCapacity);
+	memcpy(prefix.buffer + prefix.length, suffix, appendedByteCount);
+	prefix.length += appendedByteCount;
 
 	StringEnsureNullTermination(prefix);
+	return appendedByteCount == suffixLength;
 }
\ No newline at end of file
@@ -0,0 +1,128 @@
+// NOTE: Native replacement for iconv.convert(..., "CP949", "UTF-8") - most assets were authored on Korean systems, so their paths use CP949
+#include "CodePages/CP949.hpp"
+
+constexpr uint32 UNICODE_REPLACEMENT_CHARACTER = 0xFFFD;
+// Double-byte characters never need more than three bytes, but invalid single bytes are replaced with U+FFFD (which does)
+constexpr size_t UTF8_MAX_BYTES_PER_CP949_BYTE = 3;
+
+INTERNAL inline size_t TranscodeGetMaxUTF8Length(size_t inputLength) {
+	return inputLength * UTF8_MAX_BYTES_PER_CP949_BYTE;
+}
+
+// CP949 only maps to the Basic Multilingual Plane, so four-byte sequences are never needed here
+INTERNAL inline uint8* TranscodeWriteUTF8(uint8* output, uint32 codePoint) {
+	if(codePoint < 0x80) {
+		output[0] = (uint8)codePoint;
+		return output + 1;
+	}
+
+	if(codePoint < 0x800) {
+		output[0] = (uint8)(0xC0 | (codePoint >> 6));
+		output[1] = (uint8)(0x80 | (codePoint & 0x3F));
+		return output + 2;
+	}
+
+	output[0] = (uint8)(0xE0 | (codePoint >> 12));
+	output[1] = (uint8)(0x80 | ((codePoint >> 6) & 0x3F));
+	output[2] = (uint8)(0x80 | (codePoint & 0x3F));
+	return output + 3;
+}
+
+// NOTE: Blocks are stored before they're checked, so the output may be written past the ASCII run (but never past the input length)
+#ifdef RAGLITE_INTRINSICS_AVX2
+RAGLITE_TARGET_AVX2 INTERNAL size_t TranscodeCopyASCIIAVX2(const uint8* input, size_t length, uint8* output) {
+	size_t index = 0;
+	for(; index + 32 <= length; index += 32) {
+		__m256i characters = _mm256_loadu_si256((const __m256i*)(input + index));
+		_mm256_storeu_si256((__m256i*)(output + index), characters);
+		uint32 mask = (uint32)_mm256_movemask_epi8(characters);
+		if(mask != 0) return index + IntrinsicsFindLowestSetBit(mask);
+	}
+	return index;
+}
+#endif
+
+// Returns the length of the ASCII run at the start of the input (it's copied as-is, since ASCII is also valid UTF-8)
+INTERNAL size_t TranscodeCopyASCII(const uint8* input, size_t length, uint8* output) {
+	size_t index = 0;
+#ifdef RAGLITE_INTRINSICS_AVX2
+	if(IntrinsicsSupportsAVX2()) index = TranscodeCopyASCIIAVX2(input, length, output);
+#endif
+#ifdef RAGLITE_INTRINSICS_SSE2
+	for(; index + 16 <= length; index += 16) {
+		__m128i characters = _mm_loadu_si128((const __m128i*)(input + index));
+		_mm_storeu_si128((__m128i*)(output + index), characters);
+		uint32 mask = (uint32)_mm_movemask_epi8(characters);
+		if(mask != 0) return index + IntrinsicsFindLowestSetBit(mask);
+	}
+#endif
+	for(; index < length && input[index] < 0x80; ++index)
+		output[index] = input[index];
+	return index;
+}
+
+// Returns the number of bytes written - the output must be able to hold TranscodeGetMaxUTF8Length(inputLength) bytes
+INTERNAL size_t TranscodeCP949ToUTF8(const uint8* input, size_t inputLength, uint8* output) {
+	const uint8* inputEnd = input + inputLength;
+	uint8* outputStart = output;
+	while(input < inputEnd) {
+		if(input[0] < 0x80) {
+			size_t copiedLength = TranscodeCopyASCII(input, inputEnd - input, output);
+			input += copiedLength;
+			output += copiedLength;
+			continue;
+		}
+
+		// Invalid (or user-defined) sequences only consume the first byte, same as the reference decoders
+		uint32 codePoint = UNICODE_REPLACEMENT_CHARACTER;
+		size_t consumedLength = 1;
+		uint8 leadByte = input[0];
+		if(leadByte >= CP949_FIRST_LEAD_BYTE && leadByte <= CP949_LAST_LEAD_BYTE && inputEnd - input >= 2) {
+			uint8 trailByte = input[1];
+			if(trailByte >= CP949_FIRST_TRAIL_BYTE && trailByte <= CP949_LAST_TRAIL_BYTE) {
+				uint16 mappedCodePoint = CP949_DOUBLE_BYTE_CODE_POINTS[(leadByte - CP949_FIRST_LEAD_BYTE) * CP949_TRAIL_BYTE_COUNT + (trailByte - CP949_FIRST_TRAIL_BYTE)];
+				if(mappedCodePoint != 0) {
+					codePoint = mappedCodePoint;
+					consumedLength = 2;
+				}
+			}
+		}
+
+		output = TranscodeWriteUTF8(output, codePoint);
+		input += consumedLength;
+	}
+	return output - outputStart;
+}
+
+// NOTE: Transcodes straight into the arena's free space, then only claims what was actually used (most paths barely grow)
+INTERNAL String TranscodeCP949ToUTF8(memory_arena_t& arena, String text) {
+	size_t maxLength = TranscodeGetMaxUTF8Length(text.length) + sizeof(ASCII_NULL_TERMINATOR);
+	ASSUME(ArenaCanAllocate(arena, maxLength), "Insufficient memory to transcode the string");
+
+	uint8* output = (uint8*)arena.baseAddress + arena.used;
+	size_t length = TranscodeCP949ToUTF8(text.bytes, text.length, output);
+	output[length] = ASCII_NULL_TERMINATOR;
+	ArenaAllocateMemoryRegion(arena, length + sizeof(ASCII_NULL_TERMINATOR));
+	return StringCreateFromSlice(output, length);
+}
+
+// Converts an entire list at once (e.g., a file table) - the results are stored back-to-back and may replace the inputs
+INTERNAL size_t TranscodeCP949ToUTF8Batch(const String* texts, String* transcodedTexts, size_t count, memory_arena_t& arena) {
+	size_t maxLength = 0;
+	for(size_t index = 0; index < count; ++index)
+		maxLength += TranscodeGetMaxUTF8Length(texts[index].length) + sizeof(ASCII_NULL_TERMINATOR);
+	ASSUME(ArenaCanAllocate(arena, maxLength), "Insufficient memory to transcode the strings");
+
+	uint8* outputStart = (uint8*)arena.baseAddress + arena.used;
+	uint8* output = outputStart;
+	for(size_t index = 0; index < count; ++index) {
+		size_t length = TranscodeCP949ToUTF8(texts[index].bytes, texts[index].length, output);
+		output[length] = ASCII_NULL_TERMINATOR;
+		transcodedTexts[index] = StringCreateFromSlice(output, length);
+		output += length + sizeof(ASCII_NULL_TERMINATOR);
+	}
+
+	size_t usedLength = output - outputStart;
+	ArenaAllocateMemoryRegion(arena, usedLength);
+	return usedLength;
+}
\ No newline at end of file
@@ -0,0 +1,369 @@
+typedef enum : uint8 {
+	UPSCALE_NEAREST_NEIGHBOR,
+	UPSCALE_INTEGER_MULTIPLE,
+	UPSCALE_BILINEAR_FILTERED,
+	UPSCALE_MODE_COUNT,
+} upscaling_mode_t;
+
+INTERNAL const char* UpscalingModeToString(upscaling_mode_t mode) {
+	switch(mode) {
+		case UPSCALE_NEAREST_NEIGHBOR:
+			return "Nearest Neighbor";
+		case UPSCALE_INTEGER_MULTIPLE:
+			return "Integer Multiple";
+		case UPSCALE_BILINEAR_FILTERED:
+			return "Bilinear";
+		default:
+			return "N/A";
+	}
+}
+
+constexpr int MAX_UPSCALED_WIDTH = 8192;
+constexpr int BILINEAR_WEIGHT_BITS = 7; // Keeps all intermediate products within 16-bit lanes
+constexpr uint32 LETTERBOX_COLOR = 0xFF000000;
+
+typedef struct upscaling_workspace {
+	int32 leftColumns[MAX_UPSCALED_WIDTH];
+	int32 rightColumns[MAX_UPSCALED_WIDTH];
+	int32 weightPairs[MAX_UPSCALED_WIDTH]; // Same 16-bit weight in both halves (for unpacking)
+	uint32 filteredRow[MAX_UPSCALED_WIDTH];
+} upscaling_workspace_t;
+
+GLOBAL upscaling_workspace_t UPSCALING_WORKSPACE = {};
+
+INTERNAL inline int32 UpscalingGetSamplePosition(int destinationIndex, int sourceSize, int destinationSize) {
+	// NOTE: Pixel centers are aligned, in 16.16 fixed point (so that both edges are sampled symmetrically)
+	int64 position = (((int64)(2 * destinationIndex + 1) * sourceSize) << 16) / (2 * (int64)destinationSize) - 0x8000;
+	return (int32)Max(position, (int64)0);
+}
+
+INTERNAL inline uint32 UpscalingLerpChannels(uint32 first, uint32 second, int weight) {
+	uint32 result = 0;
+	for(int shift = 0; shift < 32; shift += 8) {
+		int a = (first >> shift) & 0xFF;
+		int b = (second >> shift) & 0xFF;
+		result |= (uint32)(a + (((b - a) * weight) >> BILINEAR_WEIGHT_BITS)) << shift;
+	}
+	return result;
+}
+
+#ifdef RAGLITE_INTRINSICS_SSE2
+INTERNAL inline __m128i UpscalingLerpPixelsSSE2(__m128i first, __m128i second, __m128i weightsLow, __m128i weightsHigh) {
+	__m128i zero = _mm_setzero_si128();
+	__m128i firstLow = _mm_unpacklo_epi8(first, zero);
+	__m128i firstHigh = _mm_unpackhi_epi8(first, zero);
+	__m128i deltaLow = _mm_sub_epi16(_mm_unpacklo_epi8(second, zero), firstLow);
+	__m128i deltaHigh = _mm_sub_epi16(_mm_unpackhi_epi8(second, zero), firstHigh);
+	__m128i resultLow = _mm_add_epi16(firstLow, _mm_srai_epi16(_mm_mullo_epi16(deltaLow, weightsLow), BILINEAR_WEIGHT_BITS));
+	__m128i resultHigh = _mm_add_epi16(firstHigh, _mm_srai_epi16(_mm_mullo_epi16(deltaHigh, weightsHigh), BILINEAR_WEIGHT_BITS));
+	return _mm_packus_epi16(resultLow, resultHigh);
+}
+#endif
+
+#ifdef RAGLITE_INTRINSICS_AVX2
+RAGLITE_TARGET_AVX2 INTERNAL inline __m256i UpscalingLerpPixelsAVX2(__m256i first, __m256i second, __m256i weightsLow, __m256i weightsHigh) {
+	// NOTE: Unpacking and packing both operate within 128-bit lanes, so the pixel order is preserved
+	__m256i zero = _mm256_setzero_si256();
+	__m256i firstLow = _mm256_unpacklo_epi8(first, zero);
+	__m256i firstHigh = _mm256_unpackhi_epi8(first, zero);
+	__m256i deltaLow = _mm256_sub_epi16(_mm256_unpacklo_epi8(second, zero), firstLow);
+	__m256i deltaHigh = _mm256_sub_epi16(_mm256_unpackhi_epi8(second, zero), firstHigh);
+	__m256i resultLow = _mm256_add_epi16(firstLow, _mm256_srai_epi16(_mm256_mullo_epi16(deltaLow, weightsLow), BILINEAR_WEIGHT_BITS));
+	__m256i resultHigh = _mm256_add_epi16(firstHigh, _mm256_srai_epi16(_mm256_mullo_epi16(deltaHigh, weightsHigh), BILINEAR_WEIGHT_BITS));
+	return _mm256_packus_epi16(resultLow, resultHigh);
+}
+
+RAGLITE_TARGET_AVX2 INTERNAL int UpscalingGatherRowAVX2(const uint32* source, uint32* destination, const int32* columns, int count) {
+	int index = 0;
+	for(; index + 8 <= count; index += 8) {
+		__m256i indices = _mm256_loadu_si256((__m256i*)(columns + index));
+		__m256i pixels = _mm256_i32gather_epi32((const int*)source, indices, sizeof(uint32));
+		_mm256_storeu_si256((__m256i*)(destination + index), pixels);
+	}
+	return index;
+}
+
+RAGLITE_TARGET_AVX2 INTERNAL int UpscalingLerpRowsAVX2(const uint32* first, const uint32* second, uint32* destination, int count, int weight) {
+	__m256i weights = _mm256_set1_epi16((int16)weight);
+	int index = 0;
+	for(; index + 8 <= count; index += 8) {
+		__m256i firstPixels = _mm256_loadu_si256((__m256i*)(first + index));
+		__m256i secondPixels = _mm256_loadu_si256((__m256i*)(second + index));
+		_mm256_storeu_si256((__m256i*)(destination + index), UpscalingLerpPixelsAVX2(firstPixels, secondPixels, weights, weights));
+	}
+	return index;
+}
+
+RAGLITE_TARGET_AVX2 INTERNAL int UpscalingLerpColumnsAVX2(const uint32* source, uint32* destination, upscaling_workspace_t& workspace, int count) {
+	int index = 0;
+	for(; index + 8 <= count; index += 8) {
+		__m256i leftPixels = _mm256_i32gather_epi32((const int*)source, _mm256_loadu_si256((__m256i*)(workspace.leftColumns + index)), sizeof(uint32));
+		__m256i rightPixels = _mm256_i32gather_epi32((const int*)source, _mm256_loadu_si256((__m256i*)(workspace.rightColumns + index)), sizeof(uint32));
+		__m256i weights = _mm256_loadu_si256((__m256i*)(workspace.weightPairs + index));
+		__m256i weightsLow = _mm256_unpacklo_epi32(weights, weights);
+		__m256i weightsHigh = _mm256_unpackhi_epi32(weights, weights);
+		_mm256_storeu_si256((__m256i*)(destination + index), UpscalingLerpPixelsAVX2(leftPixels, rightPixels, weightsLow, weightsHigh));
+	}
+	return index;
+}
+#endif
+
+INTERNAL void UpscalingGatherRow(const uint32* source, uint32* destination, const int32* columns, int count) {
+	int index = 0;
+#ifdef RAGLITE_INTRINSICS_AVX2
+	if(IntrinsicsSupportsAVX2()) index = UpscalingGatherRowAVX2(source, destination, columns, count);
+#endif
+#ifdef RAGLITE_INTRINSICS_SSE2
+	for(; index + 4 <= count; index += 4) {
+		__m128i pixels = _mm_setr_epi32((int)source[columns[index]], (int)source[columns[index + 1]], (int)source[columns[index + 2]], (int)source[columns[index + 3]]);
+		_mm_storeu_si128((__m128i*)(destination + index), pixels);
+	}
+#endif
+	for(; index < count; ++index)
+		destination[index] = source[columns[index]];
+}
+
+INTERNAL void UpscalingLerpRows(const uint32* first, const uint32* second, uint32* destination, int count, int weight) {
+	int index = 0;
+	if(weight == 0) {
+		memcpy(destination, first, count * sizeof(uint32));
+		return;
+	}
+
+#ifdef RAGLITE_INTRINSICS_AVX2
+	if(IntrinsicsSupportsAVX2()) index = UpscalingLerpRowsAVX2(first, second, destination, count, weight);
+#endif
+#ifdef RAGLITE_INTRINSICS_SSE2
+	__m128i weights = _mm_set1_epi16((int16)weight);
+	for(; index + 4 <= count; index += 4) {
+		__m128i firstPixels = _mm_loadu_si128((__m128i*)(first + index));
+		__m128i secondPixels = _mm_loadu_si128((__m128i*)(second + index));
+		_mm_storeu_si128((__m128i*)(destination + index), UpscalingLerpPixelsSSE2(firstPixels, secondPixels, weights, weights));
+	}
+#endif
+	for(; index < count; ++index)
+		destination[index] = UpscalingLerpChannels(first[index], second[index], weight);
+}
+
+INTERNAL void UpscalingLerpColumns(const uint32* source, uint32* destination, upscaling_workspace_t& workspace, int count) {
+	int index = 0;
+#ifdef RAGLITE_INTRINSICS_AVX2
+	if(IntrinsicsSupportsAVX2()) index = UpscalingLerpColumnsAVX2(source, destination, workspace, count);
+#endif
+#ifdef RAGLITE_INTRINSICS_SSE2
+	for(; index + 4 <= count; index += 4) {
+		const int32* left = workspace.leftColumns + index;
+		const int32* right = workspace.rightColumns + index;
+		__m128i leftPixels = _mm_setr_epi32((int)source[left[0]], (int)source[left[1]], (int)source[left[2]], (int)source[left[3]]);
+		__m128i rightPixels = _mm_setr_epi32((int)source[right[0]], (int)source[right[1]], (int)source[right[2]], (int)source[right[3]]);
+		__m128i weights = _mm_loadu_si128((__m128i*)(workspace.weightPairs + index));
+		__m128i weightsLow = _mm_unpacklo_epi32(weights, weights);
+		__m128i weightsHigh = _mm_unpackhi_epi32(weights, weights);
+		_mm_storeu_si128((__m128i*)(destination + index), UpscalingLerpPixelsSSE2(leftPixels, rightPixels, weightsLow, weightsHigh));
+	}
+#endif
+	for(; index < count; ++index) {
+		int weight = workspace.weightPairs[index] & 0xFFFF;
+		destination[index] = UpscalingLerpChannels(source[workspace.leftColumns[index]], source[workspace.rightColumns[index]], weight);
+	}
+}
+
+INTERNAL void UpscalingReplicateRow(const uint32* source, uint32* destination, int count, int factor) {
+	if(factor == 1) {
+		memcpy(destination, source, count * sizeof(uint32));
+		return;
+	}
+
+	int index = 0;
+#ifdef RAGLITE_INTRINSICS_SSE2
+	if(factor == 2) {
+		for(; index + 4 <= count; index += 4) {
+			__m128i pixels = _mm_loadu_si128((__m128i*)(source + index));
+			_mm_storeu_si128((__m128i*)(destination + 2 * index), _mm_unpacklo_epi32(pixels, pixels));
+			_mm_storeu_si128((__m128i*)(destination + 2 * index + 4), _mm_unpackhi_epi32(pixels, pixels));
+		}
+	}
+#endif
+	for(; index < count; ++index) {
+		uint32* replicas = destination + index * factor;
+		for(int replica = 0; replica < factor; ++replica)
+			replicas[replica] = source[index];
+	}
+}
+
+INTERNAL inline uint32* BitmapGetRowAddress(offscreen_buffer_t& bitmap, int y) {
+	return (uint32*)((uint8*)bitmap.pixelBuffer + (size_t)y * (size_t)bitmap.stride);
+}
+
+INTERNAL void BitmapGetDirtyRowRange(offscreen_buffer_t& bitmap, int& top, int& bottom) {
+	top = bitmap.height;
+	bottom = 0;
+	for(int index = 0; index < bitmap.dirtyRegions.count; ++index) {
+		top = Min(top, bitmap.dirtyRegions.rectangles[index].top);
+		bottom = Max(bottom, bitmap.dirtyRegions.rectangles[index].bottom);
+	}
+}
+
+INTERNAL void BitmapUpscaleIntegerMultiple(offscreen_buffer_t& source, offscreen_buffer_t& destination, int sourceTop, int sourceBottom) {
+	int factor = Max(1, Min(destination.width / source.width, destination.height / source.height));
+	int scaledWidth = source.width * factor;
+	int offsetX = (destination.width - scaledWidth) / 2;
+	int offsetY = (destination.height - source.height * factor) / 2;
+
+	int destinationTop = offsetY + sourceTop * factor;
+	int destinationBottom = offsetY + sourceBottom * factor;
+	if(sourceTop == 0) destinationTop = 0;
+	if(sourceBottom == source.height) destinationBottom = destination.height;
+
+	for(int y = destinationTop; y < destinationBottom; ++y) {
+		uint32* row = BitmapGetRowAddress(destination, y);
+		int sourceY = (y - offsetY) / factor;
+		bool isLetterboxRow = (y < offsetY) || (sourceY >= source.height);
+		if(isLetterboxRow) {
+			for(int x = 0; x < destination.width; ++x)
+				row[x] = LETTERBOX_COLOR;
+			continue;
+		}
+
+		for(int x = 0; x < offsetX; ++x)
+			row[x] = LETTERBOX_COLOR;
+		for(int x = offsetX + scaledWidth; x < destination.width; ++x)
+			row[x] = LETTERBOX_COLOR;
+
+		bool isFirstReplica = ((y - offsetY) % factor == 0) || (y == destinationTop);
+		if(isFirstReplica)
+			UpscalingReplicateRow(BitmapGetRowAddress(source, sourceY), row + offsetX, source.width, factor);
+		else
+			memcpy(row + offsetX, BitmapGetRowAddress(destination, y - 1) + offsetX, scaledWidth * sizeof(uint32));
+	}
+
+	BitmapMarkDirtyRectangle(destination, 0, destinationTop, destination.width, destinationBottom);
+}
+
+INTERNAL void BitmapUpscaleNearestNeighbor(offscreen_buffer_t& source, offscreen_buffer_t& destination, int destinationTop, int destinationBottom) {
+	upscaling_workspace_t& workspace = UPSCALING_WORKSPACE;
+	for(int x = 0; x < destination.width; ++x)
+		workspace.leftColumns[x] = Min((UpscalingGetSamplePosition(x, source.width, destination.width) + 0x8000) >> 16, source.width - 1);
+
+	int previousSourceY = -1;
+	for(int y = destinationTop; y < destinationBottom; ++y) {
+		int sourceY = Min((UpscalingGetSamplePosition(y, source.height, destination.height) + 0x8000) >> 16, source.height - 1);
+		uint32* row = BitmapGetRowAddress(destination, y);
+		if(sourceY == previousSourceY) {
+			// NOTE: Duplicated rows are much cheaper to copy than to resample
+			memcpy(row, BitmapGetRowAddress(destination, y - 1), destination.width * sizeof(uint32));
+			continue;
+		}
+
+		UpscalingGatherRow(BitmapGetRowAddress(source, sourceY), row, workspace.leftColumns, destination.width);
+		previousSourceY = sourceY;
+	}
+}
+
+INTERNAL void BitmapUpscaleBilinear(offscreen_buffer_t& source, offscreen_buffer_t& destination, int destinationTop, int destinationBottom) {
+	upscaling_workspace_t& workspace = UPSCALING_WORKSPACE;
+	for(int x = 0; x < destination.width; ++x) {
+		int32 position = UpscalingGetSamplePosition(x, source.width, destination.width);
+		int left = Min(position >> 16, source.width - 1);
+		int weight = (position & 0xFFFF) >> (16 - BILINEAR_WEIGHT_BITS);
+		workspace.leftColumns[x] = left;
+		workspace.rightColumns[x] = Min(left + 1, source.width - 1);
+		workspace.weightPairs[x] = weight | (weight << 16);
+	}
+
+	int previousTop = -1;
+	int previousWeight = -1;
+	for(int y = destinationTop; y < destinationBottom; ++y) {
+		int32 position = UpscalingGetSamplePosition(y, source.height, destination.height);
+		int top = Min(position >> 16, source.height - 1);
+		int bottom = Min(top + 1, source.height - 1);
+		int weight = (position & 0xFFFF) >> (16 - BILINEAR_WEIGHT_BITS);
+
+		uint32* row = BitmapGetRowAddress(destination, y);
+		if(top == previousTop && weight == previousWeight) {
+			memcpy(row, BitmapGetRowAddress(destination, y - 1), destination.width * sizeof(uint32));
+			continue;
+		}
+
+		// Separable: Filter vertically at the source resolution, then horizontally at the destination resolution
+		UpscalingLerpRows(BitmapGetRowAddress(source, top), BitmapGetRowAddress(source, bottom), workspace.filteredRow, source.width, weight);
+		UpscalingLerpColumns(workspace.filteredRow, row, workspace, destination.width);
+		previousTop = top;
+		previousWeight = weight;
+	}
+}
+
+INTERNAL void BitmapUpscale(offscreen_buffer_t& source, offscreen_buffer_t& destination, upscaling_mode_t mode) {
+	ASSUME(source.bytesPerPixel == 4 && destination.bytesPerPixel == 4, "Only 32-bit pixel formats can be upscaled");
+	ASSUME(destination.width <= MAX_UPSCALED_WIDTH, "Destination is too wide for the upscaling workspace");
+	ASSUME(source.width <= destination.width && source.height <= destination.height, "Source must not be larger than the destination");
+	if(!source.pixelBuffer || !destination.pixelBuffer) return;
+	if(source.width <= 0 || source.height <= 0) return;
+
+	// NOTE: Only the rows affected by the dirty regions need to be resampled (with a one-pixel margin for filtering)
+	int sourceTop, sourceBottom;
+	BitmapGetDirtyRowRange(source, sourceTop, sourceBottom);
+	if(sourceTop >= sourceBottom) return;
+
+	if(mode == UPSCALE_INTEGER_MULTIPLE) {
+		BitmapUpscaleIntegerMultiple(source, destination, sourceTop, sourceBottom);
+		return;
+	}
+
+	int destinationTop = (int)Max((int64)(sourceTop - 1) * destination.height / source.height, (int64)0);
+	int destinationBottom = (int)Min(((int64)(sourceBottom + 1) * destination.height + source.height - 1) / source.height, (int64)destination.height);
+
+	if(mode == UPSCALE_NEAREST_NEIGHBOR)
+		BitmapUpscaleNearestNeighbor(source, destination, destinationTop, destinationBottom);
+	else
+		BitmapUpscaleBilinear(source, destination, destinationTop, destinationBottom);
+
+	BitmapMarkDirtyRectangle(destination, 0, destinationTop, destination.width, destinationBottom);
+}
+
+// NOTE: Workloads above the high watermark (relative to the frame budget) trigger downscaling, and those below the low
+// watermark allow upscaling again. The gap between them and the different delays prevent oscillating between two scales
+constexpr percentage ADAPTIVE_RESOLUTION_STEP = 0.0625f;
+constexpr percentage ADAPTIVE_RESOLUTION_HIGH_WATERMARK = 0.9f;
+constexpr percentage ADAPTIVE_RESOLUTION_LOW_WATERMARK = 0.6f;
+constexpr uint32 ADAPTIVE_RESOLUTION_DOWNSCALE_DELAY = 4;
+constexpr uint32 ADAPTIVE_RESOLUTION_UPSCALE_DELAY = 30;
+constexpr uint32 ADAPTIVE_RESOLUTION_COOLDOWN = 10; // Measurements right after a change may still reflect the old scale
+
+typedef struct adaptive_resolution_controller {
+	percentage scale;
+	percentage minimumScale;
+	percentage maximumScale;
+	uint32 framesOverBudget;
+	uint32 framesUnderBudget;
+	uint32 cooldownFrames;
+} adaptive_resolution_t;
+
+INTERNAL bool AdaptiveResolutionUpdate(adaptive_resolution_t& controller, milliseconds workTime, milliseconds frameBudget) {
+	if(controller.cooldownFrames > 0) {
+		controller.cooldownFrames--;
+		return false;
+	}
+
+	percentage load = (percentage)(workTime / frameBudget);
+	controller.framesOverBudget = (load > ADAPTIVE_RESOLUTION_HIGH_WATERMARK) ? controller.framesOverBudget + 1 : 0;
+	controller.framesUnderBudget = (load < ADAPTIVE_RESOLUTION_LOW_WATERMARK) ? controller.framesUnderBudget + 1 : 0;
+
+	percentage newScale = controller.scale;
+	if(controller.framesOverBudget >= ADAPTIVE_RESOLUTION_DOWNSCALE_DELAY) {
+		// Severe overload should recover quickly, whereas slowly creeping back up is less noticeable
+		int steps = (load > 1.0f) ? 2 : 1;
+		newScale -= steps * ADAPTIVE_RESOLUTION_STEP;
+	} else if(controller.framesUnderBudget >= ADAPTIVE_RESOLUTION_UPSCALE_DELAY) {
+		newScale += ADAPTIVE_RESOLUTION_STEP;
+	}
+
+	newScale = ClampToInterval(newScale, controller.minimumScale, controller.maximumScale);
+	if(newScale == controller.scale) return false;
+
+	controller.scale = newScale;
+	controller.framesOverBudget = 0;
+	controller.framesUnderBudget = 0;
+	controller.cooldownFrames = ADAPTIVE_RESOLUTION_COOLDOWN;
+	return true;
+}
\ No newline at end of file
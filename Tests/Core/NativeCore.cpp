@@ -0,0 +1,384 @@
+// ABOUT: Native tests for the core utilities that have no Lua counterpart (the edge cases are easier to reach from here)
+
+#include "../../Core/RagLite2.hpp"
+
+// TODO: Eliminate this
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// NOTE: Long enough to exercise the AVX2 and SSE2 loops as well as the scalar tails (at every possible alignment)
+constexpr size_t TEST_MAX_STRING_LENGTH = 80;
+
+typedef struct test_context {
+	const char* caseName;
+	uint32 caseCount;
+	uint32 checkCount;
+	uint32 failedCheckCount;
+} test_context_t;
+
+GLOBAL test_context_t TEST_CONTEXT = {};
+
+#define EXPECT(condition) TestExpect((condition), #condition, __LINE__)
+
+INTERNAL bool TestExpect(bool condition, const char* expression, int line) {
+	TEST_CONTEXT.checkCount++;
+	if(condition) return true;
+
+	TEST_CONTEXT.failedCheckCount++;
+	fprintf(stderr, "FAILED: %s (line %d: %s)\n", TEST_CONTEXT.caseName, line, expression);
+	return false;
+}
+
+INTERNAL void TestBeginCase(const char* caseName) {
+	TEST_CONTEXT.caseName = caseName;
+	TEST_CONTEXT.caseCount++;
+	printf("%s\n", caseName);
+}
+
+INTERNAL void TestHistograms() {
+	latency_histogram_t histogram;
+	const double percentiles[] = { 0.0, 50.0, 99.9, 100.0 };
+	constexpr int PERCENTILE_COUNT = sizeof(percentiles) / sizeof(double);
+	milliseconds results[PERCENTILE_COUNT];
+
+	TestBeginCase("Histograms: Reports zero for every percentile if nothing was recorded");
+	HistogramReset(histogram);
+	for(int index = 0; index < PERCENTILE_COUNT; ++index)
+		results[index] = -1.0f;
+	HistogramGetPercentiles(&histogram, 1, percentiles, results, PERCENTILE_COUNT);
+	for(int index = 0; index < PERCENTILE_COUNT; ++index)
+		EXPECT(results[index] == 0.0f);
+	EXPECT(HistogramCountValuesAbove(histogram, 0.0f) == 0);
+
+	TestBeginCase("Histograms: Reports the exact value for every percentile if only one was recorded");
+	HistogramReset(histogram);
+	HistogramRecordValue(histogram, 16.5f);
+	EXPECT(histogram.totalCount == 1);
+	EXPECT(histogram.highestRecordedValue == 16500);
+	HistogramGetPercentiles(&histogram, 1, percentiles, results, PERCENTILE_COUNT);
+	for(int index = 0; index < PERCENTILE_COUNT; ++index)
+		EXPECT(results[index] == 16.5f);
+	EXPECT(HistogramCountValuesAbove(histogram, 10.0f) == 1);
+	EXPECT(HistogramCountValuesAbove(histogram, 20.0f) == 0);
+
+	TestBeginCase("Histograms: Clamps out-of-range values to the lowest and highest buckets");
+	HistogramReset(histogram);
+	HistogramRecordValue(histogram, -5.0f);
+	HistogramRecordValue(histogram, 1e9f);
+	EXPECT(histogram.totalCount == 2);
+	EXPECT(histogram.counts[0] == 1);
+	EXPECT(histogram.counts[HISTOGRAM_BUCKET_COUNT - 1] == 1);
+	EXPECT(histogram.highestRecordedValue == HISTOGRAM_HIGHEST_TRACKED_VALUE);
+	EXPECT(HistogramGetBucketIndex(HISTOGRAM_HIGHEST_TRACKED_VALUE) == HISTOGRAM_BUCKET_COUNT - 1);
+	EXPECT(HistogramGetBucketUpperBound(HISTOGRAM_BUCKET_COUNT - 1) == HISTOGRAM_HIGHEST_TRACKED_VALUE);
+	HistogramGetPercentiles(&histogram, 1, percentiles, results, PERCENTILE_COUNT);
+	EXPECT(results[0] == 0.0f);
+	EXPECT(results[1] == 0.0f);
+	EXPECT(results[3] == (milliseconds)((double)HISTOGRAM_HIGHEST_TRACKED_VALUE / MICROSECONDS_PER_MILLISECOND));
+	EXPECT(HistogramCountValuesAbove(histogram, 1e9f) == 0);
+}
+
+INTERNAL bool TestStringEquals(const char* actual, int length, const char* expected) {
+	return length == (int)strlen(expected) && strcmp(actual, expected) == 0;
+}
+
+INTERNAL void TestNumberFormatting() {
+	char buffer[MAX_FORMATTED_NUMBER_LENGTH];
+
+	TestBeginCase("Strings: Formats integers at the edges of their range");
+	EXPECT(TestStringEquals(buffer, UnsignedToString(buffer, 0), "0"));
+	EXPECT(TestStringEquals(buffer, UnsignedToString(buffer, 9), "9"));
+	EXPECT(TestStringEquals(buffer, UnsignedToString(buffer, 10), "10"));
+	EXPECT(TestStringEquals(buffer, UnsignedToString(buffer, UINT64_MAX), "18446744073709551615"));
+	EXPECT(TestStringEquals(buffer, SignedToString(buffer, 0), "0"));
+	EXPECT(TestStringEquals(buffer, SignedToString(buffer, -1), "-1"));
+	EXPECT(TestStringEquals(buffer, SignedToString(buffer, INT64_MAX), "9223372036854775807"));
+	EXPECT(TestStringEquals(buffer, SignedToString(buffer, INT64_MIN), "-9223372036854775808"));
+
+	TestBeginCase("Strings: Formats hexadecimal numbers with the requested (clamped) number of digits");
+	EXPECT(TestStringEquals(buffer, HexToString(buffer, 0, 0), "0"));
+	EXPECT(TestStringEquals(buffer, HexToString(buffer, 0xAB, 4), "00AB"));
+	EXPECT(TestStringEquals(buffer, HexToString(buffer, 0xABCDEF, 2), "ABCDEF"));
+	EXPECT(TestStringEquals(buffer, HexToString(buffer, 1, 20), "0000000000000001"));
+	EXPECT(TestStringEquals(buffer, HexToString(buffer, UINT64_MAX, 0), "FFFFFFFFFFFFFFFF"));
+
+	TestBeginCase("Strings: Formats doubles with rounding carries and special values");
+	EXPECT(TestStringEquals(buffer, DoubleToString(buffer, 0.0, TWO_DIGITS), "0.00"));
+	EXPECT(TestStringEquals(buffer, DoubleToString(buffer, -0.0, TWO_DIGITS), "0.00")); // Negative zero compares equal to zero
+	EXPECT(TestStringEquals(buffer, DoubleToString(buffer, -1.25, ONE_DIGIT), "-1.3"));
+	EXPECT(TestStringEquals(buffer, DoubleToString(buffer, 0.5, ZERO_DIGITS), "1"));
+	EXPECT(TestStringEquals(buffer, DoubleToString(buffer, 9.999, TWO_DIGITS), "10.00"));
+	EXPECT(TestStringEquals(buffer, DoubleToString(buffer, 99.96, ONE_DIGIT), "100.0"));
+	EXPECT(TestStringEquals(buffer, DoubleToString(buffer, 0.1234567891, MAX_FORMAT_PRECISION), "0.123456789"));
+	EXPECT(TestStringEquals(buffer, DoubleToString(buffer, 1.0, 20), "1.000000000")); // Clamped to the highest supported precision
+	EXPECT(TestStringEquals(buffer, DoubleToString(buffer, 18446744073709551616.0, TWO_DIGITS), "1.84e+19"));
+	EXPECT(TestStringEquals(buffer, DoubleToString(buffer, 9.999e25, TWO_DIGITS), "1.00e+26"));
+	EXPECT(TestStringEquals(buffer, DoubleToString(buffer, -1e300, ZERO_DIGITS), "-1e+300"));
+	EXPECT(TestStringEquals(buffer, DoubleToString(buffer, NAN, TWO_DIGITS), "nan"));
+	EXPECT(TestStringEquals(buffer, DoubleToString(buffer, INFINITY, TWO_DIGITS), "inf"));
+	EXPECT(TestStringEquals(buffer, DoubleToString(buffer, -INFINITY, TWO_DIGITS), "-inf"));
+}
+
+// Each string gets its own (exactly sized) allocation, so that reading past the end is caught by the address sanitizer
+INTERNAL String TestCreateString(size_t length, char filler) {
+	String text = {
+		.length = length,
+		.buffer = (char*)malloc(length + 1),
+	};
+	memset(text.buffer, filler, length);
+	text.buffer[length] = ASCII_NULL_TERMINATOR;
+	return text;
+}
+
+INTERNAL void TestFreeString(String& text) {
+	free(text.buffer);
+	text = {};
+}
+
+INTERNAL void TestStringScanning() {
+	TestBeginCase("Strings: Finds the terminator at every length and alignment");
+	bool hasFoundAllTerminators = true;
+	for(size_t length = 0; length <= TEST_MAX_STRING_LENGTH; ++length) {
+		String text = TestCreateString(length + 31, 'x');
+		for(size_t offset = 0; offset < 32; ++offset) {
+			text.buffer[offset + length] = ASCII_NULL_TERMINATOR;
+			hasFoundAllTerminators = hasFoundAllTerminators && StringLength(text.buffer + offset) == length;
+			text.buffer[offset + length] = 'x';
+		}
+		TestFreeString(text);
+	}
+	EXPECT(hasFoundAllTerminators);
+
+	TestBeginCase("Strings: Finds the last matching character at every position");
+	bool hasFoundAllMatches = true;
+	for(size_t length = 0; length <= TEST_MAX_STRING_LENGTH; ++length) {
+		String text = TestCreateString(length, 'x');
+		hasFoundAllMatches = hasFoundAllMatches && StringFindLastOf(text, '.') == STRING_INDEX_NOT_FOUND;
+		for(size_t index = 0; index < length; ++index) {
+			text.buffer[index] = (index % 2 == 0) ? ASCII_FORWARD_SLASH : ASCII_BACKWARD_SLASH;
+			hasFoundAllMatches = hasFoundAllMatches && PathStringFindLastSeparator(text) == index;
+			hasFoundAllMatches = hasFoundAllMatches && StringFindLastOf(text, text.buffer[index]) == index;
+		}
+		TestFreeString(text);
+	}
+	EXPECT(hasFoundAllMatches);
+
+	TestBeginCase("Strings: Detects non-ASCII bytes and duplicate separators at every position");
+	bool hasDetectedAll = true;
+	for(size_t length = 0; length <= TEST_MAX_STRING_LENGTH; ++length) {
+		String text = TestCreateString(length, 'x');
+		hasDetectedAll = hasDetectedAll && StringIsASCII(text) && PathStringFindDuplicateSeparator(text) == STRING_INDEX_NOT_FOUND;
+		for(size_t index = 0; index < length; ++index) {
+			text.buffer[index] = (char)0xB0;
+			hasDetectedAll = hasDetectedAll && !StringIsASCII(text);
+			text.buffer[index] = ASCII_FORWARD_SLASH;
+			if(index + 1 < length) {
+				text.buffer[index + 1] = ASCII_FORWARD_SLASH;
+				hasDetectedAll = hasDetectedAll && PathStringFindDuplicateSeparator(text) == index;
+				text.buffer[index + 1] = 'x';
+			}
+			text.buffer[index] = 'x';
+		}
+		TestFreeString(text);
+	}
+	EXPECT(hasDetectedAll);
+}
+
+INTERNAL void TestStringCaseFolding() {
+	TestBeginCase("Strings: Compares strings case-insensitively at every length");
+	bool hasComparedAll = true;
+	for(size_t length = 0; length <= TEST_MAX_STRING_LENGTH; ++length) {
+		String upperCase = TestCreateString(length, 'A');
+		String lowerCase = TestCreateString(length, 'a');
+		hasComparedAll = hasComparedAll && StringEqualsIgnoreCase(upperCase, lowerCase);
+		for(size_t index = 0; index < length; ++index) {
+			// These only differ in the case bit, but they aren't letters (so ignoring that bit everywhere isn't enough)
+			upperCase.buffer[index] = '@';
+			lowerCase.buffer[index] = '`';
+			hasComparedAll = hasComparedAll && !StringEqualsIgnoreCase(upperCase, lowerCase);
+			upperCase.buffer[index] = 'A';
+			lowerCase.buffer[index] = 'a';
+		}
+		TestFreeString(upperCase);
+		TestFreeString(lowerCase);
+	}
+	EXPECT(hasComparedAll);
+
+	TestBeginCase("Strings: Lowercases and replaces only ASCII letters and the given character");
+	bool hasConvertedAll = true;
+	for(size_t length = 0; length <= TEST_MAX_STRING_LENGTH; ++length) {
+		String text = TestCreateString(length, 'x');
+		for(size_t index = 0; index < length; ++index)
+			text.buffer[index] = "AZaz@[`{\\\xC1"[index % 10];
+		StringLowerCaseAndReplaceInPlace(text, ASCII_BACKWARD_SLASH, ASCII_FORWARD_SLASH);
+		for(size_t index = 0; index < length; ++index)
+			hasConvertedAll = hasConvertedAll && text.buffer[index] == "azaz@[`{/\xC1"[index % 10];
+		TestFreeString(text);
+	}
+	EXPECT(hasConvertedAll);
+
+	TestBeginCase("Strings: Normalizes archive paths");
+	String path = TestCreateString(TEST_MAX_STRING_LENGTH, 'x');
+	memcpy(path.buffer, "DATA\\\\Sprite//Monster\\PORING.spr", sizeof("DATA\\\\Sprite//Monster\\PORING.spr"));
+	path.length = sizeof("DATA\\\\Sprite//Monster\\PORING.spr") - 1;
+	PathStringNormalizeInPlace(path);
+	EXPECT(path.length == sizeof("data/sprite/monster/poring.spr") - 1);
+	EXPECT(memcmp(path.buffer, "data/sprite/monster/poring.spr", path.length) == 0);
+	TestFreeString(path);
+}
+
+INTERNAL void TestMemoryArenas() {
+	constexpr size_t TEST_ARENA_SIZE = 64;
+	memory_arena_t arena = {
+		.displayName = StringLiteral("Aligned Allocations"),
+		.lifetime = RESET_AFTER_TASK_COMPLETION,
+		.usage = PREALLOCATED_ON_LOAD,
+		.baseAddress = PlatformAllocateMemory(TEST_ARENA_SIZE),
+		.reservedSize = TEST_ARENA_SIZE,
+		.committedSize = TEST_ARENA_SIZE,
+	};
+	TestBeginCase("Memory: Pads aligned allocations that follow an unaligned one");
+	if(!EXPECT(arena.baseAddress != NULL)) return;
+	uint8* bytes = (uint8*)ArenaAllocateMemoryRegion(arena, 1);
+	uint32* indices = (uint32*)ArenaAllocateAlignedMemoryRegion(arena, 3 * sizeof(uint32), alignof(uint32));
+	EXPECT(bytes == arena.baseAddress);
+	EXPECT((uint8*)indices == bytes + alignof(uint32));
+	EXPECT(arena.used == 4 * sizeof(uint32));
+
+	TestBeginCase("Memory: Doesn't pad allocations that are already aligned");
+	uint64* offsets = (uint64*)ArenaAllocateAlignedMemoryRegion(arena, sizeof(uint64), alignof(uint64));
+	EXPECT((uint8*)offsets == (uint8*)(indices + 3));
+	EXPECT(arena.used == 4 * sizeof(uint32) + sizeof(uint64));
+}
+
+INTERNAL void TestStringInterning() {
+	TestBeginCase("StringInterning: Sizes the slots for a load factor of at most 50%");
+	EXPECT(InternTableGetSlotCount(0) == 16);
+	EXPECT(InternTableGetSlotCount(8) == 16);
+	EXPECT(InternTableGetSlotCount(9) == 32);
+	EXPECT(InternTableGetSlotCount(MAX_INTERNED_STRING_COUNT) == 1U << 31);
+
+	constexpr uint32 TEST_MAX_INTERNED_STRING_COUNT = 64;
+	constexpr size_t TEST_MAX_INTERNED_CHARACTER_COUNT = TEST_MAX_INTERNED_STRING_COUNT * 8;
+	size_t requiredSize = InternTableGetRequiredMemorySize(TEST_MAX_INTERNED_STRING_COUNT, TEST_MAX_INTERNED_CHARACTER_COUNT);
+	memory_arena_t arena = {
+		.displayName = StringLiteral("Interned Strings"),
+		.lifetime = RESET_AFTER_TASK_COMPLETION,
+		.usage = PREALLOCATED_ON_LOAD,
+		.baseAddress = PlatformAllocateMemory(requiredSize),
+		.reservedSize = requiredSize,
+		.committedSize = requiredSize,
+	};
+	if(!EXPECT(arena.baseAddress != NULL)) return;
+
+	TestBeginCase("StringInterning: Assigns the same ID to identical strings");
+	string_intern_table_t table;
+	InternTableInitialize(table, arena, TEST_MAX_INTERNED_STRING_COUNT, TEST_MAX_INTERNED_CHARACTER_COUNT);
+	String first = StringLiteral("data/sprite");
+	String second = StringLiteral("data/texture");
+	String empty = StringLiteral("");
+	char copiedCharacters[] = "data/sprite";
+	String copy = { .length = sizeof(copiedCharacters) - 1, .buffer = copiedCharacters };
+	string_id_t firstID = InternTableInsert(table, first);
+	string_id_t secondID = InternTableInsert(table, second);
+	string_id_t emptyID = InternTableInsert(table, empty);
+	EXPECT(firstID != INVALID_STRING_ID && secondID != INVALID_STRING_ID && emptyID != INVALID_STRING_ID);
+	EXPECT(firstID != secondID && secondID != emptyID && emptyID != firstID);
+	EXPECT(InternTableInsert(table, copy) == firstID);
+	EXPECT(InternTableGetStringCount(table) == 3);
+
+	String stored = InternTableGetString(table, firstID);
+	EXPECT(stored.length == first.length && stored.buffer != copiedCharacters && strcmp(stored.buffer, "data/sprite") == 0);
+	EXPECT(InternTableGetString(table, emptyID).length == 0);
+
+	TestBeginCase("StringInterning: Finds interned strings and rejects the ones that weren't");
+	String prefix = StringLiteral("data/sprit");
+	String missing = StringLiteral("data/sound");
+	EXPECT(InternTableFind(table, copy) == firstID);
+	EXPECT(InternTableFind(table, second) == secondID);
+	EXPECT(InternTableFind(table, empty) == emptyID);
+	EXPECT(InternTableFind(table, prefix) == INVALID_STRING_ID);
+	EXPECT(InternTableFind(table, missing) == INVALID_STRING_ID);
+
+	TestBeginCase("StringInterning: Keeps working once every string has been interned");
+	ArenaResetAllocations(arena);
+	InternTableInitialize(table, arena, TEST_MAX_INTERNED_STRING_COUNT, TEST_MAX_INTERNED_CHARACTER_COUNT);
+	char characters[TEST_MAX_INTERNED_STRING_COUNT][8];
+	bool hasInternedAll = true;
+	for(uint32 index = 0; index < TEST_MAX_INTERNED_STRING_COUNT; ++index) {
+		int length = HexToString(characters[index], index, 4);
+		String text = { .length = (size_t)length, .buffer = characters[index] };
+		hasInternedAll = hasInternedAll && InternTableInsert(table, text) == (string_id_t)(index + 1);
+	}
+	EXPECT(hasInternedAll);
+	EXPECT(InternTableGetStringCount(table) == TEST_MAX_INTERNED_STRING_COUNT);
+
+	bool hasFoundAll = true;
+	for(uint32 index = 0; index < TEST_MAX_INTERNED_STRING_COUNT; ++index) {
+		String text = { .length = 4, .buffer = characters[index] };
+		hasFoundAll = hasFoundAll && InternTableFind(table, text) == (string_id_t)(index + 1);
+		hasFoundAll = hasFoundAll && InternTableInsert(table, text) == (string_id_t)(index + 1);
+	}
+	EXPECT(hasFoundAll);
+	EXPECT(InternTableGetStringCount(table) == TEST_MAX_INTERNED_STRING_COUNT);
+	EXPECT(InternTableFind(table, missing) == INVALID_STRING_ID);
+
+	PlatformFreeMemory(arena.baseAddress, requiredSize);
+}
+
+GLOBAL logger_state_t TEST_LOGGER = {};
+
+// Captures and replays a record without involving the logger thread (the output stays in the flush buffer)
+INTERNAL bool TestFormatsLogRecord(const char* expectedOutput, const char* format, ...) {
+	logger_format_signature_t signature;
+	LoggerParseFormatSignature(format, signature);
+
+	logger_record_t record = {};
+	record.format = format;
+	va_list arguments;
+	va_start(arguments, format);
+	LoggerCaptureArguments(record, signature, arguments);
+	va_end(arguments);
+
+	TEST_LOGGER.flushBufferUsed = 0;
+	LoggerFormatRecord(TEST_LOGGER, record);
+	size_t expectedLength = strlen(expectedOutput);
+	return TEST_LOGGER.flushBufferUsed == expectedLength && memcmp(TEST_LOGGER.flushBuffer, expectedOutput, expectedLength) == 0;
+}
+
+INTERNAL void TestLogging() {
+	TestBeginCase("Logging: Forwards variable widths and precisions to the conversions that support them");
+	EXPECT(TestFormatsLogRecord("[abc]", "[%.*s]", 3, "abcdef"));
+	EXPECT(TestFormatsLogRecord("[  042]", "[%*.*d]", 5, 3, 42));
+	EXPECT(TestFormatsLogRecord("[1.50]", "[%.*f]", 2, 1.5));
+	EXPECT(TestFormatsLogRecord("[   x]", "[%*c]", 4, 'x'));
+
+	TestBeginCase("Logging: Prints characters and pointers with a variable precision as-is");
+	EXPECT(TestFormatsLogRecord("[%.*c] 42", "[%.*c] %d", 3, 'x', 42));
+	EXPECT(TestFormatsLogRecord("[%*.*p] 42", "[%*.*p] %d", 8, 3, (void*)&TEST_LOGGER, 42));
+}
+
+int main() {
+	TestHistograms();
+	TestLogging();
+	TestNumberFormatting();
+	TestStringScanning();
+	TestStringCaseFolding();
+	TestMemoryArenas();
+	TestStringInterning();
+#ifdef RAGLITE_INTRINSICS_AVX2
+	if(IntrinsicsSupportsAVX2()) {
+		// The SSE2 fallbacks would otherwise go untested on most machines
+		CPU_SUPPORTS_AVX2 = false;
+		TestStringScanning();
+		TestStringCaseFolding();
+		CPU_SUPPORTS_AVX2 = -1;
+	}
+#endif
+
+	if(TEST_CONTEXT.failedCheckCount == 0) printf("SUCCESS: All %u checks passed (%u test cases)\n", TEST_CONTEXT.checkCount, TEST_CONTEXT.caseCount);
+	else fprintf(stderr, "FAILED: %u of %u checks failed\n", TEST_CONTEXT.failedCheckCount, TEST_CONTEXT.checkCount);
+
+	return (TEST_CONTEXT.failedCheckCount == 0) ? 0 : 1;
+}
@@ -0,0 +1,1399 @@
+// ABOUT: Native counterpart of the file format specs - decodes the shared fixtures, round-trips the compiled formats (CGRF, CACT, SATL),
+// ABOUT: and makes sure that truncated or corrupted inputs are rejected cleanly (run it from the repository root, same as the Lua tests)
+
+#include "../../Core/RagLite2.hpp"
+#include "../../Core/FileFormats/ArcturusPAK.hpp"
+#include "../../Core/FileFormats/RagnarokACT.hpp"
+#include "../../Core/FileFormats/RagnarokGAT.hpp"
+#include "../../Core/FileFormats/RagnarokGRF.hpp"
+#include "../../Core/FileFormats/RagnarokRGZ.hpp"
+#include "../../Core/FileFormats/RagnarokSPR.hpp"
+#include "../../Core/FileFormats/Optimized/CompiledGRF.hpp"
+#include "../../Core/FileFormats/Optimized/BulkExtraction.hpp"
+#include "../../Core/FileFormats/Optimized/CompiledACT.hpp"
+#include "../../Core/FileFormats/Optimized/SpriteAtlas.hpp"
+
+// TODO: Eliminate this
+#include <stdio.h>
+#include <stdlib.h>
+
+constexpr char TEST_FIXTURES_DIRECTORY[] = "Tests/Fixtures/";
+constexpr size_t TEST_ARENA_SIZE = 32 * 1024 * 1024; // Inputs whose headers claim more than this are treated as rejected
+constexpr size_t TEST_MAX_PATH_LENGTH = 256;
+constexpr size_t TEST_MAX_RECORDED_ENTRIES = 8;
+constexpr uint32 TEST_EXTRACTION_WORKER_COUNT = 3;
+constexpr size_t TEST_GRF_MAX_FILE_TABLE_SIZE = 4096;
+
+// UTF-8 (as decoded) and CP949 (as stored) versions of the non-ASCII names that the fixtures use
+constexpr char TEST_KOREAN_FILE_NAME[] = "\xEC\x95\x88\xEB\x85\x95\xED\x95\x98\xEC\x84\xB8\xEC\x9A\x94.txt";
+constexpr char TEST_KOREAN_FILE_CONTENTS[] = "\xEC\x95\x88\xEB\x85\x95\xED\x95\x98\xEC\x8B\xAD\xEB\x8B\x88\xEA\xB9\x8C";
+constexpr char TEST_KOREAN_EVENT_NAME[] = "\xEC\x95\x88\xEB\x85\x95.wav";
+constexpr char TEST_CP949_EVENT_NAME[] = "\xBE\xC8\xB3\xE7.wav";
+constexpr char TEST_NESTED_TEXT_FILE_CONTENTS[] = "I'm inside the GRF archive, just minding my business. Would you like some tea?";
+constexpr char TEST_TOP_LEVEL_TEXT_FILE_CONTENTS[] = "I'm at the top level of the GRF archive. How did you get here?";
+
+typedef struct test_fixture {
+	uint8* bytes;
+	size_t size;
+} test_fixture_t;
+
+typedef struct test_context {
+	const char* caseName;
+	uint32 caseCount;
+	uint32 checkCount;
+	uint32 failedCheckCount;
+	memory_arena_t persistentMemory;
+	memory_arena_t transientMemory;
+} test_context_t;
+
+GLOBAL test_context_t TEST_CONTEXT = {};
+
+// Decoders used by the truncation and corruption tests: Returns whether the input was accepted (and fully decoded)
+typedef bool (*test_decoder_fn)(const uint8* bytes, size_t size);
+
+#define EXPECT(condition) TestExpect((condition), #condition, __LINE__)
+
+INTERNAL bool TestExpect(bool condition, const char* expression, int line) {
+	TEST_CONTEXT.checkCount++;
+	if(condition) return true;
+
+	TEST_CONTEXT.failedCheckCount++;
+	fprintf(stderr, "FAILED: %s (line %d: %s)\n", TEST_CONTEXT.caseName, line, expression);
+	return false;
+}
+
+INTERNAL void TestBeginCase(const char* caseName) {
+	TEST_CONTEXT.caseName = caseName;
+	TEST_CONTEXT.caseCount++;
+	printf("%s\n", caseName);
+}
+
+INTERNAL memory_arena_t TestCreateArena(String displayName, size_t size) {
+	memory_arena_t arena = {
+		.displayName = displayName,
+		.lifetime = RESET_AFTER_TASK_COMPLETION,
+		.usage = PREALLOCATED_ON_LOAD,
+		.baseAddress = PlatformAllocateMemory(size),
+		.reservedSize = size,
+		.committedSize = size,
+		.used = 0,
+		.allocationCount = 0,
+	};
+	return arena;
+}
+
+// NOTE: Some decoders expect zeroed memory (e.g., the sprite atlas), so everything that was used is cleared again
+INTERNAL void TestResetArena(memory_arena_t& arena) {
+	memset(arena.baseAddress, 0, arena.used);
+	ArenaResetAllocations(arena);
+}
+
+INTERNAL void TestResetMemory() {
+	TestResetArena(TEST_CONTEXT.persistentMemory);
+	TestResetArena(TEST_CONTEXT.transientMemory);
+}
+
+INTERNAL bool TestLoadFixture(const char* fileName, test_fixture_t& fixture) {
+	fixture = {};
+	char filePath[TEST_MAX_PATH_LENGTH];
+	snprintf(filePath, sizeof(filePath), "%s%s", TEST_FIXTURES_DIRECTORY, fileName);
+
+	FILE* file = fopen(filePath, "rb");
+	if(!file) {
+		fprintf(stderr, "Failed to open fixture %s (run the tests from the repository root)\n", filePath);
+		return EXPECT(file != NULL);
+	}
+
+	fseek(file, 0, SEEK_END);
+	long fileSize = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	if(fileSize > 0) {
+		fixture.size = (size_t)fileSize;
+		fixture.bytes = (uint8*)malloc(fixture.size);
+		if(fixture.bytes && fread(fixture.bytes, 1, fixture.size, file) != fixture.size) {
+			free(fixture.bytes);
+			fixture.bytes = NULL;
+		}
+	}
+	fclose(file);
+
+	return EXPECT(fixture.bytes != NULL);
+}
+
+INTERNAL void TestFreeFixture(test_fixture_t& fixture) {
+	free(fixture.bytes);
+	fixture = {};
+}
+
+// Each copy gets its own (exactly sized) allocation, so that reading past the end is caught by the address sanitizer
+INTERNAL uint8* TestCopyBytes(const uint8* bytes, size_t size) {
+	uint8* copy = (uint8*)malloc(Max(size, (size_t)1));
+	if(copy) memcpy(copy, bytes, size);
+	return copy;
+}
+
+INTERNAL inline void TestWriteUnsignedInt32(uint8* output, uint32 value) {
+	output[0] = (uint8)value;
+	output[1] = (uint8)(value >> 8);
+	output[2] = (uint8)(value >> 16);
+	output[3] = (uint8)(value >> 24);
+}
+
+// NOTE: Counted strings write their NULL terminator, which fails for literals (and reads past them with AVX2), so this only uses strlen
+INTERNAL String TestCreateString(const char* nullTerminatedString) {
+	return StringCreateFromSlice((uint8*)nullTerminatedString, strlen(nullTerminatedString));
+}
+
+INTERNAL bool TestStringEquals(String actual, const char* expected) {
+	size_t expectedLength = strlen(expected);
+	return actual.length == expectedLength && memcmp(actual.buffer, expected, expectedLength) == 0;
+}
+
+INTERNAL bool TestBytesEqual(const uint8* actual, size_t actualSize, const uint8* expected, size_t expectedSize) {
+	return actualSize == expectedSize && memcmp(actual, expected, expectedSize) == 0;
+}
+
+// Compressing isn't supported natively, but stored deflate blocks are just as valid as far as the decoder is concerned
+INTERNAL size_t TestEncodeStoredDeflateBlock(const uint8* contents, size_t size, bool hasZlibHeader, uint8* output) {
+	uint8* start = output;
+	if(hasZlibHeader) {
+		*output++ = 0x78;
+		*output++ = 0x01;
+	}
+	*output++ = 0x01; // Final block (stored)
+	*output++ = (uint8)size;
+	*output++ = (uint8)(size >> 8);
+	*output++ = (uint8)~size;
+	*output++ = (uint8)(~size >> 8);
+	memcpy(output, contents, size);
+	output += size;
+
+	if(hasZlibHeader) {
+		uint32 checksum = ComputeAdler32Checksum(contents, size);
+		*output++ = (uint8)(checksum >> 24);
+		*output++ = (uint8)(checksum >> 16);
+		*output++ = (uint8)(checksum >> 8);
+		*output++ = (uint8)checksum;
+	}
+	return output - start;
+}
+
+// Every strict prefix must be rejected - the decoders are supposed to notice that the file ends early (and not read past it)
+INTERNAL void TestRejectsTruncatedCopies(test_decoder_fn decoder, test_fixture_t& fixture) {
+	size_t firstAcceptedSize = fixture.size;
+	for(size_t size = 0; size < fixture.size; ++size) {
+		uint8* truncatedBytes = TestCopyBytes(fixture.bytes, size);
+		bool wasAccepted = decoder(truncatedBytes, size);
+		free(truncatedBytes);
+		if(wasAccepted && firstAcceptedSize == fixture.size) firstAcceptedSize = size;
+	}
+
+	if(firstAcceptedSize != fixture.size) fprintf(stderr, "Accepted a copy that was truncated to %zu bytes\n", firstAcceptedSize);
+	EXPECT(firstAcceptedSize == fixture.size);
+}
+
+// Not every corrupted byte can be detected (many formats have no checksums), so this only ensures that decoding them is safe
+INTERNAL void TestSurvivesCorruptedCopies(test_decoder_fn decoder, test_fixture_t& fixture) {
+	for(size_t offset = 0; offset < fixture.size; ++offset) {
+		uint8* corruptedBytes = TestCopyBytes(fixture.bytes, fixture.size);
+		corruptedBytes[offset] ^= 0xFF;
+		decoder(corruptedBytes, fixture.size);
+		free(corruptedBytes);
+	}
+
+	uint8* originalBytes = TestCopyBytes(fixture.bytes, fixture.size);
+	EXPECT(decoder(originalBytes, fixture.size));
+	free(originalBytes);
+}
+
+INTERNAL bool TestDecodeArchive(grf_archive_t& archive, const uint8* bytes, size_t size) {
+	if(!GRFOpenArchive(archive, bytes, size)) return false;
+	if(!ArenaCanAllocate(TEST_CONTEXT.persistentMemory, GRFGetRequiredMemorySize(archive))) return false;
+	if(!ArenaCanAllocate(TEST_CONTEXT.transientMemory, GRFGetRequiredTransientMemorySize(archive))) return false;
+	return GRFDecodeFileTable(archive, TEST_CONTEXT.persistentMemory, TEST_CONTEXT.transientMemory);
+}
+
+INTERNAL bool TestExtractArchiveEntry(grf_archive_t& archive, grf_entry_t& entry, uint8*& contents, size_t& size) {
+	size_t outputCapacity = GRFGetExtractedSize(entry);
+	if(!ArenaCanAllocate(TEST_CONTEXT.transientMemory, outputCapacity)) return false;
+
+	contents = (uint8*)ArenaAllocateMemoryRegion(TEST_CONTEXT.transientMemory, outputCapacity);
+	String errorMessage = StringLiteral("OK");
+	return GRFExtractEntry(archive, entry, contents, outputCapacity, size, errorMessage);
+}
+
+INTERNAL bool TestExpectArchiveEntry(grf_archive_t& archive, const char* filePath, const uint8* expectedContents, size_t expectedSize) {
+	grf_entry_t* entry = GRFFindEntry(archive, TestCreateString(filePath));
+	if(!EXPECT(entry != NULL)) return false;
+
+	uint8* contents = NULL;
+	size_t size = 0;
+	if(!EXPECT(TestExtractArchiveEntry(archive, *entry, contents, size))) return false;
+	return EXPECT(TestBytesEqual(contents, size, expectedContents, expectedSize));
+}
+
+INTERNAL bool TestDecodeAndExtractArchive(const uint8* bytes, size_t size) {
+	TestResetMemory();
+	grf_archive_t archive;
+	if(!TestDecodeArchive(archive, bytes, size)) return false;
+
+	bool wereAllEntriesExtracted = true;
+	for(uint32 index = 0; index < archive.fileCount; ++index) {
+		grf_entry_t& entry = archive.entries[index];
+		if(!GRFIsFileEntry(entry)) continue;
+
+		uint8* contents = NULL;
+		size_t extractedSize = 0;
+		if(!TestExtractArchiveEntry(archive, entry, contents, extractedSize)) wereAllEntriesExtracted = false;
+	}
+	return wereAllEntriesExtracted;
+}
+
+INTERNAL bool TestVerifyExtractedArchiveEntry(bulk_extraction_worker_t& worker, bulk_extraction_entry_t& entry) {
+	grf_archive_t& archive = *(grf_archive_t*)worker.job->archive;
+	grf_entry_t& archiveEntry = archive.entries[entry.index];
+	if(!entry.contents || GRFFindEntry(archive, entry.name) != &archiveEntry) return false;
+	return entry.size == archiveEntry.decompressedSize;
+}
+
+INTERNAL void TestArchiveDecoding() {
+	TestBeginCase("GRF: Decodes the file table and extracts every entry");
+	test_fixture_t fixture;
+	test_fixture_t image;
+	if(!TestLoadFixture("test.grf", fixture) || !TestLoadFixture("UPPERCASE.PNG", image)) return;
+
+	TestResetMemory();
+	grf_archive_t archive;
+	if(EXPECT(TestDecodeArchive(archive, fixture.bytes, fixture.size))) {
+		EXPECT(archive.majorVersion == 2 && archive.minorVersion == 0);
+		EXPECT(archive.fileCount == 4);
+		EXPECT(archive.fileTable.compressedSize == 111);
+		EXPECT(archive.fileTable.decompressedSize == 134);
+
+		grf_entry_t* entry = GRFFindEntry(archive, StringLiteral("subdirectory/hello.txt"));
+		if(EXPECT(entry != NULL)) {
+			EXPECT(entry->compressedSize == 82);
+			EXPECT(entry->alignedSize == 88);
+			EXPECT(entry->decompressedSize == 78);
+			EXPECT(entry->offset == 0);
+			EXPECT(GRFIsFileEntry(*entry));
+		}
+
+		// Lookups accept paths in any format, but they must all resolve to the same (normalized) entry
+		EXPECT(GRFFindEntry(archive, StringLiteral("SUBDIRECTORY\\Hello.TXT")) == entry);
+		EXPECT(GRFFindEntry(archive, StringLiteral("/subdirectory/hello.txt")) == entry);
+		EXPECT(GRFFindEntry(archive, StringLiteral("subdirectory/missing.txt")) == NULL);
+		EXPECT(GRFFindEntry(archive, StringLiteral("UPPERCASE.PNG")) != NULL);
+
+		TestExpectArchiveEntry(archive, "subdirectory/hello.txt", (const uint8*)TEST_NESTED_TEXT_FILE_CONTENTS, sizeof(TEST_NESTED_TEXT_FILE_CONTENTS) - 1);
+		TestExpectArchiveEntry(archive, "hello-grf.txt", (const uint8*)TEST_TOP_LEVEL_TEXT_FILE_CONTENTS, sizeof(TEST_TOP_LEVEL_TEXT_FILE_CONTENTS) - 1);
+		TestExpectArchiveEntry(archive, "uppercase.png", image.bytes, image.size);
+		TestExpectArchiveEntry(archive, TEST_KOREAN_FILE_NAME, (const uint8*)TEST_KOREAN_FILE_CONTENTS, sizeof(TEST_KOREAN_FILE_CONTENTS) - 1);
+	}
+
+	TestBeginCase("GRF: Collects entries by prefix and extracts them in archive order");
+	if(EXPECT(archive.fileCount == 4)) {
+		uint32 entryIndices[4];
+		uint32 entryCount = GRFCollectEntriesByPrefix(archive, StringLiteral("/SUBDIRECTORY"), entryIndices);
+		EXPECT(entryCount == 1);
+		entryCount = GRFCollectEntriesByPrefix(archive, StringLiteral(""), entryIndices);
+		EXPECT(entryCount == 4);
+		GRFSortEntriesByOffset(archive, entryIndices, entryCount, TEST_CONTEXT.transientMemory);
+		for(uint32 index = 1; index < entryCount; ++index)
+			EXPECT(archive.entries[entryIndices[index - 1]].offset <= archive.entries[entryIndices[index]].offset);
+		size_t scratchSize = GRFGetLargestExtractedSize(archive, entryIndices, entryCount);
+		EXPECT(scratchSize == 189);
+
+		bulk_extraction_job_t job = {
+			.archive = &archive,
+			.extractEntry = GRFExtractBulkEntry,
+			.entryIndices = entryIndices,
+			.entryCount = entryCount,
+			.sink = TestVerifyExtractedArchiveEntry,
+		};
+		bulk_extraction_worker_t workers[TEST_EXTRACTION_WORKER_COUNT] = {};
+		for(uint32 workerIndex = 0; workerIndex < TEST_EXTRACTION_WORKER_COUNT; ++workerIndex) {
+			workers[workerIndex].scratchMemory = {
+				.baseAddress = ArenaAllocateMemoryRegion(TEST_CONTEXT.transientMemory, scratchSize),
+				.reservedSize = scratchSize,
+				.committedSize = scratchSize,
+			};
+		}
+		BulkExtractionRunJob(job, workers, TEST_EXTRACTION_WORKER_COUNT);
+
+		uint32 extractedCount = 0;
+		uint32 failedCount = 0;
+		for(bulk_extraction_worker_t& worker : workers) {
+			extractedCount += worker.extractedCount;
+			failedCount += worker.failedCount;
+		}
+		EXPECT(extractedCount == entryCount && failedCount == 0);
+	}
+
+	TestFreeFixture(image);
+	TestFreeFixture(fixture);
+}
+
+INTERNAL void TestArchiveRejection() {
+	TestBeginCase("GRF: Rejects archives with invalid headers");
+	test_fixture_t fixture;
+	if(!TestLoadFixture("test.grf", fixture)) return;
+
+	grf_archive_t archive;
+	uint8* bytes = TestCopyBytes(fixture.bytes, fixture.size);
+	bytes[0] = 'X';
+	EXPECT(!GRFOpenArchive(archive, bytes, fixture.size));
+	EXPECT(TestStringEquals(archive.errorMessage, "Signature should be \"Master of Magic\""));
+	memcpy(bytes, fixture.bytes, fixture.size);
+	bytes[offsetof(grf_header_t, key)] = 'K';
+	EXPECT(!GRFOpenArchive(archive, bytes, fixture.size));
+	EXPECT(TestStringEquals(archive.errorMessage, "Encryption is not currently supported"));
+	memcpy(bytes, fixture.bytes, fixture.size);
+	bytes[offsetof(grf_header_t, version) + 1] = 1;
+	EXPECT(!GRFOpenArchive(archive, bytes, fixture.size));
+	EXPECT(TestStringEquals(archive.errorMessage, "Only version 2.x archives are currently supported"));
+	memcpy(bytes, fixture.bytes, fixture.size);
+	bytes[offsetof(grf_header_t, fileTableOffset) + 3] = 0xFF;
+	EXPECT(!GRFOpenArchive(archive, bytes, fixture.size));
+	EXPECT(TestStringEquals(archive.errorMessage, "File table starts past the end of the archive"));
+	memcpy(bytes, fixture.bytes, fixture.size);
+	bytes[offsetof(grf_header_t, fileCount)] = 0xFF;
+	EXPECT(!GRFOpenArchive(archive, bytes, fixture.size));
+	EXPECT(TestStringEquals(archive.errorMessage, "File count exceeds what the file table can hold"));
+
+	TestBeginCase("GRF: Rejects archives whose file table or contents are corrupted");
+	memcpy(bytes, fixture.bytes, fixture.size);
+	bytes[fixture.size - 1] ^= 0xFF; // Last byte of the compressed file table (part of its checksum)
+	TestResetMemory();
+	EXPECT(!TestDecodeArchive(archive, bytes, fixture.size));
+	memcpy(bytes, fixture.bytes, fixture.size);
+	bytes[GRF_HEADER_SIZE + 16] ^= 0xFF; // Inside the first entry's compressed contents
+	EXPECT(!TestDecodeAndExtractArchive(bytes, fixture.size));
+	TestResetMemory();
+	if(EXPECT(TestDecodeArchive(archive, fixture.bytes, fixture.size))) {
+		grf_entry_t entry = archive.entries[0];
+		entry.offset = (uint32)fixture.size;
+		uint8* contents = NULL;
+		size_t size = 0;
+		EXPECT(!TestExtractArchiveEntry(archive, entry, contents, size));
+		entry = archive.entries[0];
+		entry.type = 2;
+		EXPECT(!TestExtractArchiveEntry(archive, entry, contents, size));
+	}
+	free(bytes);
+
+	TestBeginCase("GRF: Rejects truncated archives");
+	TestRejectsTruncatedCopies(TestDecodeAndExtractArchive, fixture);
+
+	TestBeginCase("GRF: Survives corrupted archives");
+	TestSurvivesCorruptedCopies(TestDecodeAndExtractArchive, fixture);
+
+	TestFreeFixture(fixture);
+}
+
+INTERNAL uint8* TestCompileTableOfContents(grf_archive_t& archive, cgrf_header_t& header) {
+	header = CGRFComputeLayout(archive);
+	size_t compiledSize = CGRFGetCompiledSize(header);
+	uint8* compiledIndex = (uint8*)malloc(compiledSize);
+	if(compiledIndex) CGRFCompileTableOfContents(archive, header, compiledIndex, compiledSize);
+	return compiledIndex;
+}
+
+// The file table is stored uncompressed (in a single deflate block), with an empty entry for each name
+INTERNAL size_t TestBuildArchive(const char** fileNames, uint32 fileCount, uint8* output) {
+	uint8 fileTable[TEST_GRF_MAX_FILE_TABLE_SIZE];
+	size_t fileTableSize = 0;
+	for(uint32 index = 0; index < fileCount; ++index) {
+		size_t nameLength = strlen(fileNames[index]);
+		memcpy(fileTable + fileTableSize, fileNames[index], nameLength + sizeof(ASCII_NULL_TERMINATOR));
+		fileTableSize += nameLength + sizeof(ASCII_NULL_TERMINATOR);
+		grf_file_entry_t fileEntry = {
+			.compressedSize = 0,
+			.byteAlignedSize = 0,
+			.decompressedSize = 0,
+			.nodeType = GRF_RAW_FILE_ENTRY_TYPE,
+			.offset = 0,
+		};
+		memcpy(fileTable + fileTableSize, &fileEntry, sizeof(fileEntry));
+		fileTableSize += sizeof(fileEntry);
+	}
+
+	grf_header_t header = {
+		.key = {},
+		.fileTableOffset = 0,
+		.scramblingSeed = 0,
+		.fileCount = fileCount + GRF_SCRAMBLING_OFFSET,
+		.version = GRF_SUPPORTED_MAJOR_VERSION << 8,
+	};
+	memcpy(header.signature, GRF_MAGIC_HEADER, sizeof(header.signature));
+	memcpy(output, &header, sizeof(header));
+
+	grf_file_table_t table;
+	table.decompressedSize = (uint32)fileTableSize;
+	table.compressedSize = (uint32)TestEncodeStoredDeflateBlock(fileTable, fileTableSize, true, output + GRF_HEADER_SIZE + sizeof(table));
+	memcpy(output + GRF_HEADER_SIZE, &table, sizeof(table));
+	return GRF_HEADER_SIZE + sizeof(table) + table.compressedSize;
+}
+
+INTERNAL void TestArchivesWithOversizedNames() {
+	TestBeginCase("GRF: Skips entries whose names are too long to transcode");
+	char oversizedName[GRF_MAX_PATH_LENGTH + 3] = {};
+	for(size_t index = 0; index < GRF_MAX_PATH_LENGTH + 1; index += 2)
+		memcpy(oversizedName + index, "\xB0\xA1", 2); // Hangul syllable (CP949)
+	const char* fileNames[] = { "before.txt", oversizedName, "after.txt" };
+	uint8* bytes = (uint8*)malloc(TEST_GRF_MAX_FILE_TABLE_SIZE + GRF_HEADER_SIZE + 64);
+	size_t size = TestBuildArchive(fileNames, 3, bytes);
+
+	TestResetMemory();
+	grf_archive_t archive;
+	if(EXPECT(TestDecodeArchive(archive, bytes, size))) {
+		EXPECT(archive.fileCount == 2 && archive.skippedEntryCount == 1);
+		EXPECT(GRFFindEntry(archive, StringLiteral("before.txt")) == &archive.entries[0]);
+		EXPECT(GRFFindEntry(archive, StringLiteral("after.txt")) == &archive.entries[1]);
+
+		TestBeginCase("CGRF: Restores archives with skipped entries");
+		cgrf_header_t header;
+		uint8* compiledIndex = TestCompileTableOfContents(archive, header);
+		grf_archive_t restoredArchive;
+		EXPECT(GRFOpenArchive(restoredArchive, bytes, size));
+		if(EXPECT(CGRFRestoreTableOfContents(restoredArchive, compiledIndex, CGRFGetCompiledSize(header)))) {
+			EXPECT(restoredArchive.fileCount == 2 && restoredArchive.skippedEntryCount == 1);
+			EXPECT(GRFFindEntry(restoredArchive, StringLiteral("after.txt")) == &restoredArchive.entries[1]);
+		}
+		free(compiledIndex);
+	}
+
+	TestBeginCase("GRF: Skips entries whose names are too long to look up");
+	char longestName[GRF_MAX_PATH_LENGTH + 1] = {};
+	char oversizedASCIIName[GRF_MAX_PATH_LENGTH + 2] = {};
+	char oversizedUTF8Name[GRF_MAX_PATH_LENGTH * 3 / 4 + 1] = {}; // Fits before transcoding, but not afterwards (two CP949 bytes per three UTF-8 bytes)
+	memset(longestName, 'a', GRF_MAX_PATH_LENGTH);
+	memset(oversizedASCIIName, 'b', GRF_MAX_PATH_LENGTH + 1);
+	for(size_t index = 0; index < GRF_MAX_PATH_LENGTH * 3 / 4; index += 2)
+		memcpy(oversizedUTF8Name + index, "\xB0\xA1", 2);
+	const char* longFileNames[] = { oversizedASCIIName, longestName, oversizedUTF8Name, "after.txt" };
+	size = TestBuildArchive(longFileNames, 4, bytes);
+
+	TestResetMemory();
+	if(EXPECT(TestDecodeArchive(archive, bytes, size))) {
+		EXPECT(archive.fileCount == 2 && archive.skippedEntryCount == 2);
+		EXPECT(GRFFindEntry(archive, StringCreateFromSlice((uint8*)longestName, GRF_MAX_PATH_LENGTH)) == &archive.entries[0]);
+		EXPECT(GRFFindEntry(archive, StringLiteral("after.txt")) == &archive.entries[1]);
+	}
+	free(bytes);
+}
+
+INTERNAL void TestCompiledTableOfContents() {
+	TestBeginCase("CGRF: Restores the compiled file table");
+	test_fixture_t fixture;
+	if(!TestLoadFixture("test.grf", fixture)) return;
+
+	TestResetMemory();
+	grf_archive_t decodedArchive;
+	if(!EXPECT(TestDecodeArchive(decodedArchive, fixture.bytes, fixture.size))) {
+		TestFreeFixture(fixture);
+		return;
+	}
+
+	cgrf_header_t header;
+	uint8* compiledIndex = TestCompileTableOfContents(decodedArchive, header);
+	size_t compiledSize = CGRFGetCompiledSize(header);
+	EXPECT(compiledSize % CGRF_SECTION_ALIGNMENT == 0);
+
+	grf_archive_t restoredArchive;
+	EXPECT(GRFOpenArchive(restoredArchive, fixture.bytes, fixture.size));
+	if(EXPECT(CGRFRestoreTableOfContents(restoredArchive, compiledIndex, compiledSize))) {
+		EXPECT(CGRFVerifySourceContents(restoredArchive, compiledIndex));
+		EXPECT(memcmp(restoredArchive.entries, decodedArchive.entries, decodedArchive.fileCount * sizeof(grf_entry_t)) == 0);
+		for(uint32 index = 0; index < decodedArchive.fileCount; ++index) {
+			String fileName = GRFGetEntryName(decodedArchive, decodedArchive.entries[index]);
+			grf_entry_t* restoredEntry = GRFFindEntry(restoredArchive, fileName);
+			EXPECT(restoredEntry == &restoredArchive.entries[index]);
+			EXPECT(restoredEntry && TestStringEquals(GRFGetEntryName(restoredArchive, *restoredEntry), fileName.buffer));
+		}
+		TestExpectArchiveEntry(restoredArchive, "hello-grf.txt", (const uint8*)TEST_TOP_LEVEL_TEXT_FILE_CONTENTS, sizeof(TEST_TOP_LEVEL_TEXT_FILE_CONTENTS) - 1);
+	}
+
+	TestBeginCase("CGRF: Compiling is deterministic");
+	cgrf_header_t recompiledHeader;
+	uint8* recompiledIndex = TestCompileTableOfContents(decodedArchive, recompiledHeader);
+	EXPECT(recompiledIndex && memcmp(compiledIndex, recompiledIndex, compiledSize) == 0);
+	free(recompiledIndex);
+
+	TestBeginCase("CGRF: Rejects indices that don't match the archive");
+	uint8* bytes = TestCopyBytes(compiledIndex, compiledSize);
+	bytes[0] = 'X';
+	EXPECT(!CGRFRestoreTableOfContents(restoredArchive, bytes, compiledSize));
+	EXPECT(TestStringEquals(restoredArchive.errorMessage, "Signature should be \"CGRF\""));
+	memcpy(bytes, compiledIndex, compiledSize);
+	bytes[offsetof(cgrf_header_t, semanticVersion)] = CGRF_MAJOR_VERSION + 1;
+	EXPECT(!CGRFRestoreTableOfContents(restoredArchive, bytes, compiledSize));
+	EXPECT(TestStringEquals(restoredArchive.errorMessage, "Unsupported CGRF version"));
+	memcpy(bytes, compiledIndex, compiledSize);
+	bytes[offsetof(cgrf_header_t, source) + offsetof(cgrf_source_t, compressedTableSize)] ^= 0xFF;
+	EXPECT(!CGRFRestoreTableOfContents(restoredArchive, bytes, compiledSize));
+	EXPECT(TestStringEquals(restoredArchive.errorMessage, "Index was compiled from a different archive"));
+	memcpy(bytes, compiledIndex, compiledSize);
+	bytes[offsetof(cgrf_header_t, nameSlots)] += 4; // Misaligned
+	EXPECT(!CGRFRestoreTableOfContents(restoredArchive, bytes, compiledSize));
+	memcpy(bytes, compiledIndex, compiledSize);
+	bytes[offsetof(cgrf_header_t, source) + offsetof(cgrf_source_t, contentHash)] ^= 0xFF;
+	EXPECT(CGRFRestoreTableOfContents(restoredArchive, bytes, compiledSize));
+	EXPECT(!CGRFVerifySourceContents(restoredArchive, bytes));
+	EXPECT(TestStringEquals(restoredArchive.errorMessage, "Index is outdated (file table contents have changed)"));
+	free(bytes);
+
+	TestBeginCase("CGRF: Rejects truncated indices");
+	// NOTE: The alignment padding at the end isn't needed to restore the index (so it may be missing)
+	size_t requiredSize = header.nameCharacters.offset + header.nameCharacters.size;
+	size_t firstAcceptedSize = requiredSize;
+	for(size_t size = 0; size < requiredSize; ++size) {
+		uint8* truncatedIndex = TestCopyBytes(compiledIndex, size);
+		if(CGRFRestoreTableOfContents(restoredArchive, truncatedIndex, size) && firstAcceptedSize == requiredSize) firstAcceptedSize = size;
+		free(truncatedIndex);
+	}
+	EXPECT(firstAcceptedSize == requiredSize);
+
+	TestBeginCase("CGRF: Rejects indices with out-of-bounds contents");
+	// Name IDs, entry indices, and character offsets (in that order) - slot IDs are checked separately since they may be empty
+	size_t corruptedOffsets[] = {
+		header.entries.offset + offsetof(grf_entry_t, name),
+		header.entryIndicesByName.offset + sizeof(uint32),
+		header.nameEntries.offset + sizeof(intern_table_entry_t) + offsetof(intern_table_entry_t, offset),
+		header.nameEntries.offset + sizeof(intern_table_entry_t) + offsetof(intern_table_entry_t, length),
+	};
+	bytes = TestCopyBytes(compiledIndex, compiledSize);
+	for(size_t offset : corruptedOffsets) {
+		memcpy(bytes, compiledIndex, compiledSize);
+		TestWriteUnsignedInt32(bytes + offset, UINT32_MAX);
+		EXPECT(!CGRFRestoreTableOfContents(restoredArchive, bytes, compiledSize));
+		EXPECT(TestStringEquals(restoredArchive.errorMessage, "Index contents are corrupted"));
+	}
+	memcpy(bytes, compiledIndex, compiledSize);
+	intern_table_slot_t* slots = (intern_table_slot_t*)(bytes + header.nameSlots.offset);
+	uint32 slotIndex = 0;
+	while(slots[slotIndex].id != INVALID_STRING_ID)
+		slotIndex++;
+	slots[slotIndex].id = header.nameCount + 1;
+	EXPECT(!CGRFRestoreTableOfContents(restoredArchive, bytes, compiledSize));
+	slots[slotIndex].id = 1; // Occupied slots must match the names exactly (or lookups might never terminate)
+	EXPECT(!CGRFRestoreTableOfContents(restoredArchive, bytes, compiledSize));
+	memcpy(bytes, compiledIndex, compiledSize);
+	bytes[header.nameCharacters.offset + header.nameCharacters.size - 1] = 'X'; // Terminator of the last name
+	EXPECT(!CGRFRestoreTableOfContents(restoredArchive, bytes, compiledSize));
+
+	TestBeginCase("CGRF: Survives corrupted indices");
+	for(size_t offset = 0; offset < compiledSize; ++offset) {
+		memcpy(bytes, compiledIndex, compiledSize);
+		bytes[offset] ^= 0xFF;
+		grf_archive_t corruptedArchive;
+		GRFOpenArchive(corruptedArchive, fixture.bytes, fixture.size);
+		if(!CGRFRestoreTableOfContents(corruptedArchive, bytes, compiledSize)) continue;
+
+		// Whatever was accepted must be safe to use (the names may still be wrong, but they're all in bounds)
+		for(uint32 index = 0; index < corruptedArchive.fileCount; ++index) {
+			String fileName = GRFGetEntryName(corruptedArchive, corruptedArchive.entries[index]);
+			GRFFindEntry(corruptedArchive, fileName);
+		}
+	}
+	free(bytes);
+
+	free(compiledIndex);
+	TestFreeFixture(fixture);
+}
+
+typedef struct test_rgz_entry {
+	uint8 type;
+	uint32 size;
+	uint32 receivedSize;
+	uint32 checksum; // CRC-32 of the received contents
+	char name[TEST_MAX_PATH_LENGTH];
+} test_rgz_entry_t;
+
+typedef struct test_rgz_listing {
+	uint32 entryCount;
+	uint32 chunkCount;
+	bool shouldRejectContents;
+	test_rgz_entry_t entries[TEST_MAX_RECORDED_ENTRIES];
+} test_rgz_listing_t;
+
+INTERNAL bool TestRecordArchiveEntry(void* context, rgz_entry_t& entry) {
+	test_rgz_listing_t& listing = *(test_rgz_listing_t*)context;
+	if(listing.entryCount == TEST_MAX_RECORDED_ENTRIES) return true;
+
+	test_rgz_entry_t& recordedEntry = listing.entries[listing.entryCount++];
+	recordedEntry = {
+		.type = entry.type,
+		.size = entry.size,
+		.receivedSize = 0,
+		.checksum = 0,
+	};
+	snprintf(recordedEntry.name, sizeof(recordedEntry.name), "%.*s", (int)entry.name.length, entry.name.buffer);
+	return true;
+}
+
+INTERNAL bool TestRecordArchiveContents(void* context, rgz_entry_t& entry, const uint8* contents, size_t size) {
+	test_rgz_listing_t& listing = *(test_rgz_listing_t*)context;
+	if(listing.shouldRejectContents) return false;
+
+	listing.chunkCount++;
+	test_rgz_entry_t& recordedEntry = listing.entries[listing.entryCount - 1];
+	recordedEntry.receivedSize += (uint32)size;
+	recordedEntry.checksum = ComputeCRC32Checksum(contents, size, recordedEntry.checksum);
+	return true;
+}
+
+INTERNAL bool TestListPatchArchive(const uint8* bytes, size_t size, size_t windowSize, test_rgz_listing_t& listing, String& errorMessage) {
+	TestResetMemory();
+	rgz_sink_t sink = {
+		.context = &listing,
+		.beginEntry = TestRecordArchiveEntry,
+		.writeContents = TestRecordArchiveContents,
+		.endEntry = NULL,
+	};
+
+	rgz_archive_t* archive = (rgz_archive_t*)ArenaAllocateMemoryRegion(TEST_CONTEXT.persistentMemory, sizeof(rgz_archive_t));
+	uint8* window = (uint8*)ArenaAllocateMemoryRegion(TEST_CONTEXT.transientMemory, windowSize);
+	bool wasDecoded = RGZOpenArchive(*archive, bytes, size, window, windowSize) && RGZDecodeEntries(*archive, sink);
+	errorMessage = archive->errorMessage;
+	return wasDecoded;
+}
+
+INTERNAL bool TestDecodePatchArchive(const uint8* bytes, size_t size) {
+	test_rgz_listing_t listing = {};
+	String errorMessage = StringLiteral("OK");
+	return TestListPatchArchive(bytes, size, RGZ_DEFAULT_WINDOW_SIZE, listing, errorMessage);
+}
+
+INTERNAL void TestExpectPatchEntry(test_rgz_entry_t& entry, uint8 type, const char* name, const uint8* contents, size_t size) {
+	EXPECT(entry.type == type);
+	EXPECT(TestStringEquals(TestCreateString(entry.name), name));
+	EXPECT(entry.size == size && entry.receivedSize == size);
+	EXPECT(entry.checksum == ComputeCRC32Checksum(contents, size, 0));
+}
+
+INTERNAL void TestPatchArchives() {
+	TestBeginCase("RGZ: Streams every entry");
+	test_fixture_t fixture;
+	test_fixture_t image;
+	if(!TestLoadFixture("test.rgz", fixture) || !TestLoadFixture("UPPERCASE.PNG", image)) return;
+
+	// The smallest window forces the decoder to continue entries (and their headers) across chunks
+	size_t windowSizes[] = { RGZ_DEFAULT_WINDOW_SIZE, 2 * INFLATE_HISTORY_SIZE };
+	for(size_t windowSize : windowSizes) {
+		test_rgz_listing_t listing = {};
+		String errorMessage = StringLiteral("OK");
+		EXPECT(TestListPatchArchive(fixture.bytes, fixture.size, windowSize, listing, errorMessage));
+		if(!EXPECT(listing.entryCount == 5)) continue;
+
+		TestExpectPatchEntry(listing.entries[0], RGZ_DIRECTORY_ENTRY_TYPE, "subdirectory", NULL, 0);
+		TestExpectPatchEntry(listing.entries[1], RGZ_FILE_ENTRY_TYPE, "subdirectory\\hello.txt", (const uint8*)TEST_NESTED_TEXT_FILE_CONTENTS,
+			sizeof(TEST_NESTED_TEXT_FILE_CONTENTS) - 1);
+		TestExpectPatchEntry(listing.entries[2], RGZ_FILE_ENTRY_TYPE, "hello-grf.txt", (const uint8*)TEST_TOP_LEVEL_TEXT_FILE_CONTENTS,
+			sizeof(TEST_TOP_LEVEL_TEXT_FILE_CONTENTS) - 1);
+		TestExpectPatchEntry(listing.entries[3], RGZ_FILE_ENTRY_TYPE, "UPPERCASE.PNG", image.bytes, image.size);
+		TestExpectPatchEntry(listing.entries[4], RGZ_FILE_ENTRY_TYPE, TEST_KOREAN_FILE_NAME, (const uint8*)TEST_KOREAN_FILE_CONTENTS,
+			sizeof(TEST_KOREAN_FILE_CONTENTS) - 1);
+	}
+
+	TestBeginCase("RGZ: Aborts if the contents can't be stored");
+	test_rgz_listing_t listing = { .shouldRejectContents = true };
+	String errorMessage = StringLiteral("OK");
+	EXPECT(!TestListPatchArchive(fixture.bytes, fixture.size, RGZ_DEFAULT_WINDOW_SIZE, listing, errorMessage));
+	EXPECT(TestStringEquals(errorMessage, "Failed to store the file contents"));
+
+	TestBeginCase("RGZ: Rejects corrupted archives");
+	uint8* bytes = TestCopyBytes(fixture.bytes, fixture.size);
+	bytes[0] = 0;
+	EXPECT(!TestDecodePatchArchive(bytes, fixture.size));
+	memcpy(bytes, fixture.bytes, fixture.size);
+	bytes[fixture.size - GZIP_TRAILER_SIZE] ^= 0xFF; // Checksum
+	EXPECT(!TestDecodePatchArchive(bytes, fixture.size));
+	memcpy(bytes, fixture.bytes, fixture.size);
+	bytes[fixture.size - 1] ^= 0xFF; // Size
+	EXPECT(!TestDecodePatchArchive(bytes, fixture.size));
+	// Every byte of the compressed stream (and the trailer) is covered by the checksum
+	size_t firstAcceptedOffset = fixture.size;
+	for(size_t offset = GZIP_HEADER_SIZE; offset < fixture.size; ++offset) {
+		memcpy(bytes, fixture.bytes, fixture.size);
+		bytes[offset] ^= 0xFF;
+		if(TestDecodePatchArchive(bytes, fixture.size) && firstAcceptedOffset == fixture.size) firstAcceptedOffset = offset;
+	}
+	EXPECT(firstAcceptedOffset == fixture.size);
+	free(bytes);
+
+	TestBeginCase("RGZ: Rejects truncated archives");
+	TestRejectsTruncatedCopies(TestDecodePatchArchive, fixture);
+
+	TestBeginCase("RGZ: Survives corrupted archives");
+	TestSurvivesCorruptedCopies(TestDecodePatchArchive, fixture);
+
+	TestFreeFixture(image);
+	TestFreeFixture(fixture);
+}
+
+typedef struct test_pak_file {
+	const char* name; // CP949
+	const char* decodedName; // UTF-8
+	const char* contents;
+	uint8 type;
+	bool isCompressed;
+	bool hasZlibHeader;
+} test_pak_file_t;
+
+// There's no fixture (the format is only used by Arcturus), so archives are assembled in memory instead
+GLOBAL const test_pak_file_t TEST_PAK_FILES[] = {
+	{ "data", "data", "", PAK_DIRECTORY_ENTRY_TYPE, false, false },
+	{ "data/stored.txt", "data/stored.txt", "Stored as-is", PAK_FILE_ENTRY_TYPE, false, false },
+	{ "data/deflate.txt", "data/deflate.txt", "Raw deflate stream", PAK_FILE_ENTRY_TYPE, true, false },
+	{ "data/zlib.txt", "data/zlib.txt", "Deflate stream with zlib header", PAK_FILE_ENTRY_TYPE, true, true },
+	{ TEST_CP949_EVENT_NAME, TEST_KOREAN_EVENT_NAME, "Stored with a CP949 name", PAK_FILE_ENTRY_TYPE, false, false },
+};
+constexpr uint32 TEST_PAK_FILE_COUNT = sizeof(TEST_PAK_FILES) / sizeof(TEST_PAK_FILES[0]);
+constexpr size_t TEST_PAK_MAX_SIZE = 4096;
+
+// The trailer stores the entry count at a different position depending on the version (the other one is left as zero)
+INTERNAL size_t TestBuildAssetPack(uint32 version, uint8* output) {
+	uint32 offsets[TEST_PAK_FILE_COUNT];
+	uint32 compressedSizes[TEST_PAK_FILE_COUNT];
+	size_t offset = 0;
+	for(uint32 index = 0; index < TEST_PAK_FILE_COUNT; ++index) {
+		const test_pak_file_t& file = TEST_PAK_FILES[index];
+		size_t size = strlen(file.contents);
+		offsets[index] = (uint32)offset;
+		if(file.isCompressed) {
+			offset += TestEncodeStoredDeflateBlock((const uint8*)file.contents, size, file.hasZlibHeader, output + offset);
+		} else {
+			memcpy(output + offset, file.contents, size);
+			offset += size;
+		}
+		compressedSizes[index] = (uint32)(offset - offsets[index]);
+	}
+
+	size_t fileTableOffset = offset;
+	for(uint32 index = 0; index < TEST_PAK_FILE_COUNT; ++index) {
+		const test_pak_file_t& file = TEST_PAK_FILES[index];
+		size_t nameLength = strlen(file.name);
+		pak_file_entry_t fileEntry = {
+			.nameLength = (uint8)nameLength,
+			.type = file.type,
+			.offset = (int32)offsets[index],
+			.compressedSize = (int32)compressedSizes[index],
+			.decompressedSize = (int32)strlen(file.contents),
+		};
+		memcpy(output + offset, &fileEntry, sizeof(fileEntry));
+		offset += sizeof(fileEntry);
+		memcpy(output + offset, file.name, nameLength + sizeof(ASCII_NULL_TERMINATOR));
+		offset += nameLength + sizeof(ASCII_NULL_TERMINATOR);
+	}
+
+	uint8* trailer = output + offset;
+	memset(trailer, 0, PAK_TRAILER_SIZE);
+	TestWriteUnsignedInt32(trailer, (uint32)fileTableOffset);
+	trailer[4 + 2 * version] = (uint8)TEST_PAK_FILE_COUNT;
+	return offset + PAK_TRAILER_SIZE;
+}
+
+INTERNAL bool TestDecodeAssetPackFileTable(pak_archive_t& archive, const uint8* bytes, size_t size) {
+	if(!PAKOpenArchive(archive, bytes, size)) return false;
+	if(!ArenaCanAllocate(TEST_CONTEXT.persistentMemory, PAKGetRequiredMemorySize(archive))) return false;
+	return PAKDecodeFileTable(archive, TEST_CONTEXT.persistentMemory);
+}
+
+INTERNAL bool TestExtractAssetPackEntry(pak_archive_t& archive, pak_entry_t& entry, uint8*& contents, size_t& size, String& errorMessage) {
+	if(!ArenaCanAllocate(TEST_CONTEXT.transientMemory, entry.decompressedSize)) return false;
+	contents = (uint8*)ArenaAllocateMemoryRegion(TEST_CONTEXT.transientMemory, entry.decompressedSize);
+	return PAKExtractEntry(archive, entry, contents, entry.decompressedSize, size, errorMessage);
+}
+
+INTERNAL bool TestDecodeAssetPack(const uint8* bytes, size_t size) {
+	TestResetMemory();
+	pak_archive_t archive;
+	if(!TestDecodeAssetPackFileTable(archive, bytes, size)) return false;
+
+	bool wereAllEntriesExtracted = true;
+	for(uint32 index = 0; index < archive.entryCount; ++index) {
+		pak_entry_t& entry = archive.entries[index];
+		if(!PAKIsFileEntry(entry)) continue;
+
+		uint8* contents = NULL;
+		size_t extractedSize = 0;
+		String errorMessage = StringLiteral("OK");
+		if(!TestExtractAssetPackEntry(archive, entry, contents, extractedSize, errorMessage)) wereAllEntriesExtracted = false;
+	}
+	return wereAllEntriesExtracted;
+}
+
+// The test archive's file table is the only one with these exact entries, so truncated copies can't decode to the same one
+INTERNAL bool TestDecodeOriginalAssetPack(const uint8* bytes, size_t size) {
+	if(!TestDecodeAssetPack(bytes, size)) return false;
+	pak_archive_t archive;
+	TestResetMemory();
+	if(!TestDecodeAssetPackFileTable(archive, bytes, size) || archive.entryCount != TEST_PAK_FILE_COUNT) return false;
+
+	for(uint32 index = 0; index < TEST_PAK_FILE_COUNT; ++index) {
+		if(!TestStringEquals(PAKGetEntryName(archive, archive.entries[index]), TEST_PAK_FILES[index].decodedName)) return false;
+	}
+	return true;
+}
+
+INTERNAL bool TestVerifyExtractedAssetPackEntry(bulk_extraction_worker_t& worker, bulk_extraction_entry_t& entry) {
+	const test_pak_file_t& file = TEST_PAK_FILES[entry.index];
+	if(!entry.contents || !TestStringEquals(entry.name, file.decodedName)) return false;
+	return TestBytesEqual(entry.contents, entry.size, (const uint8*)file.contents, strlen(file.contents));
+}
+
+INTERNAL void TestAssetPacks() {
+	test_fixture_t fixture = {
+		.bytes = (uint8*)malloc(TEST_PAK_MAX_SIZE),
+		.size = 0,
+	};
+
+	for(uint32 version = 0; version < PAK_VERSION_COUNT; ++version) {
+		TestBeginCase("PAK: Decodes the file table and extracts every entry");
+		fixture.size = TestBuildAssetPack(version, fixture.bytes);
+		TestResetMemory();
+
+		pak_archive_t archive;
+		if(!EXPECT(TestDecodeAssetPackFileTable(archive, fixture.bytes, fixture.size))) continue;
+		EXPECT(archive.version == version);
+		if(!EXPECT(archive.entryCount == TEST_PAK_FILE_COUNT)) continue;
+
+		for(uint32 index = 0; index < TEST_PAK_FILE_COUNT; ++index) {
+			const test_pak_file_t& file = TEST_PAK_FILES[index];
+			pak_entry_t& entry = archive.entries[index];
+			EXPECT(TestStringEquals(PAKGetEntryName(archive, entry), file.decodedName));
+			EXPECT(archive.names[entry.nameOffset + entry.nameLength] == ASCII_NULL_TERMINATOR);
+			EXPECT(PAKIsFileEntry(entry) == (file.type == PAK_FILE_ENTRY_TYPE));
+			if(!PAKIsFileEntry(entry)) continue;
+
+			uint8* contents = NULL;
+			size_t size = 0;
+			String errorMessage = StringLiteral("OK");
+			EXPECT(TestExtractAssetPackEntry(archive, entry, contents, size, errorMessage));
+			EXPECT(TestBytesEqual(contents, size, (const uint8*)file.contents, strlen(file.contents)));
+		}
+
+		TestBeginCase("PAK: Extracts entries by prefix on multiple threads");
+		uint32 entryIndices[TEST_PAK_FILE_COUNT];
+		uint32 entryCount = PAKCollectEntriesByPrefix(archive, StringLiteral("data/"), entryIndices);
+		EXPECT(entryCount == 3);
+		size_t scratchSize = PAKGetLargestExtractedSize(archive, entryIndices, entryCount);
+		EXPECT(scratchSize == strlen(TEST_PAK_FILES[3].contents));
+
+		bulk_extraction_job_t job = {
+			.archive = &archive,
+			.extractEntry = PAKExtractBulkEntry,
+			.entryIndices = entryIndices,
+			.entryCount = entryCount,
+			.batchCount = 0,
+			.claimedBatchCount = 0,
+			.sink = TestVerifyExtractedAssetPackEntry,
+			.sinkContext = NULL,
+		};
+		bulk_extraction_worker_t workers[TEST_EXTRACTION_WORKER_COUNT] = {};
+		for(uint32 workerIndex = 0; workerIndex < TEST_EXTRACTION_WORKER_COUNT; ++workerIndex) {
+			workers[workerIndex].scratchMemory = {
+				.baseAddress = ArenaAllocateMemoryRegion(TEST_CONTEXT.transientMemory, scratchSize),
+				.reservedSize = scratchSize,
+				.committedSize = scratchSize,
+			};
+		}
+		BulkExtractionRunJob(job, workers, TEST_EXTRACTION_WORKER_COUNT);
+
+		uint32 extractedCount = 0;
+		uint32 failedCount = 0;
+		for(bulk_extraction_worker_t& worker : workers) {
+			extractedCount += worker.extractedCount;
+			failedCount += worker.failedCount;
+		}
+		EXPECT(extractedCount == entryCount && failedCount == 0);
+	}
+
+	TestBeginCase("PAK: Rejects corrupted entries");
+	TestResetMemory();
+	pak_archive_t archive;
+	uint8* bytes = TestCopyBytes(fixture.bytes, fixture.size);
+	if(EXPECT(TestDecodeAssetPackFileTable(archive, bytes, fixture.size))) {
+		uint8* contents = NULL;
+		size_t size = 0;
+		String errorMessage = StringLiteral("OK");
+		bytes[archive.entries[3].offset + archive.entries[3].compressedSize - 1] ^= 0xFF; // Checksum
+		EXPECT(!TestExtractAssetPackEntry(archive, archive.entries[3], contents, size, errorMessage));
+		EXPECT(TestStringEquals(errorMessage, "Checksum mismatch (the decompressed data is corrupted)"));
+		bytes[archive.entries[2].offset + 3] ^= 0xFF; // Length complement
+		EXPECT(!TestExtractAssetPackEntry(archive, archive.entries[2], contents, size, errorMessage));
+
+		pak_entry_t entry = archive.entries[1];
+		entry.offset = (uint32)fixture.size;
+		EXPECT(!TestExtractAssetPackEntry(archive, entry, contents, size, errorMessage));
+		EXPECT(TestStringEquals(errorMessage, "Entry extends past the end of the archive"));
+	}
+	memcpy(bytes, fixture.bytes, fixture.size);
+	memset(bytes + fixture.size - PAK_TRAILER_SIZE + 4, 0xFF, 2 * sizeof(uint16)); // Entry counts
+	EXPECT(!PAKOpenArchive(archive, bytes, fixture.size));
+	EXPECT(TestStringEquals(archive.errorMessage, "File table doesn't match any known PAK layout"));
+	free(bytes);
+
+	TestBeginCase("PAK: Rejects truncated archives");
+	TestRejectsTruncatedCopies(TestDecodeOriginalAssetPack, fixture);
+
+	TestBeginCase("PAK: Survives corrupted archives");
+	TestSurvivesCorruptedCopies(TestDecodeAssetPack, fixture);
+
+	TestFreeFixture(fixture);
+}
+
+INTERNAL bool TestDecodeSpriteSheet(spr_sprite_sheet_t& sheet, const uint8* bytes, size_t size) {
+	if(!SPROpenSpriteSheet(sheet, bytes, size)) return false;
+	if(!ArenaCanAllocate(TEST_CONTEXT.persistentMemory, SPRGetRequiredMemorySize(sheet))) return false;
+	return SPRDecodeImages(sheet, TEST_CONTEXT.persistentMemory);
+}
+
+INTERNAL bool TestDecodeAnySpriteSheet(const uint8* bytes, size_t size) {
+	TestResetMemory();
+	spr_sprite_sheet_t sheet;
+	return TestDecodeSpriteSheet(sheet, bytes, size);
+}
+
+INTERNAL bool TestImageEquals(offscreen_buffer_t& image, int width, int height, const uint32* pixels) {
+	if(image.width != width || image.height != height) return false;
+	return memcmp(image.pixelBuffer, pixels, (size_t)width * height * sizeof(uint32)) == 0;
+}
+
+INTERNAL void TestSpriteSheets() {
+	// Same pixels in every fixture, except for the RLE-encoded one (where some of them use the background color)
+	constexpr uint32 OPAQUE = 0xFF424242;
+	constexpr uint32 BACKGROUND = 0x00090807;
+	const uint32 firstImage[] = { OPAQUE, OPAQUE, OPAQUE, OPAQUE, OPAQUE, OPAQUE };
+	const uint32 secondImage[] = { OPAQUE, OPAQUE, OPAQUE, OPAQUE, OPAQUE, OPAQUE };
+	const uint32 secondEncodedImage[] = { OPAQUE, BACKGROUND, BACKGROUND, OPAQUE, OPAQUE, OPAQUE };
+	const uint32 trueColorImage[] = { 0xAAAAAAAA, 0xBBBBBBBB, 0xCCCCCCCC, 0xDDDDDDDD };
+
+	const char* fileNames[] = { "bmp-paletted.spr", "bmp-tga-paletted.spr", "rle-bmp-tga-paletted.spr" };
+	uint8 expectedVersions[][2] = { { 1, 1 }, { 2, 0 }, { 2, 1 } };
+	for(size_t fixtureIndex = 0; fixtureIndex < sizeof(fileNames) / sizeof(fileNames[0]); ++fixtureIndex) {
+		TestBeginCase("SPR: Decodes indexed-color and true-color images");
+		test_fixture_t fixture;
+		if(!TestLoadFixture(fileNames[fixtureIndex], fixture)) continue;
+
+		TestResetMemory();
+		spr_sprite_sheet_t sheet;
+		if(EXPECT(TestDecodeSpriteSheet(sheet, fixture.bytes, fixture.size))) {
+			bool hasTrueColorImages = sheet.majorVersion >= 2;
+			EXPECT(sheet.majorVersion == expectedVersions[fixtureIndex][0] && sheet.minorVersion == expectedVersions[fixtureIndex][1]);
+			EXPECT(sheet.indexedImageCount == 2);
+			EXPECT(sheet.trueColorImageCount == (hasTrueColorImages ? 1 : 0));
+			EXPECT(rgba_color_t{ .bytes = sheet.palette[SPR_TRANSPARENT_COLOR_INDEX] }.alpha == 0);
+
+			EXPECT(TestImageEquals(sheet.images[0], 2, 3, firstImage));
+			EXPECT(TestImageEquals(sheet.images[1], 3, 2, SPRUsesRunLengthEncoding(sheet) ? secondEncodedImage : secondImage));
+			if(hasTrueColorImages) EXPECT(TestImageEquals(sheet.images[2], 1, 4, trueColorImage));
+		}
+
+		TestBeginCase("SPR: Rejects truncated sprite sheets");
+		TestRejectsTruncatedCopies(TestDecodeAnySpriteSheet, fixture);
+
+		TestBeginCase("SPR: Survives corrupted sprite sheets");
+		TestSurvivesCorruptedCopies(TestDecodeAnySpriteSheet, fixture);
+
+		TestFreeFixture(fixture);
+	}
+
+	TestBeginCase("SPR: Rejects invalid headers and images");
+	test_fixture_t fixture;
+	if(!TestLoadFixture("rle-bmp-tga-paletted.spr", fixture)) return;
+	spr_sprite_sheet_t sheet;
+	uint8* bytes = TestCopyBytes(fixture.bytes, fixture.size);
+	bytes[0] = 'X';
+	EXPECT(!SPROpenSpriteSheet(sheet, bytes, fixture.size));
+	EXPECT(TestStringEquals(sheet.errorMessage, "Signature should be \"SP\""));
+	memcpy(bytes, fixture.bytes, fixture.size);
+	bytes[3] = 1;
+	bytes[2] = 0;
+	EXPECT(!SPROpenSpriteSheet(sheet, bytes, fixture.size));
+	EXPECT(TestStringEquals(sheet.errorMessage, "Unsupported SPR version"));
+	memcpy(bytes, fixture.bytes, fixture.size);
+	bytes[4] = 3; // One more indexed image than there actually is
+	EXPECT(!SPROpenSpriteSheet(sheet, bytes, fixture.size));
+	// Run lengths that overflow the image are only detected while decoding (the header only stores the compressed size)
+	memcpy(bytes, fixture.bytes, fixture.size);
+	bytes[8 + 3 * sizeof(uint16) + 6 + 3 * sizeof(uint16) + 2] = 0xFF; // Length of the second image's only run
+	TestResetMemory();
+	EXPECT(!TestDecodeSpriteSheet(sheet, bytes, fixture.size));
+	EXPECT(TestStringEquals(sheet.errorMessage, "Run-length encoded data exceeds the image size"));
+	free(bytes);
+	TestFreeFixture(fixture);
+
+	TestBeginCase("SPR: Rejects files whose palette overlaps the header");
+	// Large enough for the v1 header and palette, but the v2 header (with its true-color image count) doesn't fit anymore
+	for(size_t size = 4 + sizeof(uint16) + SPR_PALETTE_SIZE; size < 4 + 2 * sizeof(uint16) + SPR_PALETTE_SIZE; ++size) {
+		bytes = (uint8*)calloc(1, size);
+		memcpy(bytes, SPR_SIGNATURE, sizeof(SPR_SIGNATURE) - 1);
+		bytes[2] = 1;
+		bytes[3] = 2;
+		bytes[4] = 0xFF;
+		bytes[5] = 0xFF;
+		EXPECT(!SPROpenSpriteSheet(sheet, bytes, size));
+		EXPECT(TestStringEquals(sheet.errorMessage, "File is too small to be a SPR file"));
+		free(bytes);
+	}
+}
+
+INTERNAL bool TestDecodeAnimation(act_animation_t& animation, const uint8* bytes, size_t size) {
+	if(!ACTOpenAnimation(animation, bytes, size)) return false;
+	if(!ArenaCanAllocate(TEST_CONTEXT.persistentMemory, ACTGetRequiredMemorySize(animation))) return false;
+	ACTDecodeAnimation(animation, TEST_CONTEXT.persistentMemory);
+	return true;
+}
+
+INTERNAL bool TestDecodeAnyAnimation(const uint8* bytes, size_t size) {
+	TestResetMemory();
+	act_animation_t animation;
+	return TestDecodeAnimation(animation, bytes, size);
+}
+
+INTERNAL uint8* TestCompileAnimation(act_animation_t& animation, test_fixture_t& source, size_t& compiledSize) {
+	cact_header_t header = CACTComputeLayout(animation, source.bytes, source.size);
+	compiledSize = CACTGetCompiledSize(header);
+	uint8* compiledAnimation = (uint8*)malloc(compiledSize);
+	if(compiledAnimation) CACTCompileAnimation(animation, header, compiledAnimation, compiledSize);
+	return compiledAnimation;
+}
+
+INTERNAL bool TestAnimationsEqual(act_animation_t& first, act_animation_t& second) {
+	bool haveSameCounts = first.majorVersion == second.majorVersion && first.minorVersion == second.minorVersion
+		&& first.clipCount == second.clipCount && first.frameCount == second.frameCount && first.layerCount == second.layerCount
+		&& first.anchorCount == second.anchorCount && first.eventCount == second.eventCount;
+	if(!haveSameCounts) return false;
+
+	act_section_layout_t firstLayout = ACTGetSectionLayout(first);
+	act_section_layout_t secondLayout = ACTGetSectionLayout(second);
+	for(size_t section = 0; section < ACT_SECTION_COUNT; ++section) {
+		if(firstLayout.sizes[section] != secondLayout.sizes[section]) return false;
+		if(memcmp(*firstLayout.pointers[section], *secondLayout.pointers[section], firstLayout.sizes[section]) != 0) return false;
+	}
+	return true;
+}
+
+// The fixtures don't have any events, so one is inserted (right before the frame times of the only clip)
+INTERNAL void TestInsertAnimationEvent(test_fixture_t& fixture, test_fixture_t& modifiedFixture) {
+	size_t eventsOffset = fixture.size - sizeof(float) - sizeof(int32);
+	modifiedFixture.size = fixture.size + ACT_EVENT_NAME_SIZE;
+	modifiedFixture.bytes = (uint8*)calloc(1, modifiedFixture.size);
+	memcpy(modifiedFixture.bytes, fixture.bytes, eventsOffset);
+	TestWriteUnsignedInt32(modifiedFixture.bytes + eventsOffset, 1);
+	memcpy(modifiedFixture.bytes + eventsOffset + sizeof(int32), TEST_CP949_EVENT_NAME, sizeof(TEST_CP949_EVENT_NAME) - 1);
+	memcpy(modifiedFixture.bytes + modifiedFixture.size - sizeof(float), fixture.bytes + fixture.size - sizeof(float), sizeof(float));
+}
+
+INTERNAL void TestAnimations() {
+	const char* fileNames[] = { "v0200.act", "v0201.act", "v0203.act", "v0204.act", "v0205.act" };
+	for(size_t fixtureIndex = 0; fixtureIndex < sizeof(fileNames) / sizeof(fileNames[0]); ++fixtureIndex) {
+		TestBeginCase("ACT: Decodes clips, frames, and layers");
+		test_fixture_t fixture;
+		if(!TestLoadFixture(fileNames[fixtureIndex], fixture)) continue;
+
+		TestResetMemory();
+		act_animation_t animation;
+		if(EXPECT(TestDecodeAnimation(animation, fixture.bytes, fixture.size))) {
+			EXPECT(animation.majorVersion == 2);
+			EXPECT(animation.clipCount == 1 && animation.frameCount == 1 && animation.layerCount == 1);
+			EXPECT(ACTGetClipFrameCount(animation, 0) == 1 && ACTGetFrameLayerCount(animation, 0) == 1);
+			EXPECT(animation.layerSpriteIndices[0] == 0);
+			EXPECT(animation.layerScalesX[0] == 1.0f && animation.layerScalesY[0] == 1.0f);
+			// Older versions don't store the frame times (the default is used instead), and the image dimensions were added in 2.5
+			EXPECT(animation.clipFrameTimes[0] == ((animation.minorVersion < 5) ? ACT_UPDATE_INTERVAL * ACT_DEFAULT_TICKS_PER_FRAME : 960.0f));
+			EXPECT(animation.layerWidths[0] == ((animation.minorVersion < 5) ? 0 : 22));
+			EXPECT(animation.layerHeights[0] == ((animation.minorVersion < 5) ? 0 : 26));
+		}
+
+		TestBeginCase("CACT: Restores the compiled animation");
+		size_t compiledSize = 0;
+		uint8* compiledAnimation = TestCompileAnimation(animation, fixture, compiledSize);
+		act_animation_t restoredAnimation;
+		if(EXPECT(CACTRestoreAnimation(restoredAnimation, compiledAnimation, compiledSize))) {
+			EXPECT(TestAnimationsEqual(animation, restoredAnimation));
+			EXPECT(CACTVerifySourceContents(restoredAnimation, compiledAnimation, fixture.bytes, fixture.size));
+		}
+		free(compiledAnimation);
+
+		TestBeginCase("ACT: Rejects truncated animations");
+		TestRejectsTruncatedCopies(TestDecodeAnyAnimation, fixture);
+
+		TestBeginCase("ACT: Survives corrupted animations");
+		TestSurvivesCorruptedCopies(TestDecodeAnyAnimation, fixture);
+
+		TestFreeFixture(fixture);
+	}
+
+	TestBeginCase("ACT: Transcodes event names");
+	test_fixture_t fixture;
+	if(!TestLoadFixture("v0205.act", fixture)) return;
+	test_fixture_t modifiedFixture;
+	TestInsertAnimationEvent(fixture, modifiedFixture);
+	TestResetMemory();
+	act_animation_t animation;
+	if(EXPECT(TestDecodeAnimation(animation, modifiedFixture.bytes, modifiedFixture.size))) {
+		EXPECT(animation.eventCount == 1);
+		EXPECT(TestStringEquals(ACTGetEventName(animation, 0), TEST_KOREAN_EVENT_NAME));
+		EXPECT(animation.eventNameCharacterCount == sizeof(TEST_KOREAN_EVENT_NAME));
+	}
+
+	TestBeginCase("CACT: Restores event names");
+	size_t compiledSize = 0;
+	uint8* compiledAnimation = TestCompileAnimation(animation, modifiedFixture, compiledSize);
+	act_animation_t restoredAnimation;
+	if(EXPECT(CACTRestoreAnimation(restoredAnimation, compiledAnimation, compiledSize))) {
+		EXPECT(TestAnimationsEqual(animation, restoredAnimation));
+		EXPECT(TestStringEquals(ACTGetEventName(restoredAnimation, 0), TEST_KOREAN_EVENT_NAME));
+	}
+
+	TestBeginCase("CACT: Rejects caches compiled from a different ACT file");
+	EXPECT(CACTVerifySourceContents(restoredAnimation, compiledAnimation, modifiedFixture.bytes, modifiedFixture.size));
+	EXPECT(!CACTVerifySourceContents(restoredAnimation, compiledAnimation, fixture.bytes, fixture.size));
+	EXPECT(TestStringEquals(restoredAnimation.errorMessage, "Cache is outdated (ACT file contents have changed)"));
+	uint8* modifiedSource = TestCopyBytes(modifiedFixture.bytes, modifiedFixture.size);
+	modifiedSource[modifiedFixture.size - 1] ^= 0xFF; // Frame time (same size, but different contents)
+	EXPECT(!CACTVerifySourceContents(restoredAnimation, compiledAnimation, modifiedSource, modifiedFixture.size));
+	free(modifiedSource);
+
+	TestBeginCase("CACT: Rejects invalid caches");
+	uint8* bytes = TestCopyBytes(compiledAnimation, compiledSize);
+	bytes[0] = 'X';
+	EXPECT(!CACTRestoreAnimation(restoredAnimation, bytes, compiledSize));
+	EXPECT(TestStringEquals(restoredAnimation.errorMessage, "Signature should be \"CACT\""));
+	memcpy(bytes, compiledAnimation, compiledSize);
+	bytes[offsetof(cact_header_t, version)] = CACT_VERSION + 1;
+	EXPECT(!CACTRestoreAnimation(restoredAnimation, bytes, compiledSize));
+	EXPECT(TestStringEquals(restoredAnimation.errorMessage, "Unsupported CACT version"));
+	memcpy(bytes, compiledAnimation, compiledSize);
+	bytes[offsetof(cact_header_t, layerCount)] = 2;
+	EXPECT(!CACTRestoreAnimation(restoredAnimation, bytes, compiledSize));
+	EXPECT(TestStringEquals(restoredAnimation.errorMessage, "Invalid section layout"));
+	memcpy(bytes, compiledAnimation, compiledSize);
+	cact_header_t header;
+	memcpy(&header, compiledAnimation, sizeof(header));
+	bytes[header.sections[ACT_CLIP_FRAME_OFFSETS].offset + sizeof(uint32)] = 2; // Range ends past the frames
+	EXPECT(!CACTRestoreAnimation(restoredAnimation, bytes, compiledSize));
+	EXPECT(TestStringEquals(restoredAnimation.errorMessage, "Cache contents don't match the stored counts"));
+	free(bytes);
+
+	TestBeginCase("CACT: Rejects truncated caches");
+	// NOTE: The alignment padding at the end isn't needed to restore the animation (so it may be missing)
+	memcpy(&header, compiledAnimation, sizeof(header));
+	cact_section_t& lastSection = header.sections[ACT_SECTION_COUNT - 1];
+	size_t requiredSize = lastSection.offset + lastSection.size;
+	size_t firstAcceptedSize = requiredSize;
+	for(size_t size = 0; size < requiredSize; ++size) {
+		uint8* truncatedAnimation = TestCopyBytes(compiledAnimation, size);
+		if(CACTRestoreAnimation(restoredAnimation, truncatedAnimation, size) && firstAcceptedSize == requiredSize) firstAcceptedSize = size;
+		free(truncatedAnimation);
+	}
+	EXPECT(firstAcceptedSize == requiredSize);
+
+	free(compiledAnimation);
+	TestFreeFixture(modifiedFixture);
+	TestFreeFixture(fixture);
+}
+
+INTERNAL bool TestPackSpriteAtlas(sprite_atlas_t& atlas, offscreen_buffer_t* images, uint32 imageCount) {
+	if(!SpriteAtlasPackImages(atlas, images, imageCount, TEST_CONTEXT.transientMemory)) return false;
+	SpriteAtlasCopyImages(atlas, images, TEST_CONTEXT.persistentMemory);
+	return true;
+}
+
+INTERNAL bool TestAtlasEntriesOverlap(sprite_atlas_entry_t& first, sprite_atlas_entry_t& second) {
+	if(first.width == 0 || second.width == 0) return false;
+	bool areHorizontallySeparated = first.atlasX + first.width + SPRITE_ATLAS_PADDING <= second.atlasX
+		|| second.atlasX + second.width + SPRITE_ATLAS_PADDING <= first.atlasX;
+	bool areVerticallySeparated = first.atlasY + first.height + SPRITE_ATLAS_PADDING <= second.atlasY
+		|| second.atlasY + second.height + SPRITE_ATLAS_PADDING <= first.atlasY;
+	return !areHorizontallySeparated && !areVerticallySeparated;
+}
+
+INTERNAL void TestSpriteAtlases() {
+	TestBeginCase("SATL: Packs every image of a sprite sheet");
+	test_fixture_t fixture;
+	if(!TestLoadFixture("rle-bmp-tga-paletted.spr", fixture)) return;
+
+	TestResetMemory();
+	spr_sprite_sheet_t sheet;
+	sprite_atlas_t atlas;
+	if(EXPECT(TestDecodeSpriteSheet(sheet, fixture.bytes, fixture.size)) && EXPECT(TestPackSpriteAtlas(atlas, sheet.images, SPRGetImageCount(sheet)))) {
+		EXPECT(atlas.width == SPRITE_ATLAS_MIN_SIZE && atlas.height == SPRITE_ATLAS_MIN_SIZE);
+		EXPECT(atlas.entryCount == SPRGetImageCount(sheet));
+		for(uint32 index = 0; index < atlas.entryCount; ++index) {
+			sprite_atlas_entry_t& entry = atlas.entries[index];
+			offscreen_buffer_t& image = sheet.images[index];
+			EXPECT(entry.imageWidth == image.width && entry.imageHeight == image.height);
+			EXPECT(entry.atlasX + entry.width <= atlas.width && entry.atlasY + entry.height <= atlas.height);
+			for(uint32 otherIndex = index + 1; otherIndex < atlas.entryCount; ++otherIndex)
+				EXPECT(!TestAtlasEntriesOverlap(entry, atlas.entries[otherIndex]));
+
+			bool hasCopiedPixels = true;
+			for(int y = 0; y < entry.height; ++y) {
+				uint32* source = BitmapGetRowAddress(image, entry.trimmedY + y) + entry.trimmedX;
+				uint32* destination = BitmapGetRowAddress(atlas.image, entry.atlasY + y) + entry.atlasX;
+				if(memcmp(source, destination, entry.width * sizeof(uint32)) != 0) hasCopiedPixels = false;
+			}
+			EXPECT(hasCopiedPixels);
+		}
+
+		uint8 header[TGA_HEADER_SIZE];
+		SpriteAtlasEncodeTGAHeader(atlas, header);
+		EXPECT(header[2] == TGA_UNCOMPRESSED_TRUE_COLOR_IMAGE);
+		EXPECT((header[12] | (header[13] << 8)) == atlas.width && (header[14] | (header[15] << 8)) == atlas.height);
+
+		TestBeginCase("SATL: Encodes the UV table");
+		size_t tableSize = SpriteAtlasGetTableSize(atlas);
+		uint8* table = (uint8*)ArenaAllocateMemoryRegion(TEST_CONTEXT.transientMemory, tableSize);
+		SpriteAtlasEncodeTable(atlas, sheet, table);
+		sprite_atlas_header_t tableHeader;
+		memcpy(&tableHeader, table, sizeof(tableHeader));
+		EXPECT(memcmp(tableHeader.signature, SATL_SIGNATURE, sizeof(tableHeader.signature)) == 0);
+		EXPECT(tableHeader.version == SATL_VERSION);
+		EXPECT(tableHeader.atlasWidth == atlas.width && tableHeader.atlasHeight == atlas.height);
+		EXPECT(tableHeader.indexedImageCount == sheet.indexedImageCount && tableHeader.trueColorImageCount == sheet.trueColorImageCount);
+		EXPECT(memcmp(table + sizeof(tableHeader), atlas.entries, atlas.entryCount * sizeof(sprite_atlas_entry_t)) == 0);
+	}
+	TestFreeFixture(fixture);
+
+	TestBeginCase("SATL: Trims transparent borders");
+	uint32 pixels[4 * 3] = {};
+	pixels[1 * 4 + 2] = 0xFF000000;
+	offscreen_buffer_t images[] = {
+		{ .width = 4, .height = 3, .bytesPerPixel = 4, .stride = 4 * 4, .pixelBuffer = pixels },
+		{ .width = 2, .height = 1, .bytesPerPixel = 4, .stride = 2 * 4, .pixelBuffer = pixels }, // Fully transparent
+	};
+	TestResetMemory();
+	if(EXPECT(TestPackSpriteAtlas(atlas, images, 2))) {
+		sprite_atlas_entry_t& entry = atlas.entries[0];
+		EXPECT(entry.trimmedX == 2 && entry.trimmedY == 1 && entry.width == 1 && entry.height == 1);
+		EXPECT(atlas.entries[1].width == 0 && atlas.entries[1].height == 0 && atlas.entries[1].imageWidth == 2);
+	}
+
+	TestBeginCase("SATL: Rejects images that exceed the largest atlas");
+	constexpr int OVERSIZED_IMAGE_WIDTH = SPRITE_ATLAS_MAX_SIZE + 1;
+	uint32* oversizedPixels = (uint32*)calloc(OVERSIZED_IMAGE_WIDTH, sizeof(uint32));
+	oversizedPixels[0] = 0xFF000000;
+	oversizedPixels[OVERSIZED_IMAGE_WIDTH - 1] = 0xFF000000;
+	offscreen_buffer_t oversizedImage = {
+		.width = OVERSIZED_IMAGE_WIDTH,
+		.height = 1,
+		.bytesPerPixel = 4,
+		.stride = OVERSIZED_IMAGE_WIDTH * 4,
+		.pixelBuffer = oversizedPixels,
+	};
+	TestResetMemory();
+	EXPECT(!SpriteAtlasPackImages(atlas, &oversizedImage, 1, TEST_CONTEXT.transientMemory));
+	EXPECT(TestStringEquals(atlas.errorMessage, "Images don't fit into the largest supported atlas size"));
+	free(oversizedPixels);
+}
+
+INTERNAL bool TestDecodeCollisionMap(gat_collision_map_t& map, const uint8* bytes, size_t size) {
+	if(!GATOpenCollisionMap(map, bytes, size)) return false;
+	if(!ArenaCanAllocate(TEST_CONTEXT.persistentMemory, GATGetRequiredMemorySize(map))) return false;
+	GATDecodeCollisionMap(map, TEST_CONTEXT.persistentMemory);
+	return true;
+}
+
+INTERNAL bool TestDecodeAnyCollisionMap(const uint8* bytes, size_t size) {
+	TestResetMemory();
+	gat_collision_map_t map;
+	if(!TestDecodeCollisionMap(map, bytes, size)) return false;
+
+	bitmap_rectangle_t region = { .left = -1, .top = -1, .right = map.width + 1, .bottom = map.height + 1 };
+	GATIsAnyTileSet(map, GAT_WALKABLE_TILES, region);
+	GATAreAllTilesSetAlongLine(map, GAT_WATER_TILES, 0, 0, map.width, map.height);
+	return true;
+}
+
+INTERNAL void TestCollisionMaps() {
+	// Row by row, starting at the top left (as in the Lua specs, where the coordinates start at one)
+	const char* fileNames[] = { "v0102.gat", "v0103.gat" };
+	bool expectedWalkableTiles[][6] = { { true, false, true, false, true, false }, { false, true, true, true, true, true } };
+	bool expectedWaterTiles[][6] = { { false, false, false, false, true, true }, { false, false, false, false, false, true } };
+	for(size_t fixtureIndex = 0; fixtureIndex < sizeof(fileNames) / sizeof(fileNames[0]); ++fixtureIndex) {
+		TestBeginCase("GAT: Decodes the terrain layers");
+		test_fixture_t fixture;
+		if(!TestLoadFixture(fileNames[fixtureIndex], fixture)) continue;
+
+		TestResetMemory();
+		gat_collision_map_t map;
+		if(EXPECT(TestDecodeCollisionMap(map, fixture.bytes, fixture.size))) {
+			EXPECT(map.majorVersion == 1 && map.minorVersion == 2 + fixtureIndex);
+			EXPECT(map.width == 3 && map.height == 2);
+			for(int y = 0; y < map.height; ++y) {
+				for(int x = 0; x < map.width; ++x) {
+					EXPECT(GATIsWalkable(map, x, y) == expectedWalkableTiles[fixtureIndex][y * map.width + x]);
+					EXPECT(GATIsWater(map, x, y) == expectedWaterTiles[fixtureIndex][y * map.width + x]);
+				}
+			}
+
+			// Tiles outside of the map are never set
+			EXPECT(!GATIsWalkable(map, -1, 0) && !GATIsWalkable(map, map.width, 0) && !GATIsWalkable(map, 0, map.height));
+			bitmap_rectangle_t region = { .left = -2, .top = -2, .right = 0, .bottom = 0 };
+			EXPECT(!GATIsAnyTileSet(map, GAT_WALKABLE_TILES, region));
+			region = { .left = 0, .top = 0, .right = map.width, .bottom = map.height };
+			EXPECT(GATIsAnyTileSet(map, GAT_WATER_TILES, region));
+			EXPECT(!GATAreAllTilesSet(map, GAT_WALKABLE_TILES, region));
+		}
+
+		TestBeginCase("GAT: Rejects truncated collision maps");
+		TestRejectsTruncatedCopies(TestDecodeAnyCollisionMap, fixture);
+
+		TestBeginCase("GAT: Survives corrupted collision maps");
+		TestSurvivesCorruptedCopies(TestDecodeAnyCollisionMap, fixture);
+
+		TestFreeFixture(fixture);
+	}
+
+	TestBeginCase("GAT: Rejects invalid headers");
+	test_fixture_t fixture;
+	if(!TestLoadFixture("v0103.gat", fixture)) return;
+	gat_collision_map_t map;
+	uint8* bytes = TestCopyBytes(fixture.bytes, fixture.size);
+	bytes[0] = 'X';
+	EXPECT(!GATOpenCollisionMap(map, bytes, fixture.size));
+	EXPECT(TestStringEquals(map.errorMessage, "Signature should be \"GRAT\""));
+	memcpy(bytes, fixture.bytes, fixture.size);
+	bytes[5] = GAT_MAX_SUPPORTED_MINOR_VERSION + 1;
+	EXPECT(!GATOpenCollisionMap(map, bytes, fixture.size));
+	EXPECT(TestStringEquals(map.errorMessage, "Unsupported GAT version (must be 1.2 or 1.3)"));
+	memcpy(bytes, fixture.bytes, fixture.size);
+	bytes[9] = 0x80; // Width
+	EXPECT(!GATOpenCollisionMap(map, bytes, fixture.size));
+	EXPECT(TestStringEquals(map.errorMessage, "Map dimensions exceed the supported size"));
+	memcpy(bytes, fixture.bytes, fixture.size);
+	bytes[6] = 2; // Width
+	EXPECT(!GATOpenCollisionMap(map, bytes, fixture.size));
+	EXPECT(TestStringEquals(map.errorMessage, "Detected leftover bytes at the end of the file"));
+	free(bytes);
+	TestFreeFixture(fixture);
+}
+
+int main() {
+	TEST_CONTEXT.persistentMemory = TestCreateArena(StringLiteral("Test Fixtures (Persistent)"), TEST_ARENA_SIZE);
+	TEST_CONTEXT.transientMemory = TestCreateArena(StringLiteral("Test Fixtures (Transient)"), TEST_ARENA_SIZE);
+	if(!TEST_CONTEXT.persistentMemory.baseAddress || !TEST_CONTEXT.transientMemory.baseAddress) {
+		fprintf(stderr, "Failed to allocate %zu bytes for the test arenas\n", 2 * TEST_ARENA_SIZE);
+		return 1;
+	}
+
+	TestArchiveDecoding();
+	TestArchiveRejection();
+	TestArchivesWithOversizedNames();
+	TestCompiledTableOfContents();
+	TestPatchArchives();
+	TestAssetPacks();
+	TestSpriteSheets();
+	TestAnimations();
+	TestSpriteAtlases();
+	TestCollisionMaps();
+
+	if(TEST_CONTEXT.failedCheckCount == 0) printf("SUCCESS: All %u checks passed (%u test cases)\n", TEST_CONTEXT.checkCount, TEST_CONTEXT.caseCount);
+	else fprintf(stderr, "FAILED: %u of %u checks failed\n", TEST_CONTEXT.failedCheckCount, TEST_CONTEXT.checkCount);
+
+	return (TEST_CONTEXT.failedCheckCount == 0) ? 0 : 1;
+}
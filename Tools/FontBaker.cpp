@@ -0,0 +1,550 @@
+// ABOUT: Offline generator for the embedded bitmap fonts in Core/Fonts (run this after changing the font or its pixel size)
+// ABOUT: Only TrueType outlines and printable ASCII are supported, since that's all the debug overlays require
+
+// NOTE: Usage: FontBaker <fontFile.ttf> <pixelSize> <SYMBOL_PREFIX> <outputFile.hpp>
+// NOTE: The embedded Roboto font was baked with: FontBaker Core/NativeClient/Assets/Fonts/Roboto-Regular.ttf 13 ROBOTO_REGULAR_13PX Core/Fonts/RobotoRegular13.hpp
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GLOBAL static
+#define INTERNAL static
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef int16_t int16;
+
+constexpr char FIRST_BAKED_CHARACTER = ' ';
+constexpr char LAST_BAKED_CHARACTER = '~';
+constexpr int BAKED_CHARACTER_COUNT = LAST_BAKED_CHARACTER - FIRST_BAKED_CHARACTER + 1;
+constexpr int SUPERSAMPLING_FACTOR = 16; // Per axis, so that each pixel's coverage is estimated from 256 samples
+constexpr int BEZIER_SEGMENT_COUNT = 8; // Quadratic curves are flattened into this many line segments
+constexpr int MAX_COVERAGE_VALUE = 15; // Coverage is stored as 4 bits per pixel
+constexpr int MAX_OUTLINE_POINTS = 4096;
+constexpr int MAX_OUTLINE_CONTOURS = 256;
+constexpr int MAX_POLYLINE_POINTS = MAX_OUTLINE_POINTS * (BEZIER_SEGMENT_COUNT + 1);
+constexpr int MAX_GLYPH_SIZE = 128;
+constexpr int MAX_SCANLINE_CROSSINGS = 1024;
+constexpr size_t MAX_COVERAGE_SIZE = UINT16_MAX; // Must be addressable via embedded_glyph_t::coverageOffset
+
+typedef struct truetype_font {
+	const uint8* bytes;
+	size_t size;
+	uint32 headOffset;
+	uint32 hheaOffset;
+	uint32 hmtxOffset;
+	uint32 locaOffset;
+	uint32 glyfOffset;
+	uint32 cmapOffset;
+	uint16 unitsPerEm;
+	int16 indexToLocFormat;
+	int16 ascender;
+	int16 descender;
+	uint16 horizontalMetricsCount;
+	uint32 characterMapOffset; // Format 4 subtable (Unicode BMP)
+} truetype_font_t;
+
+typedef struct outline_point {
+	double x;
+	double y;
+	bool isOnCurve;
+} outline_point_t;
+
+typedef struct glyph_outline {
+	int pointCount;
+	int contourCount;
+	int contourEnds[MAX_OUTLINE_CONTOURS]; // Exclusive
+	outline_point_t points[MAX_OUTLINE_POINTS];
+} glyph_outline_t;
+
+typedef struct polyline_point {
+	double x;
+	double y;
+} polyline_point_t;
+
+typedef struct scanline_crossing {
+	double x;
+	int direction;
+} scanline_crossing_t;
+
+typedef struct baked_glyph {
+	int width;
+	int height;
+	int bearingX;
+	int bearingY;
+	int advance;
+	uint8 coverage[MAX_GLYPH_SIZE][MAX_GLYPH_SIZE];
+} baked_glyph_t;
+
+GLOBAL glyph_outline_t GLYPH_OUTLINE;
+GLOBAL polyline_point_t POLYLINE_POINTS[MAX_POLYLINE_POINTS];
+GLOBAL int POLYLINE_ENDS[MAX_OUTLINE_CONTOURS];
+GLOBAL int SAMPLE_COUNTS[MAX_GLYPH_SIZE][MAX_GLYPH_SIZE];
+GLOBAL baked_glyph_t BAKED_GLYPHS[BAKED_CHARACTER_COUNT];
+GLOBAL uint8 PACKED_COVERAGE[MAX_COVERAGE_SIZE];
+
+INTERNAL void FailWithError(const char* message) {
+	fprintf(stderr, "Error: %s\n", message);
+	exit(1);
+}
+
+INTERNAL uint16 ReadBigEndianU16(truetype_font_t& font, size_t offset) {
+	if(offset + 2 > font.size) FailWithError("Unexpected end of font file");
+	return (uint16)((font.bytes[offset] << 8) | font.bytes[offset + 1]);
+}
+
+INTERNAL int16 ReadBigEndianI16(truetype_font_t& font, size_t offset) {
+	return (int16)ReadBigEndianU16(font, offset);
+}
+
+INTERNAL uint32 ReadBigEndianU32(truetype_font_t& font, size_t offset) {
+	return ((uint32)ReadBigEndianU16(font, offset) << 16) | ReadBigEndianU16(font, offset + 2);
+}
+
+INTERNAL uint8 ReadByte(truetype_font_t& font, size_t offset) {
+	if(offset >= font.size) FailWithError("Unexpected end of font file");
+	return font.bytes[offset];
+}
+
+INTERNAL uint32 FindTable(truetype_font_t& font, const char* tag) {
+	uint16 tableCount = ReadBigEndianU16(font, 4);
+	for(uint16 index = 0; index < tableCount; ++index) {
+		size_t recordOffset = 12 + 16 * (size_t)index;
+		if(recordOffset + 4 <= font.size && memcmp(font.bytes + recordOffset, tag, 4) == 0) return ReadBigEndianU32(font, recordOffset + 8);
+	}
+	fprintf(stderr, "Error: Missing required table '%s'\n", tag);
+	exit(1);
+}
+
+INTERNAL void OpenFont(truetype_font_t& font, const uint8* bytes, size_t size) {
+	font = {};
+	font.bytes = bytes;
+	font.size = size;
+	font.headOffset = FindTable(font, "head");
+	font.hheaOffset = FindTable(font, "hhea");
+	font.hmtxOffset = FindTable(font, "hmtx");
+	font.locaOffset = FindTable(font, "loca");
+	font.glyfOffset = FindTable(font, "glyf");
+	font.cmapOffset = FindTable(font, "cmap");
+
+	font.unitsPerEm = ReadBigEndianU16(font, font.headOffset + 18);
+	font.indexToLocFormat = ReadBigEndianI16(font, font.headOffset + 50);
+	font.ascender = ReadBigEndianI16(font, font.hheaOffset + 4);
+	font.descender = ReadBigEndianI16(font, font.hheaOffset + 6);
+	font.horizontalMetricsCount = ReadBigEndianU16(font, font.hheaOffset + 34);
+	if(font.unitsPerEm == 0 || font.horizontalMetricsCount == 0) FailWithError("Invalid font metrics");
+
+	// Prefer the Windows Unicode BMP encoding, but accept the generic Unicode one if that's all there is
+	uint16 encodingCount = ReadBigEndianU16(font, font.cmapOffset + 2);
+	for(uint16 index = 0; index < encodingCount; ++index) {
+		size_t recordOffset = font.cmapOffset + 4 + 8 * (size_t)index;
+		uint16 platformID = ReadBigEndianU16(font, recordOffset);
+		uint16 encodingID = ReadBigEndianU16(font, recordOffset + 2);
+		uint32 subtableOffset = font.cmapOffset + ReadBigEndianU32(font, recordOffset + 4);
+		if(platformID == 3 && encodingID == 1) font.characterMapOffset = subtableOffset;
+		if(platformID == 0 && font.characterMapOffset == 0) font.characterMapOffset = subtableOffset;
+	}
+	if(font.characterMapOffset == 0 || ReadBigEndianU16(font, font.characterMapOffset) != 4) FailWithError("Only format 4 character maps are supported");
+}
+
+INTERNAL uint16 FindGlyphIndex(truetype_font_t& font, uint16 codePoint) {
+	size_t subtable = font.characterMapOffset;
+	uint16 segmentCount = ReadBigEndianU16(font, subtable + 6) / 2;
+	size_t endCodes = subtable + 14;
+	size_t startCodes = endCodes + 2 * (size_t)segmentCount + 2;
+	size_t idDeltas = startCodes + 2 * (size_t)segmentCount;
+	size_t idRangeOffsets = idDeltas + 2 * (size_t)segmentCount;
+	for(uint16 segment = 0; segment < segmentCount; ++segment) {
+		uint16 startCode = ReadBigEndianU16(font, startCodes + 2 * segment);
+		uint16 endCode = ReadBigEndianU16(font, endCodes + 2 * segment);
+		if(codePoint < startCode || codePoint > endCode) continue;
+
+		int16 idDelta = ReadBigEndianI16(font, idDeltas + 2 * segment);
+		uint16 idRangeOffset = ReadBigEndianU16(font, idRangeOffsets + 2 * segment);
+		if(idRangeOffset == 0) return (uint16)(codePoint + idDelta);
+
+		size_t glyphIndexAddress = idRangeOffsets + 2 * segment + idRangeOffset + 2 * (size_t)(codePoint - startCode);
+		uint16 glyphIndex = ReadBigEndianU16(font, glyphIndexAddress);
+		return glyphIndex ? (uint16)(glyphIndex + idDelta) : 0;
+	}
+	return 0;
+}
+
+INTERNAL uint32 GetGlyphLocation(truetype_font_t& font, uint16 glyphIndex) {
+	if(font.indexToLocFormat == 0) return 2 * (uint32)ReadBigEndianU16(font, font.locaOffset + 2 * (size_t)glyphIndex);
+	return ReadBigEndianU32(font, font.locaOffset + 4 * (size_t)glyphIndex);
+}
+
+INTERNAL uint16 GetAdvanceWidth(truetype_font_t& font, uint16 glyphIndex) {
+	if(glyphIndex >= font.horizontalMetricsCount) glyphIndex = font.horizontalMetricsCount - 1;
+	return ReadBigEndianU16(font, font.hmtxOffset + 4 * (size_t)glyphIndex);
+}
+
+INTERNAL void AppendGlyphOutline(truetype_font_t& font, uint16 glyphIndex, glyph_outline_t& outline, int depth) {
+	if(depth > 8) FailWithError("Composite glyphs are nested too deeply");
+	uint32 glyphStart = font.glyfOffset + GetGlyphLocation(font, glyphIndex);
+	uint32 glyphEnd = font.glyfOffset + GetGlyphLocation(font, glyphIndex + 1);
+	if(glyphStart == glyphEnd) return; // No outline (e.g., spaces)
+
+	int16 contourCount = ReadBigEndianI16(font, glyphStart);
+	if(contourCount < 0) {
+		// Composite glyph: Each component is transformed, then appended as-is
+		size_t offset = glyphStart + 10;
+		while(true) {
+			uint16 flags = ReadBigEndianU16(font, offset);
+			uint16 componentIndex = ReadBigEndianU16(font, offset + 2);
+			offset += 4;
+
+			double dx, dy;
+			if(flags & 0x01) {
+				dx = ReadBigEndianI16(font, offset);
+				dy = ReadBigEndianI16(font, offset + 2);
+				offset += 4;
+			} else {
+				dx = (int8_t)ReadByte(font, offset);
+				dy = (int8_t)ReadByte(font, offset + 1);
+				offset += 2;
+			}
+
+			double a = 1, b = 0, c = 0, d = 1;
+			if(flags & 0x08) {
+				a = d = ReadBigEndianI16(font, offset) / 16384.0;
+				offset += 2;
+			} else if(flags & 0x40) {
+				a = ReadBigEndianI16(font, offset) / 16384.0;
+				d = ReadBigEndianI16(font, offset + 2) / 16384.0;
+				offset += 4;
+			} else if(flags & 0x80) {
+				a = ReadBigEndianI16(font, offset) / 16384.0;
+				b = ReadBigEndianI16(font, offset + 2) / 16384.0;
+				c = ReadBigEndianI16(font, offset + 4) / 16384.0;
+				d = ReadBigEndianI16(font, offset + 6) / 16384.0;
+				offset += 8;
+			}
+
+			int firstPoint = outline.pointCount;
+			AppendGlyphOutline(font, componentIndex, outline, depth + 1);
+			for(int index = firstPoint; index < outline.pointCount; ++index) {
+				outline_point_t& point = outline.points[index];
+				double x = point.x;
+				double y = point.y;
+				point.x = a * x + c * y + dx;
+				point.y = b * x + d * y + dy;
+			}
+			if(!(flags & 0x20)) break; // No more components
+		}
+		return;
+	}
+
+	if(outline.contourCount + contourCount > MAX_OUTLINE_CONTOURS) FailWithError("Too many contours");
+	size_t endPoints = glyphStart + 10;
+	uint16 instructionLength = ReadBigEndianU16(font, endPoints + 2 * (size_t)contourCount);
+	size_t offset = endPoints + 2 * (size_t)contourCount + 2 + instructionLength;
+	int pointCount = ReadBigEndianU16(font, endPoints + 2 * (size_t)(contourCount - 1)) + 1;
+	if(outline.pointCount + pointCount > MAX_OUTLINE_POINTS) FailWithError("Too many outline points");
+
+	uint8 pointFlags[MAX_OUTLINE_POINTS];
+	for(int index = 0; index < pointCount;) {
+		uint8 flags = ReadByte(font, offset++);
+		pointFlags[index++] = flags;
+		if(flags & 0x08) {
+			uint8 repeatCount = ReadByte(font, offset++);
+			for(uint8 repeat = 0; repeat < repeatCount && index < pointCount; ++repeat)
+				pointFlags[index++] = flags;
+		}
+	}
+
+	// Coordinates are delta-encoded, first all X then all Y values
+	outline_point_t* points = outline.points + outline.pointCount;
+	int value = 0;
+	for(int index = 0; index < pointCount; ++index) {
+		uint8 flags = pointFlags[index];
+		if(flags & 0x02) {
+			uint8 delta = ReadByte(font, offset++);
+			value += (flags & 0x10) ? delta : -delta;
+		} else if(!(flags & 0x10)) {
+			value += ReadBigEndianI16(font, offset);
+			offset += 2;
+		}
+		points[index].x = value;
+		points[index].isOnCurve = flags & 0x01;
+	}
+	value = 0;
+	for(int index = 0; index < pointCount; ++index) {
+		uint8 flags = pointFlags[index];
+		if(flags & 0x04) {
+			uint8 delta = ReadByte(font, offset++);
+			value += (flags & 0x20) ? delta : -delta;
+		} else if(!(flags & 0x20)) {
+			value += ReadBigEndianI16(font, offset);
+			offset += 2;
+		}
+		points[index].y = value;
+	}
+
+	for(int16 contour = 0; contour < contourCount; ++contour)
+		outline.contourEnds[outline.contourCount++] = outline.pointCount + ReadBigEndianU16(font, endPoints + 2 * (size_t)contour) + 1;
+	outline.pointCount += pointCount;
+}
+
+INTERNAL void AppendQuadraticCurve(int& pointCount, polyline_point_t control, polyline_point_t end) {
+	polyline_point_t start = POLYLINE_POINTS[pointCount - 1];
+	for(int segment = 1; segment <= BEZIER_SEGMENT_COUNT; ++segment) {
+		double t = (double)segment / BEZIER_SEGMENT_COUNT;
+		double u = 1 - t;
+		POLYLINE_POINTS[pointCount++] = {
+			.x = u * u * start.x + 2 * u * t * control.x + t * t * end.x,
+			.y = u * u * start.y + 2 * u * t * control.y + t * t * end.y,
+		};
+	}
+}
+
+// Converts each contour into a closed polyline (the last point repeats the first one)
+INTERNAL int FlattenGlyphOutline(glyph_outline_t& outline) {
+	int pointCount = 0;
+	int contourStart = 0;
+	for(int contour = 0; contour < outline.contourCount; ++contour) {
+		int contourEnd = outline.contourEnds[contour];
+		int contourLength = contourEnd - contourStart;
+		if(contourLength <= 0) continue;
+
+		// Walking the contour from an on-curve point means that the implied midpoints are the only special case
+		outline_point_t sequence[MAX_OUTLINE_POINTS + 2];
+		int sequenceLength = 0;
+		int start = -1;
+		for(int index = contourStart; index < contourEnd && start < 0; ++index)
+			if(outline.points[index].isOnCurve) start = index - contourStart;
+		if(start >= 0) {
+			for(int index = 0; index < contourLength; ++index)
+				sequence[sequenceLength++] = outline.points[contourStart + (start + index) % contourLength];
+		} else {
+			// Only off-curve points: Start from the implied on-curve point between the first two
+			outline_point_t& first = outline.points[contourStart];
+			outline_point_t& second = outline.points[contourStart + (contourLength > 1 ? 1 : 0)];
+			sequence[sequenceLength++] = { .x = (first.x + second.x) / 2, .y = (first.y + second.y) / 2, .isOnCurve = true };
+			for(int index = 1; index < contourLength; ++index)
+				sequence[sequenceLength++] = outline.points[contourStart + index];
+			sequence[sequenceLength++] = first;
+		}
+		sequence[sequenceLength++] = sequence[0];
+
+		POLYLINE_POINTS[pointCount++] = { .x = sequence[0].x, .y = sequence[0].y };
+		bool hasControlPoint = false;
+		polyline_point_t control = {};
+		for(int index = 1; index < sequenceLength; ++index) {
+			polyline_point_t point = { .x = sequence[index].x, .y = sequence[index].y };
+			if(sequence[index].isOnCurve) {
+				if(!hasControlPoint) POLYLINE_POINTS[pointCount++] = point;
+				else AppendQuadraticCurve(pointCount, control, point);
+				hasControlPoint = false;
+			} else {
+				if(hasControlPoint) {
+					polyline_point_t midpoint = { .x = (control.x + point.x) / 2, .y = (control.y + point.y) / 2 };
+					AppendQuadraticCurve(pointCount, control, midpoint);
+				}
+				control = point;
+				hasControlPoint = true;
+			}
+		}
+		if(hasControlPoint) AppendQuadraticCurve(pointCount, control, { .x = sequence[0].x, .y = sequence[0].y });
+
+		POLYLINE_ENDS[contour] = pointCount;
+		contourStart = contourEnd;
+	}
+	return pointCount;
+}
+
+INTERNAL int CompareScanlineCrossings(const void* first, const void* second) {
+	const scanline_crossing_t& a = *(const scanline_crossing_t*)first;
+	const scanline_crossing_t& b = *(const scanline_crossing_t*)second;
+	if(a.x != b.x) return (a.x < b.x) ? -1 : 1;
+	return a.direction - b.direction;
+}
+
+// NOTE: Coverage is estimated by counting the supersampled points inside the outline (nonzero winding rule)
+INTERNAL void BakeGlyph(truetype_font_t& font, double scale, char character, baked_glyph_t& glyph) {
+	uint16 glyphIndex = FindGlyphIndex(font, (uint16)character);
+	glyph = {};
+	glyph.advance = (int)nearbyint(GetAdvanceWidth(font, glyphIndex) * scale); // Rounds half to even
+
+	GLYPH_OUTLINE.pointCount = 0;
+	GLYPH_OUTLINE.contourCount = 0;
+	AppendGlyphOutline(font, glyphIndex, GLYPH_OUTLINE, 0);
+	if(GLYPH_OUTLINE.contourCount == 0) return;
+	FlattenGlyphOutline(GLYPH_OUTLINE);
+
+	double minX = INFINITY, maxX = -INFINITY, minY = INFINITY, maxY = -INFINITY;
+	int contourStart = 0;
+	for(int contour = 0; contour < GLYPH_OUTLINE.contourCount; ++contour) {
+		for(int index = contourStart; index < POLYLINE_ENDS[contour]; ++index) {
+			double x = POLYLINE_POINTS[index].x * scale;
+			double y = POLYLINE_POINTS[index].y * scale;
+			minX = fmin(minX, x);
+			maxX = fmax(maxX, x);
+			minY = fmin(minY, y);
+			maxY = fmax(maxY, y);
+		}
+		contourStart = POLYLINE_ENDS[contour];
+	}
+
+	int left = (int)floor(minX);
+	int right = (int)ceil(maxX);
+	int bottom = (int)floor(minY);
+	int top = (int)ceil(maxY);
+	glyph.width = right - left;
+	glyph.height = top - bottom;
+	glyph.bearingX = left;
+	glyph.bearingY = top;
+	if(glyph.width > MAX_GLYPH_SIZE || glyph.height > MAX_GLYPH_SIZE) FailWithError("Glyph is too large (reduce the pixel size)");
+
+	memset(SAMPLE_COUNTS, 0, sizeof(SAMPLE_COUNTS));
+	scanline_crossing_t crossings[MAX_SCANLINE_CROSSINGS];
+	for(int row = 0; row < glyph.height; ++row) {
+		for(int subRow = 0; subRow < SUPERSAMPLING_FACTOR; ++subRow) {
+			double sampleY = (double)(top - row) - (subRow + 0.5) / SUPERSAMPLING_FACTOR;
+
+			int crossingCount = 0;
+			contourStart = 0;
+			for(int contour = 0; contour < GLYPH_OUTLINE.contourCount; ++contour) {
+				for(int index = contourStart; index + 1 < POLYLINE_ENDS[contour]; ++index) {
+					double ax = POLYLINE_POINTS[index].x * scale;
+					double ay = POLYLINE_POINTS[index].y * scale;
+					double bx = POLYLINE_POINTS[index + 1].x * scale;
+					double by = POLYLINE_POINTS[index + 1].y * scale;
+					if(ay == by) continue;
+					if(!((ay <= sampleY && sampleY < by) || (by <= sampleY && sampleY < ay))) continue;
+
+					if(crossingCount == MAX_SCANLINE_CROSSINGS) FailWithError("Too many edges on a single scanline");
+					crossings[crossingCount++] = {
+						.x = ax + (sampleY - ay) * (bx - ax) / (by - ay),
+						.direction = (by > ay) ? 1 : -1,
+					};
+				}
+				contourStart = POLYLINE_ENDS[contour];
+			}
+			qsort(crossings, crossingCount, sizeof(scanline_crossing_t), CompareScanlineCrossings);
+
+			int winding = 0;
+			for(int index = 0; index + 1 < crossingCount; ++index) {
+				winding += crossings[index].direction;
+				if(winding == 0) continue;
+
+				// Samples are located at the center of each subpixel
+				double spanStart = (crossings[index].x - left) * SUPERSAMPLING_FACTOR;
+				double spanEnd = (crossings[index + 1].x - left) * SUPERSAMPLING_FACTOR;
+				int firstSample = (int)fmax(0, ceil(spanStart - 0.5));
+				int lastSample = (int)fmin(glyph.width * SUPERSAMPLING_FACTOR, ceil(spanEnd - 0.5));
+				for(int sample = firstSample; sample < lastSample; ++sample)
+					SAMPLE_COUNTS[row][sample / SUPERSAMPLING_FACTOR]++;
+			}
+		}
+	}
+
+	for(int row = 0; row < glyph.height; ++row) {
+		for(int column = 0; column < glyph.width; ++column) {
+			double coverage = nearbyint(SAMPLE_COUNTS[row][column] * MAX_COVERAGE_VALUE / (double)(SUPERSAMPLING_FACTOR * SUPERSAMPLING_FACTOR));
+			glyph.coverage[row][column] = (uint8)fmin(MAX_COVERAGE_VALUE, coverage);
+		}
+	}
+}
+
+INTERNAL const char* GetCharacterComment(char character, char* buffer) {
+	if(character == ' ') return "Space";
+	if(character == '\'') return "Apostrophe";
+	if(character == '\\') return "Backslash";
+	buffer[0] = character;
+	buffer[1] = '\0';
+	return buffer;
+}
+
+// NOTE: Emits CRLF line endings without a trailing newline, same as all other source files
+INTERNAL bool WriteFontHeader(FILE* outputFile, const char* fontPath, int pixelSize, const char* prefix, int ascent, int descent) {
+	size_t packedSize = 0;
+	size_t coverageOffsets[BAKED_CHARACTER_COUNT];
+	for(int index = 0; index < BAKED_CHARACTER_COUNT; ++index) {
+		baked_glyph_t& glyph = BAKED_GLYPHS[index];
+		coverageOffsets[index] = packedSize;
+		for(int row = 0; row < glyph.height; ++row) {
+			for(int column = 0; column < glyph.width; column += 2) {
+				uint8 low = (column + 1 < glyph.width) ? glyph.coverage[row][column + 1] : 0;
+				if(packedSize == MAX_COVERAGE_SIZE) FailWithError("Coverage data exceeds the embedded glyph offset range");
+				PACKED_COVERAGE[packedSize++] = (uint8)((glyph.coverage[row][column] << 4) | low);
+			}
+		}
+	}
+
+	fprintf(outputFile, "// Generated by Tools/FontBaker.cpp from %s (%d px, printable ASCII only)\r\n", fontPath, pixelSize);
+	// TODO: The license notice assumes the bundled Roboto font (pass it in if other fonts are ever embedded)
+	fprintf(outputFile, "// NOTE: Glyph outlines are licensed under the Apache License, Version 2.0 (see Roboto-LICENSE.txt)\r\n");
+	fprintf(outputFile, "GLOBAL const uint8 %s_COVERAGE[] = {", prefix);
+	for(size_t index = 0; index < packedSize; ++index)
+		fprintf(outputFile, (index % 16 == 0) ? "\r\n\t0x%02X," : " 0x%02X,", PACKED_COVERAGE[index]);
+	fprintf(outputFile, "\r\n};\r\n\r\n");
+
+	fprintf(outputFile, "GLOBAL const embedded_glyph_t %s_GLYPHS[] = {\r\n", prefix);
+	for(int index = 0; index < BAKED_CHARACTER_COUNT; ++index) {
+		baked_glyph_t& glyph = BAKED_GLYPHS[index];
+		char commentBuffer[2];
+		fprintf(outputFile, "\t{ .coverageOffset = %zu, .width = %d, .height = %d, .bearingX = %d, .bearingY = %d, .advance = %d }, // %s\r\n",
+			coverageOffsets[index], glyph.width, glyph.height, glyph.bearingX, glyph.bearingY, glyph.advance,
+			GetCharacterComment((char)(FIRST_BAKED_CHARACTER + index), commentBuffer));
+	}
+	fprintf(outputFile, "};\r\n\r\n");
+
+	fprintf(outputFile, "GLOBAL const embedded_font_t %s = {\r\n", prefix);
+	fprintf(outputFile, "\t.pixelSize = %d,\r\n", pixelSize);
+	fprintf(outputFile, "\t.ascent = %d,\r\n", ascent);
+	fprintf(outputFile, "\t.descent = %d,\r\n", descent);
+	fprintf(outputFile, "\t.firstCharacter = '%c',\r\n", FIRST_BAKED_CHARACTER);
+	fprintf(outputFile, "\t.lastCharacter = '%c',\r\n", LAST_BAKED_CHARACTER);
+	fprintf(outputFile, "\t.glyphs = %s_GLYPHS,\r\n", prefix);
+	fprintf(outputFile, "\t.coverage = %s_COVERAGE,\r\n", prefix);
+	fprintf(outputFile, "\t.coverageSize = sizeof(%s_COVERAGE),\r\n", prefix);
+	fprintf(outputFile, "};");
+	return !ferror(outputFile);
+}
+
+int main(int argc, char** argv) {
+	if(argc != 5) {
+		fprintf(stderr, "Usage: %s <fontFile.ttf> <pixelSize> <SYMBOL_PREFIX> <outputFile.hpp>\n", argv[0]);
+		return 1;
+	}
+
+	const char* fontPath = argv[1];
+	int pixelSize = atoi(argv[2]);
+	const char* prefix = argv[3];
+	const char* outputPath = argv[4];
+	if(pixelSize <= 0 || pixelSize > MAX_GLYPH_SIZE / 2) FailWithError("Unsupported pixel size");
+
+	FILE* fontFile = fopen(fontPath, "rb");
+	if(!fontFile) FailWithError("Failed to open the font file");
+	fseek(fontFile, 0, SEEK_END);
+	long fontSize = ftell(fontFile);
+	fseek(fontFile, 0, SEEK_SET);
+	uint8* fontBytes = (fontSize > 0) ? (uint8*)malloc((size_t)fontSize) : NULL;
+	bool wasRead = fontBytes && fread(fontBytes, 1, (size_t)fontSize, fontFile) == (size_t)fontSize;
+	fclose(fontFile);
+	if(!wasRead) FailWithError("Failed to read the font file");
+
+	truetype_font_t font;
+	OpenFont(font, fontBytes, (size_t)fontSize);
+	double scale = pixelSize / (double)font.unitsPerEm;
+	int ascent = (int)ceil(font.ascender * scale);
+	int descent = (int)ceil(-font.descender * scale);
+	for(int index = 0; index < BAKED_CHARACTER_COUNT; ++index)
+		BakeGlyph(font, scale, (char)(FIRST_BAKED_CHARACTER + index), BAKED_GLYPHS[index]);
+
+	FILE* outputFile = fopen(outputPath, "wb");
+	if(!outputFile) FailWithError("Failed to open the output file");
+	bool wasWritten = WriteFontHeader(outputFile, fontPath, pixelSize, prefix, ascent, descent);
+	wasWritten = (fclose(outputFile) == 0) && wasWritten;
+	free(fontBytes);
+	if(!wasWritten) FailWithError("Failed to write the output file");
+
+	printf("Baked %d glyphs (%d px, ascent %d, descent %d) into %s\n", BAKED_CHARACTER_COUNT, pixelSize, ascent, descent, outputPath);
+	return 0;
+}
\ No newline at end of file
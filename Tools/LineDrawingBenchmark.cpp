@@ -0,0 +1,431 @@
+// ABOUT: Headless microbenchmark for the software line rasterizers (run this before changing the default line style)
+// ABOUT: Each line_drawing_style_t is timed over the same standardized line sets and verified against a reference
+
+#include "../Core/RagLite2.hpp"
+
+// TODO: Eliminate this
+#include <stdio.h>
+#include <stdlib.h>
+
+constexpr int BENCHMARK_CANVAS_WIDTH = 1024;
+constexpr int BENCHMARK_CANVAS_HEIGHT = 768;
+constexpr size_t BENCHMARK_LINES_PER_SET = 4096;
+constexpr size_t BENCHMARK_VERIFIED_LINES_PER_SET = 256;
+constexpr int DEFAULT_ITERATION_COUNT = 10;
+constexpr uint32 DEFAULT_RANDOM_SEED = 0xC0FFEE;
+
+constexpr rgba_color_t OPAQUE_LINE_COLOR = { .bytes = 0xFFFFFFFF };
+constexpr rgba_color_t TRANSLUCENT_LINE_COLOR = { .bytes = 0x80FFFFFF };
+constexpr uint8 COVERAGE_THRESHOLD = 128;
+
+typedef enum : uint8 {
+	LINE_SET_SHORT,
+	LINE_SET_LONG,
+	LINE_SET_STEEP,
+	LINE_SET_CLIPPED,
+	LINE_SET_ANTI_ALIASED,
+	LINE_SET_COUNT
+} benchmark_line_set_t;
+
+typedef struct line_segment {
+	int startX;
+	int startY;
+	int endX;
+	int endY;
+} line_segment_t;
+
+typedef struct benchmark_line_set {
+	const char* name;
+	rgba_color_t color;
+	line_segment_t segments[BENCHMARK_LINES_PER_SET];
+	// NOTE: Counts every step along the major axis, including those outside the canvas (= work that must be done)
+	size_t plottedPixelCount;
+} line_set_t;
+
+typedef struct benchmark_result {
+	double nanosecondsPerPixel;
+	double megapixelsPerSecond;
+	double kilolinesPerSecond;
+	size_t referencePixelCount;
+	size_t missingPixelCount;
+	size_t unexpectedPixelCount;
+} benchmark_result_t;
+
+GLOBAL line_set_t BENCHMARK_LINE_SETS[LINE_SET_COUNT] = {};
+GLOBAL uint8 REFERENCE_COVERAGE_MASK[BENCHMARK_CANVAS_WIDTH * BENCHMARK_CANVAS_HEIGHT] = {};
+GLOBAL uint32 BENCHMARK_RANDOM_STATE = DEFAULT_RANDOM_SEED;
+
+// NOTE: The aliased rasterizers should agree with the reference almost exactly (rounding ties are accepted either way)
+// NOTE: GDI omits the last pixel, and the AA coverage threshold clips faint endpoints, so they need some slack
+GLOBAL const double MAX_TOLERATED_MISMATCH[LINE_STYLE_COUNT] = {
+	0.35, // DEFAULT_GDI_LINE
+	0.02, // BRESENHAM_INTEGER_LINE
+	0.02, // DDA_FLOAT_LINE
+	0.10, // WU_FLOAT_LINE
+};
+
+INTERNAL int BenchmarkRandomInteger(int lowerBound, int upperBound) {
+	// Xorshift32 (deterministic, so that all rasterizers and all runs see the exact same lines)
+	uint32 state = BENCHMARK_RANDOM_STATE;
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	BENCHMARK_RANDOM_STATE = state;
+
+	uint32 range = (uint32)(upperBound - lowerBound + 1);
+	return lowerBound + (int)(state % range);
+}
+
+INTERNAL inline int IntegerAbsolute(int number) {
+	return (number < 0) ? -number : number;
+}
+
+INTERNAL inline size_t LineSegmentGetStepCount(line_segment_t& segment) {
+	int deltaX = IntegerAbsolute(segment.endX - segment.startX);
+	int deltaY = IntegerAbsolute(segment.endY - segment.startY);
+	return (size_t)Max(deltaX, deltaY) + 1;
+}
+
+INTERNAL line_segment_t LineSetGenerateSegment(benchmark_line_set_t setID) {
+	constexpr int WIDTH = BENCHMARK_CANVAS_WIDTH;
+	constexpr int HEIGHT = BENCHMARK_CANVAS_HEIGHT;
+	constexpr int MAX_SHORT_LINE_LENGTH = 16;
+
+	line_segment_t segment = {};
+	switch(setID) {
+		case LINE_SET_SHORT: {
+			segment.startX = BenchmarkRandomInteger(MAX_SHORT_LINE_LENGTH, WIDTH - MAX_SHORT_LINE_LENGTH - 1);
+			segment.startY = BenchmarkRandomInteger(MAX_SHORT_LINE_LENGTH, HEIGHT - MAX_SHORT_LINE_LENGTH - 1);
+			segment.endX = segment.startX + BenchmarkRandomInteger(-MAX_SHORT_LINE_LENGTH, MAX_SHORT_LINE_LENGTH);
+			segment.endY = segment.startY + BenchmarkRandomInteger(-MAX_SHORT_LINE_LENGTH, MAX_SHORT_LINE_LENGTH);
+		} break;
+		case LINE_SET_LONG: {
+			segment.startX = BenchmarkRandomInteger(0, WIDTH / 4);
+			segment.startY = BenchmarkRandomInteger(0, HEIGHT - 1);
+			segment.endX = BenchmarkRandomInteger(3 * WIDTH / 4, WIDTH - 1);
+			segment.endY = BenchmarkRandomInteger(0, HEIGHT - 1);
+		} break;
+		case LINE_SET_STEEP: {
+			segment.startX = BenchmarkRandomInteger(HEIGHT / 4, WIDTH - HEIGHT / 4 - 1);
+			segment.startY = BenchmarkRandomInteger(0, HEIGHT / 4);
+			segment.endX = segment.startX + BenchmarkRandomInteger(-HEIGHT / 4, HEIGHT / 4);
+			segment.endY = BenchmarkRandomInteger(3 * HEIGHT / 4, HEIGHT - 1);
+		} break;
+		case LINE_SET_CLIPPED: {
+			// At least one endpoint will be offscreen, so that most of the line has to be clipped
+			segment.startX = BenchmarkRandomInteger(-WIDTH / 2, WIDTH + WIDTH / 2);
+			segment.startY = BenchmarkRandomInteger(-HEIGHT / 2, -1);
+			segment.endX = BenchmarkRandomInteger(-WIDTH / 2, WIDTH + WIDTH / 2);
+			segment.endY = BenchmarkRandomInteger(0, HEIGHT + HEIGHT / 2);
+		} break;
+		case LINE_SET_ANTI_ALIASED: {
+			segment.startX = BenchmarkRandomInteger(0, WIDTH - 1);
+			segment.startY = BenchmarkRandomInteger(0, HEIGHT - 1);
+			segment.endX = BenchmarkRandomInteger(0, WIDTH - 1);
+			segment.endY = BenchmarkRandomInteger(0, HEIGHT - 1);
+		} break;
+		default:
+			break;
+	}
+
+	if(BenchmarkRandomInteger(0, 1)) {
+		// Rasterizers may well behave differently depending on the direction, so make sure all of them are covered
+		Swap(segment.startX, segment.endX, int);
+		Swap(segment.startY, segment.endY, int);
+	}
+
+	return segment;
+}
+
+INTERNAL void LineSetsInitialize() {
+	BENCHMARK_LINE_SETS[LINE_SET_SHORT].name = "Short";
+	BENCHMARK_LINE_SETS[LINE_SET_LONG].name = "Long";
+	BENCHMARK_LINE_SETS[LINE_SET_STEEP].name = "Steep";
+	BENCHMARK_LINE_SETS[LINE_SET_CLIPPED].name = "Clipped";
+	BENCHMARK_LINE_SETS[LINE_SET_ANTI_ALIASED].name = "Translucent";
+
+	for(int setID = 0; setID < LINE_SET_COUNT; ++setID) {
+		line_set_t& lineSet = BENCHMARK_LINE_SETS[setID];
+		lineSet.color = (setID == LINE_SET_ANTI_ALIASED) ? TRANSLUCENT_LINE_COLOR : OPAQUE_LINE_COLOR;
+		lineSet.plottedPixelCount = 0;
+		for(size_t index = 0; index < BENCHMARK_LINES_PER_SET; ++index) {
+			lineSet.segments[index] = LineSetGenerateSegment((benchmark_line_set_t)setID);
+			lineSet.plottedPixelCount += LineSegmentGetStepCount(lineSet.segments[index]);
+		}
+	}
+}
+
+#ifdef RAGLITE_PLATFORM_WINDOWS
+GLOBAL HDC BENCHMARK_DEVICE_CONTEXT = NULL;
+
+INTERNAL bool BenchmarkCreateCanvas(offscreen_buffer_t& canvas) {
+	// NOTE: GDI can only draw into its own DIB sections, so the software rasterizers have to share it for a fair test
+	BENCHMARK_DEVICE_CONTEXT = CreateCompatibleDC(NULL);
+	if(!BENCHMARK_DEVICE_CONTEXT) return false;
+
+	BITMAPINFO info = {};
+	info.bmiHeader.biSize = sizeof(info.bmiHeader);
+	info.bmiHeader.biWidth = BENCHMARK_CANVAS_WIDTH;
+	info.bmiHeader.biHeight = -BENCHMARK_CANVAS_HEIGHT; // Inverted Y
+	info.bmiHeader.biPlanes = 1;
+	info.bmiHeader.biBitCount = 32;
+	info.bmiHeader.biCompression = BI_RGB;
+
+	HBITMAP handle = CreateDIBSection(BENCHMARK_DEVICE_CONTEXT, &info, DIB_RGB_COLORS, &canvas.pixelBuffer, NULL, 0);
+	if(!handle || !canvas.pixelBuffer) return false;
+	SelectObject(BENCHMARK_DEVICE_CONTEXT, handle);
+
+	canvas.width = BENCHMARK_CANVAS_WIDTH;
+	canvas.height = BENCHMARK_CANVAS_HEIGHT;
+	canvas.bytesPerPixel = 4;
+	canvas.stride = canvas.width * canvas.bytesPerPixel;
+	return true;
+}
+
+INTERNAL inline void BenchmarkDrawLineGDI(line_segment_t& segment, rgba_color_t color) {
+	// NOTE: Mirrors what the runtime does (one pen per line), since that's the cost that should be measured
+	HPEN pen = CreatePen(PS_SOLID, 1, RGB(color.red, color.green, color.blue));
+	HGDIOBJ oldPen = SelectObject(BENCHMARK_DEVICE_CONTEXT, pen);
+	MoveToEx(BENCHMARK_DEVICE_CONTEXT, segment.startX, segment.startY, NULL);
+	LineTo(BENCHMARK_DEVICE_CONTEXT, segment.endX, segment.endY);
+	SelectObject(BENCHMARK_DEVICE_CONTEXT, oldPen);
+	DeleteObject(pen);
+}
+
+INTERNAL inline bool BenchmarkIsAvailable(line_drawing_style_t) {
+	return true;
+}
+
+INTERNAL inline void BenchmarkFinishDrawing() {
+	GdiFlush();
+}
+#else
+GLOBAL uint32 BENCHMARK_CANVAS_PIXELS[BENCHMARK_CANVAS_WIDTH * BENCHMARK_CANVAS_HEIGHT] = {};
+
+INTERNAL bool BenchmarkCreateCanvas(offscreen_buffer_t& canvas) {
+	canvas.width = BENCHMARK_CANVAS_WIDTH;
+	canvas.height = BENCHMARK_CANVAS_HEIGHT;
+	canvas.bytesPerPixel = 4;
+	canvas.stride = canvas.width * canvas.bytesPerPixel;
+	canvas.pixelBuffer = BENCHMARK_CANVAS_PIXELS;
+	return true;
+}
+
+INTERNAL inline void BenchmarkDrawLineGDI(line_segment_t&, rgba_color_t) {
+	// NOTE: Unreachable (there's no GDI in headless mode, and this will be skipped)
+}
+
+INTERNAL inline bool BenchmarkIsAvailable(line_drawing_style_t style) {
+	return style != DEFAULT_GDI_LINE;
+}
+
+INTERNAL inline void BenchmarkFinishDrawing() {
+}
+#endif
+
+INTERNAL inline void BenchmarkDrawLine(offscreen_buffer_t& canvas, line_drawing_style_t style, line_segment_t& segment, rgba_color_t color) {
+	switch(style) {
+		case DEFAULT_GDI_LINE:
+			BenchmarkDrawLineGDI(segment, color);
+			break;
+		case BRESENHAM_INTEGER_LINE:
+			BitmapDrawLineBresenham(canvas, segment.startX, segment.startY, segment.endX, segment.endY, color);
+			break;
+		case DDA_FLOAT_LINE:
+			BitmapDrawLineDDA(canvas, segment.startX, segment.startY, segment.endX, segment.endY, color);
+			break;
+		case WU_FLOAT_LINE:
+			BitmapDrawLineWu(canvas, segment.startX, segment.startY, segment.endX, segment.endY, color);
+			break;
+		default:
+			break;
+	}
+}
+
+INTERNAL void BenchmarkDrawLineSet(offscreen_buffer_t& canvas, line_drawing_style_t style, line_set_t& lineSet) {
+	// NOTE: Switching outside of the loop keeps dispatch overhead out of the measurements (unlike the runtime)
+	switch(style) {
+		case DEFAULT_GDI_LINE: {
+			for(size_t index = 0; index < BENCHMARK_LINES_PER_SET; ++index)
+				BenchmarkDrawLineGDI(lineSet.segments[index], lineSet.color);
+		} break;
+		case BRESENHAM_INTEGER_LINE: {
+			for(size_t index = 0; index < BENCHMARK_LINES_PER_SET; ++index) {
+				line_segment_t& segment = lineSet.segments[index];
+				BitmapDrawLineBresenham(canvas, segment.startX, segment.startY, segment.endX, segment.endY, lineSet.color);
+			}
+		} break;
+		case DDA_FLOAT_LINE: {
+			for(size_t index = 0; index < BENCHMARK_LINES_PER_SET; ++index) {
+				line_segment_t& segment = lineSet.segments[index];
+				BitmapDrawLineDDA(canvas, segment.startX, segment.startY, segment.endX, segment.endY, lineSet.color);
+			}
+		} break;
+		case WU_FLOAT_LINE: {
+			for(size_t index = 0; index < BENCHMARK_LINES_PER_SET; ++index) {
+				line_segment_t& segment = lineSet.segments[index];
+				BitmapDrawLineWu(canvas, segment.startX, segment.startY, segment.endX, segment.endY, lineSet.color);
+			}
+		} break;
+		default:
+			break;
+	}
+	BenchmarkFinishDrawing();
+}
+
+INTERNAL void BenchmarkClearCanvas(offscreen_buffer_t& canvas) {
+	for(int y = 0; y < canvas.height; ++y) {
+		uint32* row = (uint32*)((uint8*)canvas.pixelBuffer + (size_t)y * canvas.stride);
+		for(int x = 0; x < canvas.width; ++x)
+			row[x] = 0;
+	}
+}
+
+typedef enum : uint8 {
+	REFERENCE_PIXEL_UNCOVERED,
+	REFERENCE_PIXEL_COVERED,
+	REFERENCE_PIXEL_TIED, // Exactly halfway between two pixels (either one is acceptable)
+} reference_coverage_t;
+
+INTERNAL inline void ReferenceGetCandidates(int start, int delta, int step, int steps, int& first, int& second) {
+	// NOTE: Rational arithmetic, because floating-point rounding would hide the ties this is supposed to detect
+	int numerator = step * delta;
+	int quotient = (numerator >= 0) ? numerator / steps : -((-numerator + steps - 1) / steps);
+	int remainder = numerator - quotient * steps;
+
+	first = start + quotient;
+	second = first;
+	if(2 * remainder > steps) first = second = first + 1;
+	else if(2 * remainder == steps) second = first + 1;
+}
+
+INTERNAL size_t ReferenceRasterizeLine(line_segment_t& segment) {
+	// NOTE: Exact rounding of the ideal line at each step along the major axis (slow, but obviously correct)
+	int deltaX = segment.endX - segment.startX;
+	int deltaY = segment.endY - segment.startY;
+	int steps = Max(Max(IntegerAbsolute(deltaX), IntegerAbsolute(deltaY)), 1);
+
+	size_t coveredPixelCount = 0;
+	for(int step = 0; step <= steps; ++step) {
+		int firstX, secondX, firstY, secondY;
+		ReferenceGetCandidates(segment.startX, deltaX, step, steps, firstX, secondX);
+		ReferenceGetCandidates(segment.startY, deltaY, step, steps, firstY, secondY);
+
+		bool isTied = (firstX != secondX) || (firstY != secondY);
+		reference_coverage_t coverage = isTied ? REFERENCE_PIXEL_TIED : REFERENCE_PIXEL_COVERED;
+		int candidateX[] = { firstX, secondX };
+		int candidateY[] = { firstY, secondY };
+		for(int candidate = 0; candidate < (isTied ? 2 : 1); ++candidate) {
+			int x = candidateX[candidate];
+			int y = candidateY[candidate];
+			if(x < 0 || y < 0 || x >= BENCHMARK_CANVAS_WIDTH || y >= BENCHMARK_CANVAS_HEIGHT) continue;
+
+			uint8& expected = REFERENCE_COVERAGE_MASK[x + y * BENCHMARK_CANVAS_WIDTH];
+			if(expected == REFERENCE_PIXEL_UNCOVERED) coveredPixelCount++;
+			if(expected != REFERENCE_PIXEL_COVERED) expected = coverage;
+		}
+	}
+	return coveredPixelCount;
+}
+
+INTERNAL void BenchmarkVerifyLineSet(offscreen_buffer_t& canvas, line_drawing_style_t style, line_set_t& lineSet, benchmark_result_t& result) {
+	// NOTE: Lines are checked one at a time since overlapping (anti-aliased) lines would otherwise accumulate coverage
+	for(size_t index = 0; index < BENCHMARK_VERIFIED_LINES_PER_SET; ++index) {
+		line_segment_t& segment = lineSet.segments[index];
+		int left = ClampToInterval(Min(segment.startX, segment.endX) - 1, 0, canvas.width - 1);
+		int right = ClampToInterval(Max(segment.startX, segment.endX) + 1, 0, canvas.width - 1);
+		int top = ClampToInterval(Min(segment.startY, segment.endY) - 1, 0, canvas.height - 1);
+		int bottom = ClampToInterval(Max(segment.startY, segment.endY) + 1, 0, canvas.height - 1);
+
+		result.referencePixelCount += ReferenceRasterizeLine(segment);
+		BenchmarkDrawLine(canvas, style, segment, OPAQUE_LINE_COLOR);
+		BenchmarkFinishDrawing();
+
+		for(int y = top; y <= bottom; ++y) {
+			for(int x = left; x <= right; ++x) {
+				uint32* pixel = BitmapGetPixelAddress(canvas, x, y);
+				rgba_color_t color = { .bytes = *pixel };
+				uint8& expected = REFERENCE_COVERAGE_MASK[x + y * BENCHMARK_CANVAS_WIDTH];
+				bool isCovered = color.red >= COVERAGE_THRESHOLD;
+
+				if(expected == REFERENCE_PIXEL_COVERED && !isCovered) result.missingPixelCount++;
+				if(expected == REFERENCE_PIXEL_UNCOVERED && isCovered) result.unexpectedPixelCount++;
+
+				expected = REFERENCE_PIXEL_UNCOVERED;
+				*pixel = 0;
+			}
+		}
+	}
+}
+
+INTERNAL benchmark_result_t BenchmarkRunLineSet(offscreen_buffer_t& canvas, line_drawing_style_t style, line_set_t& lineSet, int iterationCount) {
+	benchmark_result_t result = {};
+
+	BenchmarkClearCanvas(canvas);
+	// Warmup run (page faults, caches, and GDI's lazy initialization shouldn't be part of the measurement)
+	BenchmarkDrawLineSet(canvas, style, lineSet);
+
+	uint64 before = PlatformGetMonotonicTicks();
+	for(int iteration = 0; iteration < iterationCount; ++iteration)
+		BenchmarkDrawLineSet(canvas, style, lineSet);
+	uint64 after = PlatformGetMonotonicTicks();
+
+	double elapsedSeconds = (double)(after - before) / (double)PlatformGetMonotonicTicksPerSecond();
+	double totalPixels = (double)lineSet.plottedPixelCount * iterationCount;
+	double totalLines = (double)BENCHMARK_LINES_PER_SET * iterationCount;
+	elapsedSeconds = Max(elapsedSeconds, 1e-9);
+
+	result.nanosecondsPerPixel = elapsedSeconds * 1e9 / totalPixels;
+	result.megapixelsPerSecond = totalPixels / elapsedSeconds / 1e6;
+	result.kilolinesPerSecond = totalLines / elapsedSeconds / 1e3;
+
+	BenchmarkClearCanvas(canvas);
+	BenchmarkVerifyLineSet(canvas, style, lineSet, result);
+
+	return result;
+}
+
+int main(int argc, char** argv) {
+	int iterationCount = DEFAULT_ITERATION_COUNT;
+	if(argc > 1) iterationCount = Max(1, atoi(argv[1]));
+
+	offscreen_buffer_t canvas = {};
+	if(!BenchmarkCreateCanvas(canvas)) {
+		fprintf(stderr, "Failed to create a %dx%d canvas for the benchmark\n", BENCHMARK_CANVAS_WIDTH, BENCHMARK_CANVAS_HEIGHT);
+		return 1;
+	}
+
+	LineSetsInitialize();
+
+	printf("Canvas: %dx%d pixels (%zu lines per set, %d iterations, %zu lines verified)\n",
+		BENCHMARK_CANVAS_WIDTH, BENCHMARK_CANVAS_HEIGHT, BENCHMARK_LINES_PER_SET, iterationCount, BENCHMARK_VERIFIED_LINES_PER_SET);
+	printf("%-12s %-28s %10s %10s %10s %10s %8s\n", "Line Set", "Rasterizer", "ns/pixel", "Mpixels/s", "Klines/s", "Mismatch", "Result");
+
+	int failedCheckCount = 0;
+	for(int setID = 0; setID < LINE_SET_COUNT; ++setID) {
+		line_set_t& lineSet = BENCHMARK_LINE_SETS[setID];
+		for(int styleID = 0; styleID < LINE_STYLE_COUNT; ++styleID) {
+			line_drawing_style_t style = (line_drawing_style_t)styleID;
+			const char* styleName = LineDrawingStyleToString(style);
+			if(!BenchmarkIsAvailable(style)) {
+				printf("%-12s %-28s %10s %10s %10s %10s %8s\n", lineSet.name, styleName, "-", "-", "-", "-", "SKIPPED");
+				continue;
+			}
+
+			benchmark_result_t result = BenchmarkRunLineSet(canvas, style, lineSet, iterationCount);
+			size_t mismatchCount = result.missingPixelCount + result.unexpectedPixelCount;
+			double mismatch = (double)mismatchCount / (double)Max(result.referencePixelCount, 1);
+			bool isAcceptable = mismatch <= MAX_TOLERATED_MISMATCH[style];
+			if(!isAcceptable) failedCheckCount++;
+
+			printf("%-12s %-28s %10.2f %10.1f %10.1f %9.2f%% %8s\n", lineSet.name, styleName,
+				result.nanosecondsPerPixel, result.megapixelsPerSecond, result.kilolinesPerSecond,
+				mismatch * 100.0, isAcceptable ? "OK" : "FAILED");
+		}
+	}
+
+	if(failedCheckCount == 0) printf("SUCCESS: All rasterizers produced the expected output\n");
+	else fprintf(stderr, "FAILED: %d rasterizer outputs deviated too much from the reference\n", failedCheckCount);
+
+	return failedCheckCount;
+}
\ No newline at end of file
@@ -5,6 +5,16 @@
 #define INTERNAL static
 
 #include "../Core/RagLite2.hpp"
+#include "../Core/FileFormats/ArcturusPAK.hpp"
+#include "../Core/FileFormats/RagnarokACT.hpp"
+#include "../Core/FileFormats/RagnarokGAT.hpp"
+#include "../Core/FileFormats/RagnarokGRF.hpp"
+#include "../Core/FileFormats/RagnarokRGZ.hpp"
+#include "../Core/FileFormats/RagnarokSPR.hpp"
+#include "../Core/FileFormats/Optimized/CompiledGRF.hpp"
+#include "../Core/FileFormats/Optimized/BulkExtraction.hpp"
+#include "../Core/FileFormats/Optimized/CompiledACT.hpp"
+#include "../Core/FileFormats/Optimized/SpriteAtlas.hpp"
 
 // TODO: Compute this automatically (requires a bit of annoying boilerplate, but it's not too difficult)
 GLOBAL const char* THIS_EXECUTABLE = "RagnarokTools.exe";
@@ -47,6 +57,8 @@ typedef enum : uint8_t {
 	OPCODE_DEFAULT_ACTION,
 	OPCODE_DESCRIBE_FORMAT,
 	OPCODE_LIST_CONTENTS,
+	OPCODE_COMPILE_INDEX,
+	OPCODE_EXTRACT_FILES,
 } roff_opcode_t;
 
 typedef struct {
@@ -54,6 +66,7 @@ typedef struct {
 	roff_opcode_t requestedOperation;
 	const char* inputSource;
 	const char* outputDestination;
+	const char* inputFilter;
 } roff_request_t;
 
 typedef struct {
@@ -97,6 +110,8 @@ INTERNAL roff_opcode_t ParseFileOperation(const char* argument) {
 	if(!argument) return OPCODE_DEFAULT_ACTION;
 	if(strcmp(argument, "info") == 0) return OPCODE_DESCRIBE_FORMAT;
 	if(strcmp(argument, "list") == 0) return OPCODE_LIST_CONTENTS;
+	if(strcmp(argument, "compile") == 0) return OPCODE_COMPILE_INDEX;
+	if(strcmp(argument, "extract") == 0) return OPCODE_EXTRACT_FILES;
 	return OPCODE_DEFAULT_ACTION;
 }
 
@@ -106,29 +121,34 @@ INTERNAL roff_request_t HandleCommandLineArguments(size_t argCount, const char**
 		.requestedOperation = OPCODE_DEFAULT_ACTION,
 		.inputSource = NULL,
 		.outputDestination = NULL,
+		.inputFilter = NULL,
 	};
 
 	if(argCount > 1) requestDetails.fileFormat = ParseFileFormat(arguments[1]);
 	if(argCount > 2) requestDetails.requestedOperation = ParseFileOperation(arguments[2]);
 	if(argCount > 3) requestDetails.inputSource = arguments[3];
 	if(argCount > 4) requestDetails.outputDestination = arguments[4];
+	if(argCount > 5) requestDetails.inputFilter = arguments[5];
 
 	return requestDetails;
 }
 
 INTERNAL void DisplayUsageInfo() {
-	printf("Usage: %s [ command action input output]\n\n", THIS_EXECUTABLE);
+	printf("Usage: %s [ command action input output filter]\n\n", THIS_EXECUTABLE);
 	// TODO: Synchronize this with the available command list (define once, auto-generate everything else)
 	printf("Available commands: %s adp bik bmp ebm ezv gat gnd gr2 grf imf jpg mp3 pak pal png rgz rsm rsw spr str tga wav OR help (default)\n", ROFF_COMMAND_LIST[FILE_FORMAT_ACT].fileExtension);
-	printf("Available operations: list or info (default)\n");
+	printf("Available operations: list, compile (act, grf, and spr only), extract (grf, pak, and rgz only) or info (default)\n");
 	printf("Available inputs: stdin (default) OR <filePath>\n");
-	printf("Available outputs: stdout (default) OR <filePath>\n");
+	printf("Available outputs: stdout (default) OR <filePath> OR <directoryPath> (extract only)\n");
+	printf("Available filters: everything (default) OR <pathPrefix> (grf and pak extract only)\n");
 }
 
 typedef void (*dispatch_fn_t)(roff_request_t requestDetails, platform_handle_t input, platform_handle_t output);
 typedef struct {
 	dispatch_fn_t info;
 	dispatch_fn_t list;
+	dispatch_fn_t compile;
+	dispatch_fn_t extract;
 } opcode_list_t;
 
 INTERNAL void PlaceholderNotYetImplemented(roff_request_t requestDetails, platform_handle_t inputFileHandle, platform_handle_t outputFileHandle) {
@@ -159,6 +179,1176 @@ INTERNAL void DisplayFormatInfo(roff_request_t requestDetails, platform_handle_t
 	printf("[NYI] A more useful file description for OS handle 0x%p should eventually appear here\n", &inputFileHandle);
 }
 
+// NOTE: Should be plenty for the typical file table (it's only used for buffering the output, so any size would do)
+constexpr size_t LIST_OUTPUT_BUFFER_SIZE = 64 * 1024;
+GLOBAL const char* CGRF_CACHE_DIRECTORY = "Cache";
+GLOBAL const char* CGRF_FILE_EXTENSION = ".cgrf";
+
+typedef struct loaded_archive {
+	const uint8* fileContents;
+	const uint8* indexContents; // Only set if the file table was restored from the cache
+	size_t indexSize;
+	grf_archive_t archive;
+	memory_arena_t persistentMemory;
+	memory_arena_t transientMemory;
+} loaded_archive_t;
+
+INTERNAL bool IsOutputHandle(platform_handle_t& outputFileHandle) {
+	return PlatformIsValidFileHandle(outputFileHandle) && PlatformNoFileErrors(outputFileHandle);
+}
+
+INTERNAL void FlushListOutput(string_builder_t& outputBuffer, platform_handle_t& outputFileHandle) {
+	if(IsOutputHandle(outputFileHandle)) PlatformWriteFileContents(outputFileHandle, outputBuffer.buffer, outputBuffer.length);
+	else fwrite(outputBuffer.buffer, sizeof(char), outputBuffer.length, stdout);
+	StringBuilderReset(outputBuffer);
+}
+
+// NOTE: Shared by all loaders - the mapping must be released via PlatformUnmapFile (even if decoding it fails later on)
+INTERNAL const uint8* MapInputFile(roff_request_t& requestDetails, platform_handle_t& inputFileHandle, size_t& fileSize) {
+	fileSize = 0;
+	if(!PlatformIsValidFileHandle(inputFileHandle) || !PlatformNoFileErrors(inputFileHandle)) {
+		fprintf(stderr, "[DISPATCH] Request aborted: Cannot read from an invalid OS file handle\n");
+		return NULL;
+	}
+
+	fileSize = PlatformGetFileSize(inputFileHandle);
+	const uint8* fileContents = (fileSize > 0) ? PlatformMapReadOnlyFile(inputFileHandle) : NULL;
+	if(!fileContents)
+		fprintf(stderr, "Failed to map %s into memory (platform reported error: %s)\n", requestDetails.inputSource, PlatformGetFileError(inputFileHandle));
+	return fileContents;
+}
+
+// The base address remains NULL if the allocation failed, so that the arena can be freed unconditionally
+INTERNAL bool CreatePreallocatedArena(memory_arena_t& arena, String displayName, arena_lifetime_flag lifetime, size_t size) {
+	arena = {
+		.displayName = displayName,
+		.lifetime = lifetime,
+		.usage = PREALLOCATED_ON_LOAD,
+		.baseAddress = PlatformAllocateMemory(size),
+		.reservedSize = size,
+		.committedSize = size,
+	};
+	return arena.baseAddress != NULL;
+}
+
+INTERNAL void FreePreallocatedArena(memory_arena_t& arena) {
+	if(arena.baseAddress) PlatformFreeMemory(arena.baseAddress, arena.reservedSize);
+	arena = {};
+}
+
+// Mirrors CompiledGRF.lua: Cache/<file name>.<extension> (relative to the working directory)
+INTERNAL String GetCachePath(const char* sourcePath, const char* fileExtension, char* pathBuffer, size_t capacity) {
+	char baseNameBuffer[GRF_MAX_PATH_LENGTH] = {};
+	String baseName = StringCreateFromSlice((uint8*)baseNameBuffer, Min(StringLength(sourcePath), sizeof(baseNameBuffer) - 1));
+	memcpy(baseNameBuffer, sourcePath, baseName.length);
+	PathStringToBaseNameInPlace(baseName);
+	PathStringStripFileExtensionInPlace(baseName);
+
+	string_builder_t cachePath = {
+		.buffer = pathBuffer,
+		.length = 0,
+		.capacity = capacity - sizeof(ASCII_NULL_TERMINATOR),
+		.wasTruncated = false,
+	};
+	StringBuilderAppendCString(cachePath, CGRF_CACHE_DIRECTORY);
+	StringBuilderAppendCharacter(cachePath, ASCII_FORWARD_SLASH);
+	StringBuilderAppendString(cachePath, baseName);
+	StringBuilderAppendCString(cachePath, fileExtension);
+	return StringBuilderToString(cachePath);
+}
+
+INTERNAL bool RestoreArchiveFromCache(loaded_archive_t& loadedArchive, const char* cachePath) {
+	platform_handle_t indexFileHandle = PlatformOpenFileHandle(cachePath, PlatformPolicyReadOnly());
+	if(!PlatformNoFileErrors(indexFileHandle)) return false;
+
+	loadedArchive.indexSize = PlatformGetFileSize(indexFileHandle);
+	loadedArchive.indexContents = (loadedArchive.indexSize > 0) ? PlatformMapReadOnlyFile(indexFileHandle) : NULL;
+	PlatformCloseFileHandle(indexFileHandle);
+	if(!loadedArchive.indexContents) return false;
+
+	grf_archive_t& archive = loadedArchive.archive;
+	if(CGRFRestoreTableOfContents(archive, loadedArchive.indexContents, loadedArchive.indexSize)
+		&& CGRFVerifySourceContents(archive, loadedArchive.indexContents)) return true;
+
+	fprintf(stderr, "Ignoring cached index %s (%s)\n", cachePath, archive.errorMessage.buffer);
+	PlatformUnmapFile(loadedArchive.indexContents);
+	loadedArchive.indexContents = NULL;
+	return false;
+}
+
+INTERNAL bool DecodeArchiveFileTable(loaded_archive_t& loadedArchive, size_t extraTransientMemorySize) {
+	grf_archive_t& archive = loadedArchive.archive;
+	size_t persistentMemorySize = GRFGetRequiredMemorySize(archive);
+	size_t transientMemorySize = GRFGetRequiredTransientMemorySize(archive) + extraTransientMemorySize;
+	bool wasPersistentMemoryAllocated = CreatePreallocatedArena(loadedArchive.persistentMemory, StringLiteral("GRF File Table"), KEEP_FOREVER_MANUAL_RESET, persistentMemorySize);
+	bool wasTransientMemoryAllocated = CreatePreallocatedArena(loadedArchive.transientMemory, StringLiteral("GRF Decompression Buffer"), RESET_AFTER_TASK_COMPLETION, transientMemorySize);
+	if(!wasPersistentMemoryAllocated || !wasTransientMemoryAllocated) {
+		fprintf(stderr, "Failed to allocate %zu bytes for the GRF file table\n", persistentMemorySize + transientMemorySize);
+		return false;
+	}
+
+	if(!GRFDecodeFileTable(archive, loadedArchive.persistentMemory, loadedArchive.transientMemory)) {
+		fprintf(stderr, "Failed to decode GRF file table (%s)\n", archive.errorMessage.buffer);
+		return false;
+	}
+
+	return true;
+}
+
+INTERNAL void UnloadArchive(loaded_archive_t& loadedArchive) {
+	FreePreallocatedArena(loadedArchive.transientMemory);
+	FreePreallocatedArena(loadedArchive.persistentMemory);
+	PlatformUnmapFile(loadedArchive.indexContents);
+	PlatformUnmapFile(loadedArchive.fileContents);
+	loadedArchive = {};
+}
+
+// NOTE: The transient arena is always allocated (even if the cache is used) so that handlers can rely on the extra space
+INTERNAL bool LoadArchive(roff_request_t& requestDetails, platform_handle_t& inputFileHandle, loaded_archive_t& loadedArchive,
+	bool shouldUseCache, size_t extraTransientMemorySize) {
+	loadedArchive = {};
+	size_t fileSize;
+	loadedArchive.fileContents = MapInputFile(requestDetails, inputFileHandle, fileSize);
+	if(!loadedArchive.fileContents) return false;
+
+	grf_archive_t& archive = loadedArchive.archive;
+	if(!GRFOpenArchive(archive, loadedArchive.fileContents, fileSize)) {
+		fprintf(stderr, "Failed to decode GRF header (%s)\n", archive.errorMessage.buffer);
+		return false;
+	}
+
+	char cachePath[GRF_MAX_PATH_LENGTH];
+	GetCachePath(requestDetails.inputSource, CGRF_FILE_EXTENSION, cachePath, sizeof(cachePath));
+	if(shouldUseCache && RestoreArchiveFromCache(loadedArchive, cachePath)) {
+		if(extraTransientMemorySize == 0) return true;
+		return CreatePreallocatedArena(loadedArchive.transientMemory, StringLiteral("GRF Output Buffer"), RESET_AFTER_TASK_COMPLETION, extraTransientMemorySize);
+	}
+
+	return DecodeArchiveFileTable(loadedArchive, extraTransientMemorySize);
+}
+
+INTERNAL void ListArchiveContents(roff_request_t requestDetails, platform_handle_t inputFileHandle, platform_handle_t outputFileHandle) {
+	uint64 startTime = PlatformGetMonotonicTicks();
+	loaded_archive_t loadedArchive;
+	if(!LoadArchive(requestDetails, inputFileHandle, loadedArchive, true, LIST_OUTPUT_BUFFER_SIZE + sizeof(ASCII_NULL_TERMINATOR))) {
+		UnloadArchive(loadedArchive);
+		return;
+	}
+
+	grf_archive_t& archive = loadedArchive.archive;
+	string_builder_t outputBuffer = StringBuilderCreate(loadedArchive.transientMemory, LIST_OUTPUT_BUFFER_SIZE);
+	// NOTE: Tab-separated so that scripts can easily consume it (paths may contain spaces, but never tabs)
+	for(uint32 index = 0; index < archive.fileCount; ++index) {
+		grf_entry_t& entry = archive.entries[index];
+		if(outputBuffer.capacity - outputBuffer.length < GRF_MAX_PATH_LENGTH + 2 * MAX_FORMATTED_NUMBER_LENGTH)
+			FlushListOutput(outputBuffer, outputFileHandle);
+
+		StringBuilderAppendString(outputBuffer, GRFGetEntryName(archive, entry));
+		StringBuilderAppendCharacter(outputBuffer, '\t');
+		StringBuilderAppendUnsigned(outputBuffer, entry.decompressedSize);
+		StringBuilderAppendCharacter(outputBuffer, '\t');
+		StringBuilderAppendUnsigned(outputBuffer, entry.compressedSize);
+		StringBuilderAppendCharacter(outputBuffer, '\n');
+	}
+	FlushListOutput(outputBuffer, outputFileHandle);
+
+	uint64 elapsedTicks = PlatformGetMonotonicTicks() - startTime;
+	milliseconds elapsedTime = (milliseconds)elapsedTicks * MILLISECONDS_PER_SECOND / (milliseconds)PlatformGetMonotonicTicksPerSecond();
+	const char* source = loadedArchive.indexContents ? "cached index" : "file table";
+	fprintf(stderr, "Listed %u entries (GRF version %u.%u) from the %s in %.2f ms\n", archive.fileCount, archive.majorVersion,
+		archive.minorVersion, source, elapsedTime);
+	if(archive.skippedEntryCount > 0)
+		fprintf(stderr, "Skipped %u entries whose names exceed the maximum path length\n", archive.skippedEntryCount);
+
+	UnloadArchive(loadedArchive);
+}
+
+INTERNAL void CompileArchiveIndex(roff_request_t requestDetails, platform_handle_t inputFileHandle, platform_handle_t outputFileHandle) {
+	loaded_archive_t loadedArchive;
+	if(!LoadArchive(requestDetails, inputFileHandle, loadedArchive, false, 0)) {
+		UnloadArchive(loadedArchive);
+		return;
+	}
+
+	grf_archive_t& archive = loadedArchive.archive;
+	cgrf_header_t header = CGRFComputeLayout(archive);
+	size_t compiledSize = CGRFGetCompiledSize(header);
+	uint8* compiledIndex = (uint8*)PlatformAllocateMemory(compiledSize);
+	if(!compiledIndex) {
+		fprintf(stderr, "Failed to allocate %zu bytes for the compiled index\n", compiledSize);
+		UnloadArchive(loadedArchive);
+		return;
+	}
+	CGRFCompileTableOfContents(archive, header, compiledIndex, compiledSize);
+
+	char cachePath[GRF_MAX_PATH_LENGTH];
+	const char* outputPath = requestDetails.outputDestination;
+	platform_handle_t indexFileHandle = outputFileHandle;
+	if(!outputPath) {
+		outputPath = GetCachePath(requestDetails.inputSource, CGRF_FILE_EXTENSION, cachePath, sizeof(cachePath)).buffer;
+		indexFileHandle = PlatformOpenFileHandle(outputPath, PlatformPolicyOverwrite());
+	}
+
+	size_t writtenSize = PlatformWriteFileContents(indexFileHandle, compiledIndex, compiledSize);
+	if(writtenSize == compiledSize) {
+		fprintf(stderr, "Saved compiled index for %u entries as %s (%zu bytes)\n", archive.fileCount, outputPath, compiledSize);
+	} else {
+		fprintf(stderr, "Failed to write %s (platform reported error: %s)\n", outputPath, PlatformGetFileError(indexFileHandle));
+		fprintf(stderr, "Make sure the %s directory exists and is writable by this process\n", CGRF_CACHE_DIRECTORY);
+	}
+
+	if(!requestDetails.outputDestination) PlatformCloseFileHandle(indexFileHandle);
+	PlatformFreeMemory(compiledIndex, compiledSize);
+	UnloadArchive(loadedArchive);
+}
+
+// Mirrors extract-from-grf.lua: <archive path>.extracted (unless a different directory was given)
+GLOBAL const char* EXTRACTION_DIRECTORY_SUFFIX = ".extracted";
+
+typedef struct extraction_target {
+	String outputDirectory;
+	// NOTE: Entries are mostly grouped by directory, so remembering the last one avoids most of the redundant system calls
+	char createdDirectories[BULK_EXTRACTION_MAX_WORKERS][GRF_MAX_PATH_LENGTH];
+	size_t createdDirectoryLengths[BULK_EXTRACTION_MAX_WORKERS];
+} extraction_target_t;
+
+// NOTE: Only the last directory must be created successfully (the others may already exist, or be drive letters, etc.)
+INTERNAL bool CreateDirectoryTree(char* directoryPath, size_t length, size_t existingPrefixLength) {
+	for(size_t index = existingPrefixLength + 1; index < length; ++index) {
+		char separator = directoryPath[index];
+		if(separator != ASCII_FORWARD_SLASH && separator != ASCII_BACKWARD_SLASH) continue;
+
+		directoryPath[index] = ASCII_NULL_TERMINATOR;
+		PlatformCreateDirectory(directoryPath);
+		directoryPath[index] = separator;
+	}
+
+	char terminator = directoryPath[length];
+	directoryPath[length] = ASCII_NULL_TERMINATOR;
+	bool wasCreated = PlatformCreateDirectory(directoryPath);
+	directoryPath[length] = terminator;
+	return wasCreated;
+}
+
+// NOTE: Archives are untrusted input - their paths must never escape from the output directory
+INTERNAL bool IsSafeRelativePath(String path) {
+	if(path.length == 0) return false;
+	if(path.buffer[0] == ASCII_FORWARD_SLASH || path.buffer[0] == ASCII_BACKWARD_SLASH) return false;
+
+	size_t componentStart = 0;
+	for(size_t index = 0; index <= path.length; ++index) {
+		char character = (index < path.length) ? path.buffer[index] : ASCII_FORWARD_SLASH;
+		if(character == ':') return false; // Drive letters and alternate data streams
+		if(character != ASCII_FORWARD_SLASH && character != ASCII_BACKWARD_SLASH) continue;
+
+		size_t componentLength = index - componentStart;
+		if(componentLength == 2 && path.buffer[componentStart] == '.' && path.buffer[componentStart + 1] == '.') return false;
+		componentStart = index + 1;
+	}
+	return true;
+}
+
+// Uses the given directory, or <input path>.extracted by default (trailing separators are removed)
+INTERNAL bool CreateExtractionDirectory(roff_request_t& requestDetails, string_builder_t& outputDirectory) {
+	char* directoryBuffer = outputDirectory.buffer;
+	StringBuilderAppendCString(outputDirectory, requestDetails.outputDestination ? requestDetails.outputDestination : requestDetails.inputSource);
+	if(!requestDetails.outputDestination) StringBuilderAppendCString(outputDirectory, EXTRACTION_DIRECTORY_SUFFIX);
+	while(outputDirectory.length > 1 && (directoryBuffer[outputDirectory.length - 1] == ASCII_FORWARD_SLASH || directoryBuffer[outputDirectory.length - 1] == ASCII_BACKWARD_SLASH))
+		directoryBuffer[--outputDirectory.length] = ASCII_NULL_TERMINATOR;
+
+	if(outputDirectory.wasTruncated) return false;
+	return CreateDirectoryTree(directoryBuffer, outputDirectory.length, 0);
+}
+
+// NOTE: Shared by all archive formats - each worker only ever touches its own slot in the target (so no locking is needed)
+INTERNAL bool WriteExtractedFile(extraction_target_t& target, uint32 workerIndex, String fileName, const uint8* contents, size_t size) {
+	if(!IsSafeRelativePath(fileName)) {
+		fprintf(stderr, "Skipped %s (path would escape from the output directory)\n", fileName.buffer);
+		return false;
+	}
+
+	char pathBuffer[2 * GRF_MAX_PATH_LENGTH];
+	string_builder_t filePath = {
+		.buffer = pathBuffer,
+		.length = 0,
+		.capacity = sizeof(pathBuffer) - sizeof(ASCII_NULL_TERMINATOR),
+		.wasTruncated = false,
+	};
+	StringBuilderAppendString(filePath, target.outputDirectory);
+	StringBuilderAppendCharacter(filePath, ASCII_FORWARD_SLASH);
+	StringBuilderAppendString(filePath, fileName);
+	if(filePath.wasTruncated) {
+		fprintf(stderr, "Failed to extract %s (output path is too long)\n", fileName.buffer);
+		return false;
+	}
+
+	// Some archives store Windows paths, with backslashes (which are regular characters elsewhere)
+	size_t directoryLength = target.outputDirectory.length;
+	for(size_t index = directoryLength + 1; index < filePath.length; ++index) {
+		if(pathBuffer[index] == ASCII_BACKWARD_SLASH) pathBuffer[index] = ASCII_FORWARD_SLASH;
+		if(pathBuffer[index] == ASCII_FORWARD_SLASH) directoryLength = index;
+	}
+
+	char* createdDirectory = target.createdDirectories[workerIndex];
+	size_t& createdDirectoryLength = target.createdDirectoryLengths[workerIndex];
+	bool isKnownDirectory = (directoryLength == createdDirectoryLength && memcmp(createdDirectory, pathBuffer, directoryLength) == 0);
+	if(!isKnownDirectory && directoryLength > target.outputDirectory.length) {
+		if(!CreateDirectoryTree(pathBuffer, directoryLength, target.outputDirectory.length)) {
+			fprintf(stderr, "Failed to create the parent directory of %s\n", pathBuffer);
+			return false;
+		}
+		createdDirectoryLength = Min(directoryLength, GRF_MAX_PATH_LENGTH);
+		memcpy(createdDirectory, pathBuffer, createdDirectoryLength);
+	}
+
+	platform_handle_t fileHandle = PlatformOpenFileHandle(pathBuffer, PlatformPolicyOverwrite());
+	size_t writtenSize = PlatformWriteFileContents(fileHandle, contents, size);
+	bool wasWritten = PlatformNoFileErrors(fileHandle) && writtenSize == size;
+	if(!wasWritten) fprintf(stderr, "Failed to write %s (platform reported error: %s)\n", pathBuffer, PlatformGetFileError(fileHandle));
+	PlatformCloseFileHandle(fileHandle);
+	return wasWritten;
+}
+
+INTERNAL bool WriteExtractedEntry(bulk_extraction_worker_t& worker, bulk_extraction_entry_t& entry) {
+	extraction_target_t& target = *(extraction_target_t*)worker.job->sinkContext;
+	if(!entry.contents) {
+		fprintf(stderr, "Failed to extract %s (%s)\n", entry.name.buffer, entry.errorMessage.buffer);
+		return false;
+	}
+
+	return WriteExtractedFile(target, worker.workerIndex, entry.name, entry.contents, entry.size);
+}
+
+// NOTE: Shared by all archive formats - the queue must only contain file entries, and the scratch space must fit the largest one
+// TBD: Workers write their own outputs (overlapping I/O with decompression on the other cores) - overlapped writes may help, but measure first
+INTERNAL void ExtractQueuedEntries(roff_request_t& requestDetails, bulk_extraction_job_t& job, size_t scratchSize, uint64 startTime) {
+	char directoryBuffer[GRF_MAX_PATH_LENGTH];
+	string_builder_t outputDirectory = {
+		.buffer = directoryBuffer,
+		.length = 0,
+		.capacity = sizeof(directoryBuffer) - sizeof(ASCII_NULL_TERMINATOR),
+		.wasTruncated = false,
+	};
+	if(job.entryCount == 0 || !CreateExtractionDirectory(requestDetails, outputDirectory)) {
+		if(job.entryCount == 0) fprintf(stderr, "No file entries match the filter \"%s\" (nothing to extract)\n", requestDetails.inputFilter ? requestDetails.inputFilter : "");
+		else fprintf(stderr, "Failed to create the output directory %s\n", directoryBuffer);
+		return;
+	}
+
+	uint32 batchCount = (job.entryCount + BULK_EXTRACTION_BATCH_SIZE - 1) / BULK_EXTRACTION_BATCH_SIZE;
+	uint32 workerCount = Min(Min(PlatformGetProcessorCount(), BULK_EXTRACTION_MAX_WORKERS), batchCount);
+	bulk_extraction_worker_t workers[BULK_EXTRACTION_MAX_WORKERS] = {};
+	for(uint32 workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+		// Fewer workers will do just fine (as long as there's at least one)
+		if(!CreatePreallocatedArena(workers[workerIndex].scratchMemory, StringLiteral("Extraction Buffer"), RESET_AFTER_TASK_COMPLETION, scratchSize)) {
+			workerCount = workerIndex;
+			break;
+		}
+	}
+
+	if(workerCount == 0) {
+		fprintf(stderr, "Failed to allocate %zu bytes for the extraction buffer\n", scratchSize);
+	} else {
+		LOCAL extraction_target_t target;
+		target.outputDirectory = StringBuilderToString(outputDirectory);
+		memset(target.createdDirectoryLengths, 0, sizeof(target.createdDirectoryLengths));
+
+		job.sink = WriteExtractedEntry;
+		job.sinkContext = &target;
+		BulkExtractionRunJob(job, workers, workerCount);
+
+		uint32 extractedCount = 0;
+		uint32 failedCount = 0;
+		uint64 extractedSize = 0;
+		for(uint32 workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+			extractedCount += workers[workerIndex].extractedCount;
+			failedCount += workers[workerIndex].failedCount;
+			extractedSize += workers[workerIndex].extractedSize;
+		}
+
+		uint64 elapsedTicks = PlatformGetMonotonicTicks() - startTime;
+		milliseconds elapsedTime = (milliseconds)elapsedTicks * MILLISECONDS_PER_SECOND / (milliseconds)PlatformGetMonotonicTicksPerSecond();
+		fprintf(stderr, "Extracted %u of %u entries (%llu bytes) into %s using %u threads in %.2f ms\n", extractedCount, job.entryCount,
+			(unsigned long long)extractedSize, directoryBuffer, workerCount, elapsedTime);
+		if(failedCount > 0) fprintf(stderr, "Failed to extract %u entries (see above for details)\n", failedCount);
+	}
+
+	for(uint32 workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+		FreePreallocatedArena(workers[workerIndex].scratchMemory);
+}
+
+INTERNAL void ExtractArchiveContents(roff_request_t requestDetails, platform_handle_t inputFileHandle, platform_handle_t outputFileHandle) {
+	uint64 startTime = PlatformGetMonotonicTicks();
+	loaded_archive_t loadedArchive;
+	if(!LoadArchive(requestDetails, inputFileHandle, loadedArchive, true, 0)) {
+		UnloadArchive(loadedArchive);
+		return;
+	}
+
+	grf_archive_t& archive = loadedArchive.archive;
+	size_t queueSize = 2 * archive.fileCount * sizeof(uint32) + 1; // Sorting requires as much scratch space as the queue itself
+	memory_arena_t queueMemory;
+	if(!CreatePreallocatedArena(queueMemory, StringLiteral("GRF Extraction Queue"), RESET_AFTER_TASK_COMPLETION, queueSize)) {
+		fprintf(stderr, "Failed to allocate %zu bytes for the extraction queue\n", queueSize);
+		UnloadArchive(loadedArchive);
+		return;
+	}
+
+	const char* filter = requestDetails.inputFilter ? requestDetails.inputFilter : "";
+	uint32* entryIndices = (uint32*)ArenaAllocateMemoryRegion(queueMemory, archive.fileCount * sizeof(uint32));
+	uint32 entryCount = GRFCollectEntriesByPrefix(archive, StringCreateFromSlice((uint8*)filter, StringLength(filter)), entryIndices);
+	GRFSortEntriesByOffset(archive, entryIndices, entryCount, queueMemory);
+
+	// NOTE: Every worker needs enough scratch space for the largest entry (it's reset after each one, so that's all it ever needs)
+	bulk_extraction_job_t job = {
+		.archive = &archive,
+		.extractEntry = GRFExtractBulkEntry,
+		.entryIndices = entryIndices,
+		.entryCount = entryCount,
+	};
+	ExtractQueuedEntries(requestDetails, job, GRFGetLargestExtractedSize(archive, entryIndices, entryCount) + 1, startTime);
+
+	FreePreallocatedArena(queueMemory);
+	UnloadArchive(loadedArchive);
+}
+
+typedef struct loaded_pack {
+	const uint8* fileContents;
+	pak_archive_t archive;
+	memory_arena_t persistentMemory;
+} loaded_pack_t;
+
+INTERNAL void UnloadPackArchive(loaded_pack_t& loadedPack) {
+	FreePreallocatedArena(loadedPack.persistentMemory);
+	PlatformUnmapFile(loadedPack.fileContents);
+	loadedPack = {};
+}
+
+// NOTE: The file table is decoded in place, straight from the mapping (only the entries and their names are copied)
+INTERNAL bool LoadPackArchive(roff_request_t& requestDetails, platform_handle_t& inputFileHandle, loaded_pack_t& loadedPack,
+	size_t extraMemorySize) {
+	loadedPack = {};
+	size_t fileSize;
+	loadedPack.fileContents = MapInputFile(requestDetails, inputFileHandle, fileSize);
+	if(!loadedPack.fileContents) return false;
+
+	pak_archive_t& archive = loadedPack.archive;
+	if(!PAKOpenArchive(archive, loadedPack.fileContents, fileSize)) {
+		fprintf(stderr, "Failed to decode PAK trailer (%s)\n", archive.errorMessage.buffer);
+		return false;
+	}
+
+	size_t persistentMemorySize = PAKGetRequiredMemorySize(archive) + extraMemorySize;
+	if(!CreatePreallocatedArena(loadedPack.persistentMemory, StringLiteral("PAK File Table"), KEEP_FOREVER_MANUAL_RESET, persistentMemorySize)) {
+		fprintf(stderr, "Failed to allocate %zu bytes for the PAK file table\n", persistentMemorySize);
+		return false;
+	}
+
+	if(!PAKDecodeFileTable(archive, loadedPack.persistentMemory)) {
+		fprintf(stderr, "Failed to decode PAK file table (%s)\n", archive.errorMessage.buffer);
+		return false;
+	}
+
+	return true;
+}
+
+INTERNAL void ListPackContents(roff_request_t requestDetails, platform_handle_t inputFileHandle, platform_handle_t outputFileHandle) {
+	uint64 startTime = PlatformGetMonotonicTicks();
+	loaded_pack_t loadedPack;
+	if(!LoadPackArchive(requestDetails, inputFileHandle, loadedPack, LIST_OUTPUT_BUFFER_SIZE + sizeof(ASCII_NULL_TERMINATOR))) {
+		UnloadPackArchive(loadedPack);
+		return;
+	}
+
+	pak_archive_t& archive = loadedPack.archive;
+	string_builder_t outputBuffer = StringBuilderCreate(loadedPack.persistentMemory, LIST_OUTPUT_BUFFER_SIZE);
+	// NOTE: Same columns as the GRF listing, so that scripts can handle both formats alike
+	for(uint32 index = 0; index < archive.entryCount; ++index) {
+		pak_entry_t& entry = archive.entries[index];
+		if(outputBuffer.capacity - outputBuffer.length < entry.nameLength + 2 * MAX_FORMATTED_NUMBER_LENGTH + 3)
+			FlushListOutput(outputBuffer, outputFileHandle);
+
+		StringBuilderAppendString(outputBuffer, PAKGetEntryName(archive, entry));
+		StringBuilderAppendCharacter(outputBuffer, '\t');
+		StringBuilderAppendUnsigned(outputBuffer, entry.decompressedSize);
+		StringBuilderAppendCharacter(outputBuffer, '\t');
+		StringBuilderAppendUnsigned(outputBuffer, entry.compressedSize);
+		StringBuilderAppendCharacter(outputBuffer, '\n');
+	}
+	FlushListOutput(outputBuffer, outputFileHandle);
+
+	uint64 elapsedTicks = PlatformGetMonotonicTicks() - startTime;
+	milliseconds elapsedTime = (milliseconds)elapsedTicks * MILLISECONDS_PER_SECOND / (milliseconds)PlatformGetMonotonicTicksPerSecond();
+	fprintf(stderr, "Listed %u entries (PAK version %u) in %.2f ms\n", archive.entryCount, archive.version, elapsedTime);
+
+	UnloadPackArchive(loadedPack);
+}
+
+INTERNAL void ExtractPackContents(roff_request_t requestDetails, platform_handle_t inputFileHandle, platform_handle_t outputFileHandle) {
+	uint64 startTime = PlatformGetMonotonicTicks();
+	loaded_pack_t loadedPack;
+	if(!LoadPackArchive(requestDetails, inputFileHandle, loadedPack, 0)) {
+		UnloadPackArchive(loadedPack);
+		return;
+	}
+
+	pak_archive_t& archive = loadedPack.archive;
+	size_t queueSize = archive.entryCount * sizeof(uint32) + 1;
+	memory_arena_t queueMemory;
+	if(!CreatePreallocatedArena(queueMemory, StringLiteral("PAK Extraction Queue"), RESET_AFTER_TASK_COMPLETION, queueSize)) {
+		fprintf(stderr, "Failed to allocate %zu bytes for the extraction queue\n", queueSize);
+		UnloadPackArchive(loadedPack);
+		return;
+	}
+
+	const char* filter = requestDetails.inputFilter ? requestDetails.inputFilter : "";
+	uint32* entryIndices = (uint32*)ArenaAllocateMemoryRegion(queueMemory, archive.entryCount * sizeof(uint32));
+	uint32 entryCount = PAKCollectEntriesByPrefix(archive, StringCreateFromSlice((uint8*)filter, StringLength(filter)), entryIndices);
+
+	// TBD: Entries are extracted in file table order, which seems to match the data layout (sort them by offset if that turns out to be wrong)
+	bulk_extraction_job_t job = {
+		.archive = &archive,
+		.extractEntry = PAKExtractBulkEntry,
+		.entryIndices = entryIndices,
+		.entryCount = entryCount,
+	};
+	ExtractQueuedEntries(requestDetails, job, PAKGetLargestExtractedSize(archive, entryIndices, entryCount) + 1, startTime);
+
+	FreePreallocatedArena(queueMemory);
+	UnloadPackArchive(loadedPack);
+}
+
+typedef struct loaded_patch {
+	const uint8* fileContents;
+	size_t fileSize;
+	rgz_archive_t archive;
+	memory_arena_t windowMemory;
+} loaded_patch_t;
+
+INTERNAL void UnloadPatchArchive(loaded_patch_t& loadedPatch) {
+	FreePreallocatedArena(loadedPatch.windowMemory);
+	PlatformUnmapFile(loadedPatch.fileContents);
+	loadedPatch.fileContents = NULL;
+}
+
+// NOTE: The window is all the memory that decoding requires - the patch itself is only mapped (and read sequentially, once)
+INTERNAL bool LoadPatchArchive(roff_request_t& requestDetails, platform_handle_t& inputFileHandle, loaded_patch_t& loadedPatch,
+	size_t extraWindowMemorySize) {
+	loadedPatch.fileContents = NULL;
+	loadedPatch.windowMemory = {};
+	loadedPatch.fileContents = MapInputFile(requestDetails, inputFileHandle, loadedPatch.fileSize);
+	if(!loadedPatch.fileContents) return false;
+
+	size_t windowMemorySize = RGZ_DEFAULT_WINDOW_SIZE + extraWindowMemorySize;
+	if(!CreatePreallocatedArena(loadedPatch.windowMemory, StringLiteral("RGZ Decompression Window"), RESET_AFTER_TASK_COMPLETION, windowMemorySize)) {
+		fprintf(stderr, "Failed to allocate %zu bytes for the decompression window\n", windowMemorySize);
+		return false;
+	}
+
+	uint8* window = (uint8*)ArenaAllocateMemoryRegion(loadedPatch.windowMemory, RGZ_DEFAULT_WINDOW_SIZE);
+	rgz_archive_t& archive = loadedPatch.archive;
+	if(!RGZOpenArchive(archive, loadedPatch.fileContents, loadedPatch.fileSize, window, RGZ_DEFAULT_WINDOW_SIZE)) {
+		fprintf(stderr, "Failed to decode RGZ header (%s)\n", archive.errorMessage.buffer);
+		return false;
+	}
+
+	return true;
+}
+
+typedef struct patch_listing {
+	string_builder_t outputBuffer;
+	platform_handle_t* outputFileHandle;
+} patch_listing_t;
+
+INTERNAL bool ListPatchEntry(void* context, rgz_entry_t& entry) {
+	patch_listing_t& listing = *(patch_listing_t*)context;
+	string_builder_t& outputBuffer = listing.outputBuffer;
+	if(outputBuffer.capacity - outputBuffer.length < entry.name.length + MAX_FORMATTED_NUMBER_LENGTH + 4)
+		FlushListOutput(outputBuffer, *listing.outputFileHandle);
+
+	StringBuilderAppendString(outputBuffer, entry.name);
+	StringBuilderAppendCharacter(outputBuffer, '\t');
+	StringBuilderAppendUnsigned(outputBuffer, entry.size);
+	StringBuilderAppendCharacter(outputBuffer, '\t');
+	StringBuilderAppendCharacter(outputBuffer, (char)entry.type);
+	StringBuilderAppendCharacter(outputBuffer, '\n');
+	return true;
+}
+
+// NOTE: The entire patch must be inflated either way (there's no file table), so listing it costs about as much as extracting it
+INTERNAL void ListPatchContents(roff_request_t requestDetails, platform_handle_t inputFileHandle, platform_handle_t outputFileHandle) {
+	uint64 startTime = PlatformGetMonotonicTicks();
+	LOCAL loaded_patch_t loadedPatch;
+	if(!LoadPatchArchive(requestDetails, inputFileHandle, loadedPatch, LIST_OUTPUT_BUFFER_SIZE + sizeof(ASCII_NULL_TERMINATOR))) {
+		UnloadPatchArchive(loadedPatch);
+		return;
+	}
+
+	rgz_archive_t& archive = loadedPatch.archive;
+	patch_listing_t listing = {
+		.outputBuffer = StringBuilderCreate(loadedPatch.windowMemory, LIST_OUTPUT_BUFFER_SIZE),
+		.outputFileHandle = &outputFileHandle,
+	};
+	rgz_sink_t sink = {
+		.context = &listing,
+		.beginEntry = ListPatchEntry,
+		.writeContents = NULL,
+		.endEntry = NULL,
+	};
+	bool wasDecoded = RGZDecodeEntries(archive, sink);
+	FlushListOutput(listing.outputBuffer, outputFileHandle);
+
+	uint64 elapsedTicks = PlatformGetMonotonicTicks() - startTime;
+	milliseconds elapsedTime = (milliseconds)elapsedTicks * MILLISECONDS_PER_SECOND / (milliseconds)PlatformGetMonotonicTicksPerSecond();
+	if(wasDecoded) {
+		fprintf(stderr, "Listed %u files and %u directories (%llu bytes) in %.2f ms\n", archive.fileCount, archive.directoryCount,
+			(unsigned long long)archive.totalFileSize, elapsedTime);
+	} else {
+		fprintf(stderr, "Failed to decode RGZ entries (%s)\n", archive.errorMessage.buffer);
+	}
+
+	UnloadPatchArchive(loadedPatch);
+}
+
+typedef struct patch_extraction_target {
+	String outputDirectory;
+	platform_handle_t fileHandle;
+	bool isFileOpen;
+	bool hasFailed; // Only the current entry is skipped (the stream must be consumed regardless)
+	uint32 extractedCount;
+	uint32 failedCount;
+	char pathBuffer[2 * GRF_MAX_PATH_LENGTH];
+	size_t pathLength;
+} patch_extraction_target_t;
+
+INTERNAL bool BeginExtractedPatchEntry(void* context, rgz_entry_t& entry) {
+	patch_extraction_target_t& target = *(patch_extraction_target_t*)context;
+	target.isFileOpen = false;
+	target.hasFailed = true;
+	if(!IsSafeRelativePath(entry.name)) {
+		fprintf(stderr, "Skipped %s (path would escape from the output directory)\n", entry.name.buffer);
+		return true;
+	}
+
+	string_builder_t entryPath = {
+		.buffer = target.pathBuffer,
+		.length = 0,
+		.capacity = sizeof(target.pathBuffer) - sizeof(ASCII_NULL_TERMINATOR),
+		.wasTruncated = false,
+	};
+	StringBuilderAppendString(entryPath, target.outputDirectory);
+	StringBuilderAppendCharacter(entryPath, ASCII_FORWARD_SLASH);
+	StringBuilderAppendString(entryPath, entry.name);
+	if(entryPath.wasTruncated) {
+		fprintf(stderr, "Failed to extract %s (output path is too long)\n", entry.name.buffer);
+		return true;
+	}
+	target.pathLength = entryPath.length;
+
+	// Patches are authored on Windows, so their paths use backslashes (which are regular characters elsewhere)
+	size_t directoryLength = target.outputDirectory.length;
+	for(size_t index = directoryLength + 1; index < entryPath.length; ++index) {
+		if(target.pathBuffer[index] == ASCII_BACKWARD_SLASH) target.pathBuffer[index] = ASCII_FORWARD_SLASH;
+		if(target.pathBuffer[index] == ASCII_FORWARD_SLASH) directoryLength = index;
+	}
+
+	if(entry.type == RGZ_DIRECTORY_ENTRY_TYPE) {
+		if(!CreateDirectoryTree(target.pathBuffer, entryPath.length, target.outputDirectory.length)) {
+			fprintf(stderr, "Failed to create directory %s\n", target.pathBuffer);
+			return true;
+		}
+		target.hasFailed = false;
+		return true;
+	}
+
+	// Directory entries usually come first, but nothing guarantees it
+	if(directoryLength > target.outputDirectory.length && !CreateDirectoryTree(target.pathBuffer, directoryLength, target.outputDirectory.length)) {
+		fprintf(stderr, "Failed to create the parent directory of %s\n", target.pathBuffer);
+		return true;
+	}
+
+	target.fileHandle = PlatformOpenFileHandle(target.pathBuffer, PlatformPolicyOverwrite());
+	if(!PlatformNoFileErrors(target.fileHandle)) {
+		fprintf(stderr, "Failed to open %s (platform reported error: %s)\n", target.pathBuffer, PlatformGetFileError(target.fileHandle));
+		return true;
+	}
+	target.isFileOpen = true;
+	target.hasFailed = false;
+	return true;
+}
+
+INTERNAL bool WriteExtractedPatchContents(void* context, rgz_entry_t& entry, const uint8* contents, size_t size) {
+	patch_extraction_target_t& target = *(patch_extraction_target_t*)context;
+	if(target.hasFailed || !target.isFileOpen) return true;
+
+	size_t writtenSize = PlatformWriteFileContents(target.fileHandle, contents, size);
+	if(writtenSize != size || !PlatformNoFileErrors(target.fileHandle)) {
+		fprintf(stderr, "Failed to write %s (platform reported error: %s)\n", target.pathBuffer, PlatformGetFileError(target.fileHandle));
+		target.hasFailed = true;
+	}
+	return true;
+}
+
+INTERNAL bool EndExtractedPatchEntry(void* context, rgz_entry_t& entry) {
+	patch_extraction_target_t& target = *(patch_extraction_target_t*)context;
+	if(target.isFileOpen) PlatformCloseFileHandle(target.fileHandle);
+	target.isFileOpen = false;
+
+	if(target.hasFailed) target.failedCount++;
+	else if(entry.type == RGZ_FILE_ENTRY_TYPE) target.extractedCount++;
+	return true;
+}
+
+// NOTE: Files are written as soon as they're inflated, so they never have to fit into memory (patches can be arbitrarily large)
+INTERNAL void ExtractPatchContents(roff_request_t requestDetails, platform_handle_t inputFileHandle, platform_handle_t outputFileHandle) {
+	uint64 startTime = PlatformGetMonotonicTicks();
+	LOCAL loaded_patch_t loadedPatch;
+	if(!LoadPatchArchive(requestDetails, inputFileHandle, loadedPatch, 0)) {
+		UnloadPatchArchive(loadedPatch);
+		return;
+	}
+
+	char directoryBuffer[GRF_MAX_PATH_LENGTH];
+	string_builder_t outputDirectory = {
+		.buffer = directoryBuffer,
+		.length = 0,
+		.capacity = sizeof(directoryBuffer) - sizeof(ASCII_NULL_TERMINATOR),
+		.wasTruncated = false,
+	};
+	if(!CreateExtractionDirectory(requestDetails, outputDirectory)) {
+		fprintf(stderr, "Failed to create the output directory %s\n", directoryBuffer);
+		UnloadPatchArchive(loadedPatch);
+		return;
+	}
+
+	LOCAL patch_extraction_target_t target;
+	target.outputDirectory = StringBuilderToString(outputDirectory);
+	target.isFileOpen = false;
+	target.hasFailed = false;
+	target.extractedCount = 0;
+	target.failedCount = 0;
+
+	rgz_archive_t& archive = loadedPatch.archive;
+	rgz_sink_t sink = {
+		.context = &target,
+		.beginEntry = BeginExtractedPatchEntry,
+		.writeContents = WriteExtractedPatchContents,
+		.endEntry = EndExtractedPatchEntry,
+	};
+	bool wasDecoded = RGZDecodeEntries(archive, sink);
+	if(target.isFileOpen) PlatformCloseFileHandle(target.fileHandle);
+
+	uint64 elapsedTicks = PlatformGetMonotonicTicks() - startTime;
+	milliseconds elapsedTime = (milliseconds)elapsedTicks * MILLISECONDS_PER_SECOND / (milliseconds)PlatformGetMonotonicTicksPerSecond();
+	if(!wasDecoded) fprintf(stderr, "Failed to decode RGZ entries (%s)\n", archive.errorMessage.buffer);
+	fprintf(stderr, "Extracted %u of %u files (%llu bytes) into %s in %.2f ms\n", target.extractedCount, archive.fileCount,
+		(unsigned long long)archive.totalFileSize, directoryBuffer, elapsedTime);
+	if(target.failedCount > 0) fprintf(stderr, "Failed to extract %u entries (see above for details)\n", target.failedCount);
+
+	UnloadPatchArchive(loadedPatch);
+}
+
+GLOBAL const char* CACT_FILE_EXTENSION = ".cact";
+
+typedef struct loaded_animation {
+	const uint8* fileContents;
+	size_t fileSize;
+	const uint8* cacheContents; // Only set if the animation was restored from the cache
+	act_animation_t animation;
+	memory_arena_t persistentMemory;
+} loaded_animation_t;
+
+INTERNAL void UnloadAnimation(loaded_animation_t& loadedAnimation) {
+	FreePreallocatedArena(loadedAnimation.persistentMemory);
+	PlatformUnmapFile(loadedAnimation.cacheContents);
+	PlatformUnmapFile(loadedAnimation.fileContents);
+	loadedAnimation = {};
+}
+
+INTERNAL bool RestoreAnimationFromCache(loaded_animation_t& loadedAnimation, const char* cachePath) {
+	platform_handle_t cacheFileHandle = PlatformOpenFileHandle(cachePath, PlatformPolicyReadOnly());
+	if(!PlatformNoFileErrors(cacheFileHandle)) return false;
+
+	size_t cacheSize = PlatformGetFileSize(cacheFileHandle);
+	loadedAnimation.cacheContents = (cacheSize > 0) ? PlatformMapReadOnlyFile(cacheFileHandle) : NULL;
+	PlatformCloseFileHandle(cacheFileHandle);
+	if(!loadedAnimation.cacheContents) return false;
+
+	act_animation_t& animation = loadedAnimation.animation;
+	if(CACTRestoreAnimation(animation, loadedAnimation.cacheContents, cacheSize)
+		&& CACTVerifySourceContents(animation, loadedAnimation.cacheContents, loadedAnimation.fileContents, loadedAnimation.fileSize)) return true;
+
+	fprintf(stderr, "Ignoring cached animation %s (%s)\n", cachePath, animation.errorMessage.buffer);
+	PlatformUnmapFile(loadedAnimation.cacheContents);
+	loadedAnimation.cacheContents = NULL;
+	return false;
+}
+
+// NOTE: The persistent arena only holds the extra memory if the cache is used (the restored arrays live in its file mapping)
+INTERNAL bool LoadAnimation(roff_request_t& requestDetails, platform_handle_t& inputFileHandle, loaded_animation_t& loadedAnimation,
+	bool shouldUseCache, size_t extraMemorySize) {
+	loadedAnimation = {};
+	loadedAnimation.fileContents = MapInputFile(requestDetails, inputFileHandle, loadedAnimation.fileSize);
+	if(!loadedAnimation.fileContents) return false;
+
+	char cachePath[GRF_MAX_PATH_LENGTH];
+	GetCachePath(requestDetails.inputSource, CACT_FILE_EXTENSION, cachePath, sizeof(cachePath));
+	if(shouldUseCache && RestoreAnimationFromCache(loadedAnimation, cachePath)) {
+		if(extraMemorySize == 0) return true;
+		return CreatePreallocatedArena(loadedAnimation.persistentMemory, StringLiteral("ACT Output Buffer"), RESET_AFTER_TASK_COMPLETION, extraMemorySize);
+	}
+
+	act_animation_t& animation = loadedAnimation.animation;
+	if(!ACTOpenAnimation(animation, loadedAnimation.fileContents, loadedAnimation.fileSize)) {
+		fprintf(stderr, "Failed to decode ACT file (%s)\n", animation.errorMessage.buffer);
+		return false;
+	}
+
+	size_t persistentMemorySize = ACTGetRequiredMemorySize(animation) + extraMemorySize;
+	if(!CreatePreallocatedArena(loadedAnimation.persistentMemory, StringLiteral("ACT Animation Data"), KEEP_FOREVER_MANUAL_RESET, persistentMemorySize)) {
+		fprintf(stderr, "Failed to allocate %zu bytes for the ACT animation data\n", persistentMemorySize);
+		return false;
+	}
+
+	ACTDecodeAnimation(animation, loadedAnimation.persistentMemory);
+	return true;
+}
+
+INTERNAL void ListAnimationContents(roff_request_t requestDetails, platform_handle_t inputFileHandle, platform_handle_t outputFileHandle) {
+	uint64 startTime = PlatformGetMonotonicTicks();
+	loaded_animation_t loadedAnimation;
+	if(!LoadAnimation(requestDetails, inputFileHandle, loadedAnimation, true, LIST_OUTPUT_BUFFER_SIZE + sizeof(ASCII_NULL_TERMINATOR))) {
+		UnloadAnimation(loadedAnimation);
+		return;
+	}
+	uint64 decodingTicks = PlatformGetMonotonicTicks() - startTime;
+
+	// NOTE: One line per clip - frame times are rounded to whole milliseconds (they're multiples of the 24 ms update interval anyway)
+	act_animation_t& animation = loadedAnimation.animation;
+	string_builder_t outputBuffer = StringBuilderCreate(loadedAnimation.persistentMemory, LIST_OUTPUT_BUFFER_SIZE);
+	for(uint32 clipIndex = 0; clipIndex < animation.clipCount; ++clipIndex) {
+		if(outputBuffer.capacity - outputBuffer.length < 4 * MAX_FORMATTED_NUMBER_LENGTH + 4)
+			FlushListOutput(outputBuffer, outputFileHandle);
+
+		uint32 firstFrame = animation.clipFrameOffsets[clipIndex];
+		uint32 lastFrame = animation.clipFrameOffsets[clipIndex + 1];
+		uint32 layerCount = animation.frameLayerOffsets[lastFrame] - animation.frameLayerOffsets[firstFrame];
+		StringBuilderAppendUnsigned(outputBuffer, clipIndex);
+		StringBuilderAppendCharacter(outputBuffer, '\t');
+		StringBuilderAppendUnsigned(outputBuffer, lastFrame - firstFrame);
+		StringBuilderAppendCharacter(outputBuffer, '\t');
+		StringBuilderAppendUnsigned(outputBuffer, layerCount);
+		StringBuilderAppendCharacter(outputBuffer, '\t');
+		StringBuilderAppendUnsigned(outputBuffer, (uint64)(animation.clipFrameTimes[clipIndex] + 0.5f));
+		StringBuilderAppendCharacter(outputBuffer, '\n');
+	}
+	FlushListOutput(outputBuffer, outputFileHandle);
+
+	milliseconds decodingTime = (milliseconds)decodingTicks * MILLISECONDS_PER_SECOND / (milliseconds)PlatformGetMonotonicTicksPerSecond();
+	const char* source = loadedAnimation.cacheContents ? "cached animation" : "ACT file";
+	fprintf(stderr, "Decoded %u clips (%u frames, %u layers, %u anchors, %u events, ACT version %u.%u) from the %s in %.2f ms\n", animation.clipCount,
+		animation.frameCount, animation.layerCount, animation.anchorCount, animation.eventCount, animation.majorVersion, animation.minorVersion, source, decodingTime);
+
+	UnloadAnimation(loadedAnimation);
+}
+
+INTERNAL void CompileAnimationCache(roff_request_t requestDetails, platform_handle_t inputFileHandle, platform_handle_t outputFileHandle) {
+	loaded_animation_t loadedAnimation;
+	if(!LoadAnimation(requestDetails, inputFileHandle, loadedAnimation, false, 0)) {
+		UnloadAnimation(loadedAnimation);
+		return;
+	}
+
+	act_animation_t& animation = loadedAnimation.animation;
+	cact_header_t header = CACTComputeLayout(animation, loadedAnimation.fileContents, loadedAnimation.fileSize);
+	size_t compiledSize = CACTGetCompiledSize(header);
+	uint8* compiledAnimation = (uint8*)PlatformAllocateMemory(compiledSize);
+	if(!compiledAnimation) {
+		fprintf(stderr, "Failed to allocate %zu bytes for the compiled animation\n", compiledSize);
+		UnloadAnimation(loadedAnimation);
+		return;
+	}
+	CACTCompileAnimation(animation, header, compiledAnimation, compiledSize);
+
+	char cachePath[GRF_MAX_PATH_LENGTH];
+	const char* outputPath = requestDetails.outputDestination;
+	platform_handle_t cacheFileHandle = outputFileHandle;
+	if(!outputPath) {
+		outputPath = GetCachePath(requestDetails.inputSource, CACT_FILE_EXTENSION, cachePath, sizeof(cachePath)).buffer;
+		cacheFileHandle = PlatformOpenFileHandle(outputPath, PlatformPolicyOverwrite());
+	}
+
+	size_t writtenSize = PlatformWriteFileContents(cacheFileHandle, compiledAnimation, compiledSize);
+	if(writtenSize == compiledSize) {
+		fprintf(stderr, "Saved compiled animation with %u clips as %s (%zu bytes)\n", animation.clipCount, outputPath, compiledSize);
+	} else {
+		fprintf(stderr, "Failed to write %s (platform reported error: %s)\n", outputPath, PlatformGetFileError(cacheFileHandle));
+		fprintf(stderr, "Make sure the %s directory exists and is writable by this process\n", CGRF_CACHE_DIRECTORY);
+	}
+
+	if(!requestDetails.outputDestination) PlatformCloseFileHandle(cacheFileHandle);
+	PlatformFreeMemory(compiledAnimation, compiledSize);
+	UnloadAnimation(loadedAnimation);
+}
+
+typedef struct loaded_sprite_sheet {
+	const uint8* fileContents;
+	spr_sprite_sheet_t sheet;
+	memory_arena_t imageMemory;
+} loaded_sprite_sheet_t;
+
+INTERNAL void UnloadSpriteSheet(loaded_sprite_sheet_t& loadedSheet) {
+	FreePreallocatedArena(loadedSheet.imageMemory);
+	PlatformUnmapFile(loadedSheet.fileContents);
+	loadedSheet = {};
+}
+
+// NOTE: Decodes every image (instead of just reading the headers) so that all operations also validate the pixel data
+INTERNAL bool LoadSpriteSheet(roff_request_t& requestDetails, platform_handle_t& inputFileHandle, loaded_sprite_sheet_t& loadedSheet,
+	size_t extraMemorySize) {
+	loadedSheet = {};
+	size_t fileSize;
+	loadedSheet.fileContents = MapInputFile(requestDetails, inputFileHandle, fileSize);
+	if(!loadedSheet.fileContents) return false;
+
+	spr_sprite_sheet_t& sheet = loadedSheet.sheet;
+	if(!SPROpenSpriteSheet(sheet, loadedSheet.fileContents, fileSize)) {
+		fprintf(stderr, "Failed to decode SPR header (%s)\n", sheet.errorMessage.buffer);
+		return false;
+	}
+
+	size_t imageMemorySize = SPRGetRequiredMemorySize(sheet) + extraMemorySize;
+	if(!CreatePreallocatedArena(loadedSheet.imageMemory, StringLiteral("SPR Images"), RESET_AFTER_TASK_COMPLETION, imageMemorySize)) {
+		fprintf(stderr, "Failed to allocate %zu bytes for the SPR images\n", imageMemorySize);
+		return false;
+	}
+
+	if(!SPRDecodeImages(sheet, loadedSheet.imageMemory)) {
+		fprintf(stderr, "Failed to decode SPR images (%s)\n", sheet.errorMessage.buffer);
+		return false;
+	}
+
+	return true;
+}
+
+INTERNAL void ListSpriteSheetContents(roff_request_t requestDetails, platform_handle_t inputFileHandle, platform_handle_t outputFileHandle) {
+	uint64 startTime = PlatformGetMonotonicTicks();
+	loaded_sprite_sheet_t loadedSheet;
+	if(!LoadSpriteSheet(requestDetails, inputFileHandle, loadedSheet, LIST_OUTPUT_BUFFER_SIZE + sizeof(ASCII_NULL_TERMINATOR))) {
+		UnloadSpriteSheet(loadedSheet);
+		return;
+	}
+	uint64 decodingTicks = PlatformGetMonotonicTicks() - startTime;
+
+	spr_sprite_sheet_t& sheet = loadedSheet.sheet;
+	string_builder_t outputBuffer = StringBuilderCreate(loadedSheet.imageMemory, LIST_OUTPUT_BUFFER_SIZE);
+	for(uint32 index = 0; index < SPRGetImageCount(sheet); ++index) {
+		offscreen_buffer_t& image = sheet.images[index];
+		if(outputBuffer.capacity - outputBuffer.length < 3 * MAX_FORMATTED_NUMBER_LENGTH + 16)
+			FlushListOutput(outputBuffer, outputFileHandle);
+
+		StringBuilderAppendUnsigned(outputBuffer, index);
+		StringBuilderAppendCharacter(outputBuffer, '\t');
+		StringBuilderAppendCString(outputBuffer, (index < sheet.indexedImageCount) ? "indexed" : "truecolor");
+		StringBuilderAppendCharacter(outputBuffer, '\t');
+		StringBuilderAppendUnsigned(outputBuffer, image.width);
+		StringBuilderAppendCharacter(outputBuffer, '\t');
+		StringBuilderAppendUnsigned(outputBuffer, image.height);
+		StringBuilderAppendCharacter(outputBuffer, '\n');
+	}
+	FlushListOutput(outputBuffer, outputFileHandle);
+
+	milliseconds decodingTime = (milliseconds)decodingTicks * MILLISECONDS_PER_SECOND / (milliseconds)PlatformGetMonotonicTicksPerSecond();
+	fprintf(stderr, "Decoded %u indexed and %u true-color images (%zu pixels, SPR version %u.%u) in %.2f ms\n", sheet.indexedImageCount,
+		sheet.trueColorImageCount, sheet.pixelCount, sheet.majorVersion, sheet.minorVersion, decodingTime);
+
+	UnloadSpriteSheet(loadedSheet);
+}
+
+// Same defaults as the compiled GRF indices: Cache/<sprite sheet name>.tga, with the UV table stored next to the atlas image
+GLOBAL const char* SATL_IMAGE_EXTENSION = ".tga";
+GLOBAL const char* SATL_FILE_EXTENSION = ".satl";
+
+INTERNAL bool WriteSpriteAtlasFiles(sprite_atlas_t& atlas, spr_sprite_sheet_t& sheet, const char* imagePath, platform_handle_t& imageFileHandle,
+	uint8* tableContents) {
+	uint8 imageHeader[TGA_HEADER_SIZE];
+	SpriteAtlasEncodeTGAHeader(atlas, imageHeader);
+	size_t imageSize = SpriteAtlasGetImageSize(atlas);
+	bool wasImageWritten = PlatformWriteFileContents(imageFileHandle, imageHeader, sizeof(imageHeader)) == sizeof(imageHeader)
+		&& PlatformWriteFileContents(imageFileHandle, atlas.image.pixelBuffer, imageSize) == imageSize;
+	if(!wasImageWritten) {
+		fprintf(stderr, "Failed to write %s (platform reported error: %s)\n", imagePath, PlatformGetFileError(imageFileHandle));
+		return false;
+	}
+
+	char tablePathBuffer[GRF_MAX_PATH_LENGTH];
+	string_builder_t tablePath = {
+		.buffer = tablePathBuffer,
+		.length = 0,
+		.capacity = sizeof(tablePathBuffer) - sizeof(ASCII_NULL_TERMINATOR),
+		.wasTruncated = false,
+	};
+	StringBuilderAppendCString(tablePath, imagePath);
+	String existingPath = StringBuilderToString(tablePath);
+	size_t extensionStartIndex = StringFindLastOf(existingPath, ASCII_PERIOD_DOT);
+	size_t separatorIndex = PathStringFindLastSeparator(existingPath);
+	bool hasExtension = extensionStartIndex != STRING_INDEX_NOT_FOUND && (separatorIndex == STRING_INDEX_NOT_FOUND || extensionStartIndex > separatorIndex);
+	if(hasExtension) tablePath.length = extensionStartIndex;
+	StringBuilderAppendCString(tablePath, SATL_FILE_EXTENSION);
+	if(tablePath.wasTruncated) {
+		fprintf(stderr, "Failed to store the UV table for %s (path is too long)\n", imagePath);
+		return false;
+	}
+
+	size_t tableSize = SpriteAtlasGetTableSize(atlas);
+	SpriteAtlasEncodeTable(atlas, sheet, tableContents);
+	platform_handle_t tableFileHandle = PlatformOpenFileHandle(tablePathBuffer, PlatformPolicyOverwrite());
+	size_t writtenSize = PlatformWriteFileContents(tableFileHandle, tableContents, tableSize);
+	if(writtenSize != tableSize) fprintf(stderr, "Failed to write %s (platform reported error: %s)\n", tablePathBuffer, PlatformGetFileError(tableFileHandle));
+	else fprintf(stderr, "Saved atlas image as %s and UV table as %s (%zu bytes)\n", imagePath, tablePathBuffer, tableSize);
+	PlatformCloseFileHandle(tableFileHandle);
+	return writtenSize == tableSize;
+}
+
+// NOTE: Packs every image of the sprite sheet, since the UV table is indexed like the sheet itself (and may be shared by several ACT files)
+INTERNAL void CompileSpriteAtlas(roff_request_t requestDetails, platform_handle_t inputFileHandle, platform_handle_t outputFileHandle) {
+	uint64 startTime = PlatformGetMonotonicTicks();
+	loaded_sprite_sheet_t loadedSheet;
+	if(!LoadSpriteSheet(requestDetails, inputFileHandle, loadedSheet, 0)) {
+		UnloadSpriteSheet(loadedSheet);
+		return;
+	}
+
+	spr_sprite_sheet_t& sheet = loadedSheet.sheet;
+	uint32 imageCount = SPRGetImageCount(sheet);
+	size_t packingMemorySize = SpriteAtlasGetRequiredMemorySize(imageCount) + sizeof(sprite_atlas_header_t) + imageCount * sizeof(sprite_atlas_entry_t);
+	memory_arena_t packingMemory;
+	if(!CreatePreallocatedArena(packingMemory, StringLiteral("Sprite Atlas Layout"), RESET_AFTER_TASK_COMPLETION, packingMemorySize)) {
+		fprintf(stderr, "Failed to allocate %zu bytes for the atlas layout\n", packingMemorySize);
+		UnloadSpriteSheet(loadedSheet);
+		return;
+	}
+
+	sprite_atlas_t atlas;
+	if(!SpriteAtlasPackImages(atlas, sheet.images, imageCount, packingMemory)) {
+		fprintf(stderr, "Failed to pack %u images (%s)\n", imageCount, atlas.errorMessage.buffer);
+		FreePreallocatedArena(packingMemory);
+		UnloadSpriteSheet(loadedSheet);
+		return;
+	}
+	uint8* tableContents = (uint8*)ArenaAllocateMemoryRegion(packingMemory, SpriteAtlasGetTableSize(atlas));
+
+	// NOTE: Freshly allocated pages are always zeroed, so the unused parts of the atlas are transparent already
+	size_t atlasMemorySize = SpriteAtlasGetImageSize(atlas);
+	memory_arena_t atlasMemory;
+	if(!CreatePreallocatedArena(atlasMemory, StringLiteral("Sprite Atlas Image"), RESET_AFTER_TASK_COMPLETION, atlasMemorySize)) {
+		fprintf(stderr, "Failed to allocate %zu bytes for the atlas image\n", atlasMemorySize);
+		FreePreallocatedArena(packingMemory);
+		UnloadSpriteSheet(loadedSheet);
+		return;
+	}
+	SpriteAtlasCopyImages(atlas, sheet.images, atlasMemory);
+
+	size_t packedArea = 0;
+	for(uint32 index = 0; index < atlas.entryCount; ++index)
+		packedArea += (size_t)atlas.entries[index].width * atlas.entries[index].height;
+	uint64 elapsedTicks = PlatformGetMonotonicTicks() - startTime;
+	milliseconds elapsedTime = (milliseconds)elapsedTicks * MILLISECONDS_PER_SECOND / (milliseconds)PlatformGetMonotonicTicksPerSecond();
+	fprintf(stderr, "Packed %u images into a %dx%d atlas (%.1f%% of its area used, %zu of %zu pixels trimmed) in %.2f ms\n", imageCount,
+		atlas.width, atlas.height, 100.0 * packedArea / ((size_t)atlas.width * atlas.height), sheet.pixelCount - packedArea, sheet.pixelCount, elapsedTime);
+
+	char cachePath[GRF_MAX_PATH_LENGTH];
+	const char* imagePath = requestDetails.outputDestination;
+	platform_handle_t imageFileHandle = outputFileHandle;
+	if(!imagePath) {
+		imagePath = GetCachePath(requestDetails.inputSource, SATL_IMAGE_EXTENSION, cachePath, sizeof(cachePath)).buffer;
+		imageFileHandle = PlatformOpenFileHandle(imagePath, PlatformPolicyOverwrite());
+	}
+	bool wasSaved = WriteSpriteAtlasFiles(atlas, sheet, imagePath, imageFileHandle, tableContents);
+	if(!wasSaved && !requestDetails.outputDestination) fprintf(stderr, "Make sure the %s directory exists and is writable by this process\n", CGRF_CACHE_DIRECTORY);
+
+	if(!requestDetails.outputDestination) PlatformCloseFileHandle(imageFileHandle);
+	FreePreallocatedArena(atlasMemory);
+	FreePreallocatedArena(packingMemory);
+	UnloadSpriteSheet(loadedSheet);
+}
+
+typedef struct loaded_collision_map {
+	const uint8* fileContents;
+	gat_collision_map_t map;
+	memory_arena_t terrainMemory;
+} loaded_collision_map_t;
+
+INTERNAL void UnloadCollisionMap(loaded_collision_map_t& loadedMap) {
+	FreePreallocatedArena(loadedMap.terrainMemory);
+	PlatformUnmapFile(loadedMap.fileContents);
+	loadedMap = {};
+}
+
+INTERNAL bool LoadCollisionMap(roff_request_t& requestDetails, platform_handle_t& inputFileHandle, loaded_collision_map_t& loadedMap,
+	size_t extraMemorySize) {
+	loadedMap = {};
+	size_t fileSize;
+	loadedMap.fileContents = MapInputFile(requestDetails, inputFileHandle, fileSize);
+	if(!loadedMap.fileContents) return false;
+
+	gat_collision_map_t& map = loadedMap.map;
+	if(!GATOpenCollisionMap(map, loadedMap.fileContents, fileSize)) {
+		fprintf(stderr, "Failed to decode GAT file (%s)\n", map.errorMessage.buffer);
+		return false;
+	}
+
+	size_t terrainMemorySize = GATGetRequiredMemorySize(map) + extraMemorySize;
+	if(!CreatePreallocatedArena(loadedMap.terrainMemory, StringLiteral("GAT Terrain Data"), KEEP_FOREVER_MANUAL_RESET, terrainMemorySize)) {
+		fprintf(stderr, "Failed to allocate %zu bytes for the GAT terrain data\n", terrainMemorySize);
+		return false;
+	}
+
+	GATDecodeCollisionMap(map, loadedMap.terrainMemory);
+	return true;
+}
+
+// NOTE: One line per row, starting with the northernmost one (so that the output looks like the minimap): '.' is walkable, '~' is walkable water
+INTERNAL void ListCollisionMapContents(roff_request_t requestDetails, platform_handle_t inputFileHandle, platform_handle_t outputFileHandle) {
+	uint64 startTime = PlatformGetMonotonicTicks();
+	loaded_collision_map_t loadedMap;
+	if(!LoadCollisionMap(requestDetails, inputFileHandle, loadedMap, LIST_OUTPUT_BUFFER_SIZE + sizeof(ASCII_NULL_TERMINATOR))) {
+		UnloadCollisionMap(loadedMap);
+		return;
+	}
+	uint64 decodingTicks = PlatformGetMonotonicTicks() - startTime;
+
+	gat_collision_map_t& map = loadedMap.map;
+	string_builder_t outputBuffer = StringBuilderCreate(loadedMap.terrainMemory, LIST_OUTPUT_BUFFER_SIZE);
+	size_t walkableTileCount = 0;
+	size_t waterTileCount = 0;
+	for(int y = map.height - 1; y >= 0; --y) {
+		if(outputBuffer.capacity - outputBuffer.length < (size_t)map.width + 1)
+			FlushListOutput(outputBuffer, outputFileHandle);
+
+		for(int x = 0; x < map.width; x += GAT_TILES_PER_WORD) {
+			int count = Min(map.width - x, GAT_TILES_PER_WORD);
+			uint32 walkableBits = GATExtractRowBits(map, GAT_WALKABLE_TILES, x, y, count);
+			uint32 waterBits = GATExtractRowBits(map, GAT_WATER_TILES, x, y, count);
+			for(int bitIndex = 0; bitIndex < count; ++bitIndex) {
+				bool isWalkable = (walkableBits >> bitIndex) & 1;
+				bool isWater = (waterBits >> bitIndex) & 1;
+				walkableTileCount += isWalkable;
+				waterTileCount += isWater;
+				StringBuilderAppendCharacter(outputBuffer, !isWalkable ? '#' : (isWater ? '~' : '.'));
+			}
+		}
+		StringBuilderAppendCharacter(outputBuffer, '\n');
+	}
+	FlushListOutput(outputBuffer, outputFileHandle);
+
+	milliseconds decodingTime = (milliseconds)decodingTicks * MILLISECONDS_PER_SECOND / (milliseconds)PlatformGetMonotonicTicksPerSecond();
+	fprintf(stderr, "Decoded %dx%d tiles (%zu walkable, %zu water, GAT version %u.%u) in %.2f ms\n", map.width, map.height, walkableTileCount,
+		waterTileCount, map.majorVersion, map.minorVersion, decodingTime);
+
+	UnloadCollisionMap(loadedMap);
+}
+
 INTERNAL opcode_list_t GetSupportedFormatOperations(roff_format_t fileFormat) {
 	opcode_list_t supportedOperations = {
 		.info = DisplayFormatInfo
@@ -169,30 +1359,48 @@ INTERNAL opcode_list_t GetSupportedFormatOperations(roff_format_t fileFormat) {
 		case FILE_FORMAT_COUNT:
 			fprintf(stderr, "Attempted to query supported operations without providing a recognized file format ID\n");
 			break;
-		case FILE_FORMAT_ACT:
 		case FILE_FORMAT_ADP:
 		case FILE_FORMAT_BMP:
 		case FILE_FORMAT_EBM:
 		case FILE_FORMAT_EZV:
-		case FILE_FORMAT_GAT:
 		case FILE_FORMAT_GND:
 		case FILE_FORMAT_GR2:
-		case FILE_FORMAT_GRF:
 		case FILE_FORMAT_IMF:
 		case FILE_FORMAT_JPG:
 		case FILE_FORMAT_MP3:
-		case FILE_FORMAT_PAK:
 		case FILE_FORMAT_PAL:
-		case FILE_FORMAT_RGZ:
 		case FILE_FORMAT_RSM:
 		case FILE_FORMAT_RSW:
-		case FILE_FORMAT_SPR:
 		case FILE_FORMAT_STR:
 		case FILE_FORMAT_TGA:
 		case FILE_FORMAT_WAV:
 		default:
 			supportedOperations.list = PlaceholderNotYetImplemented;
 			break;
+		case FILE_FORMAT_GRF:
+			supportedOperations.list = ListArchiveContents;
+			supportedOperations.compile = CompileArchiveIndex;
+			supportedOperations.extract = ExtractArchiveContents;
+			break;
+		case FILE_FORMAT_PAK:
+			supportedOperations.list = ListPackContents;
+			supportedOperations.extract = ExtractPackContents;
+			break;
+		case FILE_FORMAT_RGZ:
+			supportedOperations.list = ListPatchContents;
+			supportedOperations.extract = ExtractPatchContents;
+			break;
+		case FILE_FORMAT_ACT:
+			supportedOperations.list = ListAnimationContents;
+			supportedOperations.compile = CompileAnimationCache;
+			break;
+		case FILE_FORMAT_SPR:
+			supportedOperations.list = ListSpriteSheetContents;
+			supportedOperations.compile = CompileSpriteAtlas;
+			break;
+		case FILE_FORMAT_GAT:
+			supportedOperations.list = ListCollisionMapContents;
+			break;
 	}
 
 	return supportedOperations;
@@ -320,7 +1528,10 @@ int main(size_t argCount, const char** arguments) {
 	InitializeCommandRegistry();
 
 	roff_request_t requestDetails = HandleCommandLineArguments(argCount, arguments);
-	if(requestDetails.fileFormat == FILE_FORMAT_NONE) return DisplayUsageInfo();
+	if(requestDetails.fileFormat == FILE_FORMAT_NONE) {
+		DisplayUsageInfo();
+		return 0;
+	}
 
 	// TODO: Preallocate a temporary memory arena for the format-specific decoders here
 
@@ -335,17 +1546,19 @@ int main(size_t argCount, const char** arguments) {
 			fprintf(stderr, "Make sure the file exists in the working directory and is readable by this process\n");
 			return 1;
 		}
-		size_t fileSize = PlatformGetFileSize(inputFileHandle);
-		printf("[NYI] Reading file contents from %s (%zd bytes)\n", requestDetails.inputSource, fileSize);
-		PlatformCloseFileHandle(inputFileHandle);
 	}
 
-	// TODO: Open platform handle to output file or stream
+	// NOTE: Handlers fall back to STDOUT (or a default location) if no output file was given
+	// NOTE: Extraction writes one file per entry, so its output destination is a directory (which can't be opened here)
 	platform_handle_t outputFileHandle = {};
-	if(!requestDetails.outputDestination) {
-		printf("[NYI] Writing to STDOUT isn't currently supported, but should be very soon (... famous last words?)\n");
-	} else {
-		printf("[NYI] Writing files isn't currently supported, but should be very soon (... famous last words?)\n");
+	bool isDirectoryOutput = (requestDetails.requestedOperation == OPCODE_EXTRACT_FILES);
+	if(requestDetails.outputDestination && !isDirectoryOutput) {
+		outputFileHandle = PlatformOpenFileHandle(requestDetails.outputDestination, PlatformPolicyOverwrite());
+		if(!PlatformNoFileErrors(outputFileHandle)) {
+			fprintf(stderr, "Failed to open %s (platform reported error: %s)\n", requestDetails.outputDestination, PlatformGetFileError(outputFileHandle));
+			PlatformCloseFileHandle(inputFileHandle);
+			return 1;
+		}
 	}
 
 	opcode_list_t supportedOperations = GetSupportedFormatOperations(requestDetails.fileFormat);
@@ -358,6 +1571,12 @@ int main(size_t argCount, const char** arguments) {
 		case OPCODE_LIST_CONTENTS:
 			dispatchFunction = supportedOperations.list;
 			break;
+		case OPCODE_COMPILE_INDEX:
+			dispatchFunction = supportedOperations.compile;
+			break;
+		case OPCODE_EXTRACT_FILES:
+			dispatchFunction = supportedOperations.extract;
+			break;
 		default:
 			fprintf(stderr, "The requested operation isn't currently available for this file type\n");
 			return 1;
@@ -368,8 +1587,9 @@ int main(size_t argCount, const char** arguments) {
 		return 2;
 	}
 
-	// TODO: Pass the actual platform handle to the dispatch handlers after they've successfully been opened
 	dispatchFunction(requestDetails, inputFileHandle, outputFileHandle);
+	PlatformCloseFileHandle(outputFileHandle);
+	PlatformCloseFileHandle(inputFileHandle);
 
 	return 0;
 }
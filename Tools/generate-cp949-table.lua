@@ -0,0 +1,65 @@
+local iconv = require("iconv")
+
+-- Regenerates the lookup table used by the native transcoder (so that it always agrees with the iconv-based decoders)
+local OUTPUT_FILE_PATH = path.join("Core", "CodePages", "CP949.hpp")
+local FIRST_LEAD_BYTE, LAST_LEAD_BYTE = 0x81, 0xFE
+local FIRST_TRAIL_BYTE, LAST_TRAIL_BYTE = 0x41, 0xFE
+local VALUES_PER_LINE = 16
+local UNICODE_REPLACEMENT_CHARACTER = 0xFFFD
+
+-- Every double-byte character is part of the BMP, so there's no need to handle four-byte sequences
+local function DecodeCodePoint(utf8Character)
+	local first, second, third = string.byte(utf8Character, 1, 3)
+	if #utf8Character == 2 and first >= 0xC0 then
+		return (first % 0x20) * 0x40 + (second % 0x40)
+	end
+	if #utf8Character == 3 and first >= 0xE0 then
+		return (first % 0x10) * 0x1000 + (second % 0x40) * 0x40 + (third % 0x40)
+	end
+	return nil -- Not a single (non-ASCII) character
+end
+
+local codePoints = {}
+local validCharacterCount = 0
+for leadByte = FIRST_LEAD_BYTE, LAST_LEAD_BYTE do
+	for trailByte = FIRST_TRAIL_BYTE, LAST_TRAIL_BYTE do
+		local utf8Character = iconv.convert(string.char(leadByte, trailByte), "CP949", "UTF-8")
+		local codePoint = utf8Character and DecodeCodePoint(utf8Character) or 0
+		assert(codePoint ~= UNICODE_REPLACEMENT_CHARACTER, "Replacement characters can't be distinguished from invalid input")
+		if codePoint ~= 0 then
+			validCharacterCount = validCharacterCount + 1
+		end
+		table.insert(codePoints, format("0x%04X", codePoint))
+	end
+end
+
+local lines = {
+	format(
+		"// Generated by Tools/generate-cp949-table.lua from the Windows code page 949 (Unified Hangul Code) mapping - double-byte characters only, %d of them",
+		validCharacterCount
+	),
+	"// NOTE: Indexed by (lead - 0x81) * 190 + (trail - 0x41), where zero marks an invalid (or user-defined) byte sequence",
+	format("constexpr uint8 CP949_FIRST_LEAD_BYTE = 0x%02X;", FIRST_LEAD_BYTE),
+	format("constexpr uint8 CP949_LAST_LEAD_BYTE = 0x%02X;", LAST_LEAD_BYTE),
+	format("constexpr uint8 CP949_FIRST_TRAIL_BYTE = 0x%02X;", FIRST_TRAIL_BYTE),
+	format("constexpr uint8 CP949_LAST_TRAIL_BYTE = 0x%02X;", LAST_TRAIL_BYTE),
+	"constexpr size_t CP949_TRAIL_BYTE_COUNT = CP949_LAST_TRAIL_BYTE - CP949_FIRST_TRAIL_BYTE + 1;",
+	"",
+	"GLOBAL const uint16 CP949_DOUBLE_BYTE_CODE_POINTS[] = {",
+}
+
+for index = 1, #codePoints, VALUES_PER_LINE do
+	local lastIndex = math.min(index + VALUES_PER_LINE - 1, #codePoints)
+	table.insert(lines, "\t" .. table.concat(codePoints, ", ", index, lastIndex) .. ",")
+end
+
+table.insert(lines, "};")
+table.insert(lines, "")
+table.insert(
+	lines,
+	'static_assert(sizeof(CP949_DOUBLE_BYTE_CODE_POINTS) == (CP949_LAST_LEAD_BYTE - CP949_FIRST_LEAD_BYTE + 1) * CP949_TRAIL_BYTE_COUNT * sizeof(uint16), "Every lead byte should have a full row of trail bytes");'
+)
+
+-- Same line endings as the other native sources (and no trailing newline)
+C_FileSystem.WriteFile(OUTPUT_FILE_PATH, table.concat(lines, "\r\n"))
+printf("Generated %s (%d valid double-byte characters)", OUTPUT_FILE_PATH, validCharacterCount)
@@ -7,10 +7,9 @@ if not exist %DEFAULT_BUILD_DIR% mkdir %DEFAULT_BUILD_DIR%
 set CPP_MAIN=Core\RagLite2.cpp
 set DEBUG_EXE=%DEFAULT_BUILD_DIR%/RagLiteWin32Dbg.exe
 set RELEASE_EXE=%DEFAULT_BUILD_DIR%/RagLiteWin32.exe
-set PAK_MAIN=Core\FileFormats\ArcturusPAK.cpp
-set PAK_COMMANDLINE_EXE=%DEFAULT_BUILD_DIR%/ArcturusPAK.exe
 set PROGRAM_DLLS=PatternTest DummyTest
-set CLI_TOOLS=DependencyCheck PatchInfo RagnarokTools
+set CLI_TOOLS=DependencyCheck FontBaker LineDrawingBenchmark PatchInfo RagnarokTools
+set NATIVE_TESTS=Core FileFormats
 set RUNTIME_LIBS=gdi32.lib shlwapi.lib user32.lib xinput.lib winmm.lib imagehlp.lib ws2_32.lib
 
 for /f "delims=" %%i in ('call git describe --always --dirty') do set GIT_COMMIT_HASH=\"%%i\"
@@ -131,9 +130,14 @@ for %%T in (%CLI_TOOLS%) do (
 	call :checkdeps !DEBUG_CLI! %DEFAULT_BUILD_DIR% || exit /b
 )
 
+for %%T in (%NATIVE_TESTS%) do (
+	set TEST_MAIN=Tests/%%T/Native%%T.cpp
+	set TEST_EXE=%DEFAULT_BUILD_DIR%/Native%%TTest.exe
+	call :msvcbuild !TEST_EXE! !TEST_MAIN! "%RUNTIME_LIBS%" "%DEBUG_COMPILE_FLAGS%" "%DEBUG_LINK_FLAGS%" || exit /b
+)
+
 call :msvcbuild !DEBUG_EXE! "%CPP_MAIN%" "%RUNTIME_LIBS%" "%DEBUG_COMPILE_FLAGS%" "%ICON_RES% %DEBUG_LINK_FLAGS%" || exit /b
 call :msvcbuild !RELEASE_EXE! "%CPP_MAIN%" "%RUNTIME_LIBS%" "%RELEASE_COMPILE_FLAGS%" "%ICON_RES% %RELEASE_LINK_FLAGS%" || exit /b
-call :msvcbuild !PAK_COMMANDLINE_EXE! "%PAK_MAIN%" "%RUNTIME_LIBS%" "%RELEASE_COMPILE_FLAGS%" "%ICON_RES% %RELEASE_LINK_FLAGS%" || exit /b
 call :checkdeps !DEBUG_EXE! %DEFAULT_BUILD_DIR% || exit /b
 call :checkdeps !RELEASE_EXE! %DEFAULT_BUILD_DIR% || exit /b
 
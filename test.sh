@@ -3,4 +3,9 @@ set -e
 export PATH="$PATH:$(pwd)"
 
 evo Tests/smoke-test.lua
-evo Tests/unit-test.lua
\ No newline at end of file
+evo Tests/unit-test.lua
+
+# NOTE: The native tests only exist after building (and must run from the repository root, where the fixtures are)
+for NATIVE_TEST in BuildArtifacts/Native*Test BuildArtifacts/Native*Test.exe; do
+	if [ -f "$NATIVE_TEST" ]; then "./$NATIVE_TEST"; fi
+done
\ No newline at end of file
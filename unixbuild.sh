@@ -2,5 +2,19 @@
 # NOTE: Eventually, a proper (more portable) solution will be required. But not today... so this is all there is
 
 mkdir -p BuildArtifacts
-RUNTIME_LIBS=""
+RUNTIME_LIBS="-ldl -lpthread"
+PROGRAM_MODULES="PatternTest DummyTest"
+NATIVE_TESTS="Core FileFormats"
 gcc Core/RagLite2.cpp -o BuildArtifacts/RagLite2 $RUNTIME_LIBS -lm -fvisibility=hidden
+
+# NOTE: Only needed to benchmark apps other than the default one (which is linked into the executable)
+for APP in $PROGRAM_MODULES; do
+	gcc Core/$APP.cpp -o BuildArtifacts/RagLite$APP.so -shared -fPIC -lm -fvisibility=hidden
+done
+
+gcc Tools/LineDrawingBenchmark.cpp -o BuildArtifacts/LineDrawingBenchmark -lm
+gcc Tools/FontBaker.cpp -o BuildArtifacts/FontBaker -lm
+
+for SUITE in $NATIVE_TESTS; do
+	gcc Tests/$SUITE/Native$SUITE.cpp -o BuildArtifacts/Native${SUITE}Test -lm -lpthread
+done